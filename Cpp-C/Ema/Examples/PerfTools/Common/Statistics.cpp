@@ -57,6 +57,41 @@ void ValueStatistics::updateValueStatistics(double newValue)
 	sumOfSquares += newValue * newValue;
 	variance = count > 1 ? (sumOfSquares - sum * sum / count) / (count - 1) : 0;
 }
+void ValueHistogram::updateValueHistogram(double newValue)
+{
+	UInt64 value = newValue > 0 ? (UInt64)(newValue < 9.2e18 ? newValue : 9.2e18) : 0;
+	int shift = 0;
+
+	// Find the power of two the value falls in, and use its top bits to pick the bucket.
+	while ((value >> shift) >= SUB_BUCKETS)
+		++shift;
+
+	++buckets[shift * (SUB_BUCKETS / 2) + (int)(value >> shift)];
+	++count;
+}
+double ValueHistogram::getPercentile(double fraction) const
+{
+	if (!count)
+		return 0;
+
+	UInt64 target = (UInt64)(fraction * (double)count);
+	if (target < 1) target = 1;
+	if (target > count) target = count;
+
+	UInt64 total = 0;
+	for (int i = 0; i < BUCKETS; ++i)
+	{
+		total += buckets[i];
+		if (total >= target)
+		{
+			// Return the midpoint of the bucket's range.
+			int shift = (i < SUB_BUCKETS) ? 0 : i / (SUB_BUCKETS / 2) - 1;
+			UInt64 low = (UInt64)(i - shift * (SUB_BUCKETS / 2)) << shift;
+			return (double)low + (double)(((UInt64)1 << shift) - 1) / 2.0;
+		}
+	}
+	return 0;
+}
 bool ResourceUsageStats::initResourceUsageStats()
 {
 #if defined(WIN32)
@@ -26,6 +26,7 @@ typedef int DUMMY_SOCKET;
 #include <float.h>
 #include "Ema.h"
 #include <stdio.h>
+#include <string.h>
 using namespace thomsonreuters::ema::access;
 
 struct ResourceUsageStats {
@@ -94,6 +95,23 @@ struct ValueStatistics
 	};
 };
 
+// Histogram of sample values, used for calculating percentiles such as the median.
+// Values below SUB_BUCKETS are counted exactly. Above that, each power of two is split
+// into SUB_BUCKETS/2 buckets, so a percentile is accurate to within about 3%.
+struct ValueHistogram
+{
+	enum { SUB_BUCKETS = 64, BUCKETS = 2048 };
+
+	UInt64	count;	//number of values
+	UInt64	buckets[BUCKETS];	//number of values in each bucket
+	ValueHistogram() { clearValueHistogram(); }
+	void clearValueHistogram();
+	// Negative values are counted as 0 and fractions are dropped.
+	void updateValueHistogram(double newValue);
+	// Returns the value below which the given fraction(e.g. 0.99) of values fall.
+	double getPercentile(double fraction) const;
+};
+
 struct TimeRecord
 {
 	TimeValue startTime;	// Recorded start time.
@@ -174,4 +192,9 @@ inline void ValueStatistics::clearValueStatistics()
 	sum = 0;
 	sumOfSquares = 0;
 }
+inline void ValueHistogram::clearValueHistogram()
+{
+	count = 0;
+	memset(buckets, 0, sizeof(buckets));
+}
 #endif // _STATISTICS_H
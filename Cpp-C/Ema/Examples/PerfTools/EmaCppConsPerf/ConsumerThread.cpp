@@ -728,6 +728,25 @@ void MarketPriceClient::onUpdateMsg( const thomsonreuters::ema::access::UpdateMs
 	}
 }
 
+void MarketPriceClient::onUpdateMsgBatch( const thomsonreuters::ema::access::UpdateMsg* const* updates, const thomsonreuters::ema::access::OmmConsumerEvent* const*, UInt32 count )
+{
+	if(!(pConsumerThread->stats.firstUpdateTime))
+		pConsumerThread->stats.firstUpdateTime = GetTime::getTimeNano();
+
+	for( UInt32 i = 0; i < count; ++i )
+	{
+		pConsumerThread->stats.imageRetrievalEndTime ? pConsumerThread->stats.steadyStateUpdateCount.countStatIncr() : pConsumerThread->stats.startupUpdateCount.countStatIncr();
+
+		if( !decodeMPUpdate(updates[i]->getPayload().getFieldList(),  DataType::UpdateMsgEnum) )
+		{
+			pConsumerThread->stopThread = true;
+			pConsumerThread->testPassed = false;
+			pConsumerThread->failureLocation = "MarketPriceClient::onUpdateMsgBatch() - decodeMPUpdate failed.";
+			return;
+		}
+	}
+}
+
 void MarketPriceClient::onStatusMsg( const thomsonreuters::ema::access::StatusMsg& stMsg, const thomsonreuters::ema::access::OmmConsumerEvent& )
 {
 	pConsumerThread->stats.statusCount.countStatIncr();
@@ -84,6 +84,7 @@ public:
 
 	ValueStatistics startupLatencyStats;		// Statup latency statistics. 
 	ValueStatistics steadyStateLatencyStats;	// Steady-state latency statistics. 
+	ValueHistogram	steadyStateLatencyHist;		// Steady-state latency distribution, for percentiles. 
 	ValueStatistics overallLatencyStats;		// Overall latency statistics. 
 	ValueStatistics postLatencyStats;			// Posting latency statistics. 
 	ValueStatistics genMsgLatencyStats;			// Gen Msg latency statistics. 
@@ -149,6 +150,8 @@ protected :
 
 	void onUpdateMsg( const thomsonreuters::ema::access::UpdateMsg&, const thomsonreuters::ema::access::OmmConsumerEvent& );
 
+	void onUpdateMsgBatch( const thomsonreuters::ema::access::UpdateMsg* const*, const thomsonreuters::ema::access::OmmConsumerEvent* const*, UInt32 );
+
 	void onStatusMsg( const thomsonreuters::ema::access::StatusMsg&, const thomsonreuters::ema::access::OmmConsumerEvent& );
 	
 	void onGenericMsg( const GenericMsg& genericMsg, const OmmConsumerEvent& consumerEvent );
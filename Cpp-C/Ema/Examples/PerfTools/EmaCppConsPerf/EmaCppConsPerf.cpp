@@ -679,11 +679,15 @@ void EmaCppConsPerf::printSummaryStatistics(FILE *file)
 							"  Latency avg (usec): %.1f\n"
 							"  Latency std dev (usec): %.1f\n"
 							"  Latency max (usec): %.1f\n"
-							"  Latency min (usec): %.1f\n",
+							"  Latency min (usec): %.1f\n"
+							"  Latency median (usec): %.1f\n"
+							"  Latency 99th percentile (usec): %.1f\n",
 							consumerThreads[i]->stats.steadyStateLatencyStats.mean,
 							sqrt(consumerThreads[i]->stats.steadyStateLatencyStats.variance),
 							consumerThreads[i]->stats.steadyStateLatencyStats.maxValue,
-							consumerThreads[i]->stats.steadyStateLatencyStats.minValue);
+							consumerThreads[i]->stats.steadyStateLatencyStats.minValue,
+							consumerThreads[i]->stats.steadyStateLatencyHist.getPercentile(0.5),
+							consumerThreads[i]->stats.steadyStateLatencyHist.getPercentile(0.99));
 				}
 				else
 					fprintf( file, "  No latency information was received during steady-state time.\n");
@@ -870,11 +874,15 @@ void EmaCppConsPerf::printSummaryStatistics(FILE *file)
 					"  Latency avg (usec): %.1f\n"
 					"  Latency std dev (usec): %.1f\n"
 					"  Latency max (usec): %.1f\n"
-					"  Latency min (usec): %.1f\n",
+					"  Latency min (usec): %.1f\n"
+					"  Latency median (usec): %.1f\n"
+					"  Latency 99th percentile (usec): %.1f\n",
 					totalStats.steadyStateLatencyStats.mean,
 					sqrt(totalStats.steadyStateLatencyStats.variance),
 					totalStats.steadyStateLatencyStats.maxValue,
-					totalStats.steadyStateLatencyStats.minValue);
+					totalStats.steadyStateLatencyStats.minValue,
+					totalStats.steadyStateLatencyHist.getPercentile(0.5),
+					totalStats.steadyStateLatencyHist.getPercentile(0.99));
 		}
 		else
 			fprintf( file, "  No latency information was received during steady-state time.\n");
@@ -1306,7 +1314,10 @@ void EmaCppConsPerf::collectStats(bool writeStats, bool displayStats, UInt32 cur
 			consumerThreads[i]->stats.intervalLatencyStats.updateValueStatistics( latency);
 			consumerThreads[i]->stats.overallLatencyStats.updateValueStatistics( latency);
 			if( latencyIsSteadyStateForClient )
+			{
 				consumerThreads[i]->stats.steadyStateLatencyStats.updateValueStatistics( latency );
+				consumerThreads[i]->stats.steadyStateLatencyHist.updateValueHistogram( latency );
+			}
 			else
 				consumerThreads[i]->stats.startupLatencyStats.updateValueStatistics( latency );
 	
@@ -1318,7 +1329,10 @@ void EmaCppConsPerf::collectStats(bool writeStats, bool displayStats, UInt32 cur
 					&& recordEndTimeNsec > (double)totalStats.imageRetrievalEndTime;
 
 				if( latencyIsSteadyStateOverall ) 
+				{
 					totalStats.steadyStateLatencyStats.updateValueStatistics( latency );
+					totalStats.steadyStateLatencyHist.updateValueHistogram( latency );
+				}
 				else
 					totalStats.startupLatencyStats.updateValueStatistics( latency );
 				totalStats.overallLatencyStats.updateValueStatistics( latency);
@@ -0,0 +1,287 @@
+///*|-----------------------------------------------------------------------------
+// *|            This source code is provided under the Apache 2.0 license      --
+// *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+// *|                See the project's LICENSE.md for details.                  --
+// *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+///*|-----------------------------------------------------------------------------
+
+// Measures the cost of publishing the same updates to many consumers from an interactive provider.
+// The provider and its consumers run in one process. Every consumer opens the same set of items,
+// and each round of updates is published either with one submit per item stream, or with one
+// submit per item, which EMA fans out to all the streams of the item.
+
+#include "Ema.h"
+#include "../Common/AppUtil.h"
+#include "../Common/GetTime.h"
+#include "../Common/Mutex.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace thomsonreuters::ema::access;
+using namespace thomsonreuters::ema::rdm;
+using namespace perftool::common;
+
+static EmaString port( "14002" );
+static EmaString serviceName( "DIRECT_FEED" );
+static Int32 consumerCount = 20;
+static Int32 itemCount = 1000;
+static Int32 roundCount = 10;
+
+class ProviderClient : public OmmProviderClient
+{
+public:
+
+	ProviderClient() : _itemHandles( 0 ), _refreshCount( 0 ) {}
+
+	~ProviderClient() { delete [] _itemHandles; }
+
+	void init( Int32 items ) { _itemHandles = new EmaVector< UInt64 >[ items ]; }
+
+	const EmaVector< UInt64 >& getItemHandles( Int32 item ) const { return _itemHandles[ item ]; }
+
+	Int32 getRefreshCount()
+	{
+		_mutex.lock();
+		Int32 count = _refreshCount;
+		_mutex.unlock();
+		return count;
+	}
+
+protected:
+
+	void onReqMsg( const ReqMsg& reqMsg, const OmmProviderEvent& event )
+	{
+		switch ( reqMsg.getDomainType() )
+		{
+		case MMT_LOGIN:
+			event.getProvider().submit( RefreshMsg().domainType( MMT_LOGIN ).name( reqMsg.getName() ).nameType( USER_NAME ).complete().
+				attrib( ElementList().complete() ).solicited( true ).state( OmmState::OpenEnum, OmmState::OkEnum, OmmState::NoneEnum, "Login accepted" ),
+				event.getHandle() );
+			break;
+		case MMT_MARKET_PRICE:
+		{
+			Int32 item = atoi( reqMsg.getName().c_str() + 3 );
+
+			event.getProvider().submit( RefreshMsg().name( reqMsg.getName() ).serviceName( reqMsg.getServiceName() ).solicited( true ).
+				state( OmmState::OpenEnum, OmmState::OkEnum, OmmState::NoneEnum, "Refresh Completed" ).
+				payload( FieldList().
+					addReal( 22, 3990, OmmReal::ExponentNeg2Enum ).
+					addReal( 25, 3994, OmmReal::ExponentNeg2Enum ).
+					addReal( 30, 9, OmmReal::Exponent0Enum ).
+					addReal( 31, 19, OmmReal::Exponent0Enum ).
+					complete() ).
+				complete(), event.getHandle() );
+
+			_mutex.lock();
+			_itemHandles[ item ].push_back( event.getHandle() );
+			++_refreshCount;
+			_mutex.unlock();
+		}
+			break;
+		default:
+			event.getProvider().submit( StatusMsg().name( reqMsg.getName() ).serviceName( reqMsg.getServiceName() ).
+				domainType( reqMsg.getDomainType() ).
+				state( OmmState::ClosedEnum, OmmState::SuspectEnum, OmmState::NotFoundEnum, "Item not found" ),
+				event.getHandle() );
+			break;
+		}
+	}
+
+private:
+
+	EmaVector< UInt64 >*	_itemHandles;
+	Int32					_refreshCount;
+	Mutex					_mutex;
+};
+
+class ConsumerClient : public OmmConsumerClient
+{
+public:
+
+	ConsumerClient() : _refreshCount( 0 ), _updateCount( 0 ) {}
+
+	volatile Int32	_refreshCount;
+	volatile Int64	_updateCount;
+
+protected:
+
+	void onRefreshMsg( const RefreshMsg&, const OmmConsumerEvent& ) { ++_refreshCount; }
+
+	void onUpdateMsg( const UpdateMsg&, const OmmConsumerEvent& ) { ++_updateCount; }
+};
+
+static Int64 getUpdateCount( ConsumerClient* consumerClients )
+{
+	Int64 count = 0;
+
+	for ( Int32 i = 0; i < consumerCount; ++i )
+		count += consumerClients[ i ]._updateCount;
+
+	return count;
+}
+
+static bool waitForUpdates( ConsumerClient* consumerClients, Int64 expected )
+{
+	TimeValue endTime = GetTime::getTimeMilli() + 60000;
+
+	while ( getUpdateCount( consumerClients ) < expected )
+	{
+		if ( GetTime::getTimeMilli() > endTime )
+			return false;
+
+		AppUtil::sleep( 1 );
+	}
+
+	return true;
+}
+
+static void runRounds( OmmProvider& provider, ProviderClient& providerClient, ConsumerClient* consumerClients, bool byItem )
+{
+	char itemName[ 32 ];
+	Int64 startCount = getUpdateCount( consumerClients );
+	Int64 submitCount = 0;
+	UpdateMsg updateMsg;
+
+	TimeValue startTime = GetTime::getTimeNano();
+
+	for ( Int32 round = 0; round < roundCount; ++round )
+	{
+		for ( Int32 item = 0; item < itemCount; ++item )
+		{
+			updateMsg.clear().payload( FieldList().
+				addReal( 22, 3391 + round, OmmReal::ExponentNeg2Enum ).
+				addReal( 30, 10 + round, OmmReal::Exponent0Enum ).
+				complete() );
+
+			if ( byItem )
+			{
+				snprintf( itemName, sizeof( itemName ), "RIC%d", item );
+				updateMsg.serviceName( serviceName ).name( itemName );
+
+				provider.submit( updateMsg, 0 );
+				++submitCount;
+			}
+			else
+			{
+				const EmaVector< UInt64 >& handles = providerClient.getItemHandles( item );
+
+				for ( UInt32 idx = 0; idx < handles.size(); ++idx )
+				{
+					provider.submit( updateMsg, handles[ idx ] );
+					++submitCount;
+				}
+			}
+		}
+	}
+
+	TimeValue submitTime = GetTime::getTimeNano() - startTime;
+
+	Int64 expected = startCount + (Int64)consumerCount * itemCount * roundCount;
+	bool received = waitForUpdates( consumerClients, expected );
+
+	TimeValue totalTime = GetTime::getTimeNano() - startTime;
+	Int64 updates = (Int64)consumerCount * itemCount * roundCount;
+
+	printf( "%-9s submits: %10lld  submit time: %9.3f ms  (%8.1f ns/stream update)  delivered in: %9.3f ms%s\n",
+		byItem ? "By item" : "By handle", submitCount,
+		submitTime / 1000000.0, (double)submitTime / updates, totalTime / 1000000.0,
+		received ? "" : "  (timed out waiting for consumers)" );
+}
+
+static void exitWithUsage()
+{
+	printf( "Options:\n"
+		"  -p <port>          Port the provider listens on (default 14002)\n"
+		"  -consumers <count> Number of consumers (default 20)\n"
+		"  -items <count>     Number of items each consumer opens (default 1000)\n"
+		"  -rounds <count>    Number of updates published per item in each mode (default 10)\n" );
+	exit( -1 );
+}
+
+int main( int argc, char* argv[] )
+{
+	for ( int iargs = 1; iargs < argc; ++iargs )
+	{
+		if ( strcmp( "-p", argv[ iargs ] ) == 0 && iargs + 1 < argc )
+			port = argv[ ++iargs ];
+		else if ( strcmp( "-consumers", argv[ iargs ] ) == 0 && iargs + 1 < argc )
+			consumerCount = atoi( argv[ ++iargs ] );
+		else if ( strcmp( "-items", argv[ iargs ] ) == 0 && iargs + 1 < argc )
+			itemCount = atoi( argv[ ++iargs ] );
+		else if ( strcmp( "-rounds", argv[ iargs ] ) == 0 && iargs + 1 < argc )
+			roundCount = atoi( argv[ ++iargs ] );
+		else
+			exitWithUsage();
+	}
+
+	if ( consumerCount <= 0 || itemCount <= 0 || roundCount <= 0 )
+		exitWithUsage();
+
+	try
+	{
+		ProviderClient providerClient;
+		providerClient.init( itemCount );
+
+		OmmProvider* provider = new OmmProvider( OmmIProviderConfig().port( port ), providerClient );
+
+		ConsumerClient* consumerClients = new ConsumerClient[ consumerCount ];
+		OmmConsumer** consumers = new OmmConsumer*[ consumerCount ];
+		EmaString host( "localhost:" );
+		host.append( port );
+		char itemName[ 32 ];
+
+		printf( "Opening %d items on %d consumers\n", itemCount, consumerCount );
+
+		for ( Int32 i = 0; i < consumerCount; ++i )
+		{
+			consumers[ i ] = new OmmConsumer( OmmConsumerConfig().host( host ).username( "perf" ) );
+
+			for ( Int32 item = 0; item < itemCount; ++item )
+			{
+				snprintf( itemName, sizeof( itemName ), "RIC%d", item );
+				consumers[ i ]->registerClient( ReqMsg().serviceName( serviceName ).name( itemName ), consumerClients[ i ] );
+			}
+		}
+
+		TimeValue endTime = GetTime::getTimeMilli() + 60000;
+
+		while ( providerClient.getRefreshCount() < consumerCount * itemCount )
+		{
+			if ( GetTime::getTimeMilli() > endTime )
+			{
+				printf( "Timed out waiting for item requests\n" );
+				return -1;
+			}
+
+			AppUtil::sleep( 10 );
+		}
+
+		for ( Int32 i = 0; i < consumerCount; ++i )
+		{
+			while ( consumerClients[ i ]._refreshCount < itemCount )
+				AppUtil::sleep( 10 );
+		}
+
+		printf( "Publishing %d rounds of updates for %d items to %d streams per item\n", roundCount, itemCount, consumerCount );
+
+		runRounds( *provider, providerClient, consumerClients, false );
+		runRounds( *provider, providerClient, consumerClients, true );
+
+		// The provider goes first, while it is idle, so it is not still handling the consumers' closes when it shuts down.
+		delete provider;
+
+		for ( Int32 i = 0; i < consumerCount; ++i )
+			delete consumers[ i ];
+
+		delete [] consumers;
+		delete [] consumerClients;
+	}
+	catch ( const OmmException& excp )
+	{
+		printf( "%s\n", excp.toString().c_str() );
+		return -1;
+	}
+
+	return 0;
+}
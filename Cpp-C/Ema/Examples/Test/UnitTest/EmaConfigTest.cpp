@@ -279,7 +279,11 @@ TEST_F(EmaConfigTest, testLoadingConfigurationFromProgrammaticConfigHttp)
 			.addUInt("PostAckTimeout", 1200)
 			.addUInt("RequestTimeout", 2400)
 			.addUInt("MaxOutstandingPosts", 9999)
+			.addUInt("UpdateBatchSize", 64)
 			.addInt("DispatchTimeoutApiThread", 60)
+			.addInt("CpuApiThreadBind", 0)
+			.addInt("CpuWorkerThreadBind", 0)
+			.addUInt("BusyPollTime", 50)
 			.addUInt("CatchUnhandledException", 1)
 			.addUInt("MaxDispatchCountApiThread", 300)
 			.addUInt("MaxDispatchCountUserThread", 700).complete()).complete();
@@ -373,7 +377,11 @@ TEST_F(EmaConfigTest, testLoadingConfigurationFromProgrammaticConfigHttp)
 		EXPECT_TRUE( activeConfig.postAckTimeout == 1200) << "postAckTimeout , 1200";
 		EXPECT_TRUE( activeConfig.requestTimeout == 2400) << "requestTimeout , 2400";
 		EXPECT_TRUE( activeConfig.maxOutstandingPosts == 9999) << "maxOutstandingPosts , 9999";
+		EXPECT_TRUE( activeConfig.updateBatchSize == 64) << "updateBatchSize , 64";
 		EXPECT_TRUE( activeConfig.dispatchTimeoutApiThread == 60) << "dispatchTimeoutApiThread , 60";
+		EXPECT_TRUE( activeConfig.cpuApiThreadBind == 0) << "cpuApiThreadBind , 0";
+		EXPECT_TRUE( activeConfig.cpuWorkerThreadBind == 0) << "cpuWorkerThreadBind , 0";
+		EXPECT_TRUE( activeConfig.busyPollTime == 50) << "busyPollTime , 50";
 		EXPECT_TRUE( activeConfig.catchUnhandledException == 1) << "catchUnhandledException , 1";
 		EXPECT_TRUE( activeConfig.maxDispatchCountApiThread == 300) << "maxDispatchCountApiThread , 300";
 		EXPECT_TRUE( activeConfig.maxDispatchCountUserThread == 700) << "maxDispatchCountUserThread , 700";
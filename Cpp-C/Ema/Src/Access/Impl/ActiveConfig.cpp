@@ -113,6 +113,9 @@ BaseConfig::BaseConfig() :
 	itemCountHint(DEFAULT_ITEM_COUNT_HINT),
 	serviceCountHint(DEFAULT_SERVICE_COUNT_HINT),
 	dispatchTimeoutApiThread(DEFAULT_DISPATCH_TIMEOUT_API_THREAD),
+	cpuApiThreadBind(DEFAULT_CPU_API_THREAD_BIND),
+	cpuWorkerThreadBind(DEFAULT_CPU_WORKER_THREAD_BIND),
+	busyPollTime(DEFAULT_BUSY_POLL_TIME),
 	maxDispatchCountApiThread(DEFAULT_MAX_DISPATCH_COUNT_API_THREAD),
 	maxDispatchCountUserThread(DEFAULT_MAX_DISPATCH_COUNT_USER_THREAD),
 	xmlTraceMaxFileSize(DEFAULT_XML_TRACE_MAX_FILE_SIZE),
@@ -144,6 +147,9 @@ void BaseConfig::clear()
 	itemCountHint = DEFAULT_ITEM_COUNT_HINT;
 	serviceCountHint = DEFAULT_SERVICE_COUNT_HINT;
 	dispatchTimeoutApiThread = DEFAULT_DISPATCH_TIMEOUT_API_THREAD;
+	cpuApiThreadBind = DEFAULT_CPU_API_THREAD_BIND;
+	cpuWorkerThreadBind = DEFAULT_CPU_WORKER_THREAD_BIND;
+	busyPollTime = DEFAULT_BUSY_POLL_TIME;
 	maxDispatchCountApiThread = DEFAULT_MAX_DISPATCH_COUNT_API_THREAD;
 	maxDispatchCountUserThread = DEFAULT_MAX_DISPATCH_COUNT_USER_THREAD;
 	xmlTraceMaxFileSize = DEFAULT_XML_TRACE_MAX_FILE_SIZE;
@@ -210,6 +216,7 @@ ActiveConfig::ActiveConfig( const EmaString& defaultServiceName ) :
 	requestTimeout( DEFAULT_REQUEST_TIMEOUT ),
 	postAckTimeout( DEFAULT_POST_ACK_TIMEOUT ),
 	maxOutstandingPosts( DEFAULT_MAX_OUTSTANDING_POSTS ),
+	updateBatchSize( DEFAULT_UPDATE_BATCH_SIZE ),
 	loginRequestTimeOut( DEFAULT_LOGIN_REQUEST_TIMEOUT ),
 	directoryRequestTimeOut( DEFAULT_DIRECTORY_REQUEST_TIMEOUT ),
 	dictionaryRequestTimeOut( DEFAULT_DICTIONARY_REQUEST_TIMEOUT ),
@@ -260,6 +267,7 @@ void ActiveConfig::clear()
 	requestTimeout = DEFAULT_REQUEST_TIMEOUT;
 	postAckTimeout = DEFAULT_POST_ACK_TIMEOUT;
 	maxOutstandingPosts = DEFAULT_MAX_OUTSTANDING_POSTS;
+	updateBatchSize = DEFAULT_UPDATE_BATCH_SIZE;
 	reconnectAttemptLimit = DEFAULT_RECONNECT_ATTEMPT_LIMIT;
 	reconnectMinDelay = DEFAULT_RECONNECT_MIN_DELAY;
 	reconnectMaxDelay = DEFAULT_RECONNECT_MAX_DELAY;
@@ -338,6 +346,14 @@ void ActiveConfig::setMaxOutstandingPosts( UInt64 value )
 		maxOutstandingPosts = ( UInt32 )value;
 }
 
+void ActiveConfig::setUpdateBatchSize( UInt64 value )
+{
+	if ( value > 0xFFFFFFFF )
+		updateBatchSize = 0xFFFFFFFF;
+	else
+		updateBatchSize = ( UInt32 )value;
+}
+
 void ActiveConfig::setReconnectAttemptLimit(Int64 value)
 {
 	if (value >= 0)
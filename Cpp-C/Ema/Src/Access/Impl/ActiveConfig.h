@@ -31,6 +31,9 @@
 #define DEFAULT_DICTIONARY_TYPE							Dictionary::FileDictionaryEnum
 #define DEFAULT_DIRECTORY_REQUEST_TIMEOUT				45000
 #define DEFAULT_DISPATCH_TIMEOUT_API_THREAD				-1
+#define DEFAULT_CPU_API_THREAD_BIND						-1
+#define DEFAULT_CPU_WORKER_THREAD_BIND					-1
+#define DEFAULT_BUSY_POLL_TIME							0
 #define DEFAULT_GUARANTEED_OUTPUT_BUFFERS				100
 #define DEFAULT_PROVIDER_GUARANTEED_OUTPUT_BUFFERS		5000
 #define DEFAULT_NUM_INPUT_BUFFERS					    10
@@ -76,6 +79,7 @@
 #define DEFAULT_TWAIT								  3
 #define DEFAULT_TBCHOLD								  3
 #define DEFAULT_TPPHOLD								  3
+#define DEFAULT_UPDATE_BATCH_SIZE					  0
 #define DEFAULT_USER_QLIMIT							  65535
 #define DEFAULT_XML_TRACE_FILE_NAME					  EmaString( "EmaTrace" )
 #define DEFAULT_XML_TRACE_HEX						  false
@@ -407,6 +411,9 @@ public:
 	UInt32					itemCountHint;
 	UInt32					serviceCountHint;
 	Int64					dispatchTimeoutApiThread;
+	Int64					cpuApiThreadBind;
+	Int64					cpuWorkerThreadBind;
+	UInt32					busyPollTime;
 	UInt32					maxDispatchCountApiThread;
 	UInt32					maxDispatchCountUserThread;
 	Int64					xmlTraceMaxFileSize;
@@ -442,6 +449,7 @@ public:
 	void setPostAckTimeout( UInt64 value );
 	void setRequestTimeout( UInt64 value );
 	void setMaxOutstandingPosts( UInt64 value );
+	void setUpdateBatchSize( UInt64 value );
 	void setLoginRequestTimeOut( UInt64 );
 	void setDirectoryRequestTimeOut( UInt64 );
 	void setDictionaryRequestTimeOut( UInt64 );
@@ -459,6 +467,7 @@ public:
 	UInt32			requestTimeout;
 	UInt32			postAckTimeout;
 	UInt32			maxOutstandingPosts;
+	UInt32			updateBatchSize;
 	UInt32			loginRequestTimeOut;
 	UInt32			directoryRequestTimeOut;
 	UInt32			dictionaryRequestTimeOut;
@@ -870,6 +870,25 @@ RsslReactorCallbackRet ChannelCallbackClient::processCallback( RsslReactor* pRss
 			}
 		}
 
+		// set the socket busy poll time if busy polling; raising it may need privileges, so failing is not fatal
+		if ( _ommBaseImpl.getActiveConfig().busyPollTime > 0 && pChannelConfig->connectionType != RSSL_CONN_TYPE_RELIABLE_MCAST )
+		{
+			int busyPollTime = ( int )_ommBaseImpl.getActiveConfig().busyPollTime;
+			if ( rsslReactorChannelIoctl( pRsslReactorChannel, RSSL_SYSTEM_BUSY_POLL, &busyPollTime, &rsslErrorInfo ) != RSSL_RET_SUCCESS )
+			{
+				if ( OmmLoggerClient::WarningEnum >= _ommBaseImpl.getActiveConfig().loggerConfig.minLoggerSeverity )
+				{
+					EmaString temp( "Failed to set the busy poll time on channel " );
+					temp.append( pChannel->getName() ).append( CR )
+						.append( "Instance Name " ).append( _ommBaseImpl.getInstanceName() ).append( CR )
+						.append( "Error Id " ).append( rsslErrorInfo.rsslError.rsslErrorId ).append( CR )
+						.append( "Internal sysError " ).append( rsslErrorInfo.rsslError.sysError ).append( CR )
+						.append( "Error Text " ).append( rsslErrorInfo.rsslError.text );
+					_ommBaseImpl.getOmmLoggerClient().log( _clientName, OmmLoggerClient::WarningEnum, temp.trimWhitespace() );
+				}
+			}
+		}
+
 		ActiveConfig& activeConfig = _ommBaseImpl.getActiveConfig();
 		if ( activeConfig.xmlTraceToFile || activeConfig.xmlTraceToStdout )
 		{
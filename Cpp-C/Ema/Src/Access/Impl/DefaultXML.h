@@ -68,6 +68,8 @@ thomsonreuters::ema::access::EmaString EnumeratedValues[] = {
 };
 
 thomsonreuters::ema::access::EmaString Int64Values[] = {
+	"CpuApiThreadBind",
+	"CpuWorkerThreadBind",
 	"DictionaryID",
 	"DispatchTimeoutApiThread",
 	"PipePort",
@@ -86,6 +88,7 @@ thomsonreuters::ema::access::EmaString UInt64Values[] = {
 	"AcceptMessageWithoutAcceptingRequests",
 	"AcceptMessageWithoutBeingLogin",
 	"AcceptMessageWithoutQosInRange",
+	"BusyPollTime",
 	"CatchUnhandledException",
 	"CompressionThreshold",
 	"ConnectionMinPingTimeout",
@@ -123,6 +126,7 @@ thomsonreuters::ema::access::EmaString UInt64Values[] = {
 	"SysRecvBufSize",
 	"SysSendBufSize",
 	"TcpNodelay",
+	"UpdateBatchSize",
 	"XmlTraceHex",
 	"XmlTracePing",
 	"XmlTraceRead",
@@ -69,11 +69,13 @@ const EmaString UnknownItemString( "UnknownItem" );
 #define PROVIDER_STARTING_STREAM_ID 0
 #define CONSUMER_MAX_STREAM_ID_MINUSONE (INT_MAX - 1)
 #define INITIAL_ITEM_WATCHLIST_SIZE 10
+#define INITIAL_UPDATE_BATCH_BUFFER_SIZE 65536
 
 Item::Item( ) :
 	_domainType( 0 ),
 	_streamId( 0 ),
-	_closedStatusInfo( 0 )
+	_closedStatusInfo( 0 ),
+	_handle( 0 )
 {
 }
 
@@ -138,14 +140,30 @@ ClosedStatusInfo*	Item::getClosedStatusInfo()
 	return _closedStatusInfo;
 }
 
+void Item::setHandle( UInt64 handle )
+{
+	_handle = handle;
+}
+
 ConsumerItem::ConsumerItem( OmmBaseImpl& ommBaseImpl, OmmConsumerClient& ommConsClient, void* closure, Item* pParentItem ) :
 	_ommBaseImpl( ommBaseImpl ),
 	_client( ommConsClient ),
-	_event()
+	_event(),
+	_pParentItem( pParentItem )
 {
-	_event._handle = ( UInt64 )this;
 	_event._closure = closure;
-	_event._parentHandle = (UInt64) pParentItem;
+	_event._parentHandle = pParentItem ? pParentItem->getHandle() : 0;
+}
+
+void ConsumerItem::setHandle( UInt64 handle )
+{
+	Item::setHandle( handle );
+
+	_event._handle = handle;
+
+	/* a batch parent is given its handle only after its single items are created */
+	if ( _pParentItem )
+		_event._parentHandle = _pParentItem->getHandle();
 }
 
 ConsumerItem::~ConsumerItem()
@@ -183,6 +201,16 @@ void ConsumerItem::onGenericMsg( const GenericMsg& msg )
 	_client.onGenericMsg( msg, _event );
 }
 
+OmmConsumerClient& ConsumerItem::getClient() const
+{
+	return _client;
+}
+
+const OmmConsumerEvent& ConsumerItem::getEvent() const
+{
+	return _event;
+}
+
 OmmBaseImpl& ConsumerItem::getImpl()
 {
 	return _ommBaseImpl;
@@ -207,11 +235,17 @@ ProviderItem::ProviderItem(OmmCommonImpl& ommCommonImpl,OmmProviderClient& ommPr
 	_specifiedServiceInReq(false)
 {
 	rsslClearMsgKey( &_msgKey );
-	_event._handle = ( UInt64 )this;
 	_event._closure = closure;
 	_event._clientHandle = 0;
 }
 
+void ProviderItem::setHandle( UInt64 handle )
+{
+	Item::setHandle( handle );
+
+	_event._handle = handle;
+}
+
 ProviderItem::~ProviderItem()
 {
 	cancelReqTimerEvent();
@@ -513,10 +547,10 @@ void SingleItem::remove()
 {
 	if ( getType() != Item::BatchItemEnum )
 	{
-		if ( _event.getParentHandle() )
+		if ( _pParentItem )
 		{
-			if ( reinterpret_cast<Item*>( _event.getParentHandle() )->getType() == Item::BatchItemEnum )
-				reinterpret_cast<BatchItem*>( _event.getParentHandle() )->decreaseItemCount();
+			if ( _pParentItem->getType() == Item::BatchItemEnum )
+				static_cast<BatchItem*>( _pParentItem )->decreaseItemCount();
 		}
 
 		delete this;
@@ -2292,7 +2326,7 @@ SubItem::SubItem( OmmBaseImpl& ommBaseImpl, OmmConsumerClient& ommConsClient, vo
 
 SubItem::~SubItem()
 {
-	reinterpret_cast<TunnelItem*>( _event.getParentHandle() )->removeSubItem( _streamId );
+	static_cast<TunnelItem*>( _pParentItem )->removeSubItem( _streamId );
 
 	_ommBaseImpl.getItemCallbackClient().removeFromList( this );
 
@@ -2333,7 +2367,7 @@ bool SubItem::open( const ReqMsg& reqMsg )
 
 	if ( !reqMsgEncoder.getRsslRequestMsg()->msgBase.streamId )
 	{
-		_streamId = reinterpret_cast<TunnelItem*>( _event.getParentHandle() )->addSubItem( this );
+		_streamId = static_cast<TunnelItem*>( _pParentItem )->addSubItem( this );
 		reqMsgEncoder.getRsslRequestMsg()->msgBase.streamId = _streamId;
 	}
 	else
@@ -2357,13 +2391,13 @@ bool SubItem::open( const ReqMsg& reqMsg )
 		}
 		else
 		{
-			_streamId = reinterpret_cast<TunnelItem*>( _event.getParentHandle() )->addSubItem( this, reqMsgEncoder.getRsslRequestMsg()->msgBase.streamId );
+			_streamId = static_cast<TunnelItem*>( _pParentItem )->addSubItem( this, reqMsgEncoder.getRsslRequestMsg()->msgBase.streamId );
 		}
 	}
 
 	_domainType = (UInt8)reqMsgEncoder.getRsslRequestMsg()->msgBase.domainType;
 
-	return reinterpret_cast<TunnelItem*>( _event.getParentHandle() )->submitSubItemMsg( (RsslMsg*)reqMsgEncoder.getRsslRequestMsg() );
+	return static_cast<TunnelItem*>( _pParentItem )->submitSubItemMsg( (RsslMsg*)reqMsgEncoder.getRsslRequestMsg() );
 }
 
 bool SubItem::modify( const ReqMsg& reqMsg )
@@ -2372,7 +2406,7 @@ bool SubItem::modify( const ReqMsg& reqMsg )
 
 	reqMsgEncoder.getRsslRequestMsg()->msgBase.streamId = _streamId;
 
-	return reinterpret_cast<TunnelItem*>( _event.getParentHandle() )->submitSubItemMsg( (RsslMsg*)reqMsgEncoder.getRsslRequestMsg() );
+	return static_cast<TunnelItem*>( _pParentItem )->submitSubItemMsg( (RsslMsg*)reqMsgEncoder.getRsslRequestMsg() );
 }
 
 bool SubItem::submit( const PostMsg& postMsg )
@@ -2381,7 +2415,7 @@ bool SubItem::submit( const PostMsg& postMsg )
 
 	postMsgEncoder.getRsslPostMsg()->msgBase.streamId = _streamId;
 
-	return reinterpret_cast<TunnelItem*>( _event.getParentHandle() )->submitSubItemMsg( (RsslMsg*)postMsgEncoder.getRsslPostMsg() );
+	return static_cast<TunnelItem*>( _pParentItem )->submitSubItemMsg( (RsslMsg*)postMsgEncoder.getRsslPostMsg() );
 }
 
 bool SubItem::submit( const GenericMsg& genMsg )
@@ -2392,7 +2426,7 @@ bool SubItem::submit( const GenericMsg& genMsg )
 	if (genMsgEncoder.getRsslGenericMsg()->msgBase.domainType == 0)
 		genMsgEncoder.getRsslGenericMsg()->msgBase.domainType = _domainType;
 
-	return reinterpret_cast<TunnelItem*>( _event.getParentHandle() )->submitSubItemMsg( (RsslMsg*)genMsgEncoder.getRsslGenericMsg() );
+	return static_cast<TunnelItem*>( _pParentItem )->submitSubItemMsg( (RsslMsg*)genMsgEncoder.getRsslGenericMsg() );
 }
 
 bool SubItem::close()
@@ -2403,7 +2437,7 @@ bool SubItem::close()
 	rsslCloseMsg.msgBase.containerType = RSSL_DT_NO_DATA;
 	rsslCloseMsg.msgBase.domainType = _domainType;
 	rsslCloseMsg.msgBase.streamId = _streamId;
-    bool retCode = reinterpret_cast<TunnelItem*>( _event.getParentHandle() )->submitSubItemMsg( (RsslMsg*)&rsslCloseMsg );
+    bool retCode = static_cast<TunnelItem*>( _pParentItem )->submitSubItemMsg( (RsslMsg*)&rsslCloseMsg );
 	
 	remove();
 
@@ -2412,11 +2446,76 @@ bool SubItem::close()
 
 void SubItem::remove()
 {
-	reinterpret_cast<TunnelItem*>(_event.getParentHandle())->returnSubItemStreamId(_streamId);
+	static_cast<TunnelItem*>( _pParentItem )->returnSubItemStreamId(_streamId);
 
 	delete this;
 }
 
+ItemHandleTable::ItemHandleTable( UInt32 itemCountHint ) :
+	_chunks( itemCountHint / _chunkSize + 1 ),
+	_freeHead( _noFreeSlot )
+{
+}
+
+ItemHandleTable::~ItemHandleTable()
+{
+	for ( UInt32 i = 0; i < _chunks.size(); ++i )
+		delete [] _chunks[i];
+}
+
+UInt64 ItemHandleTable::insert( Item* pItem )
+{
+	if ( _freeHead == _noFreeSlot )
+	{
+		UInt32 base = _chunks.size() << _chunkShift;
+		Slot* pChunk = new Slot[_chunkSize];
+
+		for ( UInt32 i = 0; i < _chunkSize; ++i )
+		{
+			pChunk[i]._pItem = 0;
+			pChunk[i]._generation = 1;
+			pChunk[i]._nextFree = ( i + 1 < _chunkSize ) ? base + i + 1 : _noFreeSlot;
+		}
+
+		_chunks.push_back( pChunk );
+		_freeHead = base;
+	}
+
+	UInt32 index = _freeHead;
+	Slot& slot = _chunks[index >> _chunkShift][index & ( _chunkSize - 1 )];
+
+	_freeHead = slot._nextFree;
+	slot._pItem = pItem;
+
+	return ( (UInt64)slot._generation << 32 ) | ( index + 1 );
+}
+
+void ItemHandleTable::erase( UInt64 handle )
+{
+	if ( !find( handle ) ) return;
+
+	UInt32 index = (UInt32)handle - 1;
+	Slot& slot = _chunks[index >> _chunkShift][index & ( _chunkSize - 1 )];
+
+	slot._pItem = 0;
+	if ( ++slot._generation == 0 )
+		slot._generation = 1;
+	slot._nextFree = _freeHead;
+	_freeHead = index;
+}
+
+Item* ItemHandleTable::find( UInt64 handle ) const
+{
+	UInt32 index = (UInt32)handle - 1;
+
+	if ( !(UInt32)handle || ( index >> _chunkShift ) >= _chunks.size() )
+		return 0;
+
+	const Slot& slot = _chunks[index >> _chunkShift][index & ( _chunkSize - 1 )];
+
+	return slot._generation == (UInt32)( handle >> 32 ) ? slot._pItem : 0;
+}
+
 ItemList* ItemList::create(OmmCommonImpl& ommCommonImpl)
 {
 	ItemList* pItemList = 0;
@@ -2492,10 +2591,19 @@ ItemCallbackClient::ItemCallbackClient( OmmBaseImpl& ommBaseImpl ) :
 	_genericMsg(),
 	_ackMsg(),
 	_ommCommonImpl( ommBaseImpl ),
-	_itemMap( ommBaseImpl.getActiveConfig().itemCountHint ),
+	_itemHandleTable( ommBaseImpl.getActiveConfig().itemCountHint ),
 	_streamIdMap(ommBaseImpl.getActiveConfig().itemCountHint),
 	_nextStreamIdWrapAround(false),
-	_streamIdAccessMutex()
+	_streamIdAccessMutex(),
+	_updateBatchSize( ommBaseImpl.getImplType() == OmmCommonImpl::ConsumerEnum ? ommBaseImpl.getActiveConfig().updateBatchSize : 0 ),
+	_batchHandles( _updateBatchSize ),
+	_batchUpdateMsgs( _updateBatchSize ),
+	_batchEvents( _updateBatchSize ),
+	_batchDeliverMsgs( _updateBatchSize ),
+	_batchDeliverEvents( _updateBatchSize ),
+	_pBatchBuffer( 0 ),
+	_batchBufferLength( 0 ),
+	_batchBufferUsed( 0 )
 {
     _itemList = ItemList::create( ommBaseImpl );
 
@@ -2523,10 +2631,19 @@ ItemCallbackClient::ItemCallbackClient( OmmServerBaseImpl& ommServerBaseImpl ) :
 	_genericMsg(),
 	_ackMsg(),
 	_ommCommonImpl( ommServerBaseImpl ),
-	_itemMap( ommServerBaseImpl.getActiveConfig().itemCountHint ),
+	_itemHandleTable( ommServerBaseImpl.getActiveConfig().itemCountHint ),
 	_streamIdMap( ommServerBaseImpl.getActiveConfig().itemCountHint ),
 	_nextStreamIdWrapAround( false ),
-	_streamIdAccessMutex()
+	_streamIdAccessMutex(),
+	_updateBatchSize( 0 ),
+	_batchHandles(),
+	_batchUpdateMsgs(),
+	_batchEvents(),
+	_batchDeliverMsgs(),
+	_batchDeliverEvents(),
+	_pBatchBuffer( 0 ),
+	_batchBufferLength( 0 ),
+	_batchBufferUsed( 0 )
 {
 	_itemList = ItemList::create( ommServerBaseImpl );
 
@@ -2544,6 +2661,15 @@ ItemCallbackClient::~ItemCallbackClient()
 {
 	ItemList::destroy( _itemList );
 
+	for ( UInt32 idx = 0; idx < _batchUpdateMsgs.size(); ++idx )
+	{
+		delete _batchUpdateMsgs[idx];
+		delete _batchEvents[idx];
+	}
+
+	if ( _pBatchBuffer )
+		delete [] _pBatchBuffer;
+
 	if ( OmmLoggerClient::VerboseEnum >= _ommCommonImpl.getActiveLoggerConfig().minLoggerSeverity )
 	{
 		EmaString temp( "Destroyed ItemCallbackClient [" );
@@ -2597,6 +2723,8 @@ void ItemCallbackClient::initialize()
 
 RsslReactorCallbackRet ItemCallbackClient::processCallback( RsslTunnelStream* pRsslTunnelStream, RsslTunnelStreamStatusEvent* pTunnelStreamStatusEvent )
 {
+	flushUpdateBatch();
+
 	if ( !pRsslTunnelStream )
 	{
 		if ( OmmLoggerClient::ErrorEnum >= _ommCommonImpl.getActiveLoggerConfig().minLoggerSeverity )
@@ -2674,6 +2802,8 @@ RsslReactorCallbackRet ItemCallbackClient::processCallback( RsslTunnelStream* pR
 
 RsslReactorCallbackRet ItemCallbackClient::processCallback( RsslTunnelStream* pRsslTunnelStream, RsslTunnelStreamMsgEvent* pTunnelStreamMsgEvent )
 {
+	flushUpdateBatch();
+
 	if ( !pRsslTunnelStream )
 	{
 		if ( OmmLoggerClient::ErrorEnum >= _ommCommonImpl.getActiveLoggerConfig().minLoggerSeverity )
@@ -2797,6 +2927,8 @@ RsslReactorCallbackRet ItemCallbackClient::processCallback( RsslTunnelStream* pR
 
 RsslReactorCallbackRet ItemCallbackClient::processCallback( RsslTunnelStream* pRsslTunnelStream, RsslTunnelStreamQueueMsgEvent* pTunnelStreamQueueMsgEvent )
 {
+	flushUpdateBatch();
+
 	if ( !pRsslTunnelStream )
 	{
 		if ( OmmLoggerClient::ErrorEnum >= _ommCommonImpl.getActiveLoggerConfig().minLoggerSeverity )
@@ -3006,6 +3138,9 @@ RsslReactorCallbackRet ItemCallbackClient::processCallback( RsslReactor* pRsslRe
 		}
 	}
 
+	if ( pRsslMsg->msgBase.msgClass != RSSL_MC_UPDATE )
+		flushUpdateBatch();
+
 	switch ( pRsslMsg->msgBase.msgClass )
 	{
 	case RSSL_MC_ACK :
@@ -3180,14 +3315,25 @@ RsslReactorCallbackRet ItemCallbackClient::processRefreshMsg( RsslMsg* pRsslMsg,
 
 RsslReactorCallbackRet ItemCallbackClient::processUpdateMsg( RsslMsg* pRsslMsg, RsslReactorChannel* pRsslReactorChannel, Item* item, const RsslDataDictionary* pRsslDataDictionary )
 {
+	if ( item->getType() == Item::BatchItemEnum )
+		item = static_cast<BatchItem *>(item)->getSingleItem( pRsslMsg->msgBase.streamId );
+
+	if ( _updateBatchSize )
+	{
+		if ( item->getType() == Item::SingleItemEnum && batchUpdateMsg( pRsslMsg, pRsslReactorChannel, item, pRsslDataDictionary ) )
+		{
+			_ommCommonImpl.msgDispatched();
+			return RSSL_RC_CRET_SUCCESS;
+		}
+
+		flushUpdateBatch();
+	}
+
 	StaticDecoder::setRsslData( &_updateMsg, pRsslMsg,
 		pRsslReactorChannel->majorVersion,
 		pRsslReactorChannel->minorVersion,
 		pRsslDataDictionary );
 
-	if ( item->getType() == Item::BatchItemEnum )
-		item = static_cast<BatchItem *>(item)->getSingleItem( pRsslMsg->msgBase.streamId );
-	
 	_updateMsg.getDecoder().setServiceName( item->getDirectory()->getName().c_str(), item->getDirectory()->getName().length() );
 
 	_ommCommonImpl.msgDispatched();
@@ -3198,6 +3344,121 @@ RsslReactorCallbackRet ItemCallbackClient::processUpdateMsg( RsslMsg* pRsslMsg,
 	return RSSL_RC_CRET_SUCCESS;
 }
 
+bool ItemCallbackClient::batchUpdateMsg( RsslMsg* pRsslMsg, RsslReactorChannel* pRsslReactorChannel, Item* item, const RsslDataDictionary* pRsslDataDictionary )
+{
+	UInt32 msgLength = rsslSizeOfMsg( pRsslMsg, RSSL_CMF_ALL_FLAGS );
+	if ( msgLength < sizeof( RsslMsg ) + pRsslMsg->msgBase.encMsgBuffer.length )
+		msgLength = sizeof( RsslMsg ) + pRsslMsg->msgBase.encMsgBuffer.length;
+	msgLength = ( msgLength + 7 ) & ~7;
+
+	if ( _batchHandles.size() >= _updateBatchSize || _batchBufferUsed + msgLength > _batchBufferLength )
+		flushUpdateBatch();
+
+	if ( msgLength > _batchBufferLength )
+	{
+		UInt32 newLength = _batchBufferLength ? _batchBufferLength : INITIAL_UPDATE_BATCH_BUFFER_SIZE;
+		while ( newLength < msgLength )
+			newLength *= 2;
+
+		char* pNewBuffer = 0;
+		try {
+			pNewBuffer = new char[newLength];
+		}
+		catch ( std::bad_alloc ) {}
+
+		if ( !pNewBuffer )
+			return false;
+
+		if ( _pBatchBuffer )
+			delete [] _pBatchBuffer;
+
+		_pBatchBuffer = pNewBuffer;
+		_batchBufferLength = newLength;
+	}
+
+	UInt32 idx = _batchHandles.size();
+
+	if ( idx == _batchUpdateMsgs.size() )
+	{
+		UpdateMsg* pUpdateMsg = 0;
+		OmmConsumerEvent* pEvent = 0;
+		try {
+			pUpdateMsg = new UpdateMsg();
+			pEvent = new OmmConsumerEvent();
+		}
+		catch ( std::bad_alloc ) {}
+
+		if ( !pUpdateMsg || !pEvent )
+		{
+			delete pUpdateMsg;
+			return false;
+		}
+
+		_batchUpdateMsgs.push_back( pUpdateMsg );
+		_batchEvents.push_back( pEvent );
+	}
+
+	RsslBuffer copyBuffer;
+	copyBuffer.data = _pBatchBuffer + _batchBufferUsed;
+	copyBuffer.length = msgLength;
+
+	RsslMsg* pCopiedMsg = rsslCopyMsg( pRsslMsg, RSSL_CMF_ALL_FLAGS, 0, &copyBuffer );
+	if ( !pCopiedMsg )
+		return false;
+
+	_batchBufferUsed += msgLength;
+
+	StaticDecoder::setRsslData( _batchUpdateMsgs[idx], pCopiedMsg,
+		pRsslReactorChannel->majorVersion,
+		pRsslReactorChannel->minorVersion,
+		pRsslDataDictionary );
+
+	_batchUpdateMsgs[idx]->getDecoder().setServiceName( item->getDirectory()->getName().c_str(), item->getDirectory()->getName().length() );
+
+	_batchHandles.push_back( item->getHandle() );
+
+	return true;
+}
+
+void ItemCallbackClient::flushUpdateBatch()
+{
+	UInt32 count = _batchHandles.size();
+	UInt32 idx = 0;
+
+	while ( idx < count )
+	{
+		OmmConsumerClient* pClient = 0;
+		_batchDeliverMsgs.clear();
+		_batchDeliverEvents.clear();
+
+		for ( ; idx < count; ++idx )
+		{
+			Item* pItem = _batchHandles[idx] ? _itemHandleTable.find( _batchHandles[idx] ) : 0;
+			if ( !pItem ) continue;
+
+			ConsumerItem* pConsumerItem = static_cast<ConsumerItem*>( pItem );
+			if ( pClient && &pConsumerItem->getClient() != pClient ) break;
+
+			pClient = &pConsumerItem->getClient();
+
+			const OmmConsumerEvent& itemEvent = pConsumerItem->getEvent();
+			OmmConsumerEvent* pEvent = _batchEvents[idx];
+			pEvent->_handle = itemEvent._handle;
+			pEvent->_parentHandle = itemEvent._parentHandle;
+			pEvent->_closure = itemEvent._closure;
+
+			_batchDeliverMsgs.push_back( _batchUpdateMsgs[idx] );
+			_batchDeliverEvents.push_back( pEvent );
+		}
+
+		if ( pClient )
+			pClient->onUpdateMsgBatch( &_batchDeliverMsgs[0], &_batchDeliverEvents[0], _batchDeliverMsgs.size() );
+	}
+
+	_batchHandles.clear();
+	_batchBufferUsed = 0;
+}
+
 RsslReactorCallbackRet ItemCallbackClient::processStatusMsg( RsslMsg* pRsslMsg, RsslReactorChannel* pRsslReactorChannel, Item* item, const RsslDataDictionary* pRsslDataDictionary )
 {
 	StaticDecoder::setRsslData( &_statusMsg, pRsslMsg,
@@ -3280,7 +3541,7 @@ UInt64 ItemCallbackClient::registerClient( const ReqMsg& reqMsg, OmmConsumerClie
 					addToItemMap( pItem );
 				}
 
-				return (UInt64)pItem;
+				return pItem ? pItem->getHandle() : 0;
 			}
 		case RSSL_DMT_DICTIONARY :
 			{
@@ -3317,7 +3578,7 @@ UInt64 ItemCallbackClient::registerClient( const ReqMsg& reqMsg, OmmConsumerClie
 					}
 				}
 
-				return (UInt64)pItem;
+				return pItem ? pItem->getHandle() : 0;
 			}
 		case RSSL_DMT_SOURCE :
 		{
@@ -3348,7 +3609,7 @@ UInt64 ItemCallbackClient::registerClient( const ReqMsg& reqMsg, OmmConsumerClie
 				}
 			}
 
-			return (UInt64)pItem;
+			return pItem ? pItem->getHandle() : 0;
 
 		}
 		default :
@@ -3385,7 +3646,7 @@ UInt64 ItemCallbackClient::registerClient( const ReqMsg& reqMsg, OmmConsumerClie
 								EmaString temp("Batch request acknowledged.");
 								pBatchItem->scheduleItemClosedStatus(reqMsgEncoder, temp);
 
-								return (UInt64)pBatchItem;
+								return pBatchItem->getHandle();
 							}
 							else
 							{
@@ -3450,13 +3711,15 @@ UInt64 ItemCallbackClient::registerClient( const ReqMsg& reqMsg, OmmConsumerClie
 					}
 				}
 
-				return (UInt64)pItem;
+				return pItem ? pItem->getHandle() : 0;
 			}
 		}
 	}
 	else
 	{
-		if ( !_itemMap.find( parentHandle ) )
+		Item* pParentItem = _itemHandleTable.find( parentHandle );
+
+		if ( !pParentItem )
 		{
 			EmaString temp( "Attempt to use invalid parentHandle on registerClient(). " );
 			temp.append( "Instance name='" ).append( ommBaseImpl.getInstanceName() ).append( "'." );
@@ -3464,17 +3727,17 @@ UInt64 ItemCallbackClient::registerClient( const ReqMsg& reqMsg, OmmConsumerClie
 			return 0;
 		}
 
-		if ( ((Item*)parentHandle)->getType() != Item::TunnelItemEnum )
+		if ( pParentItem->getType() != Item::TunnelItemEnum )
 		{
 			EmaString temp( "Invalid attempt to use " );
-			temp += ((Item*)parentHandle)->getTypeAsString();
+			temp += pParentItem->getTypeAsString();
 			temp.append( " as parentHandle on registerClient(). " );
 			temp.append( "Instance name='" ).append( ommBaseImpl.getInstanceName() ).append( "'." );
 			ommBaseImpl.handleIhe(parentHandle, temp);
 			return 0;
 		}
 
-		SubItem* pItem = SubItem::create( ommBaseImpl, ommConsClient, closure, (Item*)parentHandle );
+		SubItem* pItem = SubItem::create( ommBaseImpl, ommConsClient, closure, pParentItem );
 
 		if ( pItem )
 		{
@@ -3494,7 +3757,7 @@ UInt64 ItemCallbackClient::registerClient( const ReqMsg& reqMsg, OmmConsumerClie
 			}
 		}
 
-		return (UInt64)pItem;
+		return pItem ? pItem->getHandle() : 0;
 	}
 }
 
@@ -3516,7 +3779,7 @@ UInt64 ItemCallbackClient::registerClient( const ReqMsg& reqMsg, OmmProviderClie
 				addToItemMap( pItem );
 			}
 
-			return (UInt64) pItem;
+			return pItem ? pItem->getHandle() : 0;
 		}
 		case RSSL_DMT_DICTIONARY:
 		{
@@ -3562,7 +3825,7 @@ UInt64 ItemCallbackClient::registerClient( const ReqMsg& reqMsg, OmmProviderClie
 				}
 			}
 
-			return (UInt64) pItem;
+			return pItem ? pItem->getHandle() : 0;
 		}
 
 		default:
@@ -3606,12 +3869,14 @@ UInt64 ItemCallbackClient::registerClient( const TunnelStreamRequest& tunnelStre
 		}
 	}
 
-	return (UInt64)pItem;
+	return pItem ? pItem->getHandle() : 0;
 }
 
 void ItemCallbackClient::reissue( const ReqMsg& reqMsg, UInt64 handle )
 {
-	if ( !_itemMap.find( handle ) || ((Item*)handle)->getClosedStatusInfo())
+	Item* pItem = _itemHandleTable.find( handle );
+
+	if ( !pItem || pItem->getClosedStatusInfo() )
 	{
 		EmaString temp( "Attempt to use invalid Handle on reissue(). " );
 		temp.append( "Instance name='" ).append( _ommCommonImpl.getInstanceName() ).append( "'." );
@@ -3619,19 +3884,29 @@ void ItemCallbackClient::reissue( const ReqMsg& reqMsg, UInt64 handle )
 		return;
 	}
 
-	((Item*)handle)->modify( reqMsg );
+	pItem->modify( reqMsg );
 }
 
 void ItemCallbackClient::unregister( UInt64 handle )
 {
-	if ( !_itemMap.find( handle ) ) return;
+	Item* pItem = _itemHandleTable.find( handle );
 
-	((Item*)handle)->close();
+	if ( !pItem ) return;
+
+	for ( UInt32 idx = 0; idx < _batchHandles.size(); ++idx )
+	{
+		if ( _batchHandles[idx] == handle )
+			_batchHandles[idx] = 0;
+	}
+
+	pItem->close();
 }
 
 void ItemCallbackClient::submit( const PostMsg& postMsg, UInt64 handle )
 {
-	if ( !_itemMap.find( handle ) )
+	Item* pItem = _itemHandleTable.find( handle );
+
+	if ( !pItem )
 	{
 		EmaString temp( "Attempt to use invalid Handle on submit( const PostMsg& ). " );
 		temp.append( "Instance name='" ).append( _ommCommonImpl.getInstanceName() ).append( "'." );
@@ -3639,12 +3914,14 @@ void ItemCallbackClient::submit( const PostMsg& postMsg, UInt64 handle )
 		return;
 	}
 
-	((Item*)handle)->submit( postMsg );
+	pItem->submit( postMsg );
 }
 
 void ItemCallbackClient::submit( const GenericMsg& genericMsg, UInt64 handle )
 {
-	if ( !_itemMap.find( handle ) )
+	Item* pItem = _itemHandleTable.find( handle );
+
+	if ( !pItem )
 	{
 		EmaString temp( "Attempt to use invalid Handle on submit( const GenericMsg& ). " );
 		temp.append( "Instance name='" ).append( _ommCommonImpl.getInstanceName() ).append( "'." );
@@ -3652,17 +3929,12 @@ void ItemCallbackClient::submit( const GenericMsg& genericMsg, UInt64 handle )
 		return;
 	}
 
-	((Item*)handle)->submit( genericMsg );
+	pItem->submit( genericMsg );
 }
 
-size_t ItemCallbackClient::UInt64rHasher::operator()( const UInt64& value ) const
+Item* ItemCallbackClient::getItem( UInt64 handle ) const
 {
-	return value;
-}
-
-bool ItemCallbackClient::UInt64Equal_To::operator()( const UInt64& x, const UInt64& y ) const
-{
-	return x == y;
+	return _itemHandleTable.find( handle );
 }
 
 Int32 ItemCallbackClient::Int32rHasher::operator()(const Int32& value) const
@@ -3687,7 +3959,7 @@ void ItemCallbackClient::removeFromList( Item* pItem )
 
 void ItemCallbackClient::addToMap( Item* pItem )
 {
-	_itemMap.insert( (UInt64)pItem, pItem );
+	addToItemMap( pItem );
 	_streamIdMap.insert(pItem->getStreamId(), pItem);
 }
 
@@ -3695,7 +3967,7 @@ void ItemCallbackClient::removeFromMap(Item* pItem)
 {
 	_ommCommonImpl.getUserMutex().lock();
 
-	_itemMap.erase( (UInt64)pItem );
+	_itemHandleTable.erase( pItem->getHandle() );
 
 	if ( pItem->getStreamId() != 0 )
 		_streamIdMap.erase( pItem->getStreamId() );
@@ -3705,7 +3977,14 @@ void ItemCallbackClient::removeFromMap(Item* pItem)
 
 void ItemCallbackClient::addToItemMap(Item* pItem)
 {
-	_itemMap.insert((UInt64)pItem, pItem);
+	if ( pItem->getHandle() ) return;
+
+	try {
+		pItem->setHandle( _itemHandleTable.insert( pItem ) );
+	}
+	catch ( std::bad_alloc ) {
+		_ommCommonImpl.handleMee( "Failed to allocate memory for item handle in ItemCallbackClient::addToItemMap()" );
+	}
 }
 
 bool ItemCallbackClient::isStreamIdInUse( int nextStreamId )
@@ -78,6 +78,45 @@ private :
 	ItemList& operator=( const ItemList& );
 };
 
+/* Maps item handles to open items.
+ * A handle is a slot index (plus one) in the low 32 bits and the slot's generation in the high 32 bits.
+ * The generation changes whenever a slot is released, so handles of closed items never validate
+ * against a slot reused by a later item. Slots are allocated in fixed-size chunks that never move. */
+class ItemHandleTable
+{
+public :
+
+	ItemHandleTable( UInt32 itemCountHint );
+
+	virtual ~ItemHandleTable();
+
+	UInt64 insert( Item* );
+
+	void erase( UInt64 );
+
+	Item* find( UInt64 ) const;
+
+private :
+
+	struct Slot
+	{
+		Item*		_pItem;
+		UInt32		_generation;
+		UInt32		_nextFree;
+	};
+
+	static const UInt32			_chunkShift = 12;
+	static const UInt32			_chunkSize = 1 << _chunkShift;
+	static const UInt32			_noFreeSlot = 0xFFFFFFFF;
+
+	EmaVector< Slot* >			_chunks;
+	UInt32						_freeHead;
+
+	ItemHandleTable();
+	ItemHandleTable( const ItemHandleTable& );
+	ItemHandleTable& operator=( const ItemHandleTable& );
+};
+
 class Item : public ListLinks< Item >
 {
 public :
@@ -110,6 +149,12 @@ public :
 
 	ClosedStatusInfo*	getClosedStatusInfo();
 
+	UInt64 getHandle() const {
+		return _handle;
+	}
+
+	virtual void setHandle( UInt64 );
+
 	virtual const Directory* getDirectory() = 0;
 
 	virtual Int32 getNextStreamId(int numOfItem = 0) = 0;
@@ -135,6 +180,7 @@ protected :
 	UInt8				_domainType;
 	Int32				_streamId;
 	ClosedStatusInfo*	_closedStatusInfo;
+	UInt64				_handle;
 
 	Item();
 	virtual ~Item();
@@ -200,6 +246,12 @@ public :
 
 	Int32 getNextStreamId(int numOfItem = 0);
 
+	void setHandle( UInt64 );
+
+	OmmConsumerClient& getClient() const;
+
+	const OmmConsumerEvent& getEvent() const;
+
 protected :
 
 	ConsumerItem( OmmBaseImpl&, OmmConsumerClient&, void* , Item* );
@@ -208,6 +260,7 @@ protected :
 	OmmConsumerClient&		_client;
 	OmmConsumerEvent		_event;
 	OmmBaseImpl&			_ommBaseImpl;
+	Item*					_pParentItem;
 
 private:
 
@@ -250,6 +303,8 @@ public :
 
 	void cancelReqTimerEvent();
 
+	void setHandle( UInt64 );
+
 protected :
 
 	ProviderItem(OmmCommonImpl&, OmmProviderClient&, ItemWatchList*, void*);
@@ -551,6 +606,10 @@ public :
 
 	void submit( const GenericMsg& , UInt64 );
 
+	Item* getItem( UInt64 ) const;
+
+	void flushUpdateBatch();
+
 	RsslReactorCallbackRet processCallback( RsslReactor* , RsslReactorChannel* , RsslMsgEvent* );
 
 	RsslReactorCallbackRet processCallback( RsslTunnelStream* , RsslTunnelStreamStatusEvent* );
@@ -595,19 +654,7 @@ private :
 
 	ItemList*						_itemList;
 
-	class UInt64rHasher {
-	public:
-		size_t operator()( const UInt64 & ) const;
-	};
-
-	class UInt64Equal_To {
-	public:
-		bool operator()( const UInt64 & , const UInt64 & ) const;
-	};
-
-	typedef HashTable< UInt64 , ItemPtr , UInt64rHasher , UInt64Equal_To > ItemMap;
-
-	ItemMap							_itemMap;
+	ItemHandleTable					_itemHandleTable;
 
 	class Int32rHasher {
 	public:
@@ -629,6 +676,26 @@ private :
 
 	Mutex							_streamIdAccessMutex;
 
+	UInt32							_updateBatchSize;
+
+	EmaVector< UInt64 >				_batchHandles;
+
+	EmaVector< UpdateMsg* >			_batchUpdateMsgs;
+
+	EmaVector< OmmConsumerEvent* >	_batchEvents;
+
+	EmaVector< const UpdateMsg* >	_batchDeliverMsgs;
+
+	EmaVector< const OmmConsumerEvent* >	_batchDeliverEvents;
+
+	char*							_pBatchBuffer;
+
+	UInt32							_batchBufferLength;
+
+	UInt32							_batchBufferUsed;
+
+	bool batchUpdateMsg( RsslMsg*, RsslReactorChannel*, Item*, const RsslDataDictionary* );
+
 	RsslReactorCallbackRet processAckMsg( RsslMsg*, RsslReactorChannel* pRsslReactorChannel, Item*, const RsslDataDictionary* );
 	RsslReactorCallbackRet processGenericMsg( RsslMsg*, RsslReactorChannel* pRsslReactorChannel, Item*, const RsslDataDictionary* );
 	RsslReactorCallbackRet processRefreshMsg( RsslMsg*, RsslReactorChannel* pRsslReactorChannel, Item*, const RsslDataDictionary* );
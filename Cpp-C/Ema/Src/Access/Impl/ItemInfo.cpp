@@ -19,6 +19,7 @@ _streamId(0),
 _name(),
 _flags(None),
 _itemGroup(),
+_itemKey(),
 _pClientSession(0),
 _sentRefresh(false),
 _ommServerBaseimpl(ommServerBaseimpl)
@@ -181,6 +182,41 @@ bool ItemInfo::isSentRefresh() const
 	return _sentRefresh;
 }
 
+bool ItemInfo::hasItemKey() const
+{
+	return _itemKey.length() > 0;
+}
+
+const EmaBuffer& ItemInfo::getItemKey() const
+{
+	return _itemKey;
+}
+
+bool ItemInfo::buildItemKey(EmaBuffer& itemKey) const
+{
+	/* Only streaming, non-private market items with a service and a name receive item-level fan-out */
+	if ( _domainType <= ema::rdm::MMT_DICTIONARY || !(_flags & StreamingFlag) || (_flags & PrivateStreamFlag) ||
+		!hasServiceId() || !hasName() )
+	{
+		return false;
+	}
+
+	buildItemKey(_rsslMsgKey.serviceId, _domainType, _rsslMsgKey.name, itemKey);
+
+	return true;
+}
+
+void ItemInfo::buildItemKey(UInt16 serviceId, UInt8 domainType, const RsslBuffer& name, EmaBuffer& itemKey)
+{
+	char prefix[3];
+
+	prefix[0] = (char)(serviceId >> 8);
+	prefix[1] = (char)serviceId;
+	prefix[2] = (char)domainType;
+
+	itemKey.setFrom(prefix, sizeof(prefix)).append(name.data, name.length);
+}
+
 bool ItemInfo::setRsslRequestMsg(RsslRequestMsg& requestMsg)
 {
 	_streamId = requestMsg.msgBase.streamId;
@@ -302,6 +338,11 @@ void ItemInfo::setSentRefresh()
 	_sentRefresh = true;
 }
 
+void ItemInfo::setItemKey(const EmaBuffer& itemKey)
+{
+	_itemKey = itemKey;
+}
+
 bool ItemInfo::operator==(const ItemInfo& other) const
 {
 	if (this == &other) return true;
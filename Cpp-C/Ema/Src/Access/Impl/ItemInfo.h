@@ -77,6 +77,14 @@ public:
 
 	bool isSentRefresh() const;
 
+	bool hasItemKey() const;
+
+	const EmaBuffer& getItemKey() const;
+
+	bool buildItemKey(EmaBuffer&) const;
+
+	static void buildItemKey(UInt16 serviceId, UInt8 domainType, const RsslBuffer& name, EmaBuffer& itemKey);
+
 	void setStreamId(Int32 streamId);
 
 	void setServiceId(UInt16 serviceId);
@@ -97,6 +105,8 @@ public:
 
 	void setSentRefresh();
 
+	void setItemKey(const EmaBuffer&);
+
 	bool operator==(const ItemInfo&) const;
 
 private:
@@ -111,6 +121,7 @@ private:
 	UInt32 _flags;
 	UInt8 _domainType;
 	EmaBuffer _itemGroup;
+	EmaBuffer _itemKey;
 	RsslMsgKey _rsslMsgKey;
 	ClientSession* _pClientSession;
 	OmmServerBaseImpl& _ommServerBaseimpl;
@@ -353,6 +353,8 @@ RsslReactorCallbackRet MarketItemHandler::itemCallback(RsslReactor* pReactor, Rs
 				if (!setMessageKey && !itemInfo->setRsslRequestMsg(pRsslMsg->requestMsg))
 					return RSSL_RC_CRET_SUCCESS;
 
+				ommServerBaseImpl->updateItemKey(itemInfo);
+
 				ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
 				ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 				ommServerBaseImpl->_pOmmProviderClient->onReissue(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
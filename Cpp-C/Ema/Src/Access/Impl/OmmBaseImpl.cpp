@@ -325,6 +325,13 @@ void OmmBaseImpl::readConfig( EmaConfigImpl* pConfigImpl )
 
 	pConfigImpl->get<Int64>( instanceNodeName + "DispatchTimeoutApiThread", _activeConfig.dispatchTimeoutApiThread );
 
+	pConfigImpl->get<Int64>( instanceNodeName + "CpuApiThreadBind", _activeConfig.cpuApiThreadBind );
+
+	pConfigImpl->get<Int64>( instanceNodeName + "CpuWorkerThreadBind", _activeConfig.cpuWorkerThreadBind );
+
+	if ( pConfigImpl->get<UInt64>( instanceNodeName + "BusyPollTime", tmp ) )
+		_activeConfig.busyPollTime = static_cast<UInt32>( tmp > 0x7FFFFFFF ? 0x7FFFFFFF : tmp );
+
 	if ( pConfigImpl->get<UInt64>( instanceNodeName + "CatchUnhandledException", tmp ) )
 		_activeConfig.catchUnhandledException = static_cast<UInt32>( tmp > 0 ? true : false );
 
@@ -1083,6 +1090,7 @@ void OmmBaseImpl::initialize( EmaConfigImpl* configImpl )
 		rsslClearCreateReactorOptions( &reactorOpts );
 
 		reactorOpts.userSpecPtr = ( void* )this;
+		reactorOpts.cpuBindWorkerThread = static_cast<RsslInt32>( _activeConfig.cpuWorkerThreadBind > 0x7FFFFFFF ? 0x7FFFFFFF : _activeConfig.cpuWorkerThreadBind );
 
 		_pRsslReactor = rsslCreateReactor( &reactorOpts, &rsslErrorInfo );
 		if ( !_pRsslReactor )
@@ -1208,7 +1216,18 @@ void OmmBaseImpl::initialize( EmaConfigImpl* configImpl )
 		loadDirectory();
 		loadDictionary();
 
-		if ( isApiDispatching() ) start();
+		if ( isApiDispatching() )
+		{
+			start();
+
+			if ( _activeConfig.cpuApiThreadBind >= 0 && !bindCpu( _activeConfig.cpuApiThreadBind ) &&
+				OmmLoggerClient::WarningEnum >= _activeConfig.loggerConfig.minLoggerSeverity )
+			{
+				EmaString temp( "Failed to bind API thread to CPU " );
+				temp.append( _activeConfig.cpuApiThreadBind ).append( "." );
+				_pLoggerClient->log( _activeConfig.instanceName, OmmLoggerClient::WarningEnum, temp );
+			}
+		}
 		
 		_userLock.unlock();
 	}
@@ -1412,6 +1431,7 @@ Int64 OmmBaseImpl::rsslReactorDispatchLoop( Int64 timeOut, UInt32 count, bool& b
 	{
 		_userLock.lock();
 		reactorRetCode = _pRsslReactor ? rsslReactorDispatch( _pRsslReactor, &dispatchOpts, &_reactorDispatchErrorInfo ) : RSSL_RET_SUCCESS;
+		if ( _pItemCallbackClient ) _pItemCallbackClient->flushUpdateBatch();
 		_userLock.unlock();
 		++loopCount;
 	}
@@ -1461,6 +1481,9 @@ Int64 OmmBaseImpl::rsslReactorDispatchLoop( Int64 timeOut, UInt32 count, bool& b
 
 		Int64 selectRetCode = 1;
 
+		// When busy polling, poll without blocking until the timeout expires.
+		Int64 pollTimeOut = _activeConfig.busyPollTime ? 0 : timeOut;
+
 		// Do not wait infinitely in the select if there is a timeout event in the list.
 		if ( ( timeOut < 0 ) && getTimeOutList().size() != 0 )
 		{
@@ -1473,13 +1496,13 @@ Int64 OmmBaseImpl::rsslReactorDispatchLoop( Int64 timeOut, UInt32 count, bool& b
 		fd_set useExceptFds = _exceptFds;
 
 		struct timeval selectTime;
-		if ( timeOut >= 0 )
+		if ( pollTimeOut >= 0 )
 		{
-			selectTime.tv_sec = static_cast<long>( timeOut / 1000000 );
-			selectTime.tv_usec = timeOut % 1000000;
+			selectTime.tv_sec = static_cast<long>( pollTimeOut / 1000000 );
+			selectTime.tv_usec = pollTimeOut % 1000000;
 			selectRetCode = select( FD_SETSIZE, &useReadFds, NULL, &useExceptFds, &selectTime );
 		}
-		else if ( timeOut < 0 )
+		else if ( pollTimeOut < 0 )
 			selectRetCode = select( FD_SETSIZE, &useReadFds, NULL, &useExceptFds, NULL );
 
 		if ( selectRetCode > 0 && FD_ISSET( _pipe.readFD(), &useReadFds ) )
@@ -1492,13 +1515,13 @@ Int64 OmmBaseImpl::rsslReactorDispatchLoop( Int64 timeOut, UInt32 count, bool& b
 
 		struct timespec ppollTime;
 
-		if ( timeOut >= 0 )
+		if ( pollTimeOut >= 0 )
 		{
-			ppollTime.tv_sec = timeOut / static_cast<long long>( 1e6 );
-			ppollTime.tv_nsec = timeOut % static_cast<long long>( 1e6 ) * static_cast<long long>( 1e3 );
+			ppollTime.tv_sec = pollTimeOut / static_cast<long long>( 1e6 );
+			ppollTime.tv_nsec = pollTimeOut % static_cast<long long>( 1e6 ) * static_cast<long long>( 1e3 );
 			selectRetCode = ppoll( _eventFds, _eventFdsCount, &ppollTime, 0 );
 		}
-		else if ( timeOut < 0 )
+		else if ( pollTimeOut < 0 )
 			selectRetCode = ppoll( _eventFds, _eventFdsCount, 0, 0 );
 
 		if ( selectRetCode > 0 )
@@ -1530,6 +1553,7 @@ Int64 OmmBaseImpl::rsslReactorDispatchLoop( Int64 timeOut, UInt32 count, bool& b
 			{
 				_userLock.lock();
 				reactorRetCode = _pRsslReactor ? rsslReactorDispatch( _pRsslReactor, &dispatchOpts, &_reactorDispatchErrorInfo ) : RSSL_RET_SUCCESS;
+				if ( _pItemCallbackClient ) _pItemCallbackClient->flushUpdateBatch();
 				_userLock.unlock();
 				++loopCount;
 			}
@@ -7,6 +7,7 @@
  */
 
 #include "OmmConsumerClient.h"
+#include "UpdateMsg.h"
 
 using namespace thomsonreuters::ema::access;
 
@@ -17,3 +18,12 @@ OmmConsumerClient::OmmConsumerClient()
 OmmConsumerClient::~OmmConsumerClient()
 {
 }
+
+void OmmConsumerClient::onUpdateMsgBatch( const UpdateMsg* const* updateMsgs, const OmmConsumerEvent* const* consumerEvents, UInt32 count )
+{
+	for ( UInt32 idx = 0; idx < count; ++idx )
+	{
+		onAllMsg( *updateMsgs[idx], *consumerEvents[idx] );
+		onUpdateMsg( *updateMsgs[idx], *consumerEvents[idx] );
+	}
+}
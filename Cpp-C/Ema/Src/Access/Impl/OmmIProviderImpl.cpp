@@ -46,6 +46,10 @@ OmmIProviderImpl::OmmIProviderImpl(OmmProvider* ommProvider, const OmmIProviderC
 
 	_ommIProviderDirectoryStore.setClient(this);
 
+	_rsslFanoutMsgBuffer.length = 0;
+	_rsslFanoutMsgBuffer.data = 0;
+	_fanoutMsgLength = 0;
+
 	_rsslDirectoryMsgBuffer.length = 2048;
 	_rsslDirectoryMsgBuffer.data = (char*)malloc(_rsslDirectoryMsgBuffer.length * sizeof(char));
 	if (!_rsslDirectoryMsgBuffer.data)
@@ -73,6 +77,10 @@ OmmIProviderImpl::OmmIProviderImpl(OmmProvider* ommProvider, const OmmIProviderC
 
 	_ommIProviderDirectoryStore.setClient(this);
 
+	_rsslFanoutMsgBuffer.length = 0;
+	_rsslFanoutMsgBuffer.data = 0;
+	_fanoutMsgLength = 0;
+
 	_rsslDirectoryMsgBuffer.length = 2048;
 	_rsslDirectoryMsgBuffer.data = (char*)malloc(_rsslDirectoryMsgBuffer.length * sizeof(char));
 	if (!_rsslDirectoryMsgBuffer.data)
@@ -88,6 +96,9 @@ OmmIProviderImpl::~OmmIProviderImpl()
 {
 	free(_rsslDirectoryMsgBuffer.data);
 
+	if (_rsslFanoutMsgBuffer.data)
+		free(_rsslFanoutMsgBuffer.data);
+
 	OmmServerBaseImpl::uninitialize(false, false);
 }
 
@@ -652,11 +663,7 @@ void OmmIProviderImpl::submit(const UpdateMsg& updateMsg, UInt64 handle)
 	{
 		if (handle == 0)
 		{
-			_userLock.unlock();
-			EmaString temp("Attempt to fanout UpdateMsg with domain type ");
-			temp.append(rdmDomainToString(submitMsgOpts.pRsslMsg->msgBase.domainType))
-				.append(" while this is not supported.");
-			handleIue(temp);
+			submitByItemKey(updateMsgEncoder);
 			return;
 		}
 
@@ -1084,6 +1091,196 @@ bool OmmIProviderImpl::submit(RsslReactorSubmitMsgOptions submitMsgOptions, cons
 	return true;
 }
 
+void OmmIProviderImpl::submitByItemKey(const UpdateMsgEncoder& updateMsgEncoder)
+{
+	RsslUpdateMsg rsslUpdateMsg = *updateMsgEncoder.getRsslUpdateMsg();
+
+	if (!updateMsgEncoder.hasName())
+	{
+		_userLock.unlock();
+		EmaString temp("Attempt to fanout UpdateMsg with domain type ");
+		temp.append(rdmDomainToString(rsslUpdateMsg.msgBase.domainType))
+			.append(" without name. Name and service are required to fanout UpdateMsg to the streams of an item.");
+		handleIue(temp);
+		return;
+	}
+
+	if (updateMsgEncoder.hasServiceName())
+	{
+		if (encodeServiceIdFromName(updateMsgEncoder.getServiceName(), rsslUpdateMsg.msgBase.msgKey.serviceId, rsslUpdateMsg.msgBase) == false)
+		{
+			return;
+		}
+	}
+	else if (updateMsgEncoder.hasServiceId())
+	{
+		if (validateServiceId(rsslUpdateMsg.msgBase.msgKey.serviceId, rsslUpdateMsg.msgBase) == false)
+		{
+			return;
+		}
+	}
+	else
+	{
+		_userLock.unlock();
+		EmaString temp("Attempt to fanout UpdateMsg with domain type ");
+		temp.append(rdmDomainToString(rsslUpdateMsg.msgBase.domainType))
+			.append(" without service name or service id. Name and service are required to fanout UpdateMsg to the streams of an item.");
+		handleIue(temp);
+		return;
+	}
+
+	ItemInfo::buildItemKey(rsslUpdateMsg.msgBase.msgKey.serviceId, rsslUpdateMsg.msgBase.domainType, rsslUpdateMsg.msgBase.msgKey.name, _fanoutItemKey);
+
+	const EmaVector< ItemInfo* >* pItemInfoList = getItemInfoListByKey(_fanoutItemKey);
+
+	if (!pItemInfoList || pItemInfoList->empty())
+	{
+		_userLock.unlock();
+		return;
+	}
+
+	/* The key only identifies the item; the consumers already know it from the streams they opened. */
+	rsslUpdateMsg.flags &= ~RSSL_UPMF_HAS_MSG_KEY;
+
+	RsslErrorInfo rsslErrorInfo;
+	clearRsslErrorInfo(&rsslErrorInfo);
+
+	if (encodeFanoutMsg((RsslMsg*)&rsslUpdateMsg, rsslErrorInfo) == false)
+	{
+		_userLock.unlock();
+		EmaString temp("Internal error: failed to encode UpdateMsg in OmmIProviderImpl::submitByItemKey().");
+		temp.append(CR).append("Error Id ").append(rsslErrorInfo.rsslError.rsslErrorId).append(CR)
+			.append("Error Location ").append(rsslErrorInfo.errorLocation).append(CR)
+			.append("Error Text ").append(rsslErrorInfo.rsslError.text);
+		handleIue(temp);
+		return;
+	}
+
+	RsslReactorSubmitOptions submitOpts;
+	rsslClearReactorSubmitOptions(&submitOpts);
+
+	UInt32 failedCount = 0;
+	EmaString failureText;
+
+	/* The message is encoded once; each stream gets a copy with its own stream id. */
+	for (UInt32 idx = 0; idx < pItemInfoList->size(); idx++)
+	{
+		ItemInfo* itemInfo = (*pItemInfoList)[idx];
+
+		if (_ommIProviderActiveConfig.refreshFirstRequired && !itemInfo->isSentRefresh())
+		{
+			continue;
+		}
+
+		RsslReactorChannel* pReactorChannel = itemInfo->getClientSession()->getChannel();
+
+		clearRsslErrorInfo(&rsslErrorInfo);
+
+		RsslBuffer* pMsgBuffer = rsslReactorGetBuffer(pReactorChannel, _fanoutMsgLength, RSSL_FALSE, &rsslErrorInfo);
+		RsslRet ret = RSSL_RET_FAILURE;
+
+		if (pMsgBuffer)
+		{
+			RsslEncodeIterator encodeIter;
+
+			memcpy(pMsgBuffer->data, _rsslFanoutMsgBuffer.data, _fanoutMsgLength);
+			pMsgBuffer->length = _fanoutMsgLength;
+
+			rsslClearEncodeIterator(&encodeIter);
+			rsslSetEncodeIteratorRWFVersion(&encodeIter, pReactorChannel->majorVersion, pReactorChannel->minorVersion);
+			rsslSetEncodeIteratorBuffer(&encodeIter, pMsgBuffer);
+
+			if ((ret = rsslReplaceStreamId(&encodeIter, itemInfo->getStreamId())) == RSSL_RET_SUCCESS)
+			{
+				ret = rsslReactorSubmit(_pRsslReactor, pReactorChannel, pMsgBuffer, &submitOpts, &rsslErrorInfo);
+
+				while (ret == RSSL_RET_WRITE_CALL_AGAIN)
+					ret = rsslReactorSubmit(_pRsslReactor, pReactorChannel, pMsgBuffer, &submitOpts, &rsslErrorInfo);
+			}
+
+			if (ret < RSSL_RET_SUCCESS)
+			{
+				RsslErrorInfo releaseErrorInfo;
+				rsslReactorReleaseBuffer(pReactorChannel, pMsgBuffer, &releaseErrorInfo);
+			}
+		}
+
+		if (ret < RSSL_RET_SUCCESS)
+		{
+			if (failedCount++ == 0)
+			{
+				failureText.set(itemInfo->getClientSession()->toString()).append(CR)
+					.append("RsslChannel ").append(ptrToStringAsHex(rsslErrorInfo.rsslError.channel)).append(CR)
+					.append("Error Id ").append(rsslErrorInfo.rsslError.rsslErrorId).append(CR)
+					.append("Internal sysError ").append(rsslErrorInfo.rsslError.sysError).append(CR)
+					.append("Error Location ").append(rsslErrorInfo.errorLocation).append(CR)
+					.append("Error Text ").append(rsslErrorInfo.rsslError.text);
+			}
+		}
+	}
+
+	if (failedCount > 0)
+	{
+		UInt32 streamCount = pItemInfoList->size();
+
+		_userLock.unlock();
+		EmaString temp("Internal error: failed to fanout UpdateMsg to ");
+		temp.append(failedCount).append(" of ").append(streamCount)
+			.append(" streams in OmmIProviderImpl::submitByItemKey(). First failure:").append(CR).append(failureText);
+		handleIue(temp);
+		return;
+	}
+
+	_userLock.unlock();
+}
+
+bool OmmIProviderImpl::encodeFanoutMsg(RsslMsg* pRsslMsg, RsslErrorInfo& rsslErrorInfo)
+{
+	RsslUInt32 bufferSize = pRsslMsg->msgBase.encDataBody.length + 256;
+	RsslRet ret;
+
+	if (_rsslFanoutMsgBuffer.length > bufferSize)
+		bufferSize = _rsslFanoutMsgBuffer.length;
+
+	/* _rsslFanoutMsgBuffer.length is the allocated size; the encoded length goes to _fanoutMsgLength */
+	while (true)
+	{
+		if (_rsslFanoutMsgBuffer.length < bufferSize)
+		{
+			if (_rsslFanoutMsgBuffer.data)
+				free(_rsslFanoutMsgBuffer.data);
+
+			_rsslFanoutMsgBuffer.data = (char*)malloc(bufferSize * sizeof(char));
+			_rsslFanoutMsgBuffer.length = _rsslFanoutMsgBuffer.data ? bufferSize : 0;
+
+			if (!_rsslFanoutMsgBuffer.data)
+			{
+				rsslSetErrorInfo(&rsslErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate memory for the fanout message.");
+				return false;
+			}
+		}
+
+		RsslEncodeIterator encodeIter;
+		rsslClearEncodeIterator(&encodeIter);
+		rsslSetEncodeIteratorRWFVersion(&encodeIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		rsslSetEncodeIteratorBuffer(&encodeIter, &_rsslFanoutMsgBuffer);
+
+		if ((ret = rsslEncodeMsg(&encodeIter, pRsslMsg)) == RSSL_RET_SUCCESS)
+		{
+			_fanoutMsgLength = rsslGetEncodedBufferLength(&encodeIter);
+			return true;
+		}
+
+		if (ret != RSSL_RET_BUFFER_TOO_SMALL)
+		{
+			rsslSetErrorInfo(&rsslErrorInfo, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, "Message encoding failure.");
+			return false;
+		}
+
+		bufferSize *= 2;
+	}
+}
+
 void OmmIProviderImpl::handleItemInfo(int domainType, UInt64 handle, RsslState& state, bool refreshComplete)
 {
 	if ( ( state.streamState == RSSL_STREAM_CLOSED ) || ( state.streamState == RSSL_STREAM_CLOSED_RECOVER ) || ( state.streamState == RSSL_STREAM_REDIRECTED ) ||
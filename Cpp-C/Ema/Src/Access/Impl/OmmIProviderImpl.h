@@ -20,6 +20,8 @@ namespace ema {
 
 namespace access {
 
+class UpdateMsgEncoder;
+
 class OmmIProviderImpl : public OmmProviderImpl, public OmmServerBaseImpl, public DirectoryServiceStoreClient
 {
 public:
@@ -84,6 +86,10 @@ private:
 
 	bool submit(RsslReactorSubmitMsgOptions submitMsgOptions, const EmaVector< ItemInfo* >& itemList, EmaString& text, bool applyDirectoryFilter, RsslErrorInfo& rsslErrorInfo);
 
+	void submitByItemKey(const UpdateMsgEncoder& updateMsgEncoder);
+
+	bool encodeFanoutMsg(RsslMsg* pRsslMsg, RsslErrorInfo& rsslErrorInfo);
+
 	void handleItemInfo(int domainType, UInt64 handle, RsslState& state, bool refreshComplete = false);
 
 	void handleItemGroup(ItemInfo* itemInfo, RsslBuffer& groupId, RsslState&);
@@ -93,6 +99,9 @@ private:
 	bool											_storeUserSubmitted;
 	RsslRDMDirectoryMsg								_rsslDirectoryMsg;
 	RsslBuffer										_rsslDirectoryMsgBuffer;
+	RsslBuffer										_rsslFanoutMsgBuffer;
+	UInt32											_fanoutMsgLength;
+	EmaBuffer										_fanoutItemKey;
 	ItemWatchList									_itemWatchList;
 
 	OmmIProviderImpl();
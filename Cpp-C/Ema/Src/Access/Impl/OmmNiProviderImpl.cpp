@@ -768,7 +768,7 @@ UInt64 OmmNiProviderImpl::registerClient( const ReqMsg& reqMsg, OmmProviderClien
 	{
 		try
 		{
-			Item* item = reinterpret_cast<Item*>(handle);
+			Item* item = _pItemCallbackClient->getItem( handle );
 			StreamInfo* pStreamInfoPtr = new StreamInfo(StreamInfo::ConsumingEnum, item->getStreamId(), 0, item->getDomainType());
 
 			if ( _handleToStreamInfo.find( handle ) != 0)
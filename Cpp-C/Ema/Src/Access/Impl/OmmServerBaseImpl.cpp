@@ -130,6 +130,13 @@ void OmmServerBaseImpl::readConfig(EmaConfigServerImpl* pConfigServerImpl)
 
 	pConfigServerImpl->get<Int64>(instanceNodeName + "DispatchTimeoutApiThread", _activeServerConfig.dispatchTimeoutApiThread);
 
+	pConfigServerImpl->get<Int64>(instanceNodeName + "CpuApiThreadBind", _activeServerConfig.cpuApiThreadBind);
+
+	pConfigServerImpl->get<Int64>(instanceNodeName + "CpuWorkerThreadBind", _activeServerConfig.cpuWorkerThreadBind);
+
+	if (pConfigServerImpl->get<UInt64>(instanceNodeName + "BusyPollTime", tmp))
+		_activeServerConfig.busyPollTime = static_cast<UInt32>(tmp > 0x7FFFFFFF ? 0x7FFFFFFF : tmp);
+
 	if (pConfigServerImpl->get<UInt64>(instanceNodeName + "CatchUnhandledException", tmp))
 		_activeServerConfig.catchUnhandledException = static_cast<UInt32>(tmp > 0 ? true : false);
 
@@ -491,6 +498,7 @@ void OmmServerBaseImpl::initialize(EmaConfigServerImpl* serverConfigImpl)
 		rsslClearCreateReactorOptions(&reactorOpts);
 
 		reactorOpts.userSpecPtr = (void*)this;
+		reactorOpts.cpuBindWorkerThread = static_cast<RsslInt32>(_activeServerConfig.cpuWorkerThreadBind > 0x7FFFFFFF ? 0x7FFFFFFF : _activeServerConfig.cpuWorkerThreadBind);
 
 		_pRsslReactor = rsslCreateReactor(&reactorOpts, &rsslErrorInfo);
 		if (!_pRsslReactor)
@@ -595,7 +603,18 @@ void OmmServerBaseImpl::initialize(EmaConfigServerImpl* serverConfigImpl)
 		_serverReadEventFdsIdx = addFd(_pRsslServer->socketId);
 #endif
 
-		if (isApiDispatching()) start();
+		if (isApiDispatching())
+		{
+			start();
+
+			if (_activeServerConfig.cpuApiThreadBind >= 0 && !bindCpu(_activeServerConfig.cpuApiThreadBind) &&
+				OmmLoggerClient::WarningEnum >= _activeServerConfig.loggerConfig.minLoggerSeverity)
+			{
+				EmaString temp("Failed to bind API thread to CPU ");
+				temp.append(_activeServerConfig.cpuApiThreadBind).append(".");
+				_pLoggerClient->log(_activeServerConfig.instanceName, OmmLoggerClient::WarningEnum, temp);
+			}
+		}
 
 		_userLock.unlock();
 	}
@@ -744,6 +763,8 @@ void OmmServerBaseImpl::addItemInfo(ItemInfo* itemInfo)
 
 		_itemInfoHash.insert(handle, itemInfo);
 		itemInfo->getClientSession()->addItemInfo(itemInfo);
+
+		addItemKey(itemInfo);
 	}
 
 	_userLock.unlock();
@@ -765,6 +786,8 @@ void OmmServerBaseImpl::removeItemInfo(ItemInfo* itemInfo, bool eraseItemGroup)
 	_itemInfoHash.erase((UInt64)itemInfo);
 	itemInfo->getClientSession()->removeItemInfo(itemInfo);
 
+	removeItemKey(itemInfo);
+
 	if (eraseItemGroup && itemInfo->hasItemGroup() )
 	{
 		removeItemGroup(itemInfo);
@@ -775,6 +798,83 @@ void OmmServerBaseImpl::removeItemInfo(ItemInfo* itemInfo, bool eraseItemGroup)
 	_userLock.unlock();
 }
 
+void OmmServerBaseImpl::updateItemKey(ItemInfo* itemInfo)
+{
+	_userLock.lock();
+
+	if (!itemInfo->buildItemKey(_itemKey) || !(_itemKey == itemInfo->getItemKey()))
+	{
+		removeItemKey(itemInfo);
+		addItemKey(itemInfo);
+	}
+
+	_userLock.unlock();
+}
+
+const EmaVector<ItemInfo*>* OmmServerBaseImpl::getItemInfoListByKey(const EmaBuffer& itemKey)
+{
+	_userLock.lock();
+
+	EmaVector<ItemInfo*>** itemInfoListPtr = _itemKeyToItemInfoHash.find(itemKey);
+
+	_userLock.unlock();
+
+	return itemInfoListPtr ? *itemInfoListPtr : 0;
+}
+
+void OmmServerBaseImpl::addItemKey(ItemInfo* itemInfo)
+{
+	if (!itemInfo->buildItemKey(_itemKey))
+		return;
+
+	try
+	{
+		EmaVector<ItemInfo*>** itemInfoListPtr = _itemKeyToItemInfoHash.find(_itemKey);
+
+		if (itemInfoListPtr)
+		{
+			(*itemInfoListPtr)->push_back(itemInfo);
+		}
+		else
+		{
+			EmaVector<ItemInfo*>* pItemInfoList = new EmaVector<ItemInfo*>();
+			pItemInfoList->push_back(itemInfo);
+
+			_itemKeyToItemInfoHash.insert(_itemKey, pItemInfoList);
+		}
+
+		itemInfo->setItemKey(_itemKey);
+	}
+	catch (std::bad_alloc)
+	{
+		throwMeeException("Failed to allocate memory in OmmServerBaseImpl::addItemKey()");
+	}
+}
+
+void OmmServerBaseImpl::removeItemKey(ItemInfo* itemInfo)
+{
+	if (!itemInfo->hasItemKey())
+		return;
+
+	EmaVector<ItemInfo*>** itemInfoListPtr = _itemKeyToItemInfoHash.find(itemInfo->getItemKey());
+
+	if (itemInfoListPtr)
+	{
+		EmaVector<ItemInfo*>* pItemInfoList = *itemInfoListPtr;
+
+		pItemInfoList->removeValue(itemInfo);
+
+		/* The list is freed with the last stream of the item, so closed items do not accumulate */
+		if (pItemInfoList->empty())
+		{
+			_itemKeyToItemInfoHash.erase(itemInfo->getItemKey());
+			delete pItemInfoList;
+		}
+	}
+
+	itemInfo->setItemKey(EmaBuffer());
+}
+
 void OmmServerBaseImpl::cleanUp()
 {
 	uninitialize(true, false);
@@ -975,19 +1075,22 @@ Int64 OmmServerBaseImpl::rsslReactorDispatchLoop(Int64 timeOut, UInt32 count, bo
 
 		Int64 selectRetCode = 1;
 
+		// When busy polling, poll without blocking until the timeout expires.
+		Int64 pollTimeOut = _activeServerConfig.busyPollTime ? 0 : timeOut;
+
 #if defined( USING_SELECT )
 
 		fd_set useReadFds = _readFds;
 		fd_set useExceptFds = _exceptFds;
 
 		struct timeval selectTime;
-		if (timeOut >= 0)
+		if (pollTimeOut >= 0)
 		{
-			selectTime.tv_sec = static_cast<long>(timeOut / 1000000);
-			selectTime.tv_usec = timeOut % 1000000;
+			selectTime.tv_sec = static_cast<long>(pollTimeOut / 1000000);
+			selectTime.tv_usec = pollTimeOut % 1000000;
 			selectRetCode = select(FD_SETSIZE, &useReadFds, NULL, &useExceptFds, &selectTime);
 		}
-		else if (timeOut < 0)
+		else if (pollTimeOut < 0)
 			selectRetCode = select(FD_SETSIZE, &useReadFds, NULL, &useExceptFds, NULL);
 
 		if (selectRetCode > 0 && FD_ISSET(_pRsslServer->socketId, &useReadFds))
@@ -1030,13 +1133,13 @@ Int64 OmmServerBaseImpl::rsslReactorDispatchLoop(Int64 timeOut, UInt32 count, bo
 
 		struct timespec ppollTime;
 
-		if (timeOut >= 0)
+		if (pollTimeOut >= 0)
 		{
-			ppollTime.tv_sec = timeOut / static_cast<long long>(1e6);
-			ppollTime.tv_nsec = timeOut % static_cast<long long>(1e6) * static_cast<long long>(1e3);
+			ppollTime.tv_sec = pollTimeOut / static_cast<long long>(1e6);
+			ppollTime.tv_nsec = pollTimeOut % static_cast<long long>(1e6) * static_cast<long long>(1e3);
 			selectRetCode = ppoll(_eventFds, _eventFdsCount, &ppollTime, 0);
 		}
-		else if (timeOut < 0)
+		else if (pollTimeOut < 0)
 			selectRetCode = ppoll(_eventFds, _eventFdsCount, 0, 0);
 
 		if (selectRetCode > 0)
@@ -1643,3 +1746,13 @@ bool OmmServerBaseImpl::UInt64Equal_To::operator()(const UInt64& x, const UInt64
 {
 	return x == y ? true : false;
 }
+
+size_t OmmServerBaseImpl::EmaBufferHasher::operator()(const EmaBuffer& value) const
+{
+	return ClientSession::hashCodeBuffer(value);
+}
+
+bool OmmServerBaseImpl::EmaBufferEqual_To::operator()(const EmaBuffer& x, const EmaBuffer& y) const
+{
+	return x == y;
+}
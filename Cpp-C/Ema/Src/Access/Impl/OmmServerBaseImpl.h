@@ -195,6 +195,10 @@ protected:
 
 	void removeItemInfo(ItemInfo *, bool eraseItemGroup);
 
+	void updateItemKey(ItemInfo *);
+
+	const EmaVector<ItemInfo*>* getItemInfoListByKey(const EmaBuffer&);
+
 	void bindServerOptions(RsslBindOptions& bindOptions, const EmaString& componentVersion);
 
 	ActiveServerConfig&	_activeServerConfig;
@@ -261,10 +265,31 @@ private:
 		bool operator()(const UInt64&, const UInt64&) const;
 	};
 
+	class EmaBufferHasher
+	{
+	public:
+		size_t operator()(const EmaBuffer&) const;
+	};
+
+	class EmaBufferEqual_To
+	{
+	public:
+		bool operator()(const EmaBuffer&, const EmaBuffer&) const;
+	};
+
 	typedef HashTable< UInt64, ItemInfoPtr, UInt64rHasher, UInt64Equal_To > ItemInfoHash;
 
+	typedef HashTable< EmaBuffer, EmaVector<ItemInfo*>*, EmaBufferHasher, EmaBufferEqual_To > ItemKeyToItemInfoHash;
+
+	void addItemKey(ItemInfo *);
+
+	void removeItemKey(ItemInfo *);
+
 	ItemInfoHash _itemInfoHash;
 
+	ItemKeyToItemInfoHash				_itemKeyToItemInfoHash;
+	EmaBuffer							_itemKey;
+
 	RsslReactorOMMProviderRole	_providerRole;
 	RsslServer*					_pRsslServer;
 	RsslReactorAcceptOptions	_reactorAcceptOptions;
@@ -695,6 +695,10 @@ void ProgrammaticConfigure::retrieveInstanceCommonConfig( const Map& map, const
 												{
 													activeConfig.setRequestTimeout( eentry.getUInt() );
 												}
+												else if ( eentry.getName() == "BusyPollTime" )
+												{
+													activeConfig.busyPollTime = static_cast<UInt32>( eentry.getUInt() > 0x7FFFFFFF ? 0x7FFFFFFF : eentry.getUInt() );
+												}
 												else if ( eentry.getName() == "CatchUnhandledException" )
 												{
 													activeConfig.setCatchUnhandledException( eentry.getUInt() );
@@ -759,6 +763,14 @@ void ProgrammaticConfigure::retrieveInstanceCommonConfig( const Map& map, const
 												{
 													activeConfig.dispatchTimeoutApiThread = eentry.getInt();
 												}
+												else if ( eentry.getName() == "CpuApiThreadBind" )
+												{
+													activeConfig.cpuApiThreadBind = eentry.getInt();
+												}
+												else if ( eentry.getName() == "CpuWorkerThreadBind" )
+												{
+													activeConfig.cpuWorkerThreadBind = eentry.getInt();
+												}
 												else if (eentry.getName() == "XmlTraceMaxFileSize")
 												{
 													activeConfig.xmlTraceMaxFileSize = eentry.getInt();
@@ -859,6 +871,10 @@ void ProgrammaticConfigure::retrieveInstanceCustomConfig( const Map& map, const
 												{
 													activeConfig.setMaxOutstandingPosts( eentry.getUInt() );
 												}
+												else if ( eentry.getName() == "UpdateBatchSize" )
+												{
+													activeConfig.setUpdateBatchSize( eentry.getUInt() );
+												}
 												else if ( eentry.getName() == "DirectoryRequestTimeOut" )
 												{
 													activeConfig.setDirectoryRequestTimeOut( eentry.getUInt() );
@@ -167,6 +167,25 @@ RsslReactorCallbackRet ServerChannelHandler::channelEventCallback(RsslReactor* p
 				}
 			}
 
+			// set the socket busy poll time if busy polling; raising it may need privileges, so failing is not fatal
+			if (ommServerBase->getActiveConfig().busyPollTime > 0)
+			{
+				int busyPollTime = (int)ommServerBase->getActiveConfig().busyPollTime;
+				if (rsslReactorChannelIoctl(pRsslReactorChannel, RSSL_SYSTEM_BUSY_POLL, &busyPollTime, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+				{
+					if (OmmLoggerClient::WarningEnum >= ommServerBase->getActiveConfig().loggerConfig.minLoggerSeverity)
+					{
+						EmaString temp("Failed to set the busy poll time on client handle ");
+						temp.append(clientSession->getClientHandle()).append(CR)
+							.append("Instance Name ").append(ommServerBase->getInstanceName()).append(CR)
+							.append("Error Id ").append(rsslErrorInfo.rsslError.rsslErrorId).append(CR)
+							.append("Internal sysError ").append(rsslErrorInfo.rsslError.sysError).append(CR)
+							.append("Error Text ").append(rsslErrorInfo.rsslError.text);
+						ommServerBase->getOmmLoggerClient().log(_clientName, OmmLoggerClient::WarningEnum, temp.trimWhitespace());
+					}
+				}
+			}
+
 			ActiveServerConfig& activeConfig = ommServerBase->getActiveConfig();
 			if (activeConfig.xmlTraceToFile || activeConfig.xmlTraceToStdout)
 			{
@@ -144,6 +144,29 @@ bool Thread::setPriority( Int64 pri )
 	return false;
 }
 
+bool Thread::bindCpu( Int64 cpuId )
+{
+	if ( !_isActive || cpuId < 0 )
+		return false;
+
+#ifdef WIN32
+	if ( cpuId >= (Int64)( sizeof( DWORD_PTR ) * 8 ) )
+		return false;
+
+	return SetThreadAffinityMask( _handle, ( (DWORD_PTR)1 ) << cpuId ) != 0;
+#elif defined(Linux)
+	if ( cpuId >= CPU_SETSIZE )
+		return false;
+
+	cpu_set_t cpuSet;
+	CPU_ZERO( &cpuSet );
+	CPU_SET( (int)cpuId, &cpuSet );
+	return pthread_setaffinity_np( _threadId, sizeof( cpu_set_t ), &cpuSet ) == 0;
+#else
+	return false;
+#endif
+}
+
 void Thread::sleep( UInt64 millisecs )
 {
 #ifdef WIN32
@@ -44,6 +44,8 @@ public :
 
 	virtual bool setPriority( Int64 );
 
+	virtual bool bindCpu( Int64 cpuId );
+
 	virtual void sleep( UInt64 sleepTime );
 
 protected:
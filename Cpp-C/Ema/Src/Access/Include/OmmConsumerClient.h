@@ -133,6 +133,20 @@ public :
 		@return void
 	*/
 	virtual void onAllMsg( const Msg& msg, const OmmConsumerEvent& consumerEvent ) {}
+
+	/** Invoked with the update messages collected during one dispatch cycle.
+		Invoked only when the UpdateBatchSize configuration parameter is greater than zero;
+		otherwise each update message is delivered through onAllMsg() and onUpdateMsg().
+		Only update messages received on single item streams are batched; all other messages are
+		delivered individually and in order with respect to the batched updates.
+		The default implementation invokes onAllMsg() and onUpdateMsg() for every entry.
+		\remark the passed in messages and events are valid only for the duration of this call
+		@param[out] updateMsgs array of received update messages
+		@param[out] consumerEvents array of events, identifying open items for the matching entries of updateMsgs
+		@param[out] count number of entries in both arrays
+		@return void
+	*/
+	virtual void onUpdateMsgBatch( const UpdateMsg* const* updateMsgs, const OmmConsumerEvent* const* consumerEvents, UInt32 count );
 	//@}
 
 protected :
@@ -61,6 +61,7 @@ public :
 private :
 
 	friend class ConsumerItem;
+	friend class ItemCallbackClient;
 
 	UInt64			_handle;
 	UInt64			_parentHandle;
@@ -290,6 +290,9 @@ public :
 		@return void
 		@throw OmmInvalidHandleException if passed in handle does not refer to an open stream
 		\remark This method is \ref ObjectLevelSafe
+		\remark For interactive providers, a handle of 0 on a non-administrative domain sends the UpdateMsg
+		to every open stream whose request matches the message's domain type, service and name. The message
+		is encoded once and only its stream id differs per stream; its message key is not sent.
 	*/
 	void submit( const UpdateMsg& updateMsg, UInt64 handle );
 	
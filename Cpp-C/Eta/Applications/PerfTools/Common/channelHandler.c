@@ -128,7 +128,10 @@ RsslRet channelHandlerReadChannel(ChannelHandler *pHandler, ChannelInfo *pChanne
 	do
 	{
 		RsslBuffer *pMsgBuf;
-		if (pMsgBuf = rsslReadEx(pChannelInfo->pChannel,&readInArgs,&readOutArgs,&ret,&error))
+		pMsgBuf = rsslReadEx(pChannelInfo->pChannel,&readInArgs,&readOutArgs,&ret,&error);
+		countStatAdd(&pHandler->transportReads, readOutArgs.transportReads);
+
+		if (pMsgBuf)
 		{
 			/* Mark that we received data for ping timeout handling. */
 			pChannelInfo->receivedMsg = RSSL_TRUE;
@@ -13,6 +13,7 @@
 #define _CHANNEL_HANDLER_H
 
 #include "getTime.h"
+#include "statistics.h"
 
 #include "rtr/rsslQueue.h"
 
@@ -69,6 +70,7 @@ struct _ChannelHandler {
 	void					*pUserSpec;					/* Pointer to application-specified data. */
 	ChannelActiveCallback	*channelActiveCallback;		/* Function to be called when a channel finishes initializing and becomes active. */
 	ChannelInactiveCallback	*channelInactiveCallback;	/* Function to be called when a channel is closed. */
+	CountStat				transportReads;				/* Transport reads made by rsslReadEx() on these channels. */
 };
 
 /* Requests that the ChannelHandler begin calling rsslFlush() for a channel.  Used when a call to rsslWrite()
@@ -91,6 +93,7 @@ RTR_C_INLINE void initChannelHandler(ChannelHandler *pHandler,
 	pHandler->channelInactiveCallback = channelInactiveCallback;
 	pHandler->msgCallback = msgCallback;
 	pHandler->pUserSpec = pUserSpec;
+	initCountStat(&pHandler->transportReads);
 }
 
 /* Cleans up a ChannelHandler. */
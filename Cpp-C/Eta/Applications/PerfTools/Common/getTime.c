@@ -29,6 +29,13 @@ TimeValue getTimeMilli()
 	return(gethrtime()/1000000L);
 }
 
+TimeValue getSystemTimeNano()
+{
+	struct timeval tv;
+	gettimeofday(&tv,0);
+	return (TimeValue)tv.tv_sec * 1000000000ULL + (TimeValue)tv.tv_usec * 1000ULL;
+}
+
 #elif defined(Linux)
 
 #include <time.h>
@@ -89,6 +96,24 @@ TimeValue getTimeMilli()
 	return(ret);
 }
 
+TimeValue getSystemTimeNano()
+{
+	TimeValue	ret;
+	struct timespec	ts;
+
+	if ( clock_gettime(CLOCK_REALTIME,&ts) == 0)
+	{
+		ret = (TimeValue)ts.tv_sec * 1000000000ULL + (TimeValue)ts.tv_nsec;
+	}
+	else
+	{
+		struct timeval tv;
+		gettimeofday(&tv,0);
+		ret = (TimeValue)tv.tv_sec * 1000000000ULL + (TimeValue)tv.tv_usec * 1000ULL;
+	}
+	return(ret);
+}
+
 #else /* Windows */
 #include <Windows.h>
 
@@ -156,4 +181,16 @@ TimeValue getTimeMilli()
 	return( (TimeValue)ret );
 }
 
+TimeValue getSystemTimeNano()
+{
+	FILETIME		fileTime;
+	ULARGE_INTEGER	time;
+
+	/* FILETIME counts 100-nanosecond intervals since 1601. */
+	GetSystemTimeAsFileTime(&fileTime);
+	time.LowPart = fileTime.dwLowDateTime;
+	time.HighPart = fileTime.dwHighDateTime;
+	return( (TimeValue)(time.QuadPart - 116444736000000000ULL) * 100ULL );
+}
+
 #endif
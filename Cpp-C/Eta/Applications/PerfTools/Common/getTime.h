@@ -32,6 +32,10 @@ TimeValue getTimeMicro();
 /* Get current time value in milliseconds. */
 TimeValue getTimeMilli();
 
+/* Get the current system(wall-clock) time in nanoseconds since the epoch. This is the clock used
+ * by transport receive timestamps(see RSSL_RECV_TIMESTAMPS). */
+TimeValue getSystemTimeNano();
+
 #if defined(__cplusplus)
 }
 #endif
@@ -163,7 +163,13 @@ RsslRet encodeItemUpdate(RsslChannel* chnl,
 			if ((ret = rsslEncodeMsgInit(&encodeIter, (RsslMsg*)&updateMsg, 0)) < RSSL_RET_SUCCESS)
 				return ret;
 
-			if ((ret = encodeMarketPriceDataBody(&encodeIter, 
+			if (marketPriceUpdateSource)
+			{
+				if ((ret = marketPriceUpdateSource->encodeUpdateDataBody(&encodeIter, 
+								(MarketPriceItem*)itemInfo->itemData, encodeStartTime)) < RSSL_RET_SUCCESS)
+					return ret;
+			}
+			else if ((ret = encodeMarketPriceDataBody(&encodeIter, 
 							getNextMarketPriceUpdate((MarketPriceItem*)itemInfo->itemData),
 							RSSL_MC_UPDATE, encodeStartTime)) < RSSL_RET_SUCCESS)
 				return ret;
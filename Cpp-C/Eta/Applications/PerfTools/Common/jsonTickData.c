@@ -0,0 +1,197 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's 
+ * LICENSE.md for details. 
+ * Copyright Thomson Reuters 2018. All rights reserved.
+*/
+
+#include "jsonTickData.h"
+#include "xmlMsgDataParser.h"
+#include "rtr/rsslJsonConverter.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define JSON_ERR_STR "Error: jsonTickData: "
+
+/* Room for the latency field that may be added to each update. */
+#define JSON_TICK_LATENCY_FIELD_LENGTH 16
+
+RsslBool jsonTickDataLoaded = RSSL_FALSE;
+RsslInt32 jsonTickCount = 0;
+JsonTick *jsonTicks = NULL;
+
+static char *jsonTickFileData = NULL;
+
+static RsslUInt32 getNextJsonTickEstimatedContentLength(MarketPriceItem *mpItem)
+{
+	return jsonTicks[mpItem->iSourceMsg].estimatedContentLength;
+}
+
+/* Encodes the item's next tick as a MarketPrice update payload. */
+static RsslRet encodeNextJsonTickDataBody(RsslEncodeIterator *pIter, MarketPriceItem *mpItem,
+		RsslUInt encodeStartTime)
+{
+	JsonTick *pTick = &jsonTicks[mpItem->iSourceMsg++];
+	RsslFieldList fList;
+	RsslFieldEntry fEntry;
+	RsslRet ret;
+
+	if (mpItem->iSourceMsg == jsonTickCount) mpItem->iSourceMsg = 0;
+
+	/* encode field list */
+	rsslClearFieldList(&fList);
+	rsslClearFieldEntry(&fEntry);
+	fList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+	if ((ret = rsslEncodeFieldListInit(pIter, &fList, 0, 0)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	/* The tick was checked when it was loaded, so no error text is needed. */
+	if ((ret = rsslConvertJsonToFieldEntries(pIter, &pTick->json, &dictionary, NULL)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if (encodeStartTime)
+	{
+		/* Encode the latency timestamp. */
+		fEntry.fieldId = TIM_TRK_1_FID;
+		fEntry.dataType = RSSL_DT_UINT;
+		if ((ret = rsslEncodeFieldEntry(pIter, &fEntry, (void*)&encodeStartTime)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	/* complete encode field list */
+	if ((ret = rsslEncodeFieldListComplete(pIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	return RSSL_RET_SUCCESS;
+}
+
+static MarketPriceUpdateSource jsonTickUpdateSource = 
+{
+	getNextJsonTickEstimatedContentLength,
+	encodeNextJsonTickDataBody
+};
+
+/* Encodes the tick into a field list, to check it and measure its encoded size. */
+static RsslRet encodeJsonTick(JsonTick *pTick, RsslBuffer *pEncodeBuffer, RsslBuffer *pErrorText)
+{
+	RsslEncodeIterator encodeIter;
+	RsslFieldList fList;
+	RsslBuffer buffer = *pEncodeBuffer;
+	RsslRet ret;
+
+	rsslClearEncodeIterator(&encodeIter);
+	rsslSetEncodeIteratorBuffer(&encodeIter, &buffer);
+
+	rsslClearFieldList(&fList);
+	fList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+	if ((ret = rsslEncodeFieldListInit(&encodeIter, &fList, 0, 0)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if ((ret = rsslConvertJsonToFieldEntries(&encodeIter, &pTick->json, &dictionary, pErrorText)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if ((ret = rsslEncodeFieldListComplete(&encodeIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	pTick->estimatedContentLength = rsslGetEncodedBufferLength(&encodeIter) + JSON_TICK_LATENCY_FIELD_LENGTH;
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet jsonTickDataInit(char *filename)
+{
+	FILE *file;
+	long fileLength;
+	char *pLine, *pEnd, *pLineEnd;
+	char encodeData[65535], errTxt[256];
+	RsslBuffer encodeBuffer = { sizeof(encodeData), encodeData };
+	RsslBuffer errorText;
+	RsslInt32 lineNumber;
+	RsslRet ret;
+
+	if (!(file = fopen(filename, "rb")))
+		return (printf(JSON_ERR_STR "Unable to open tick file '%s'.\n", filename), RSSL_RET_FAILURE);
+
+	if (fseek(file, 0, SEEK_END) != 0 || (fileLength = ftell(file)) < 0 || fseek(file, 0, SEEK_SET) != 0)
+		return (printf(JSON_ERR_STR "Unable to read tick file '%s'.\n", filename), fclose(file), RSSL_RET_FAILURE);
+
+	jsonTickFileData = (char*)malloc(fileLength + 1);
+	if (!jsonTickFileData)
+	{
+		printf("malloc of jsonTickFileData failed.\n");
+		abort();
+	}
+
+	if (fread(jsonTickFileData, 1, fileLength, file) != (size_t)fileLength)
+		return (printf(JSON_ERR_STR "Unable to read tick file '%s'.\n", filename), fclose(file), RSSL_RET_FAILURE);
+	fclose(file);
+
+	/* Count the lines, to size the list. */
+	jsonTickCount = 0;
+	pEnd = jsonTickFileData + fileLength;
+	for (pLine = jsonTickFileData; pLine < pEnd; ++pLine)
+		if (*pLine == '\n') ++jsonTickCount;
+
+	jsonTicks = (JsonTick*)malloc((jsonTickCount + 1) * sizeof(JsonTick));
+	if (!jsonTicks)
+	{
+		printf("malloc of jsonTicks failed.\n");
+		abort();
+	}
+
+	/* Each non-empty line is a tick. */
+	jsonTickCount = 0;
+	lineNumber = 0;
+	for (pLine = jsonTickFileData; pLine < pEnd; pLine = pLineEnd + 1)
+	{
+		JsonTick *pTick = &jsonTicks[jsonTickCount];
+
+		++lineNumber;
+		if (!(pLineEnd = (char*)memchr(pLine, '\n', pEnd - pLine)))
+			pLineEnd = pEnd;
+
+		pTick->json.data = pLine;
+		pTick->json.length = (RsslUInt32)(pLineEnd - pLine);
+		while (pTick->json.length > 0 && (pLine[pTick->json.length - 1] == '\r' || pLine[pTick->json.length - 1] == ' '))
+			--pTick->json.length;
+
+		if (pTick->json.length == 0)
+			continue;
+
+		errorText.data = errTxt;
+		errorText.length = sizeof(errTxt);
+		errTxt[0] = '\0';
+		if ((ret = encodeJsonTick(pTick, &encodeBuffer, &errorText)) < RSSL_RET_SUCCESS)
+		{
+			printf(JSON_ERR_STR "%s line %d: %s (%s)\n", filename, lineNumber, errTxt, rsslRetCodeToString(ret));
+			jsonTickDataCleanup();
+			return RSSL_RET_FAILURE;
+		}
+
+		++jsonTickCount;
+	}
+
+	if (jsonTickCount == 0)
+	{
+		printf(JSON_ERR_STR "No ticks found in '%s'.\n", filename);
+		jsonTickDataCleanup();
+		return RSSL_RET_FAILURE;
+	}
+
+	jsonTickDataLoaded = RSSL_TRUE;
+	marketPriceUpdateSource = &jsonTickUpdateSource;
+	return RSSL_RET_SUCCESS;
+}
+
+void jsonTickDataCleanup()
+{
+	free(jsonTicks);
+	free(jsonTickFileData);
+	jsonTicks = NULL;
+	jsonTickFileData = NULL;
+	jsonTickCount = 0;
+	jsonTickDataLoaded = RSSL_FALSE;
+	if (marketPriceUpdateSource == &jsonTickUpdateSource)
+		marketPriceUpdateSource = NULL;
+}
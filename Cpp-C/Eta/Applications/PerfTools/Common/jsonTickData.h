@@ -0,0 +1,51 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's 
+ * LICENSE.md for details. 
+ * Copyright Thomson Reuters 2018. All rights reserved.
+*/
+
+/* jsonTickData.h
+ * Loads MarketPrice update payloads from a file of JSON ticks, for publishing through the 
+ * JSON-to-RWF encoder. Each line of the file is one JSON object of fields, keyed by acronym, 
+ * e.g. {"BID":99.96,"ASK":100.02,"TRDTIM_1":"14:02:33.125"} */
+
+#ifndef _JSON_TICK_DATA_H
+#define _JSON_TICK_DATA_H
+
+#include "marketPriceEncoder.h"
+#include "rtr/rsslMessagePackage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* One tick from the file. */
+typedef struct {
+	RsslBuffer	json;						/* JSON text of the tick. */
+	RsslUInt32	estimatedContentLength;		/* Estimated size of the encoded payload. */
+} JsonTick;
+
+/* Whether JSON ticks have been loaded. When they have, MarketPrice updates are encoded 
+ * from them instead of from the XML message data. */
+extern RsslBool jsonTickDataLoaded;
+
+/* Number of ticks loaded. */
+extern RsslInt32 jsonTickCount;
+
+/* List of ticks loaded. */
+extern JsonTick *jsonTicks;
+
+/* Loads the ticks from the file, and checks that each one encodes with the global dictionary. 
+ * MarketPrice updates are then encoded from the ticks, through marketPriceUpdateSource.
+ * Call after xmlMsgDataInit(), which loads the dictionary. */
+RsslRet jsonTickDataInit(char *filename);
+
+/* Cleans up memory associated with the ticks. */
+void jsonTickDataCleanup();
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
@@ -12,8 +12,13 @@
 
 #include <assert.h>
 
+MarketPriceUpdateSource *marketPriceUpdateSource = NULL;
+
 RsslUInt32 getNextMarketPriceUpdateEstimatedContentLength(MarketPriceItem *mpItem)
 {
+	if (marketPriceUpdateSource)
+		return marketPriceUpdateSource->estimateUpdateContentLength(mpItem);
+
 	return xmlMarketPriceMsgs.updateMsgs[mpItem->iMsg].estimatedContentLength;
 }
 
@@ -24,8 +24,22 @@ extern "C" {
 /* market price item data */
 typedef struct {
 	RsslInt32		iMsg;
+	RsslInt32		iSourceMsg;		/* Next update to publish from marketPriceUpdateSource, if set. */
 } MarketPriceItem;
 
+/* Provides MarketPrice update payloads in place of the XML message data (see jsonTickData.h). */
+typedef struct {
+	/* Estimates the size of the item's next update payload. */
+	RsslUInt32 (*estimateUpdateContentLength)(MarketPriceItem *mpItem);
+
+	/* Encodes the item's next update payload(moves over the list). */
+	RsslRet (*encodeUpdateDataBody)(RsslEncodeIterator *pIter, MarketPriceItem *mpItem,
+			RsslUInt encodeStartTime);
+} MarketPriceUpdateSource;
+
+/* If set, MarketPrice updates are encoded from this source instead of from the XML message data. */
+extern MarketPriceUpdateSource *marketPriceUpdateSource;
+
 /* Encodes a MarketPrice data body for a message. */
 RsslRet encodeMarketPriceDataBody(RsslEncodeIterator *pIter, MarketPriceMsg *mpMsg,
 		RsslMsgClasses msgClass, RsslUInt encodeStartTime);
@@ -34,6 +48,7 @@ RsslRet encodeMarketPriceDataBody(RsslEncodeIterator *pIter, MarketPriceMsg *mpM
 RTR_C_INLINE void clearMarketPriceItem(MarketPriceItem* itemInfo)
 {
 	itemInfo->iMsg = 0;
+	itemInfo->iSourceMsg = 0;
 }
 
 
@@ -7,6 +7,7 @@
 
 #include "providerThreads.h"
 #include "directoryProvider.h"
+#include "jsonTickData.h"
 #include "testUtils.h"
 #include "provPerfConfig.h"
 #include "niProvPerfConfig.h"
@@ -45,8 +46,11 @@ void clearProviderThreadConfig()
 	providerThreadConfig.writeFlags = 0;
 	snprintf(providerThreadConfig.itemFilename, sizeof(providerThreadConfig.itemFilename), "350k.xml");
 	snprintf(providerThreadConfig.msgFilename, sizeof(providerThreadConfig.msgFilename), "MsgData.xml");
+	snprintf(providerThreadConfig.jsonTickFilename, sizeof(providerThreadConfig.jsonTickFilename), "");
 	providerThreadConfig.threadBindList = defaultThreadBindList;
 	providerThreadConfig.threadCount = defaultThreadCount;
+	providerThreadConfig.workerThreadBindList = NULL;
+	providerThreadConfig.workerThreadCount = 0;
 	snprintf(providerThreadConfig.statsFilename, sizeof(providerThreadConfig.statsFilename), "ProvStats");
 	snprintf(providerThreadConfig.latencyLogFilename, sizeof(providerThreadConfig.latencyLogFilename), "");
 	providerThreadConfig.logLatencyToFile = RSSL_FALSE;
@@ -170,6 +174,10 @@ void providerThreadConfigInit()
 	if (xmlMsgDataInit(providerThreadConfig.msgFilename) != RSSL_RET_SUCCESS)
 		exit(-1);
 
+	if (providerThreadConfig.jsonTickFilename[0] != '\0'
+			&& jsonTickDataInit(providerThreadConfig.jsonTickFilename) != RSSL_RET_SUCCESS)
+		exit(-1);
+
 	directoryServiceInit();
 }
 
@@ -180,33 +188,14 @@ void providerThreadInit(ProviderThread *pProvThread,
 		RsslInt32 providerIndex,
 		ProviderType providerType)
 {
-	char errTxt[256];
-	RsslBuffer errorText = {255, (char*)errTxt};
 	char tmpFilename[sizeof(providerThreadConfig.statsFilename) + 8];
 
 	timeRecordQueueInit(&pProvThread->genMsgLatencyRecords);
 
-	/* Load dictionary from file if possible. */
-	pProvThread->pDictionary = NULL;
-	pProvThread->pDictionary = (RsslDataDictionary*)malloc(sizeof(RsslDataDictionary));
-	rsslClearDataDictionary(pProvThread->pDictionary);
-	if (rsslLoadFieldDictionary("RDMFieldDictionary", pProvThread->pDictionary, &errorText) < 0)
-	{
-		printf("Unable to load field dictionary: %s.\n"
-				"Will request dictionaries from provider.\n\n" , errorText.data);
-	}
-	else if (rsslLoadEnumTypeDictionary("enumtype.def", pProvThread->pDictionary, &errorText) < 0)
-	{
-		printf("\nUnable to load enum type dictionary: %s\n", errorText.data);
-		printf("Unable to load enum type dictionary: %s.\n\n"
-				"Will request dictionaries from provider.\n" , errorText.data);
-	}
-	else
-	{
-		/* Dictionary successfully loaded. */
-		pProvThread->dictionaryStateFlags =
-			(DictionaryStateFlags)(DICTIONARY_STATE_HAVE_FIELD_DICT | DICTIONARY_STATE_HAVE_ENUM_DICT);
-	}
+	/* Use the dictionary loaded with the message data. It is shared, read-only, by all threads. */
+	pProvThread->pDictionary = &dictionary;
+	pProvThread->dictionaryStateFlags =
+		(DictionaryStateFlags)(DICTIONARY_STATE_HAVE_FIELD_DICT | DICTIONARY_STATE_HAVE_ENUM_DICT);
 
 	provStatsInit(&totalStats);
 
@@ -278,6 +267,7 @@ void providerThreadInit(ProviderThread *pProvThread,
 	initChannelHandler(&pProvThread->channelHandler, processActiveChannel, processInactiveChannel, processMsg, (void*)pProvThread);
 
 	pProvThread->cpuId = -1;
+	pProvThread->workerCpuId = -1;
 
 	latencyRandomArrayIterInit(&pProvThread->randArrayIter);
 
@@ -288,11 +278,6 @@ void providerThreadInit(ProviderThread *pProvThread,
 static void providerThreadCleanup(ProviderThread *pProvThread)
 {
 	timeRecordQueueCleanup(&pProvThread->genMsgLatencyRecords);
-	if (pProvThread->pDictionary)
-	{
-		rsslDeleteDataDictionary(pProvThread->pDictionary);
-		free(pProvThread->pDictionary);
-	}
 
 	channelHandlerCleanup(&pProvThread->channelHandler);
 
@@ -306,6 +291,7 @@ void providerThreadConfigCleanup()
 {
 	cleanupLatencyRandomArray(&providerThreadConfig._latencyUpdateRandomArray);
 	cleanupLatencyRandomArray(&providerThreadConfig._latencyGenMsgRandomArray);
+	jsonTickDataCleanup();
 	xmlMsgDataCleanup();
 }
 
@@ -327,6 +313,7 @@ ProviderSession *providerSessionCreate(ProviderThread *pProvThread, RsslChannel
 	pSession->packedBufferCount = 0;
 	pSession->timeActivated = 0;
 	pSession->lastWriteRet = 0;
+	pSession->reactorBuffersWritten = 0;
 
 
 	hashTableInit(&pSession->itemAttributesTable, 
@@ -1085,7 +1072,20 @@ static RsslRet writeCurrentBuffer(ProviderThread *pProvThread, ProviderSession *
 		}
 	}
 
-	countStatIncr(&pProvThread->bufferSentCount);
+	if (provPerfConfig.packingLatencyBudget == 0)
+		countStatIncr(&pProvThread->bufferSentCount);
+	else
+	{
+		/* The reactor decides when to write the messages it packs, so take the count of buffers from it. */
+		RsslErrorInfo errorInfo;
+		RsslReactorPackingStats packingStats;
+
+		if (rsslReactorGetPackingStats(pProvThread->pReactor, pSession->pChannelInfo->pReactorChannel, &packingStats, &errorInfo) == RSSL_RET_SUCCESS)
+		{
+			countStatAdd(&pProvThread->bufferSentCount, packingStats.buffersWritten - pSession->reactorBuffersWritten);
+			pSession->reactorBuffersWritten = packingStats.buffersWritten;
+		}
+	}
 
 	if (ret >= RSSL_RET_SUCCESS)
 	{
@@ -1251,14 +1251,43 @@ RsslRet sendItemMsgBuffer(ProviderThread *pProvThread, ProviderSession *pSession
 	}
 }
 
-RsslRet providerSessionAddPublishingItems(ProviderThread *pProvThread, ProviderSession *pSession, RsslInt32 commonItemCount, RsslInt32 itemListUniqueIndex, RsslInt32 uniqueItemCount, RsslUInt16 serviceId)
+/* Adds an item from the item list to the items published on a session. */
+static RsslRet providerSessionAddPublishingItem(ProviderThread *pProvThread, ProviderSession *pSession, XmlItemInfo *pXmlItemInfo, RsslInt32 streamId, RsslUInt16 serviceId)
 {
-	RsslInt32 i, itemListIndex;
 	ItemInfo *itemInfo;
-	XmlItemInfoList *pXmlItemInfoList;
 	RsslItemAttributes attributes;
 	RsslMsgKey msgKey;
 
+	attributes.pMsgKey = &msgKey;
+
+	rsslClearMsgKey(&msgKey);
+	msgKey.flags = RSSL_MKF_HAS_NAME_TYPE | RSSL_MKF_HAS_NAME | RSSL_MKF_HAS_SERVICE_ID;
+	msgKey.nameType = RDM_INSTRUMENT_NAME_TYPE_RIC;
+	msgKey.serviceId = serviceId;
+	msgKey.name.data = pXmlItemInfo->name;
+	msgKey.name.length = pXmlItemInfo->nameLength;
+	attributes.domainType = pXmlItemInfo->domainType;
+
+	itemInfo = createItemInfo(pProvThread, pSession, &attributes, streamId);
+
+	if (!itemInfo)
+	{
+		printf("createItemInfo() failed\n");
+		return RSSL_RET_FAILURE;
+	}
+	itemInfo->itemFlags = ITEM_IS_STREAMING_REQ;
+
+	hashTableInsertLink(&pSession->itemAttributesTable, &itemInfo->itemAttributesTableLink, &itemInfo->attributes) ;
+	hashTableInsertLink(&pSession->itemStreamIdTable, &itemInfo->itemStreamIdTableLink, &itemInfo->StreamId) ;
+
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet providerSessionAddPublishingItems(ProviderThread *pProvThread, ProviderSession *pSession, RsslInt32 commonItemCount, RsslInt32 itemListUniqueIndex, RsslInt32 uniqueItemCount, RsslUInt16 serviceId)
+{
+	RsslInt32 i, itemListIndex;
+	XmlItemInfoList *pXmlItemInfoList;
+
 	assert(!uniqueItemCount || itemListUniqueIndex >= commonItemCount);
 
 	pXmlItemInfoList = createXmlItemList(providerThreadConfig.itemFilename, itemListUniqueIndex + uniqueItemCount);
@@ -1270,8 +1299,6 @@ RsslRet providerSessionAddPublishingItems(ProviderThread *pProvThread, ProviderS
 	}
 
 
-	attributes.pMsgKey = &msgKey;
-
 	itemListIndex = 0;
 	for (i = 0; i < commonItemCount + uniqueItemCount; ++i)
 	{
@@ -1285,26 +1312,12 @@ RsslRet providerSessionAddPublishingItems(ProviderThread *pProvThread, ProviderS
 				&& itemListIndex < itemListUniqueIndex)
 			itemListIndex = itemListUniqueIndex;
 
-		rsslClearMsgKey(&msgKey);
-		msgKey.flags = RSSL_MKF_HAS_NAME_TYPE | RSSL_MKF_HAS_NAME | RSSL_MKF_HAS_SERVICE_ID;
-		msgKey.nameType = RDM_INSTRUMENT_NAME_TYPE_RIC;
-		msgKey.serviceId = serviceId;
-		msgKey.name.data = pXmlItemInfoList->itemInfoList[itemListIndex].name;
-		msgKey.name.length = pXmlItemInfoList->itemInfoList[itemListIndex].nameLength;
-		attributes.domainType = pXmlItemInfoList->itemInfoList[itemListIndex].domainType;
-
-		itemInfo = createItemInfo(pProvThread, pSession, &attributes, -i-6);
-
-		if (!itemInfo)
+		if (providerSessionAddPublishingItem(pProvThread, pSession, &pXmlItemInfoList->itemInfoList[itemListIndex], 
+					-i-6, serviceId) != RSSL_RET_SUCCESS)
 		{
-			printf("createItemInfo() failed\n");
 			destroyXmlItemList(pXmlItemInfoList);
 			return RSSL_RET_FAILURE;
 		}
-		itemInfo->itemFlags = ITEM_IS_STREAMING_REQ;
-
-		hashTableInsertLink(&pSession->itemAttributesTable, &itemInfo->itemAttributesTableLink, &itemInfo->attributes) ;
-		hashTableInsertLink(&pSession->itemStreamIdTable, &itemInfo->itemStreamIdTableLink, &itemInfo->StreamId) ;
 
 		++itemListIndex;
 	}
@@ -1315,6 +1328,60 @@ RsslRet providerSessionAddPublishingItems(ProviderThread *pProvThread, ProviderS
 
 }
 
+/* Hashes an item name to choose the session that publishes it. */
+static RsslUInt32 hashItemName(const char *name, RsslUInt32 length)
+{
+	/* FNV-1a */
+	RsslUInt32 hash = 2166136261U;
+	RsslUInt32 i;
+
+	for (i = 0; i < length; ++i)
+	{
+		hash ^= (unsigned char)name[i];
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+RsslRet providerSessionAddPublishingItemsByHash(ProviderThread *pProvThread, ProviderSession *pSession, RsslInt32 commonItemCount, RsslInt32 itemCount, RsslInt32 sessionIndex, RsslInt32 sessionCount, RsslUInt16 serviceId)
+{
+	RsslInt32 i, streamIndex = 0;
+	XmlItemInfoList *pXmlItemInfoList;
+
+	assert(sessionIndex < sessionCount);
+
+	pXmlItemInfoList = createXmlItemList(providerThreadConfig.itemFilename, itemCount);
+
+	if (!pXmlItemInfoList)
+	{
+		printf("Failed to load item file '%s'.\n", providerThreadConfig.itemFilename);
+		return RSSL_RET_FAILURE;
+	}
+
+	for (i = 0; i < itemCount; ++i)
+	{
+		XmlItemInfo *pXmlItemInfo = &pXmlItemInfoList->itemInfoList[i];
+
+		/* Common items are published on every session; each of the others on one session, chosen by its name. */
+		if (i >= commonItemCount 
+				&& hashItemName(pXmlItemInfo->name, pXmlItemInfo->nameLength) % (RsslUInt32)sessionCount != (RsslUInt32)sessionIndex)
+			continue;
+
+		if (providerSessionAddPublishingItem(pProvThread, pSession, pXmlItemInfo, -streamIndex-6, serviceId) != RSSL_RET_SUCCESS)
+		{
+			destroyXmlItemList(pXmlItemInfoList);
+			return RSSL_RET_FAILURE;
+		}
+
+		++streamIndex;
+	}
+
+	destroyXmlItemList(pXmlItemInfoList);
+
+	return RSSL_RET_SUCCESS;
+}
+
 void providerThreadSendNewChannel(ProviderThread *pProvThread, RsslChannel *pChannel)
 {
 	NewChannel *pNewChannel = (NewChannel*)malloc(sizeof(NewChannel)); assert(pNewChannel);
@@ -1395,6 +1462,8 @@ void providerInit(Provider *pProvider, ProviderType providerType,
 				processActiveChannel, processInactiveChannel, processMsg,
 				i, providerType);
 		pProvider->providerThreadList[i].cpuId = providerThreadConfig.threadBindList[i];
+		if (i < providerThreadConfig.workerThreadCount)
+			pProvider->providerThreadList[i].workerCpuId = providerThreadConfig.workerThreadBindList[i];
 	}
 
 	if (initResourceUsageStats(&pProvider->resourceStats) != RSSL_RET_SUCCESS)
@@ -1602,7 +1671,7 @@ void providerCollectStats(Provider *pProvider, RsslBool writeStats, RsslBool dis
 		countStatAdd(&pProvider->outOfBuffersCount, outOfBuffersCount);
 
 		/* Take packing stats, if packing is enabled. */
-		if (providerThreadConfig.totalBuffersPerPack > 1)
+		if (providerThreadConfig.totalBuffersPerPack > 1 || provPerfConfig.packingLatencyBudget > 0)
 		{
 			countStatAdd(&pProvider->msgSentCount, countStatGetChange(&pProviderThread->msgSentCount));
 			countStatAdd(&pProvider->bufferSentCount, countStatGetChange(&pProviderThread->bufferSentCount));
@@ -54,6 +54,7 @@ typedef struct
 	RsslInt32	latencyGenMsgsPerSec;		/* Total latency generic messages rate per second */
 	char		itemFilename[128];			/* Item List file. Provides a list of items to open. */
 	char		msgFilename[128];			/* Data file. Describes the data to use when encoding messages. */
+	char		jsonTickFilename[128];		/* JSON tick file. If set, MarketPrice updates are encoded from its ticks. See -jsonTickFile. */
 	RsslBool	logLatencyToFile;			/* Whether to log genMsg latency information to a file. See -latencyFile. */
 	char		latencyLogFilename[128];	/* Name of the latency log file. See -latencyFile. */
 	RsslInt32	_updatesPerTick;			/* Updates per tick */
@@ -73,6 +74,8 @@ typedef struct
 
 	RsslInt32	*threadBindList;			/* List of CPU ID's to bind threads to */
 	RsslInt32	threadCount;				/* Number of provider threads to create. */
+	RsslInt32	*workerThreadBindList;		/* List of CPU ID's to bind reactor worker threads to */
+	RsslInt32	workerThreadCount;			/* Number of entries in workerThreadBindList. */
 	char		statsFilename[128];			/* Name of the statistics log file*/
 	RsslUInt8	writeFlags;
 } ProviderThreadConfig;
@@ -137,6 +140,7 @@ typedef struct
 	RsslInt32				clientSessionsCount;	/* Number of channels in use. */
 	RsslThreadId			threadId;				/* Thread ID. */
 	RsslInt32				cpuId;					/* CPU to bind to, if any. */
+	RsslInt32				workerCpuId;			/* CPU to bind the reactor worker to, if any. */
 	ChannelHandler			channelHandler;			/* Channel handler. */
 	LatencyRandomArrayIter	randArrayIter;			/* Iterator for the randomized latency array. */
 	FILE					*statsFile;				/* Statistics file for recording. */
@@ -174,6 +178,7 @@ typedef struct {
 	RsslInt32		packedBufferCount;		/* Total number of buffers currently packed in pWritingBuffer */
 	TimeValue		timeActivated;			/* Time at which this channel was fully setup. */
 	RsslRet			lastWriteRet;			/* Last return from an rsslWrite call. */
+	RsslUInt64		reactorBuffersWritten;	/* Buffers written by the reactor, when it is packing messages. See -packLatencyBudget */
 
 	RsslBuffer		*preEncMarketPriceMsgs;		/* Buffer of a pre-encoded market price message, if sending pre-encoded items;  This is allocated per-channel in case the versions are different */
 	RsslBuffer		*preEncMarketByOrderMsgs;	/* Buffer of a pre-encoded market by order message, if sending pre-encoded items;  This is allocated per-channel in case the versions are different */
@@ -223,6 +228,13 @@ RsslRet providerSessionAddPublishingItems(ProviderThread *pProvThread, ProviderS
 		RsslInt32 commonItemCount, RsslInt32 itemListUniqueIndex, RsslInt32 uniqueItemCount, 
 		RsslUInt16 serviceId);
 
+/* For Non-Interactive Providers.  Reads in the first itemCount items from the configured XML file, 
+ * and creates a publishing list of the common items and the items whose names hash to this session
+ * out of sessionCount sessions. */
+RsslRet providerSessionAddPublishingItemsByHash(ProviderThread *pProvThread, ProviderSession *pSession, 
+		RsslInt32 commonItemCount, RsslInt32 itemCount, RsslInt32 sessionIndex, RsslInt32 sessionCount,
+		RsslUInt16 serviceId);
+
 /* Hash sum function for hashing item attributes. */
 static RsslUInt32 hashSumItemAttributes(void *key);
 
@@ -43,6 +43,46 @@ void updateValueStatistics(ValueStatistics *pStats, double newValue)
 		(pStats->_sumOfSquares - pStats->_sum * pStats->_sum / pStats->count) / (pStats->count - 1) : 0;
 }
 
+void updateValueHistogram(ValueHistogram *pHist, double newValue)
+{
+	RsslUInt64 value = newValue > 0 ? (RsslUInt64)(newValue < 9.2e18 ? newValue : 9.2e18) : 0;
+	int shift = 0;
+
+	/* Find the power of two the value falls in, and use its top bits to pick the bucket. */
+	while ((value >> shift) >= VALUE_HISTOGRAM_SUB_BUCKETS)
+		++shift;
+
+	++pHist->buckets[shift * (VALUE_HISTOGRAM_SUB_BUCKETS / 2) + (int)(value >> shift)];
+	++pHist->count;
+}
+
+double getValueHistogramPercentile(ValueHistogram *pHist, double fraction)
+{
+	RsslUInt64 target, total = 0;
+	int i;
+
+	if (!pHist->count)
+		return 0;
+
+	target = (RsslUInt64)(fraction * (double)pHist->count);
+	if (target < 1) target = 1;
+	if (target > pHist->count) target = pHist->count;
+
+	for (i = 0; i < VALUE_HISTOGRAM_BUCKETS; ++i)
+	{
+		total += pHist->buckets[i];
+		if (total >= target)
+		{
+			/* Return the midpoint of the bucket's range. */
+			int shift = (i < VALUE_HISTOGRAM_SUB_BUCKETS) ? 0 : i / (VALUE_HISTOGRAM_SUB_BUCKETS / 2) - 1;
+			RsslUInt64 low = (RsslUInt64)(i - shift * (VALUE_HISTOGRAM_SUB_BUCKETS / 2)) << shift;
+			return (double)low + (double)(((RsslUInt64)1 << shift) - 1) / 2.0;
+		}
+	}
+
+	return 0;
+}
+
 void printValueStatistics(FILE *file, const char *valueStatsName, const char *countUnitName, 
 		ValueStatistics *pStats, RsslBool displayThousandths)
 {
@@ -18,6 +18,7 @@
 #include "rtr/rsslRetCodes.h"
 
 #include <float.h>
+#include <string.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -54,6 +55,29 @@ void updateValueStatistics(ValueStatistics *pStats, double newValue);
 void printValueStatistics(FILE *file, const char *valueStatsName, const char *countUnitName, 
 		ValueStatistics *pStats, RsslBool displayThousandths);
 
+/* Histogram of sample values, used for calculating percentiles such as the median.
+ * Values below VALUE_HISTOGRAM_SUB_BUCKETS are counted exactly. Above that, each power of two
+ * is split into VALUE_HISTOGRAM_SUB_BUCKETS/2 buckets, so a percentile is accurate to within about 3%. */
+#define VALUE_HISTOGRAM_SUB_BUCKETS 64
+#define VALUE_HISTOGRAM_BUCKETS 2048
+
+typedef struct {
+	RsslUInt64		count;								/* Total number of samples. */
+	RsslUInt64		buckets[VALUE_HISTOGRAM_BUCKETS];	/* Sample counts. */
+} ValueHistogram;
+
+/* Clears a ValueHistogram structure. */
+RTR_C_INLINE void clearValueHistogram(ValueHistogram *pHist)
+{
+	memset(pHist, 0, sizeof(ValueHistogram));
+}
+
+/* Adds a sample to the histogram. Negative values are counted as 0 and fractions are dropped. */
+void updateValueHistogram(ValueHistogram *pHist, double newValue);
+
+/* Returns the value below which the given fraction(e.g. 0.99) of samples fall. */
+double getValueHistogramPercentile(ValueHistogram *pHist, double fraction);
+
 /*** Time Statistics. ***/
 
 /* This functionality is used to collect individual time differences
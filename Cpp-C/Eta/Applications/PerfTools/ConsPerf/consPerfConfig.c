@@ -27,6 +27,8 @@ static void clearConsPerfConfig()
 	consPerfConfig.steadyStateTime = 300;
 	consPerfConfig.threadCount = defaultThreadCount;
 	consPerfConfig.threadBindList = defaultThreadBindList;
+	consPerfConfig.workerThreadCount = 0;
+	consPerfConfig.workerThreadBindList = NULL;
 
 	snprintf(consPerfConfig.summaryFilename, sizeof(consPerfConfig.summaryFilename), "ConsSummary.out");
 	snprintf(consPerfConfig.statsFilename, sizeof(consPerfConfig.statsFilename), "ConsStats");
@@ -36,7 +38,10 @@ static void clearConsPerfConfig()
 
 	consPerfConfig.sendBufSize = 0;
 	consPerfConfig.recvBufSize = 0;
+	consPerfConfig.readAheadSize = 0;
 	consPerfConfig.highWaterMark = 0;
+	consPerfConfig.busyPollTime = 0;
+	consPerfConfig.recvTimestampType = RSSL_RECV_TIMESTAMP_NONE;
 	consPerfConfig.tcpNoDelay = RSSL_TRUE;
 	consPerfConfig.connectionType = RSSL_CONN_TYPE_SOCKET;
 	consPerfConfig.guaranteedOutputBuffers = 5000;
@@ -44,6 +49,8 @@ static void clearConsPerfConfig()
 	snprintf(consPerfConfig.interfaceName, sizeof(consPerfConfig.interfaceName), "");
 	snprintf(consPerfConfig.hostName, sizeof(consPerfConfig.hostName), "localhost");
 	snprintf(consPerfConfig.portNo, sizeof(consPerfConfig.portNo), "14002");
+	snprintf(consPerfConfig.standbyHostName, sizeof(consPerfConfig.standbyHostName), "");
+	snprintf(consPerfConfig.standbyPortNo, sizeof(consPerfConfig.standbyPortNo), "");
 	snprintf(consPerfConfig.serviceName, sizeof(consPerfConfig.serviceName), "DIRECT_FEED");
 	snprintf(consPerfConfig.username, sizeof(consPerfConfig.username), "");
 
@@ -107,6 +114,16 @@ void initConsPerfConfig(int argc, char **argv)
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
 			sscanf(argv[iargs++], "%s", consPerfConfig.portNo);
 		}
+		else if(strcmp("-standbyHost", argv[iargs]) == 0)
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs++], "%s", consPerfConfig.standbyHostName);
+		}
+		else if(strcmp("-standbyPort", argv[iargs]) == 0)
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs++], "%s", consPerfConfig.standbyPortNo);
+		}
 		else if(strcmp("-if", argv[iargs]) == 0 || strcmp("-i", argv[iargs]) == 0)
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -135,6 +152,29 @@ void initConsPerfConfig(int argc, char **argv)
 				pToken = strtok(NULL, ",");
 			}
 		}
+		else if (0 == strcmp("-workerThreads", argv[iargs]))
+		{
+			char *pToken;
+
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+
+			consPerfConfig.workerThreadCount = 0;
+			consPerfConfig.workerThreadBindList = (RsslInt32*)malloc(MAX_CONS_THREADS * sizeof(RsslInt32));
+
+			pToken = strtok(argv[iargs++], ",");
+			while(pToken)
+			{
+				if (++consPerfConfig.workerThreadCount > MAX_CONS_THREADS)
+				{
+					printf("Config Error: Too many worker threads specified.\n");
+					exit(-1);
+				}
+
+				sscanf(pToken, "%d", &consPerfConfig.workerThreadBindList[consPerfConfig.workerThreadCount-1]);
+
+				pToken = strtok(NULL, ",");
+			}
+		}
 		else if(strcmp("-tcpDelay", argv[iargs]) == 0)
 		{
 			++iargs;
@@ -229,6 +269,11 @@ void initConsPerfConfig(int argc, char **argv)
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
 			consPerfConfig.recvBufSize = atoi(argv[iargs++]);
 		}
+		else if (0 == strcmp("-readAhead", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			consPerfConfig.readAheadSize = atoi(argv[iargs++]);
+		}
 		else if(strcmp("-steadyStateTime", argv[iargs]) == 0)
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -251,6 +296,21 @@ void initConsPerfConfig(int argc, char **argv)
 		{
 			++iargs; consPerfConfig.measureDecode = RSSL_TRUE;
 		}
+		else if(strcmp("-recvTimestamps", argv[iargs]) == 0)
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+
+			if(strcmp("software", argv[iargs]) == 0)
+				consPerfConfig.recvTimestampType = RSSL_RECV_TIMESTAMP_SOFTWARE;
+			else if(strcmp("hardware", argv[iargs]) == 0)
+				consPerfConfig.recvTimestampType = RSSL_RECV_TIMESTAMP_HARDWARE;
+			else
+			{
+				printf("Config Error: Unknown receive timestamp type \"%s\"\n", argv[iargs]);
+				exitConfigError(argv);
+			}
+			++iargs;
+		}
 		else if(strcmp("-postingRate", argv[iargs]) == 0)
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -276,6 +336,11 @@ void initConsPerfConfig(int argc, char **argv)
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
 			consPerfConfig.ticksPerSec = atoi(argv[iargs++]);
 		}
+		else if(strcmp("-busyPoll", argv[iargs]) == 0)
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			consPerfConfig.busyPollTime = atoi(argv[iargs++]);
+		}
 		else if(strcmp("-highWaterMark", argv[iargs]) == 0)
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -289,6 +354,15 @@ void initConsPerfConfig(int argc, char **argv)
 		{
 			++iargs; consPerfConfig.useWatchlist = RSSL_TRUE;
 		}
+		else if(strcmp("-coalesceRequests", argv[iargs]) == 0)
+		{
+			++iargs; consPerfConfig.coalesceRequests = RSSL_TRUE;
+		}
+		else if(strcmp("-itemSnapshotFile", argv[iargs]) == 0)
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			snprintf(consPerfConfig.itemSnapshotFilename, sizeof(consPerfConfig.itemSnapshotFilename), "%s", argv[iargs++]);
+		}
 		else
 		{
 			printf("Config Error: Unrecognized option: %s\n", argv[iargs]);
@@ -377,6 +451,24 @@ void initConsPerfConfig(int argc, char **argv)
 		exitConfigError(argv);
 	}
 
+	if (strlen(consPerfConfig.itemSnapshotFilename) && !consPerfConfig.useWatchlist)
+	{
+		printf("Config Error: -itemSnapshotFile requires -watchlist.\n");
+		exitConfigError(argv);
+	}
+
+	if (strlen(consPerfConfig.standbyPortNo))
+	{
+		if (!consPerfConfig.useWatchlist)
+		{
+			printf("Config Error: A standby connection requires -watchlist.\n");
+			exitConfigError(argv);
+		}
+
+		if (!strlen(consPerfConfig.standbyHostName))
+			snprintf(consPerfConfig.standbyHostName, sizeof(consPerfConfig.standbyHostName), "%s", consPerfConfig.hostName);
+	}
+
 	consPerfConfig._requestsPerTick = consPerfConfig.itemRequestsPerSec 
 		/ consPerfConfig.ticksPerSec;
 
@@ -409,6 +501,8 @@ void printConsPerfConfig(FILE *file)
 	int i;
 	int tmpStringPos = 0;
 	char tmpString[128];
+	int workerStringPos = 0;
+	char workerString[128];
 	char reactorWatchlistUsageString[32];
 
 	if (consPerfConfig.useWatchlist)
@@ -429,6 +523,16 @@ void printConsPerfConfig(FILE *file)
 	for(i = 1; i < consPerfConfig.threadCount; ++i)
 		tmpStringPos += snprintf(tmpString + tmpStringPos, 128 - tmpStringPos, ",%d", consPerfConfig.threadBindList[i]);
 
+	/* Build reactor worker thread list */
+	if (consPerfConfig.workerThreadCount)
+	{
+		workerStringPos += snprintf(workerString, 128, "%d", consPerfConfig.workerThreadBindList[0]);
+		for(i = 1; i < consPerfConfig.workerThreadCount; ++i)
+			workerStringPos += snprintf(workerString + workerStringPos, 128 - workerStringPos, ",%d", consPerfConfig.workerThreadBindList[i]);
+	}
+	else
+		snprintf(workerString, 128, "(none)");
+
 	fprintf(file, "--- TEST INPUTS ---\n\n");
 
 	fprintf(file,
@@ -440,13 +544,17 @@ void printConsPerfConfig(FILE *file)
 	fprintf(file,
 		"                Hostname: %s\n"
 		"                    Port: %s\n"
+		"      Standby Connection: %s%s%s\n"
 		"                 Service: %s\n"
 		"             Thread List: %s\n"
+		"      Worker Thread List: %s\n"
 		"          Output Buffers: %u\n"
 		"           Input Buffers: %u\n"
 		"        Send Buffer Size: %u%s\n"
 		"        Recv Buffer Size: %u%s\n"
+		"         Read-Ahead Size: %u%s\n"
 		"         High Water Mark: %u%s\n"
+		"               Busy Poll: %u%s\n"
 		"          Interface Name: %s\n"
 		"             Tcp_NoDelay: %s\n"
 		"                Username: %s\n"
@@ -464,16 +572,24 @@ void printConsPerfConfig(FILE *file)
 		"              Stats File: %s\n"
 		"        Latency Log File: %s\n"
 		"               Tick Rate: %u\n"
-		" Reactor/Watchlist Usage: %s\n\n",
+		" Reactor/Watchlist Usage: %s\n"
+		"       Coalesce Requests: %s\n"
+		"      Item Snapshot File: %s\n\n",
 		consPerfConfig.hostName,
 		consPerfConfig.portNo,
+		strlen(consPerfConfig.standbyPortNo) ? consPerfConfig.standbyHostName : "(none)",
+		strlen(consPerfConfig.standbyPortNo) ? ":" : "",
+		consPerfConfig.standbyPortNo,
 		consPerfConfig.serviceName,
 		tmpString,
+		workerString,
 		consPerfConfig.guaranteedOutputBuffers,
 		consPerfConfig.numInputBuffers,
 		consPerfConfig.sendBufSize, (consPerfConfig.sendBufSize ? " bytes" : "(use default)"),
 		consPerfConfig.recvBufSize, (consPerfConfig.recvBufSize ? " bytes" : "(use default)"),
+		consPerfConfig.readAheadSize, (consPerfConfig.readAheadSize ? " bytes" : "(disabled)"),
 		consPerfConfig.highWaterMark, (consPerfConfig.highWaterMark > 0 ?  " bytes" : "(use default)"),
+		consPerfConfig.busyPollTime, (consPerfConfig.busyPollTime > 0 ? " usec" : "(disabled)"),
 		strlen(consPerfConfig.interfaceName) ? consPerfConfig.interfaceName : "(use default)",
 		(consPerfConfig.tcpNoDelay ? "Yes" : "No"),
 		strlen(consPerfConfig.username) ? consPerfConfig.username : "(use system login name)",
@@ -491,14 +607,19 @@ void printConsPerfConfig(FILE *file)
 		consPerfConfig.statsFilename,
 		consPerfConfig.logLatencyToFile ? consPerfConfig.latencyLogFilename : "(none)",
 		consPerfConfig.ticksPerSec,
-		reactorWatchlistUsageString
+		reactorWatchlistUsageString,
+		consPerfConfig.coalesceRequests ? "Yes" : "No",
+		strlen(consPerfConfig.itemSnapshotFilename) ? consPerfConfig.itemSnapshotFilename : "(none)"
 	  );
 
 	fprintf(file,
 			"      Nanosecond Latency: %s\n"
-			"          Measure Decode: %s\n\n",
+			"          Measure Decode: %s\n"
+			"      Receive Timestamps: %s\n\n",
 			consPerfConfig.nanoTime ? "Yes" : "No",
-			consPerfConfig.measureDecode ? "Yes" : "No"
+			consPerfConfig.measureDecode ? "Yes" : "No",
+			consPerfConfig.recvTimestampType == RSSL_RECV_TIMESTAMP_HARDWARE ? "hardware"
+				: (consPerfConfig.recvTimestampType == RSSL_RECV_TIMESTAMP_SOFTWARE ? "software" : "No")
 		   );
 }
 
@@ -512,12 +633,17 @@ void exitWithUsage()
 			"  -h <hostname>                        Name of host to connect to\n"
 			"  -p <port number>                     Port number to connect to\n"
 			"  -if <interface name>                 Name of network interface to use\n"
+			"  -standbyHost <hostname>              Name of host for the warm standby connection(defaults to -h)\n"
+			"  -standbyPort <port number>           With -watchlist, keep a warm standby connection to this port, and report the time\n"
+			"                                         taken to fail over to it when the first connection is lost\n"
 			"\n"
 			"  -outputBufs <count>                  Number of output buffers(configures guaranteedOutputBuffers in RsslConnectOptions)\n"
 			"  -inputBufs <count>                   Number of input buffers(configures numInputBufs in RsslConnectOptions)\n"
 			"  -tcpDelay                            Turns off tcp_nodelay in RsslConnectOptions, enabling Nagle's\n"
 			"  -sendBufSize <size>                  System Send Buffer Size(configures sysSendBufSize in RsslConnectOptions)\n"
 			"  -recvBufSize <size>                  System Receive Buffer Size(configures sysRecvBufSize in RsslConnectOptions)\n"
+			"  -readAhead <size>                    Read as much as fits into an input buffer of this size on each read(configures tcpOpts.readAheadSize)\n"
+			"  -busyPoll <usec>                     Never block waiting for data, and set this SO_BUSY_POLL time on the channel(configures RSSL_SYSTEM_BUSY_POLL)\n"
 			"\n"
 			"  -tickRate <ticks per second>         Ticks per second\n"
 			"  -itemCount <count>                   Number of items to request\n"
@@ -545,11 +671,18 @@ void exitWithUsage()
 			"  -threads <thread list>               list of threads(which create 1 connection each),\n"
 			"                                         by their bound CPU. Comma-separated list. -1 means do not bind.\n"
 			"                                         (e.g. \"-threads 0,1 \" creates two threads bound to CPU's 0 and 1)\n"
+			"  -workerThreads <thread list>         With -reactor or -watchlist, CPU's to bind the reactor worker thread of each\n"
+			"                                         connection to, in the same order as -threads. -1 means do not bind.\n"
 			"  -reactor                             Use the VA Reactor instead of the UPA Channel for sending and receiving.\n"
 			"  -watchlist                           Use the VA Reactor watchlist instead of the UPA Channel for sending and receiving.\n"
+			"  -coalesceRequests                    With -watchlist, send item requests as batch requests when the provider supports them.\n"
+			"  -itemSnapshotFile <filename>         With -watchlist, store item images in files of this name, followed by the connection number,\n"
+			"                                         and provide them as suspect data when items are next requested.\n"
 			"\n"
 			"  -nanoTime                            Assume latency has nanosecond precision instead of microsecond.\n"
-			"  -measureDecode                       Measure decode time of updates.\n\n"
+			"  -measureDecode                       Measure decode time of updates.\n"
+			"  -recvTimestamps <type>               Split update latency at the time the data was received, using receive timestamps\n"
+			"                                         of the given type(\"software\" or \"hardware\"). Socket connections only.\n\n"
 			"\n"
 			);
 #ifdef _WIN32
@@ -29,6 +29,8 @@ typedef struct
 	RsslInt32	ticksPerSec;						/* Main loop ticks per second.  See -tps */
 	RsslInt32	threadCount;						/* Number of threads that handle connections.  See -threads */
 	RsslInt32	*threadBindList;					/* CPU ID list for threads that handle connections.  See -threads */
+	RsslInt32	workerThreadCount;					/* Number of entries in workerThreadBindList.  See -workerThreads */
+	RsslInt32	*workerThreadBindList;				/* CPU ID list for the reactor worker threads of each connection.  See -workerThreads */
 
 	char		itemFilename[128];					/* File of names to use when requesting items. See -itemFile. */
 	char		msgFilename[128];					/* File of data to use for message payloads. See -msgFile. */
@@ -45,12 +47,16 @@ typedef struct
 	RsslConnectionTypes	connectionType;				/* Type of connection. See -connType */
 	char				hostName[128];				/* hostName, if using rsslConnect(). See -hostname */
 	char 				portNo[32];					/* Port number. See -p */
+	char				standbyHostName[128];		/* Host of the warm standby connection. See -standbyHost */
+	char 				standbyPortNo[32];			/* Port of the warm standby connection, if any. See -standbyPort */
 	char				interfaceName[128];			/* Name of interface.  See -if */
 	RsslUInt32			guaranteedOutputBuffers;	/* Guaranteed Output Buffers. See -outputBufs */
 	RsslUInt32			numInputBuffers;			/* Input Buffers. See -inputBufs */
 	RsslUInt32			sendBufSize;				/* System Send Buffer Size(-sendBufSize) */
 	RsslUInt32			recvBufSize;				/* System Send Buffer Size(-recvBufSize) */
+	RsslUInt32			readAheadSize;				/* Read-ahead size for socket connections(-readAhead). 0 disables read-ahead. */
 	RsslUInt32			highWaterMark;				/* sets the point which will cause UPA to automatically flush */
+	RsslUInt32			busyPollTime;				/* Busy poll: never block waiting for data, and set this SO_BUSY_POLL time(usec) on the channel. See -busyPoll */
 	RsslBool			tcpNoDelay;					/* Enable/Disable Nagle's algorithm. See -tcpDelay */
 	RsslBool			requestSnapshots;			/* Whether to request all items as snapshots. See -snapshot */
 
@@ -68,9 +74,12 @@ typedef struct
 
 	RsslBool			nanoTime;					/* Whether to assume latency is nanosecond precision instead of microsecond. */
 	RsslBool			measureDecode;				/* Measure time to decode latency updates (-measureDecode) */
+	RsslInt32			recvTimestampType;			/* Receive timestamps used to split update latency(RsslRecvTimestampTypes). See -recvTimestamps. */
 
 	RsslBool			useReactor;					/* Use the VA Reactor instead of the UPA Channel for sending and receiving. */
 	RsslBool			useWatchlist;				/* Use the VA Reactor watchlist instead of the UPA Channel for sending and receiving. */
+	RsslBool			coalesceRequests;			/* Have the watchlist send item requests as batch requests, when the provider supports them. */
+	char				itemSnapshotFilename[128];	/* File in which the watchlist stores item images. See -itemSnapshotFile. */
 
 	RsslInt32 _requestsPerTick;
 	RsslInt32 _requestsPerTickRemainder;
@@ -908,6 +908,7 @@ static RsslRet connectChannel(ConsumerThread* pConsumerThread)
 	if(consPerfConfig.connectionType == RSSL_CONN_TYPE_SOCKET)
 	{
 		copts.tcpOpts.tcp_nodelay = consPerfConfig.tcpNoDelay;
+		copts.tcpOpts.readAheadSize = consPerfConfig.readAheadSize;
 	}
 
 		copts.connectionInfo.unified.address = consPerfConfig.hostName;
@@ -992,6 +993,16 @@ static RsslRet connectChannel(ConsumerThread* pConsumerThread)
 		}
 	}
 
+	/* Raising the busy poll time may require privileges, so continue without it if it can't be set. */
+	if (consPerfConfig.busyPollTime > 0
+			&& rsslIoctl(pConsumerThread->pChannel, RSSL_SYSTEM_BUSY_POLL, &consPerfConfig.busyPollTime, &pConsumerThread->threadRsslError) != RSSL_RET_SUCCESS)
+		printf("Warning: could not set busy poll time: %s\n", pConsumerThread->threadRsslError.text);
+
+	/* Receive timestamps depend on the platform and connection type, so latency is not split without them. */
+	if (consPerfConfig.recvTimestampType != RSSL_RECV_TIMESTAMP_NONE
+			&& rsslIoctl(pConsumerThread->pChannel, RSSL_RECV_TIMESTAMPS, &consPerfConfig.recvTimestampType, &pConsumerThread->threadRsslError) != RSSL_RET_SUCCESS)
+		printf("Warning: could not enable receive timestamps: %s\n", pConsumerThread->threadRsslError.text);
+
 	return RSSL_RET_SUCCESS;
 }
 
@@ -1000,6 +1011,7 @@ static RsslRet connectReactor(ConsumerThread* pConsumerThread)
 	RsslCreateReactorOptions reactorOpts;
 	RsslReactorConnectOptions cOpts;
 	RsslReactorConnectInfo cInfo;
+	RsslReactorConnectInfo connectionList[2];
 	RsslErrorInfo rsslErrorInfo;
 	RsslRet ret = 0;
 
@@ -1007,6 +1019,8 @@ static RsslRet connectReactor(ConsumerThread* pConsumerThread)
 	rsslClearReactorConnectOptions(&cOpts);
 	rsslClearReactorConnectInfo(&cInfo);
 
+	reactorOpts.cpuBindWorkerThread = pConsumerThread->workerCpuId;
+
 	/* Create an RsslReactor which will manage our channels. */
 	if (!(pConsumerThread->pReactor = rsslCreateReactor(&reactorOpts, &rsslErrorInfo)))
 	{
@@ -1033,6 +1047,7 @@ static RsslRet connectReactor(ConsumerThread* pConsumerThread)
 	if(consPerfConfig.connectionType == RSSL_CONN_TYPE_SOCKET)
 	{
 		cInfo.rsslConnectOptions.tcpOpts.tcp_nodelay = consPerfConfig.tcpNoDelay;
+		cInfo.rsslConnectOptions.tcpOpts.readAheadSize = consPerfConfig.readAheadSize;
 	}
 
 		cInfo.rsslConnectOptions.connectionInfo.unified.address = consPerfConfig.hostName;
@@ -1074,6 +1089,13 @@ static RsslRet connectReactor(ConsumerThread* pConsumerThread)
 	if (consPerfConfig.useWatchlist == RSSL_TRUE)
 	{
 		pConsumerThread->consumerRole.watchlistOptions.enableWatchlist = RSSL_TRUE;
+		pConsumerThread->consumerRole.watchlistOptions.coalesceItemRequests = consPerfConfig.coalesceRequests;
+		if (strlen(pConsumerThread->itemSnapshotFilename))
+		{
+			/* Size a new file for all of this connection's items. */
+			pConsumerThread->consumerRole.watchlistOptions.itemSnapshotFile = pConsumerThread->itemSnapshotFilename;
+			pConsumerThread->consumerRole.watchlistOptions.itemCountHint = pConsumerThread->itemListCount;
+		}
 	}
 		
 	// connect via Reactor
@@ -1081,9 +1103,20 @@ static RsslRet connectReactor(ConsumerThread* pConsumerThread)
 	cOpts.reconnectMaxDelay = 5000;
 	cOpts.reconnectMinDelay = 1000;
 	cInfo.rsslConnectOptions.userSpecPtr = pConsumerThread;
-	cOpts.reactorConnectionList = &cInfo;
+	connectionList[0] = cInfo;
+	cOpts.reactorConnectionList = connectionList;
 	cOpts.connectionCount = 1;
 
+	if (strlen(consPerfConfig.standbyPortNo))
+	{
+		/* Keep a logged-in standby connection to the second provider, and fail over to it. */
+		connectionList[1] = cInfo;
+		connectionList[1].rsslConnectOptions.connectionInfo.unified.address = consPerfConfig.standbyHostName;
+		connectionList[1].rsslConnectOptions.connectionInfo.unified.serviceName = consPerfConfig.standbyPortNo;
+		cOpts.connectionCount = 2;
+		cOpts.enableWarmStandby = RSSL_TRUE;
+	}
+
     if ((ret = rsslReactorConnect(pConsumerThread->pReactor, &cOpts, (RsslReactorChannelRole *)&pConsumerThread->consumerRole, &rsslErrorInfo)) < RSSL_RET_SUCCESS)
     {
 		printf("rsslReactorConnect failed with return code: %d error = %s", ret,  rsslErrorInfo.rsslError.text);
@@ -1722,6 +1755,13 @@ static RsslRet processDefaultMsgResp(ConsumerThread* pConsumerThread, RsslMsg *p
 				return RSSL_RET_FAILURE;
 			}
 
+			/* After failing over, the watchlist recovers each item with a new refresh. */
+			if (pConsumerThread->stats.failoverStartTime && !pConsumerThread->stats.failoverEndTime
+					&& pMsg->refreshMsg.flags & RSSL_RFMF_REFRESH_COMPLETE
+					&& pMsg->refreshMsg.state.dataState == RSSL_DATA_OK
+					&& ++pConsumerThread->stats.failoverRefreshCount == pConsumerThread->itemListCount)
+				pConsumerThread->stats.failoverEndTime = getTimeNano();
+
 			if(!pConsumerThread->stats.imageRetrievalEndTime && rsslQueueGetElementCount(&pConsumerThread->waitingForRefreshQueue))
 			{
 				if (rsslIsFinalState(&pMsg->refreshMsg.state))
@@ -1748,6 +1788,14 @@ static RsslRet processDefaultMsgResp(ConsumerThread* pConsumerThread, RsslMsg *p
 					return RSSL_RET_FAILURE;
 				}
 
+				/* The watchlist provides stored images as suspect data, before the provider's refresh. */
+				if (pMsg->refreshMsg.flags & RSSL_RFMF_REFRESH_COMPLETE
+						&& pMsg->refreshMsg.state.dataState == RSSL_DATA_SUSPECT
+						&& strlen(pConsumerThread->itemSnapshotFilename)
+						&& pConsumerThread->itemRequestList[streamId].requestState == ITEM_WAITING_FOR_REFRESH
+						&& ++pConsumerThread->stats.storedImageCount == pConsumerThread->itemListCount)
+					pConsumerThread->stats.storedImageEndTime = getTimeNano();
+
 				if (pMsg->refreshMsg.flags & RSSL_RFMF_REFRESH_COMPLETE
 						&& pMsg->refreshMsg.state.dataState == RSSL_DATA_OK)
 				{
@@ -1851,7 +1899,10 @@ RSSL_THREAD_DECLARE(runConsumerChannelConnection, threadStruct)
 	RsslError closeError;
 	RsslBuffer *msgBuf=0;
 	RsslRet	readret;
+	RsslReadInArgs readInArgs;
+	RsslReadOutArgs readOutArgs;
 	RsslMsg msg = RSSL_INIT_MSG;
+	RsslMsgHeaderInfo headerInfo;
 	RsslDecodeIterator dIter;
 	char errTxt[256];
 	RsslBuffer errorText = {255, (char*)errTxt};
@@ -1901,7 +1952,8 @@ RSSL_THREAD_DECLARE(runConsumerChannelConnection, threadStruct)
 		useWrt = pConsumerThread->wrtfds;
 
 		currentTime = getTimeNano();
-		time_interval.tv_usec = (long)((currentTime > nextTickTime) ? 0 : ((nextTickTime - currentTime)/1000));
+		/* When busy polling, never block; keep checking for data until the next tick. */
+		time_interval.tv_usec = (long)((currentTime > nextTickTime || consPerfConfig.busyPollTime) ? 0 : ((nextTickTime - currentTime)/1000));
 
 		selRet = select(FD_SETSIZE,&useRead,&useWrt,&useExcept,&time_interval);
 
@@ -1910,8 +1962,14 @@ RSSL_THREAD_DECLARE(runConsumerChannelConnection, threadStruct)
 			if (pConsumerThread->pChannel != NULL && FD_ISSET(pConsumerThread->pChannel->socketId, &useRead))
 			{
 				do{
-					if ((msgBuf = rsslRead(pConsumerThread->pChannel,&readret,&pConsumerThread->threadRsslError)) != 0)
+					rsslClearReadInArgs(&readInArgs);
+					msgBuf = rsslReadEx(pConsumerThread->pChannel, &readInArgs, &readOutArgs, &readret, &pConsumerThread->threadRsslError);
+					countStatAdd(&pConsumerThread->stats.transportReadCount, readOutArgs.transportReads);
+					pConsumerThread->recvTimestamp = (readOutArgs.readOutFlags & RSSL_READ_OUT_RECV_TIMESTAMP) ? readOutArgs.recvTimestamp : 0;
+
+					if (msgBuf != 0)
 					{	
+						countStatIncr(&pConsumerThread->stats.readMsgCount);
 						pConsumerThread->receivedPing = RSSL_TRUE;
 
 						/* clear decode iterator */
@@ -1922,7 +1980,24 @@ RSSL_THREAD_DECLARE(runConsumerChannelConnection, threadStruct)
 
 						rsslSetDecodeIteratorBuffer(&dIter, msgBuf);
 
-						ret = rsslDecodeMsg(&dIter, &msg);	
+						/* Item updates only need their routing fields and payload, so peek at the header
+						 * and skip the full header decode for them. */
+						if (rsslPeekMsgHeader(&dIter, &headerInfo) == RSSL_RET_SUCCESS
+								&& headerInfo.msgClass == RSSL_MC_UPDATE
+								&& headerInfo.streamId >= ITEM_STREAM_ID_START
+								&& headerInfo.domainType > RSSL_DMT_DICTIONARY)
+						{
+							msg.msgBase.msgClass = headerInfo.msgClass;
+							msg.msgBase.domainType = headerInfo.domainType;
+							msg.msgBase.streamId = headerInfo.streamId;
+							msg.msgBase.containerType = headerInfo.containerType;
+							msg.msgBase.encDataBody = headerInfo.encDataBody;
+							msg.updateMsg.flags = headerInfo.flags;
+
+							ret = rsslSetDecodeIteratorBuffer(&dIter, &msg.msgBase.encDataBody);
+						}
+						else
+							ret = rsslDecodeMsg(&dIter, &msg);	
 
 						if (ret != RSSL_RET_SUCCESS)
 						{
@@ -2227,7 +2302,8 @@ RSSL_THREAD_DECLARE(runConsumerReactorConnection, threadStruct)
 		useWrt = pConsumerThread->wrtfds;
 
 		currentTime = getTimeNano();
-		time_interval.tv_usec = (long)((currentTime > nextTickTime) ? 0 : ((nextTickTime - currentTime)/1000));
+		/* When busy polling, never block; keep checking for data until the next tick. */
+		time_interval.tv_usec = (long)((currentTime > nextTickTime || consPerfConfig.busyPollTime) ? 0 : ((nextTickTime - currentTime)/1000));
 
 		selRet = select(FD_SETSIZE,&useRead,&useWrt,&useExcept,&time_interval);
 
@@ -2399,6 +2475,9 @@ void consumerThreadInit(ConsumerThread *pConsumerThread, RsslInt32 consThreadId)
 	char tmpFilename[sizeof(consPerfConfig.statsFilename) + 8];
 
 	timeRecordQueueInit(&pConsumerThread->latencyRecords);
+	timeRecordQueueInit(&pConsumerThread->netLatencyRecords);
+	timeRecordQueueInit(&pConsumerThread->appLatencyRecords);
+	pConsumerThread->recvTimestamp = 0;
 	timeRecordQueueInit(&pConsumerThread->postLatencyRecords);
 	timeRecordQueueInit(&pConsumerThread->genMsgLatencyRecords);
 
@@ -2407,6 +2486,7 @@ void consumerThreadInit(ConsumerThread *pConsumerThread, RsslInt32 consThreadId)
 	pConsumerThread->pChannel = NULL;
 
 	pConsumerThread->cpuId = -1;
+	pConsumerThread->workerCpuId = -1;
 	pConsumerThread->latStreamId = 0;
 	pConsumerThread->pDictionary = NULL;
 	pConsumerThread->dictionaryStateFlags = DICTIONARY_STATE_NONE;
@@ -2423,6 +2503,12 @@ void consumerThreadInit(ConsumerThread *pConsumerThread, RsslInt32 consThreadId)
 
 	latencyRandomArrayIterInit(&pConsumerThread->randArrayIter);
 
+	if (strlen(consPerfConfig.itemSnapshotFilename))
+		snprintf(pConsumerThread->itemSnapshotFilename, sizeof(pConsumerThread->itemSnapshotFilename), "%s%d",
+				consPerfConfig.itemSnapshotFilename, consThreadId);
+	else
+		pConsumerThread->itemSnapshotFilename[0] = '\0';
+
 	snprintf(tmpFilename, sizeof(tmpFilename), "%s%d.csv", 
 			consPerfConfig.statsFilename, consThreadId);
 
@@ -2467,6 +2553,8 @@ void consumerThreadInit(ConsumerThread *pConsumerThread, RsslInt32 consThreadId)
 void consumerThreadCleanup(ConsumerThread *pConsumerThread)
 {
 	timeRecordQueueCleanup(&pConsumerThread->latencyRecords);
+	timeRecordQueueCleanup(&pConsumerThread->netLatencyRecords);
+	timeRecordQueueCleanup(&pConsumerThread->appLatencyRecords);
 	timeRecordQueueCleanup(&pConsumerThread->postLatencyRecords);
 	timeRecordQueueCleanup(&pConsumerThread->genMsgLatencyRecords);
 	if (pConsumerThread->statsFile)
@@ -2513,6 +2601,9 @@ RsslReactorCallbackRet channelEventCallback(RsslReactor *pReactor, RsslReactorCh
 			pConsumerThread->pChannel = pReactorChannel->pRsslChannel;
             printf("Connected ");
 
+			if (pConsumerThread->stats.failoverStartTime && !pConsumerThread->stats.failoverChannelUpTime)
+				pConsumerThread->stats.failoverChannelUpTime = getTimeNano();
+
             // set the high water mark if configured
             if (consPerfConfig.highWaterMark > 0)
             {
@@ -2523,6 +2614,16 @@ RsslReactorCallbackRet channelEventCallback(RsslReactor *pReactor, RsslReactorCh
                 }
             }
 
+			/* Raising the busy poll time may require privileges, so continue without it if it can't be set. */
+			if (consPerfConfig.busyPollTime > 0
+					&& rsslReactorChannelIoctl(pReactorChannel, RSSL_SYSTEM_BUSY_POLL, &consPerfConfig.busyPollTime, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+				printf("Warning: could not set busy poll time: %s\n", rsslErrorInfo.rsslError.text);
+
+			/* Receive timestamps depend on the platform and connection type, so latency is not split without them. */
+			if (consPerfConfig.recvTimestampType != RSSL_RECV_TIMESTAMP_NONE
+					&& rsslReactorChannelIoctl(pReactorChannel, RSSL_RECV_TIMESTAMPS, &consPerfConfig.recvTimestampType, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+				printf("Warning: could not enable receive timestamps: %s\n", rsslErrorInfo.rsslError.text);
+
 			/* Set file descriptor. */
 			FD_SET(pReactorChannel->socketId, &(pConsumerThread->readfds));
 			FD_SET(pReactorChannel->socketId, &(pConsumerThread->exceptfds));
@@ -2621,10 +2722,16 @@ RsslReactorCallbackRet channelEventCallback(RsslReactor *pReactor, RsslReactorCh
 				FD_CLR(pReactorChannel->socketId, &(pConsumerThread->exceptfds));
 			}
 
-			// only allow one connect
+			// only allow one connect, unless failing over to the standby connection
 			if (pConsumerThread->pDesiredService)
             {
-                shutdownThreads = RSSL_TRUE;
+				if (strlen(consPerfConfig.standbyPortNo) && !pConsumerThread->stats.failoverStartTime)
+				{
+					pConsumerThread->stats.failoverStartTime = getTimeNano();
+					printf("Failing over to standby connection.\n");
+				}
+				else
+					shutdownThreads = RSSL_TRUE;
             }
 
 			return RSSL_RC_CRET_SUCCESS;
@@ -2780,6 +2887,8 @@ RsslReactorCallbackRet defaultMsgCallback(RsslReactor *pReactor, RsslReactorChan
 		return RSSL_RC_CRET_FAILURE;
 	}
 
+	pConsumerThread->recvTimestamp = pMsgEvent->pRecvTimestamp ? *pMsgEvent->pRecvTimestamp : 0;
+
 	/* clear decode iterator */
 	rsslClearDecodeIterator(&dIter);
 		
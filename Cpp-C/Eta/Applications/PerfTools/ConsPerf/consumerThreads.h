@@ -77,6 +77,12 @@ typedef struct {
 	TimeValue	firstUpdateTime;				/* Time at which first item update was received. */
 	TimeValue	firstGenMsgSentTime;			/* Time at which first generic message was sent */
 	TimeValue	firstGenMsgRecvTime;			/* Time at which first generic message was received */
+	TimeValue	failoverStartTime;				/* Time at which the connection was lost, if failing over to the standby connection. */
+	TimeValue	failoverChannelUpTime;			/* Time at which the channel came up on the standby connection. */
+	TimeValue	failoverEndTime;				/* Time at which all item refreshes were received again after failover. */
+	RsslInt32	failoverRefreshCount;			/* Number of items refreshed since failover. */
+	TimeValue	storedImageEndTime;				/* Time at which the last stored item image was received(see -itemSnapshotFile). */
+	RsslInt32	storedImageCount;				/* Number of stored item images received. */
 
 
 	CountStat		refreshCount;				/* Number of item refreshes received. */
@@ -90,12 +96,19 @@ typedef struct {
 	CountStat		genMsgRecvCount;			/* Number of generic msgs received. */
 	CountStat		latencyGenMsgSentCount;		/* Number of latency generic msgs sent. */
 	CountStat		genMsgOutOfBuffersCount;	/* Number of generic msgs not sent due to lack of buffers. */
+	CountStat		readMsgCount;				/* Number of messages returned by rsslReadEx(). */
+	CountStat		transportReadCount;			/* Number of transport reads made by rsslReadEx(). */
 	ValueStatistics	intervalLatencyStats;		/* Latency statistics (recorded by stats thread). */
 	ValueStatistics	intervalPostLatencyStats;	/* Post latency statistics (recorded by stats thread). */
 	ValueStatistics	intervalGenMsgLatencyStats;	/* Gen Msg latency statistics (recorded by stats thread). */
 
 	ValueStatistics startupLatencyStats;		/* Statup latency statistics. */
 	ValueStatistics steadyStateLatencyStats;	/* Steady-state latency statistics. */
+	ValueHistogram	steadyStateLatencyHist;		/* Steady-state latency distribution, for percentiles. */
+	ValueStatistics steadyStateNetLatencyStats;	/* Steady-state latency up to the data being received(see -recvTimestamps). */
+	ValueHistogram	steadyStateNetLatencyHist;
+	ValueStatistics steadyStateAppLatencyStats;	/* Steady-state latency from the data being received until the update is decoded. */
+	ValueHistogram	steadyStateAppLatencyHist;
 	ValueStatistics overallLatencyStats;		/* Overall latency statistics. */
 	ValueStatistics postLatencyStats;			/* Posting latency statistics. */
 	ValueStatistics genMsgLatencyStats;			/* Gen Msg latency statistics. */
@@ -111,6 +124,12 @@ RTR_C_INLINE void consumerStatsInit(ConsumerStats *stats)
 	stats->firstUpdateTime = 0;
 	stats->firstGenMsgSentTime = 0;
 	stats->firstGenMsgRecvTime = 0;
+	stats->failoverStartTime = 0;
+	stats->failoverChannelUpTime = 0;
+	stats->failoverEndTime = 0;
+	stats->failoverRefreshCount = 0;
+	stats->storedImageEndTime = 0;
+	stats->storedImageCount = 0;
 	initCountStat(&stats->startupUpdateCount);
 	initCountStat(&stats->steadyStateUpdateCount);
 	initCountStat(&stats->refreshCount);
@@ -121,11 +140,18 @@ RTR_C_INLINE void consumerStatsInit(ConsumerStats *stats)
 	initCountStat(&stats->genMsgRecvCount);
 	initCountStat(&stats->postOutOfBuffersCount);
 	initCountStat(&stats->genMsgOutOfBuffersCount);
+	initCountStat(&stats->readMsgCount);
+	initCountStat(&stats->transportReadCount);
 	clearValueStatistics(&stats->intervalLatencyStats);
 	clearValueStatistics(&stats->intervalPostLatencyStats);
 	clearValueStatistics(&stats->intervalGenMsgLatencyStats);
 	clearValueStatistics(&stats->startupLatencyStats);
 	clearValueStatistics(&stats->steadyStateLatencyStats);
+	clearValueHistogram(&stats->steadyStateLatencyHist);
+	clearValueStatistics(&stats->steadyStateNetLatencyStats);
+	clearValueHistogram(&stats->steadyStateNetLatencyHist);
+	clearValueStatistics(&stats->steadyStateAppLatencyStats);
+	clearValueHistogram(&stats->steadyStateAppLatencyHist);
 	clearValueStatistics(&stats->overallLatencyStats);
 	clearValueStatistics(&stats->postLatencyStats);
 	clearValueStatistics(&stats->genMsgLatencyStats);
@@ -146,6 +172,7 @@ typedef enum
 typedef struct {
 	RsslThreadId			threadId;					/* ID saved from thread creation. */
 	RsslInt32				cpuId;						/* CPU to bind the thread to, if any */
+	RsslInt32				workerCpuId;				/* CPU to bind the thread's reactor worker to, if any */
     RsslChannel				*pChannel;					/* RSSL Channel. */
 	TimeRecordQueue			latencyRecords;				/* Queue of timestamp information, collected periodically by the main thread. */
 	TimeRecordQueue			postLatencyRecords;			/* Queue of timestamp information(for posts), collected periodically by the main thread. */
@@ -167,6 +194,9 @@ typedef struct {
 	RsslBool				receivedPing;				/* Indicates whether a ping or message was received since our last check. */
 
 	TimeRecordQueue			updateDecodeTimeRecords;	/* Time spent decoding updates. */
+	RsslUInt64				recvTimestamp;				/* Receive timestamp of the message being processed, if any(see -recvTimestamps). */
+	TimeRecordQueue			netLatencyRecords;			/* Update latency up to the data being received. */
+	TimeRecordQueue			appLatencyRecords;			/* Update latency from the data being received until the update is decoded. */
 
 	RsslLocalFieldSetDefDb	fListSetDef;				/* Set definition, if needed. */
 	char					setDefMemory[3825];			/* Memory for set definitions.  */
@@ -187,6 +217,7 @@ typedef struct {
 	RsslReactorOMMConsumerRole consumerRole;			/* Used for when application uses VA Reactor instead of UPA Channel. */
 	RsslRDMLoginRequest		loginRequest;				/* Used for when application uses VA Reactor instead of UPA Channel. */
 	RsslRDMDirectoryRequest	dirRequest;					/* Used for when application uses VA Reactor instead of UPA Channel. */
+	char					itemSnapshotFilename[sizeof(consPerfConfig.itemSnapshotFilename) + 8];	/* Watchlist item snapshot file for this connection, if any. */
 	RsslRDMService          *pDesiredService;           /* Store information about the desired service once we find it. */
 	RsslQueue				requestQueue;				/* Request queue. */
 	RsslQueue				waitingForRefreshQueue;		/* Waiting for refresh queue. */
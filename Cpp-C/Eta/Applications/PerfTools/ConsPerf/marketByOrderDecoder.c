@@ -44,6 +44,22 @@ RTR_C_INLINE void updateLatencyStats(ConsumerThread *pConsumerThread, TimeValue
 	{
 	case RSSL_MC_UPDATE:
 		timeRecordSubmit(&pConsumerThread->latencyRecords, timeTracker, currentTime, unitsPerMicro);
+
+		/* Split the latency at the time the data was received, if known. Receive timestamps are
+		 * wall-clock time, so the time since then is measured against the wall clock. */
+		if (pConsumerThread->recvTimestamp)
+		{
+			TimeValue appTime = getSystemTimeNano() - pConsumerThread->recvTimestamp;
+
+			if (!consPerfConfig.nanoTime)
+				appTime /= 1000;
+
+			if (appTime > currentTime - timeTracker)
+				appTime = currentTime - timeTracker;
+
+			timeRecordSubmit(&pConsumerThread->netLatencyRecords, timeTracker, currentTime - appTime, unitsPerMicro);
+			timeRecordSubmit(&pConsumerThread->appLatencyRecords, currentTime - appTime, currentTime, unitsPerMicro);
+		}
 		break;
 	case RSSL_MC_GENERIC:
 		timeRecordSubmit(&pConsumerThread->genMsgLatencyRecords, timeTracker, currentTime, unitsPerMicro);
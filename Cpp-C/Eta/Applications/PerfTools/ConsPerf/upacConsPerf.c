@@ -134,7 +134,11 @@ int main(int argc, char **argv)
 	signal(SIGINT, signal_handler);
 	
 	for(i = 0; i < consPerfConfig.threadCount; ++i)
+	{
 		consumerThreads[i].cpuId = consPerfConfig.threadBindList[i];
+		if (i < consPerfConfig.workerThreadCount)
+			consumerThreads[i].workerCpuId = consPerfConfig.workerThreadBindList[i];
+	}
 
 	/* Initialize RSSL */
 	if (consPerfConfig.useReactor == RSSL_FALSE && consPerfConfig.useWatchlist == RSSL_FALSE) // use UPA Channel
@@ -266,6 +270,58 @@ int main(int argc, char **argv)
 	return 0;
 }
 
+/* Gathers the steady-state records of one part of the update latency(see -recvTimestamps). */
+static void collectSplitLatencyRecords(ConsumerThread *pConsumerThread, TimeRecordQueue *pRecordQueue,
+		ValueStatistics *pThreadStats, ValueHistogram *pThreadHist, ValueStatistics *pTotalStats, ValueHistogram *pTotalHist)
+{
+	RsslQueue latencyRecords;
+	RsslQueueLink *pLink;
+
+	rsslInitQueue(&latencyRecords);
+	timeRecordQueueGet(pRecordQueue, &latencyRecords);
+	RSSL_QUEUE_FOR_EACH_LINK(&latencyRecords, pLink)
+	{
+		TimeRecord *pRecord = RSSL_QUEUE_LINK_TO_OBJECT(TimeRecord, queueLink, pLink);
+		double latency = (double)(pRecord->endTime - pRecord->startTime)/(double)pRecord->ticks;
+		double recordEndTimeNsec = (double)pRecord->endTime/(double)pRecord->ticks * 1000.0;
+
+		if (pConsumerThread->stats.imageRetrievalEndTime != 0
+				&& recordEndTimeNsec > (double)pConsumerThread->stats.imageRetrievalEndTime)
+		{
+			updateValueStatistics(pThreadStats, latency);
+			updateValueHistogram(pThreadHist, latency);
+		}
+
+		if (consPerfConfig.threadCount > 1 && totalStats.imageRetrievalEndTime != 0
+				&& recordEndTimeNsec > (double)totalStats.imageRetrievalEndTime)
+		{
+			updateValueStatistics(pTotalStats, latency);
+			updateValueHistogram(pTotalHist, latency);
+		}
+	}
+	timeRecordQueueRepool(pRecordQueue, &latencyRecords);
+}
+
+static void printSplitLatency(FILE *file, const char *indent, ConsumerStats *pStats)
+{
+	if (!pStats->steadyStateNetLatencyStats.count)
+		return;
+
+	fprintf( file,
+			"%sWire+kernel latency avg (usec): %.1f\n"
+			"%sWire+kernel latency median (usec): %.1f\n"
+			"%sWire+kernel latency 99th percentile (usec): %.1f\n"
+			"%sLibrary+application latency avg (usec): %.1f\n"
+			"%sLibrary+application latency median (usec): %.1f\n"
+			"%sLibrary+application latency 99th percentile (usec): %.1f\n",
+			indent, pStats->steadyStateNetLatencyStats.average,
+			indent, getValueHistogramPercentile(&pStats->steadyStateNetLatencyHist, 0.5),
+			indent, getValueHistogramPercentile(&pStats->steadyStateNetLatencyHist, 0.99),
+			indent, pStats->steadyStateAppLatencyStats.average,
+			indent, getValueHistogramPercentile(&pStats->steadyStateAppLatencyHist, 0.5),
+			indent, getValueHistogramPercentile(&pStats->steadyStateAppLatencyHist, 0.99));
+}
+
 void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 currentRuntimeSec, RsslUInt32 timePassedSec)
 {
 	RsslRet ret;
@@ -301,7 +357,9 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 				   genMsgRecvCount,
 				   latencyGenMsgSentCount,
 				   latencyGenMsgRecvCount,
-				   genMsgOutOfBuffersCount;
+				   genMsgOutOfBuffersCount,
+				   readMsgCount,
+				   transportReadCount;
 
 		/* Gather latency records from each thread and update statistics. */
 		timeRecordQueueGet(&consumerThreads[i].latencyRecords, &latencyRecords);
@@ -322,6 +380,8 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 					&consumerThreads[i].stats.steadyStateLatencyStats
 					: &consumerThreads[i].stats.startupLatencyStats,
 					latency);
+			if (latencyIsSteadyStateForClient)
+				updateValueHistogram(&consumerThreads[i].stats.steadyStateLatencyHist, latency);
 
 			if (consPerfConfig.threadCount > 1)
 			{
@@ -334,6 +394,8 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 						&totalStats.steadyStateLatencyStats
 						: &totalStats.startupLatencyStats,
 						latency);
+				if (latencyIsSteadyStateOverall)
+					updateValueHistogram(&totalStats.steadyStateLatencyHist, latency);
 				updateValueStatistics(&totalStats.overallLatencyStats, latency);
 			}
 
@@ -342,6 +404,14 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 		}
 		timeRecordQueueRepool(&consumerThreads[i].latencyRecords, &latencyRecords);
 
+		/* Gather the wire+kernel and library+application parts of update latency. */
+		collectSplitLatencyRecords(&consumerThreads[i], &consumerThreads[i].netLatencyRecords,
+				&consumerThreads[i].stats.steadyStateNetLatencyStats, &consumerThreads[i].stats.steadyStateNetLatencyHist,
+				&totalStats.steadyStateNetLatencyStats, &totalStats.steadyStateNetLatencyHist);
+		collectSplitLatencyRecords(&consumerThreads[i], &consumerThreads[i].appLatencyRecords,
+				&consumerThreads[i].stats.steadyStateAppLatencyStats, &consumerThreads[i].stats.steadyStateAppLatencyHist,
+				&totalStats.steadyStateAppLatencyStats, &totalStats.steadyStateAppLatencyHist);
+
 		/* Gather latency records for posts. */
 		timeRecordQueueGet(&consumerThreads[i].postLatencyRecords, &latencyRecords);
 		RSSL_QUEUE_FOR_EACH_LINK(&latencyRecords, pLink)
@@ -410,6 +480,8 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 		latencyGenMsgSentCount = countStatGetChange(&consumerThreads[i].stats.latencyGenMsgSentCount);
 		latencyGenMsgRecvCount = consumerThreads[i].stats.intervalGenMsgLatencyStats.count;
 		genMsgOutOfBuffersCount = countStatGetChange(&consumerThreads[i].stats.genMsgOutOfBuffersCount);
+		readMsgCount = countStatGetChange(&consumerThreads[i].stats.readMsgCount);
+		transportReadCount = countStatGetChange(&consumerThreads[i].stats.transportReadCount);
 
 		if (consPerfConfig.threadCount > 1)
 		{
@@ -424,6 +496,8 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 			countStatAdd(&totalStats.genMsgRecvCount, genMsgRecvCount);
 			countStatAdd(&totalStats.latencyGenMsgSentCount, latencyGenMsgSentCount);
 			countStatAdd(&totalStats.genMsgOutOfBuffersCount, genMsgOutOfBuffersCount);
+			countStatAdd(&totalStats.readMsgCount, readMsgCount);
+			countStatAdd(&totalStats.transportReadCount, transportReadCount);
 		}
 
 		if (writeStats)
@@ -476,6 +550,9 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 				clearValueStatistics(&consumerThreads[i].stats.intervalLatencyStats);
 			}
 
+			if (readMsgCount)
+				printf("  Transport reads: %llu, Reads/Msg: %.3f\n", transportReadCount, (double)transportReadCount / (double)readMsgCount);
+
 			if (postOutOfBuffersCount)
 				printf("  - %llu posts not sent due to lack of output buffers.\n", postOutOfBuffersCount);
 
@@ -713,11 +790,16 @@ void printSummaryStatistics(FILE *file)
 							"  Latency avg (usec): %.1f\n"
 							"  Latency std dev (usec): %.1f\n"
 							"  Latency max (usec): %.1f\n"
-							"  Latency min (usec): %.1f\n",
+							"  Latency min (usec): %.1f\n"
+							"  Latency median (usec): %.1f\n"
+							"  Latency 99th percentile (usec): %.1f\n",
 							consumerThreads[i].stats.steadyStateLatencyStats.average,
 							sqrt(consumerThreads[i].stats.steadyStateLatencyStats.variance),
 							consumerThreads[i].stats.steadyStateLatencyStats.maxValue,
-							consumerThreads[i].stats.steadyStateLatencyStats.minValue);
+							consumerThreads[i].stats.steadyStateLatencyStats.minValue,
+							getValueHistogramPercentile(&consumerThreads[i].stats.steadyStateLatencyHist, 0.5),
+							getValueHistogramPercentile(&consumerThreads[i].stats.steadyStateLatencyHist, 0.99));
+					printSplitLatency(file, "  ", &consumerThreads[i].stats);
 				}
 				else
 					fprintf( file, "  No latency information was received during steady-state time.\n");
@@ -811,6 +893,10 @@ void printSummaryStatistics(FILE *file)
 				fprintf(file, "  GenMsg latencies sent: %llu\n", countStatGetTotal(&consumerThreads[i].stats.latencyGenMsgSentCount));
 			if (consumerThreads[i].stats.genMsgLatencyStats.count)
 				fprintf(file, "  GenMsg latencies received: %llu\n", consumerThreads[i].stats.genMsgLatencyStats.count);
+			if (countStatGetTotal(&consumerThreads[i].stats.readMsgCount))
+				fprintf(file, "  Transport reads per msg received: %.3f\n", 
+						(double)countStatGetTotal(&consumerThreads[i].stats.transportReadCount)
+						/ (double)countStatGetTotal(&consumerThreads[i].stats.readMsgCount));
 
 			if (imageRetrievalTime)
 			{
@@ -906,11 +992,16 @@ void printSummaryStatistics(FILE *file)
 					"  Latency avg (usec): %.1f\n"
 					"  Latency std dev (usec): %.1f\n"
 					"  Latency max (usec): %.1f\n"
-					"  Latency min (usec): %.1f\n",
+					"  Latency min (usec): %.1f\n"
+					"  Latency median (usec): %.1f\n"
+					"  Latency 99th percentile (usec): %.1f\n",
 					totalStats.steadyStateLatencyStats.average,
 					sqrt(totalStats.steadyStateLatencyStats.variance),
 					totalStats.steadyStateLatencyStats.maxValue,
-					totalStats.steadyStateLatencyStats.minValue);
+					totalStats.steadyStateLatencyStats.minValue,
+					getValueHistogramPercentile(&totalStats.steadyStateLatencyHist, 0.5),
+					getValueHistogramPercentile(&totalStats.steadyStateLatencyHist, 0.99));
+			printSplitLatency(file, "  ", &totalStats);
 		}
 		else
 			fprintf( file, "  No latency information was received during steady-state time.\n");
@@ -1026,6 +1117,9 @@ void printSummaryStatistics(FILE *file)
 		fprintf(file, "  GenMsg latencies sent: %llu\n", countStatGetTotal(&totalStats.latencyGenMsgSentCount));
 	if (totalStats.genMsgLatencyStats.count)
 		fprintf(file, "  GenMsg latencies received: %llu\n", totalStats.genMsgLatencyStats.count);
+	if (countStatGetTotal(&totalStats.readMsgCount))
+		fprintf(file, "  Transport reads per msg received: %.3f\n", 
+				(double)countStatGetTotal(&totalStats.transportReadCount) / (double)countStatGetTotal(&totalStats.readMsgCount));
 
 	if (totalStats.imageRetrievalEndTime)
 	{
@@ -1039,6 +1133,39 @@ void printSummaryStatistics(FILE *file)
 				(double)consPerfConfig.itemRequestCount/((double)totalRefreshRetrievalTime/1000000000.0));
 	}
 
+	for(i = 0; i < consPerfConfig.threadCount; ++i)
+	{
+		ConsumerStats *pStats = &consumerThreads[i].stats;
+
+		if (!pStats->storedImageCount)
+			continue;
+
+		fprintf(file, "  Stored images, connection %d:\n", i + 1);
+		if (pStats->storedImageEndTime)
+			fprintf(file, "    Time to all stored images (sec): %.3f\n", 
+					(double)(pStats->storedImageEndTime - pStats->imageRetrievalStartTime)/1000000000.0);
+		else
+			fprintf(file, "    Stored images received: %d of %d\n", pStats->storedImageCount, consumerThreads[i].itemListCount);
+	}
+
+	for(i = 0; i < consPerfConfig.threadCount; ++i)
+	{
+		ConsumerStats *pStats = &consumerThreads[i].stats;
+
+		if (!pStats->failoverStartTime)
+			continue;
+
+		fprintf(file, "  Failover, connection %d:\n", i + 1);
+		if (pStats->failoverChannelUpTime)
+			fprintf(file, "    Time to channel up (sec): %.3f\n", 
+					(double)(pStats->failoverChannelUpTime - pStats->failoverStartTime)/1000000000.0);
+		if (pStats->failoverEndTime)
+			fprintf(file, "    Time to all images (sec): %.3f\n", 
+					(double)(pStats->failoverEndTime - pStats->failoverStartTime)/1000000000.0);
+		else
+			fprintf(file, "    Images recovered: %d of %d\n", pStats->failoverRefreshCount, consumerThreads[i].itemListCount);
+	}
+
 
 	fprintf(file, "  Avg update rate: %.0f\n", 
 			(double)totalUpdateCount/(double)((currentTime - firstUpdateTime)/1000000000.0));
@@ -47,6 +47,9 @@ static void clearNIProvPerfConfig()
 
 	niProvPerfConfig.itemPublishCount = 100000;
 	niProvPerfConfig.commonItemCount = 0;
+
+	niProvPerfConfig.useReactor = RSSL_FALSE;
+	niProvPerfConfig.sharedReactor = RSSL_FALSE;
 }
 
 void exitConfigError(char **argv)
@@ -62,6 +65,30 @@ void exitMissingArgument(char **argv, int arg)
 	exit(-1);
 }
 
+/* Splits a comma-separated list into an array of MAX_NIPROV_CONNECT_HOSTS strings of entrySize bytes. 
+ * Returns the number of entries, or -1 if there are too many. */
+static RsslInt32 splitConnectList(const char *list, char *entries, size_t entrySize)
+{
+	RsslInt32 count = 0;
+	const char *pEntry = list;
+
+	do
+	{
+		const char *pComma = strchr(pEntry, ',');
+		size_t length = pComma ? (size_t)(pComma - pEntry) : strlen(pEntry);
+
+		if (count == MAX_NIPROV_CONNECT_HOSTS)
+			return -1;
+
+		snprintf(entries + count * entrySize, entrySize, "%.*s", (int)length, pEntry);
+		++count;
+
+		pEntry = pComma ? pComma + 1 : NULL;
+	} while (pEntry);
+
+	return count;
+}
+
 void initNIProvPerfConfig(int argc, char **argv)
 {
 	int iargs;
@@ -230,6 +257,11 @@ void initNIProvPerfConfig(int argc, char **argv)
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
 			snprintf(providerThreadConfig.msgFilename, sizeof(providerThreadConfig.msgFilename), argv[iargs]);
 		}
+		else if (0 == strcmp("-jsonTickFile", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			snprintf(providerThreadConfig.jsonTickFilename, sizeof(providerThreadConfig.jsonTickFilename), argv[iargs]);
+		}
 		else if (0 == strcmp("-itemCount", argv[iargs]))
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -304,6 +336,11 @@ void initNIProvPerfConfig(int argc, char **argv)
 		{
 			niProvPerfConfig.useReactor = RSSL_TRUE;
 		}
+		else if (0 == strcmp("-sharedReactor", argv[iargs]))
+		{
+			niProvPerfConfig.useReactor = RSSL_TRUE;
+			niProvPerfConfig.sharedReactor = RSSL_TRUE;
+		}
 		else
 		{
 			printf("Config Error: Unrecognized option: %s\n", argv[iargs]);
@@ -339,10 +376,31 @@ void initNIProvPerfConfig(int argc, char **argv)
 		exitConfigError(argv);
 	}
 
+	/* Split the host and port lists. */
+	if ((niProvPerfConfig.connectHostCount = splitConnectList(niProvPerfConfig.hostName, niProvPerfConfig.connectHosts[0], 
+					sizeof(niProvPerfConfig.connectHosts[0]))) < 0)
+	{
+		printf("Config Error: Too many hosts specified.\n");
+		exitConfigError(argv);
+	}
+
+	if ((niProvPerfConfig.connectPortCount = splitConnectList(niProvPerfConfig.portNo, niProvPerfConfig.connectPorts[0], 
+					sizeof(niProvPerfConfig.connectPorts[0]))) < 0)
+	{
+		printf("Config Error: Too many ports specified.\n");
+		exitConfigError(argv);
+	}
+
 	initDirectoryConfig();
 	providerThreadConfigInit();
 }
 
+void getNIProvPerfConnectAddress(RsslInt32 providerIndex, char **pHostName, char **pPortNo)
+{
+	*pHostName = niProvPerfConfig.connectHosts[providerIndex % niProvPerfConfig.connectHostCount];
+	*pPortNo = niProvPerfConfig.connectPorts[providerIndex % niProvPerfConfig.connectPortCount];
+}
+
 static const char *connectionTypeToString(RsslConnectionTypes connType)
 {
 	switch(connType)
@@ -443,6 +501,11 @@ void printNIProvPerfConfig(FILE *file)
 			providerThreadConfig.itemFilename,
 			providerThreadConfig.msgFilename);
 
+	if (providerThreadConfig.jsonTickFilename[0] != '\0')
+		fprintf(file,
+			"        JSON Tick File: %s\n",
+			providerThreadConfig.jsonTickFilename);
+
 	if (providerThreadConfig.totalBuffersPerPack > 1)
 		fprintf(file,
 			"               Packing: Yes(max %d per pack, %u buffer size)\n",
@@ -461,8 +524,10 @@ void printNIProvPerfConfig(FILE *file)
 		  );
 
 	fprintf(file,
-			"           Use Reactor: %s\n\n",
-			(niProvPerfConfig.useReactor ? "Yes" : "No")
+			"           Use Reactor: %s\n"
+			"        Shared Reactor: %s\n\n",
+			(niProvPerfConfig.useReactor ? "Yes" : "No"),
+			(niProvPerfConfig.sharedReactor ? "Yes(items partitioned by name)" : "No")
 		  );
 
 	fprintf(file,
@@ -483,8 +548,9 @@ void exitWithUsage()
 			"  -connType <type>                 Type of connection(\"socket\", \"reliableMCast\")\n"
 			"\n"
 			"Connection options(for socket-based connections):\n"
-			"  -h <hostname>                    Name of host to connect to\n"
-			"  -p <port number>                 Port number\n"
+			"  -h <hostname>                    Name of host to connect to. With multiple threads, a comma-separated list\n"
+			"                                     may be given; threads connect to the hosts in turn.\n"
+			"  -p <port number>                 Port number. A comma-separated list may also be given.\n"
 			"\n"
 			"Connection options(for segmented multicast connections):\n"
 			"  -rp <port number>                Receive port\n"
@@ -515,6 +581,8 @@ void exitWithUsage()
 			"\n"
 			"  -itemFile <file name>            Name of the file to get items from for publishing\n"
 			"  -msgFile <file name>             Name of the file that specifies the data content in messages\n"
+			"  -jsonTickFile <file name>        Name of a file of JSON ticks, one object of fields per line. MarketPrice updates\n"
+			"                                     are encoded from the ticks with the JSON-to-RWF encoder.\n"
 			"  -summaryFile <filename>          Name of file for logging summary info.\n"
 			"  -statsFile <filename>            Base name of file for logging periodic statistics.\n"
 			"  -writeStatsInterval <sec>        Controls how often stats are written to the file.\n"
@@ -526,6 +594,9 @@ void exitWithUsage()
 			"                                     (e.g. \"-threads 0,1 \" creates two threads bound to CPU's 0 and 1)\n"
 
 			"  -reactor                         Use the VA Reactor instead of the UPA Channel for sending and receiving.\n"
+			"  -sharedReactor                   Use one VA Reactor for the channels of all threads. The login, directory and\n"
+			"                                     dictionary are set up once, and items are partitioned across the channels\n"
+			"                                     by a hash of their names.\n"
 			" \n"
 			"  -nanoTime                        Use nanosecond precision for latency information instead of microsecond.\n"
 			"  -preEnc                          Use Pre-Encoded updates\n"
@@ -18,6 +18,8 @@
 extern "C" {
 #endif
 
+#define MAX_NIPROV_CONNECT_HOSTS 16
+
 /* Provides configuration options for the provider. */
 typedef struct 
 {
@@ -50,6 +52,12 @@ typedef struct
 	RsslInt32			commonItemCount;			/* Number of items common to all providers, if using multiple connections. */
 
 	RsslBool			useReactor;					/* Use the VA Reactor instead of the UPA Channel for sending and receiving. */
+	RsslBool			sharedReactor;				/* Publish on all threads' channels through one VA Reactor(-sharedReactor). */
+
+	char				connectHosts[MAX_NIPROV_CONNECT_HOSTS][128];	/* Hosts from the -h list. */
+	RsslInt32			connectHostCount;			/* Number of hosts in the -h list. */
+	char				connectPorts[MAX_NIPROV_CONNECT_HOSTS][32];		/* Ports from the -p list. */
+	RsslInt32			connectPortCount;			/* Number of ports in the -p list. */
 } NIProvPerfConfig;
 
 /* Contains the global application configuration */
@@ -61,6 +69,9 @@ void initNIProvPerfConfig(int argc, char **argv);
 /* Prints out the configuration. */
 void printNIProvPerfConfig(FILE *file);
 
+/* Gets the host and port that a provider thread connects to. Threads use the -h and -p lists in turn. */
+void getNIProvPerfConnectAddress(RsslInt32 providerIndex, char **pHostName, char **pPortNo);
+
 /* Exits the application and prints out usage information. */
 void exitWithUsage();
 
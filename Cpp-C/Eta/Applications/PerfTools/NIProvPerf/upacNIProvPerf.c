@@ -46,6 +46,16 @@ static RsslInt64 nsecPerTick;
 
 RsslBool reactorConnectCount; // Used for when application uses VA Reactor instead of UPA Channel.
 
+/* Used with -sharedReactor. The reactor, role, login request and directory refresh are shared by all 
+ * provider threads, and the reactor is dispatched by its own thread. */
+static RsslReactor *pSharedReactor = NULL;
+static RsslReactorOMMNIProviderRole sharedNIProviderRole;
+static RsslRDMLoginRequest sharedLoginRequest;
+static RsslRDMDirectoryRefresh sharedDirectoryRefresh;
+static RsslThreadId sharedReactorThreadId;
+static fd_set sharedReadFds;
+static fd_set sharedExceptFds;
+
 static void signal_handler(int sig)
 {
 	signal_shutdown = RSSL_TRUE;
@@ -156,8 +166,8 @@ RSSL_THREAD_DECLARE(runNIProvChannelConnection, pArg)
 	}
 	else
 	{
-		copts.connectionInfo.unified.address = niProvPerfConfig.hostName;
-		copts.connectionInfo.unified.serviceName = niProvPerfConfig.portNo;
+		getNIProvPerfConnectAddress(pProviderThread->providerIndex, &copts.connectionInfo.unified.address,
+				&copts.connectionInfo.unified.serviceName);
 		copts.connectionInfo.unified.interfaceName = niProvPerfConfig.interfaceName;
 		copts.tcp_nodelay = niProvPerfConfig.tcpNoDelay;
 		copts.connectionType = RSSL_CONN_TYPE_SOCKET;
@@ -176,7 +186,7 @@ RSSL_THREAD_DECLARE(runNIProvChannelConnection, pArg)
 					niProvPerfConfig.sendAddr, niProvPerfConfig.sendPort, niProvPerfConfig.recvAddr, niProvPerfConfig.recvPort, niProvPerfConfig.unicastPort);
 		else
 			printf("\nAttempting unified connect to server %s:%s...\n", 
-					niProvPerfConfig.hostName, niProvPerfConfig.portNo) ;
+					copts.connectionInfo.unified.address, copts.connectionInfo.unified.serviceName) ;
 
 		if (!(pChannel = rsslConnect(&copts, &error)))
 		{
@@ -231,6 +241,36 @@ RSSL_THREAD_DECLARE(runNIProvChannelConnection, pArg)
 	return RSSL_THREAD_RETURN();
 }
 
+/* Adds a reactor channel's file descriptor to the descriptor sets used to dispatch its reactor. */
+static void setReactorChannelFd(ProviderThread *pProviderThread, RsslSocket socketId)
+{
+	if (niProvPerfConfig.sharedReactor)
+	{
+		FD_SET(socketId, &sharedReadFds);
+		FD_SET(socketId, &sharedExceptFds);
+	}
+	else
+	{
+		FD_SET(socketId, &pProviderThread->readfds);
+		FD_SET(socketId, &pProviderThread->exceptfds);
+	}
+}
+
+/* Removes a reactor channel's file descriptor from the descriptor sets used to dispatch its reactor. */
+static void clearReactorChannelFd(ProviderThread *pProviderThread, RsslSocket socketId)
+{
+	if (niProvPerfConfig.sharedReactor)
+	{
+		FD_CLR(socketId, &sharedReadFds);
+		FD_CLR(socketId, &sharedExceptFds);
+	}
+	else
+	{
+		FD_CLR(socketId, &pProviderThread->readfds);
+		FD_CLR(socketId, &pProviderThread->exceptfds);
+	}
+}
+
 /* 
  * Processes events about the state of an RsslReactorChannel.
  */
@@ -265,8 +305,7 @@ RsslReactorCallbackRet channelEventCallback(RsslReactor *pReactor, RsslReactorCh
             }
 
 			/* Set file descriptor. */
-			FD_SET(pReactorChannel->socketId, &pProviderThread->readfds);
-			FD_SET(pReactorChannel->socketId, &pProviderThread->exceptfds);
+			setReactorChannelFd(pProviderThread, pReactorChannel->socketId);
 
 			if ((ret = rsslReactorGetChannelInfo(pReactorChannel, &reactorChannelInfo, &rsslErrorInfo)) != RSSL_RET_SUCCESS)
 			{
@@ -323,13 +362,17 @@ RsslReactorCallbackRet channelEventCallback(RsslReactor *pReactor, RsslReactorCh
 			}
 
 			RSSL_MUTEX_LOCK(&pProviderThread->newClientSessionsLock);
-			++pProviderThread->clientSessionsCount;
 			pProvSession->pChannelInfo->pChannel = pReactorChannel->pRsslChannel;
 			pProvSession->pChannelInfo->pReactorChannel = pReactorChannel;
 			pProvSession->pChannelInfo->pReactor = pReactor;
-			rsslQueueAddLinkToBack(&pProviderThread->channelHandler.activeChannelList, &pProvSession->pChannelInfo->queueLink);
+			if (!niProvPerfConfig.sharedReactor)
+			{
+				/* With a shared reactor, the provider thread adds the channel itself once it is ready. */
+				++pProviderThread->clientSessionsCount;
+				rsslQueueAddLinkToBack(&pProviderThread->channelHandler.activeChannelList, &pProvSession->pChannelInfo->queueLink);
+			}
 			pProvSession->timeActivated = getTimeNano();
-			RSSL_MUTEX_LOCK(&pProviderThread->newClientSessionsLock);
+			RSSL_MUTEX_UNLOCK(&pProviderThread->newClientSessionsLock);
 
 			return RSSL_RC_CRET_SUCCESS;
 		}
@@ -376,11 +419,25 @@ RsslReactorCallbackRet channelEventCallback(RsslReactor *pReactor, RsslReactorCh
 					/* Shift index by one for each provider that publishes an extra item. */
 					itemListUniqueIndex += itemListCountRemainder;
 
-				if ((ret = providerSessionAddPublishingItems(pProviderThread, pProvSession, 
+				if (niProvPerfConfig.sharedReactor)
+				{
+					/* Items are published on the channel chosen by their name, as an application publishing
+					 * through one provider would route them. */
+					ret = providerSessionAddPublishingItemsByHash(pProviderThread, pProvSession,
+							niProvPerfConfig.commonItemCount, niProvPerfConfig.itemPublishCount,
+							pProviderThread->providerIndex, providerThreadConfig.threadCount,
+							(RsslUInt16)directoryConfig.serviceId);
+				}
+				else
+				{
+					ret = providerSessionAddPublishingItems(pProviderThread, pProvSession, 
 							niProvPerfConfig.commonItemCount, itemListUniqueIndex, itemListCount - niProvPerfConfig.commonItemCount, 
-							(RsslUInt16)directoryConfig.serviceId)) != RSSL_RET_SUCCESS)
+							(RsslUInt16)directoryConfig.serviceId);
+				}
+
+				if (ret != RSSL_RET_SUCCESS)
 				{
-					printf("providerSessionAddPublishingItems() failed\n");
+					printf("Failed to create publishing list.\n");
 					return RSSL_RC_CRET_FAILURE;
 				}
 				else
@@ -398,6 +455,14 @@ RsslReactorCallbackRet channelEventCallback(RsslReactor *pReactor, RsslReactorCh
 
 			reactorConnectCount++;
 
+			if (niProvPerfConfig.sharedReactor && cbRet == RSSL_RC_CRET_SUCCESS)
+			{
+				/* Hand the channel to its provider thread, which starts publishing updates on it. */
+				RSSL_MUTEX_LOCK(&pProviderThread->newClientSessionsLock);
+				++pProviderThread->clientSessionsCount;
+				RSSL_MUTEX_UNLOCK(&pProviderThread->newClientSessionsLock);
+			}
+
 			return cbRet;
 		}
 		case RSSL_RC_CET_FD_CHANGE:
@@ -405,10 +470,8 @@ RsslReactorCallbackRet channelEventCallback(RsslReactor *pReactor, RsslReactorCh
 			/* The file descriptor representing the RsslReactorChannel has been changed.
 			 * Update our file descriptor sets. */
 			printf("Fd change: "SOCKET_PRINT_TYPE" to "SOCKET_PRINT_TYPE"\n", pReactorChannel->oldSocketId, pReactorChannel->socketId);
-			FD_CLR(pReactorChannel->oldSocketId, &pProviderThread->readfds);
-			FD_CLR(pReactorChannel->oldSocketId, &pProviderThread->exceptfds);
-			FD_SET(pReactorChannel->socketId, &pProviderThread->readfds);
-			FD_SET(pReactorChannel->socketId, &pProviderThread->exceptfds);
+			clearReactorChannelFd(pProviderThread, pReactorChannel->oldSocketId);
+			setReactorChannelFd(pProviderThread, pReactorChannel->socketId);
 			return RSSL_RC_CRET_SUCCESS;
 		}
 		case RSSL_RC_CET_CHANNEL_DOWN:
@@ -432,8 +495,7 @@ RsslReactorCallbackRet channelEventCallback(RsslReactor *pReactor, RsslReactorCh
 
 			if (pReactorChannel->socketId != REACTOR_INVALID_SOCKET)
 			{
-				FD_CLR(pReactorChannel->socketId, &pProviderThread->readfds);
-				FD_CLR(pReactorChannel->socketId, &pProviderThread->exceptfds);
+				clearReactorChannelFd(pProviderThread, pReactorChannel->socketId);
 			}
 
 			// only allow one connect
@@ -542,55 +604,17 @@ RsslReactorCallbackRet defaultMsgCallback(RsslReactor *pReactor, RsslReactorChan
 	return RSSL_RC_CRET_SUCCESS;
 }
 
-RSSL_THREAD_DECLARE(runNIProvReactorConnection, pArg)
+/* Configures the connection options for a provider thread's channel. */
+static void initReactorConnectInfo(ProviderThread *pProviderThread, RsslReactorConnectInfo *pInfo)
 {
-	ProviderThread *pProviderThread = (ProviderThread*)pArg;
-	ProviderSession *pProvSession;
-
-	TimeValue nextTickTime;
-	RsslInt32 currentTicks = 0;
-	RsslCreateReactorOptions reactorOpts;
-	RsslReactorConnectOptions cOpts;
-	RsslReactorConnectInfo cInfo;
-	RsslErrorInfo rsslErrorInfo;
-	RsslReactorDispatchOptions dispatchOptions;
-	RsslRet ret = 0;
-
-	if (pProviderThread->cpuId >= 0)
-	{
-		if (bindThread(pProviderThread->cpuId) != RSSL_RET_SUCCESS)
-		{
-			printf("Error: Failed to bind thread to core %d.\n", pProviderThread->cpuId);
-			exit(-1);
-		}
-	}
-
-	FD_ZERO(&pProviderThread->readfds);
-	FD_ZERO(&pProviderThread->exceptfds);
-	FD_ZERO(&pProviderThread->wrtfds);
-
-	rsslClearCreateReactorOptions(&reactorOpts);
-	rsslClearReactorConnectOptions(&cOpts);
-	rsslClearReactorConnectInfo(&cInfo);
-
-	/* Create an RsslReactor which will manage our channels. */
-	if (!(pProviderThread->pReactor = rsslCreateReactor(&reactorOpts, &rsslErrorInfo)))
-	{
-		printf("Error: %s", rsslErrorInfo.rsslError.text);
-		exit(-1);
-	}
-
-	/* Set the reactor's event file descriptor on our descriptor set. This, along with the file descriptors 
-	 * of RsslReactorChannels, will notify us when we should call rsslReactorDispatch(). */
-	FD_SET(pProviderThread->pReactor->eventFd, &pProviderThread->readfds);
-
-	/* Configure connection options. */
-	cInfo.rsslConnectOptions.guaranteedOutputBuffers = niProvPerfConfig.guaranteedOutputBuffers;
-	cInfo.rsslConnectOptions.majorVersion = RSSL_RWF_MAJOR_VERSION;
-	cInfo.rsslConnectOptions.minorVersion = RSSL_RWF_MINOR_VERSION;
-	cInfo.rsslConnectOptions.protocolType = RSSL_RWF_PROTOCOL_TYPE;
-	cInfo.rsslConnectOptions.sysSendBufSize = niProvPerfConfig.sendBufSize;
-	cInfo.rsslConnectOptions.sysRecvBufSize = niProvPerfConfig.recvBufSize;
+	rsslClearReactorConnectInfo(pInfo);
+
+	pInfo->rsslConnectOptions.guaranteedOutputBuffers = niProvPerfConfig.guaranteedOutputBuffers;
+	pInfo->rsslConnectOptions.majorVersion = RSSL_RWF_MAJOR_VERSION;
+	pInfo->rsslConnectOptions.minorVersion = RSSL_RWF_MINOR_VERSION;
+	pInfo->rsslConnectOptions.protocolType = RSSL_RWF_PROTOCOL_TYPE;
+	pInfo->rsslConnectOptions.sysSendBufSize = niProvPerfConfig.sendBufSize;
+	pInfo->rsslConnectOptions.sysRecvBufSize = niProvPerfConfig.recvBufSize;
 	if (niProvPerfConfig.sAddr || niProvPerfConfig.rAddr)
 	{
 		if (niProvPerfConfig.connectionType != RSSL_CONN_TYPE_RELIABLE_MCAST)
@@ -599,55 +623,72 @@ RSSL_THREAD_DECLARE(runNIProvReactorConnection, pArg)
 			exit(-1);
 		}
 
-		cInfo.rsslConnectOptions.connectionInfo.segmented.recvAddress = niProvPerfConfig.recvAddr;
-		cInfo.rsslConnectOptions.connectionInfo.segmented.recvServiceName = niProvPerfConfig.recvPort;
-		cInfo.rsslConnectOptions.connectionInfo.segmented.sendAddress = niProvPerfConfig.sendAddr;
-		cInfo.rsslConnectOptions.connectionInfo.segmented.sendServiceName = niProvPerfConfig.sendPort;
-		cInfo.rsslConnectOptions.connectionInfo.segmented.interfaceName = niProvPerfConfig.interfaceName;
-		cInfo.rsslConnectOptions.connectionInfo.unified.unicastServiceName = niProvPerfConfig.unicastPort;		
-		cInfo.rsslConnectOptions.connectionType = RSSL_CONN_TYPE_RELIABLE_MCAST;
+		pInfo->rsslConnectOptions.connectionInfo.segmented.recvAddress = niProvPerfConfig.recvAddr;
+		pInfo->rsslConnectOptions.connectionInfo.segmented.recvServiceName = niProvPerfConfig.recvPort;
+		pInfo->rsslConnectOptions.connectionInfo.segmented.sendAddress = niProvPerfConfig.sendAddr;
+		pInfo->rsslConnectOptions.connectionInfo.segmented.sendServiceName = niProvPerfConfig.sendPort;
+		pInfo->rsslConnectOptions.connectionInfo.segmented.interfaceName = niProvPerfConfig.interfaceName;
+		pInfo->rsslConnectOptions.connectionInfo.unified.unicastServiceName = niProvPerfConfig.unicastPort;		
+		pInfo->rsslConnectOptions.connectionType = RSSL_CONN_TYPE_RELIABLE_MCAST;
 	}
 	else
 	{
-		cInfo.rsslConnectOptions.connectionInfo.unified.address = niProvPerfConfig.hostName;
-		cInfo.rsslConnectOptions.connectionInfo.unified.serviceName = niProvPerfConfig.portNo;
-		cInfo.rsslConnectOptions.connectionInfo.unified.interfaceName = niProvPerfConfig.interfaceName;
-		cInfo.rsslConnectOptions.tcp_nodelay = niProvPerfConfig.tcpNoDelay;
-		cInfo.rsslConnectOptions.connectionType = RSSL_CONN_TYPE_SOCKET;
+		getNIProvPerfConnectAddress(pProviderThread->providerIndex, &pInfo->rsslConnectOptions.connectionInfo.unified.address,
+				&pInfo->rsslConnectOptions.connectionInfo.unified.serviceName);
+		pInfo->rsslConnectOptions.connectionInfo.unified.interfaceName = niProvPerfConfig.interfaceName;
+		pInfo->rsslConnectOptions.tcp_nodelay = niProvPerfConfig.tcpNoDelay;
+		pInfo->rsslConnectOptions.connectionType = RSSL_CONN_TYPE_SOCKET;
 	}
+}
 
-	// set NIProvider role information
-	rsslClearOMMNIProviderRole(&pProviderThread->niProviderRole);
-	pProviderThread->niProviderRole.base.channelEventCallback = channelEventCallback;
-	pProviderThread->niProviderRole.base.defaultMsgCallback = defaultMsgCallback;
-	pProviderThread->niProviderRole.loginMsgCallback = loginMsgCallback;
+/* Sets up an NIProvider role, with the login request and directory refresh it sends. */
+static void initNIProviderRole(RsslReactorOMMNIProviderRole *pRole, RsslRDMLoginRequest *pLoginRequest, 
+		RsslRDMDirectoryRefresh *pDirectoryRefresh)
+{
+	rsslClearOMMNIProviderRole(pRole);
+	pRole->base.channelEventCallback = channelEventCallback;
+	pRole->base.defaultMsgCallback = defaultMsgCallback;
+	pRole->loginMsgCallback = loginMsgCallback;
 
 	/* Initialize the default login request(Use 1 as the Login Stream ID). */
-	if (rsslInitDefaultRDMLoginRequest(&pProviderThread->loginRequest, 1) != RSSL_RET_SUCCESS)
+	if (rsslInitDefaultRDMLoginRequest(pLoginRequest, 1) != RSSL_RET_SUCCESS)
 	{
 		printf("rsslInitDefaultRDMLoginRequest() failed\n");
 		exit(-1);
 	}
-	pProviderThread->loginRequest.flags |= RDM_LG_RQF_HAS_ROLE;
-	pProviderThread->loginRequest.role = RDM_LOGIN_ROLE_PROV;
+	pLoginRequest->flags |= RDM_LG_RQF_HAS_ROLE;
+	pLoginRequest->role = RDM_LOGIN_ROLE_PROV;
 	/* If a username was specified, change username on login request. */
 	if (strlen(niProvPerfConfig.username) > 0)
 	{
-		pProviderThread->loginRequest.userName.data = niProvPerfConfig.username;
-		pProviderThread->loginRequest.userName.length = (rtrUInt32)strlen(niProvPerfConfig.username);
+		pLoginRequest->userName.data = niProvPerfConfig.username;
+		pLoginRequest->userName.length = (rtrUInt32)strlen(niProvPerfConfig.username);
 	}
-	pProviderThread->niProviderRole.pLoginRequest = &pProviderThread->loginRequest;
+	pRole->pLoginRequest = pLoginRequest;
 
 	/* Initialize the default directory refresh(Use -1 as the Directory Stream ID). */
-	rsslClearRDMDirectoryRefresh(&pProviderThread->directoryRefresh);
-	pProviderThread->directoryRefresh.flags = RDM_DR_RFF_HAS_SERVICE_ID | RDM_DR_RFF_CLEAR_CACHE;
-	pProviderThread->directoryRefresh.filter = RDM_DIRECTORY_SERVICE_INFO_FILTER | RDM_DIRECTORY_SERVICE_STATE_FILTER | RDM_DIRECTORY_SERVICE_GROUP_FILTER;
-	pProviderThread->directoryRefresh.rdmMsgBase.streamId = -1;
+	rsslClearRDMDirectoryRefresh(pDirectoryRefresh);
+	pDirectoryRefresh->flags = RDM_DR_RFF_HAS_SERVICE_ID | RDM_DR_RFF_CLEAR_CACHE;
+	pDirectoryRefresh->filter = RDM_DIRECTORY_SERVICE_INFO_FILTER | RDM_DIRECTORY_SERVICE_STATE_FILTER | RDM_DIRECTORY_SERVICE_GROUP_FILTER;
+	pDirectoryRefresh->rdmMsgBase.streamId = -1;
 
-	pProviderThread->directoryRefresh.serviceList = &service;
-	pProviderThread->directoryRefresh.serviceCount = 1;
+	pDirectoryRefresh->serviceList = &service;
+	pDirectoryRefresh->serviceCount = 1;
 	
-	pProviderThread->niProviderRole.pDirectoryRefresh = &pProviderThread->directoryRefresh;
+	pRole->pDirectoryRefresh = pDirectoryRefresh;
+}
+
+/* Creates the provider thread's session and connects its channel through the thread's reactor. */
+static ProviderSession *connectReactorSession(ProviderThread *pProviderThread, RsslReactorOMMNIProviderRole *pRole)
+{
+	ProviderSession *pProvSession;
+	RsslReactorConnectOptions cOpts;
+	RsslReactorConnectInfo cInfo;
+	RsslErrorInfo rsslErrorInfo;
+	RsslRet ret;
+
+	rsslClearReactorConnectOptions(&cOpts);
+	initReactorConnectInfo(pProviderThread, &cInfo);
 
 	// connect via Reactor
 	if (niProvPerfConfig.sAddr || niProvPerfConfig.rAddr)
@@ -655,7 +696,7 @@ RSSL_THREAD_DECLARE(runNIProvReactorConnection, pArg)
 				niProvPerfConfig.sendAddr, niProvPerfConfig.sendPort, niProvPerfConfig.recvAddr, niProvPerfConfig.recvPort, niProvPerfConfig.unicastPort);
 	else
 		printf("\nAttempting unified connect to server %s:%s...\n", 
-				niProvPerfConfig.hostName, niProvPerfConfig.portNo) ;
+				cInfo.rsslConnectOptions.connectionInfo.unified.address, cInfo.rsslConnectOptions.connectionInfo.unified.serviceName) ;
 
 	// create provider session here and link to provider thread
 	if (!(pProvSession = providerSessionCreate(pProviderThread, NULL)))
@@ -672,12 +713,58 @@ RSSL_THREAD_DECLARE(runNIProvReactorConnection, pArg)
 	cOpts.reactorConnectionList = &cInfo;
 	cOpts.connectionCount = 1;
 
-    if ((ret = rsslReactorConnect(pProviderThread->pReactor, &cOpts, (RsslReactorChannelRole *)&pProviderThread->niProviderRole, &rsslErrorInfo)) < RSSL_RET_SUCCESS)
+    if ((ret = rsslReactorConnect(pProviderThread->pReactor, &cOpts, (RsslReactorChannelRole *)pRole, &rsslErrorInfo)) < RSSL_RET_SUCCESS)
     {
 		printf("rsslReactorConnect failed with return code: %d error = %s", ret,  rsslErrorInfo.rsslError.text);
 		exit(-1);
     }		
 
+	return pProvSession;
+}
+
+RSSL_THREAD_DECLARE(runNIProvReactorConnection, pArg)
+{
+	ProviderThread *pProviderThread = (ProviderThread*)pArg;
+	ProviderSession *pProvSession;
+
+	TimeValue nextTickTime;
+	RsslInt32 currentTicks = 0;
+	RsslCreateReactorOptions reactorOpts;
+	RsslErrorInfo rsslErrorInfo;
+	RsslReactorDispatchOptions dispatchOptions;
+	RsslRet ret = 0;
+
+	if (pProviderThread->cpuId >= 0)
+	{
+		if (bindThread(pProviderThread->cpuId) != RSSL_RET_SUCCESS)
+		{
+			printf("Error: Failed to bind thread to core %d.\n", pProviderThread->cpuId);
+			exit(-1);
+		}
+	}
+
+	FD_ZERO(&pProviderThread->readfds);
+	FD_ZERO(&pProviderThread->exceptfds);
+	FD_ZERO(&pProviderThread->wrtfds);
+
+	rsslClearCreateReactorOptions(&reactorOpts);
+
+	/* Create an RsslReactor which will manage our channels. */
+	if (!(pProviderThread->pReactor = rsslCreateReactor(&reactorOpts, &rsslErrorInfo)))
+	{
+		printf("Error: %s", rsslErrorInfo.rsslError.text);
+		exit(-1);
+	}
+
+	/* Set the reactor's event file descriptor on our descriptor set. This, along with the file descriptors 
+	 * of RsslReactorChannels, will notify us when we should call rsslReactorDispatch(). */
+	FD_SET(pProviderThread->pReactor->eventFd, &pProviderThread->readfds);
+
+	// set NIProvider role information
+	initNIProviderRole(&pProviderThread->niProviderRole, &pProviderThread->loginRequest, &pProviderThread->directoryRefresh);
+
+	pProvSession = connectReactorSession(pProviderThread, &pProviderThread->niProviderRole);
+
 	nextTickTime = getTimeNano() + nsecPerTick;
 
 	rsslClearReactorDispatchOptions(&dispatchOptions);
@@ -756,6 +843,145 @@ RSSL_THREAD_DECLARE(runNIProvReactorConnection, pArg)
 	return RSSL_THREAD_RETURN();
 }
 
+/* Waits until the given time. */
+static void waitUntilTime(TimeValue stopTime)
+{
+	TimeValue currentTime;
+
+	while ((currentTime = getTimeNano()) < stopTime && !signal_shutdown)
+	{
+#ifdef WIN32
+		Sleep((DWORD)((stopTime - currentTime)/1000000));
+#else
+		struct timeval time_interval;
+
+		time_interval.tv_sec = 0;
+		time_interval.tv_usec = (long)((stopTime - currentTime)/1000);
+		select(0, NULL, NULL, NULL, &time_interval);
+#endif
+	}
+}
+
+/* Provider thread for -sharedReactor. Connects the thread's channel through the shared reactor, and publishes
+ * on it once the dispatching thread has set it up. */
+RSSL_THREAD_DECLARE(runNIProvSharedReactorConnection, pArg)
+{
+	ProviderThread *pProviderThread = (ProviderThread*)pArg;
+	ProviderSession *pProvSession;
+	RsslBool sessionActive = RSSL_FALSE;
+
+	TimeValue nextTickTime;
+	RsslInt32 currentTicks = 0;
+
+	if (pProviderThread->cpuId >= 0)
+	{
+		if (bindThread(pProviderThread->cpuId) != RSSL_RET_SUCCESS)
+		{
+			printf("Error: Failed to bind thread to core %d.\n", pProviderThread->cpuId);
+			exit(-1);
+		}
+	}
+
+	pProviderThread->pReactor = pSharedReactor;
+	pProvSession = connectReactorSession(pProviderThread, &sharedNIProviderRole);
+
+	nextTickTime = getTimeNano() + nsecPerTick;
+
+	/* this is the main loop */
+	while(rtrLikely(!signal_shutdown))
+	{
+		for (currentTicks = 0; currentTicks < providerThreadConfig.ticksPerSec; ++currentTicks)
+		{
+			waitUntilTime(nextTickTime);
+
+			nextTickTime += nsecPerTick;
+
+			/* The channel is counted once the dispatching thread has created its publishing list and sent the
+			 * first refreshes. */
+			if (!sessionActive && providerThreadGetConnectionCount(pProviderThread) > 0)
+			{
+				rsslQueueAddLinkToBack(&pProviderThread->channelHandler.activeChannelList, &pProvSession->pChannelInfo->queueLink);
+				sessionActive = RSSL_TRUE;
+			}
+
+			if (sessionActive &&
+				pProvSession->pChannelInfo->pReactorChannel->pRsslChannel &&
+				pProvSession->pChannelInfo->pReactorChannel->pRsslChannel->state == RSSL_CH_STATE_ACTIVE)
+			{
+				providerThreadSendMsgBurst(pProviderThread, nextTickTime);
+			}
+		}
+	}
+
+	return RSSL_THREAD_RETURN();
+}
+
+/* Dispatches the shared reactor for -sharedReactor. All reactor callbacks run on this thread. */
+RSSL_THREAD_DECLARE(runNIProvSharedReactorDispatch, pArg)
+{
+	RsslErrorInfo rsslErrorInfo;
+	RsslReactorDispatchOptions dispatchOptions;
+	RsslRet ret;
+
+	rsslClearReactorDispatchOptions(&dispatchOptions);
+
+	while(rtrLikely(!signal_shutdown))
+	{
+		int selRet;
+		struct timeval time_interval;
+		fd_set useRead = sharedReadFds;
+		fd_set useExcept = sharedExceptFds;
+
+		time_interval.tv_sec = 0;
+		time_interval.tv_usec = 100000;
+
+		selRet = select(FD_SETSIZE, &useRead, NULL, &useExcept, &time_interval);
+
+		if (selRet > 0)
+		{
+			while ((ret = rsslReactorDispatch(pSharedReactor, &dispatchOptions, &rsslErrorInfo)) > RSSL_RET_SUCCESS) {}
+			if (ret < RSSL_RET_SUCCESS)
+			{
+				printf("rsslReactorDispatch failed with return code: %d error = %s", ret,  rsslErrorInfo.rsslError.text);
+				exit(-1);
+			}
+		}
+#ifdef WIN32
+		else if (selRet < 0 && WSAGetLastError() != WSAEINTR)
+#else 
+		else if (selRet < 0 && errno != EINTR)
+#endif
+		{
+			perror("select");
+			exit(-1);
+		}
+	}
+
+	return RSSL_THREAD_RETURN();
+}
+
+/* Creates the reactor and role shared by all provider threads for -sharedReactor. */
+static void createSharedReactor()
+{
+	RsslCreateReactorOptions reactorOpts;
+	RsslErrorInfo rsslErrorInfo;
+
+	rsslClearCreateReactorOptions(&reactorOpts);
+
+	if (!(pSharedReactor = rsslCreateReactor(&reactorOpts, &rsslErrorInfo)))
+	{
+		printf("Error: %s", rsslErrorInfo.rsslError.text);
+		exit(-1);
+	}
+
+	FD_ZERO(&sharedReadFds);
+	FD_ZERO(&sharedExceptFds);
+	FD_SET(pSharedReactor->eventFd, &sharedReadFds);
+
+	/* One login request and directory refresh is used for every channel. */
+	initNIProviderRole(&sharedNIProviderRole, &sharedLoginRequest, &sharedDirectoryRefresh);
+}
+
 int main(int argc, char **argv)
 {
 	RsslError error;
@@ -803,6 +1029,18 @@ int main(int argc, char **argv)
 	{
 		startProviderThreads(&provider, runNIProvChannelConnection);
 	}
+	else if (niProvPerfConfig.sharedReactor) // use one UPA VA Reactor for all threads
+	{
+		reactorConnectCount = 0;
+		createSharedReactor();
+		startProviderThreads(&provider, runNIProvSharedReactorConnection);
+
+		if (RSSL_THREAD_START(&sharedReactorThreadId, runNIProvSharedReactorDispatch, NULL) < 0)
+		{
+			printf("Failed to start reactor dispatch thread.\n");
+			exit(-1);
+		}
+	}
 	else // use UPA VA Reactor
 	{
 		reactorConnectCount = 0;
@@ -1127,6 +1365,10 @@ void processInactiveChannel(ChannelHandler *pChanHandler, ChannelInfo *pChannelI
 void cleanUpAndExit()
 {
 	providerWaitForThreads(&provider);
+
+	if (pSharedReactor)
+		RSSL_THREAD_JOIN(sharedReactorThreadId);
+
 	providerCollectStats(&provider, RSSL_FALSE, RSSL_FALSE, 0, 0);
 	providerPrintSummaryStats(&provider, stdout);
 	providerPrintSummaryStats(&provider, summaryFile);
@@ -1141,6 +1383,15 @@ void cleanUpAndExit()
 
 	providerCleanup(&provider);
 
+	/* The provider threads' channels are closed through the shared reactor, so it is destroyed last. */
+	if (pSharedReactor)
+	{
+		RsslErrorInfo rsslErrorInfo;
+
+		rsslDestroyReactor(pSharedReactor, &rsslErrorInfo);
+		pSharedReactor = NULL;
+	}
+
 	providerThreadConfigCleanup();
 
 	if (niProvPerfConfig.useReactor == RSSL_FALSE) // use UPA Channel
@@ -120,6 +120,9 @@ RsslRet processLoginRequest(ChannelHandler *pChannelHandler, ChannelInfo* pChann
 		loginRefresh.supportOMMPost = 1;
 		loginRefresh.flags |= RDM_LG_RFF_HAS_SUPPORT_POST;
 
+		loginRefresh.supportBatchRequests = RDM_LOGIN_BATCH_SUPPORT_REQUESTS;
+		loginRefresh.flags |= RDM_LG_RFF_HAS_SUPPORT_BATCH;
+
 		loginRefresh.flags |= RDM_LG_RFF_SOLICITED;
 
 		rsslClearEncodeIterator(&eIter);
@@ -208,6 +211,9 @@ RsslRet processLoginRequestReactor(RsslReactor *pReactor, RsslReactorChannel *pR
 		loginRefresh.supportOMMPost = 1;
 		loginRefresh.flags |= RDM_LG_RFF_HAS_SUPPORT_POST;
 
+		loginRefresh.supportBatchRequests = RDM_LOGIN_BATCH_SUPPORT_REQUESTS;
+		loginRefresh.flags |= RDM_LG_RFF_HAS_SUPPORT_BATCH;
+
 		loginRefresh.flags |= RDM_LG_RFF_SOLICITED;
 
 		rsslClearEncodeIterator(&eIter);
@@ -36,6 +36,7 @@ static void clearProvPerfConfig()
 	snprintf(provPerfConfig.summaryFilename, sizeof(provPerfConfig.summaryFilename), "ProvSummary.out");
 	provPerfConfig.writeStatsInterval = 5;
 	provPerfConfig.displayStats = RSSL_TRUE;
+	provPerfConfig.packingLatencyBudget = 0;
 }
 
 void exitConfigError(char **argv)
@@ -122,6 +123,30 @@ void initProvPerfConfig(int argc, char **argv)
 				pToken = strtok(NULL, ",");
 			}
 
+		}
+		else if (0 == strcmp("-workerThreads", argv[iargs]))
+		{
+			char *pToken;
+
+			providerThreadConfig.workerThreadCount = 0;
+
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+
+			providerThreadConfig.workerThreadBindList = (RsslInt32*)malloc(128 * sizeof(RsslInt32));
+			pToken = strtok(argv[iargs], ",");
+			while(pToken)
+			{
+				if (++providerThreadConfig.workerThreadCount > 128)
+				{
+					printf("Config Error: Too many worker threads specified.\n");
+					exitConfigError(argv);
+				}
+
+				sscanf(pToken, "%d", &providerThreadConfig.workerThreadBindList[providerThreadConfig.workerThreadCount-1]);
+
+				pToken = strtok(NULL, ",");
+			}
+
 		}
 		else if (0 == strcmp("-outputBufs", argv[iargs]))
 		{
@@ -251,6 +276,12 @@ void initProvPerfConfig(int argc, char **argv)
 		{
 			provPerfConfig.useReactor = RSSL_TRUE;
 		}
+		else if (0 == strcmp("-packLatencyBudget", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &provPerfConfig.packingLatencyBudget);
+			provPerfConfig.useReactor = RSSL_TRUE;
+		}
 		else
 		{
 			printf("Config Error: Unrecognized option: %s\n", argv[iargs]);
@@ -271,6 +302,12 @@ void initProvPerfConfig(int argc, char **argv)
 		exitConfigError(argv);
 	}
 
+	if (provPerfConfig.packingLatencyBudget > 0 && providerThreadConfig.totalBuffersPerPack > 1)
+	{
+		printf("Config Error: -packLatencyBudget cannot be used with -maxPackCount, as the reactor does the packing.\n");
+		exitConfigError(argv);
+	}
+
 	loginConfig.applicationName = applicationName;
 	loginConfig.applicationId = applicationId;
 	setLoginConfigPosition();
@@ -286,11 +323,23 @@ void printProvPerfConfig(FILE *file)
 	int i;
 	int threadStringPos = 0;
 	char threadString[128];
+	int workerStringPos = 0;
+	char workerString[128];
 
 	/* Build thread list */
 	threadStringPos += snprintf(threadString, 128, "%d", providerThreadConfig.threadBindList[0]);
 	for(i = 1; i < providerThreadConfig.threadCount; ++i)
 		threadStringPos += snprintf(threadString + threadStringPos, 128 - threadStringPos, ",%d", providerThreadConfig.threadBindList[i]);
+
+	/* Build reactor worker thread list */
+	if (providerThreadConfig.workerThreadCount)
+	{
+		workerStringPos += snprintf(workerString, 128, "%d", providerThreadConfig.workerThreadBindList[0]);
+		for(i = 1; i < providerThreadConfig.workerThreadCount; ++i)
+			workerStringPos += snprintf(workerString + workerStringPos, 128 - workerStringPos, ",%d", providerThreadConfig.workerThreadBindList[i]);
+	}
+	else
+		snprintf(workerString, 128, "(none)");
 	
 
 
@@ -300,6 +349,7 @@ void printProvPerfConfig(FILE *file)
 			"                Run Time: %u\n"
 			"                    Port: %s\n"
 			"             Thread List: %s\n"
+			"      Worker Thread List: %s\n"
 			"          Output Buffers: %u\n"
 			"       Max Fragment Size: %u\n"
 			"        Send Buffer Size: %u%s\n"
@@ -317,6 +367,7 @@ void printProvPerfConfig(FILE *file)
 			provPerfConfig.runTime,
 			provPerfConfig.portNo,
 			threadString,
+			workerString,
 			provPerfConfig.guaranteedOutputBuffers,
 			provPerfConfig.maxFragmentSize,
 			provPerfConfig.sendBufSize, (provPerfConfig.sendBufSize ? " bytes" : "(use default)"),
@@ -353,6 +404,10 @@ void printProvPerfConfig(FILE *file)
 			"                 Packing: Yes(max %d per pack, %u buffer size)\n",
 			providerThreadConfig.totalBuffersPerPack,
 			providerThreadConfig.packingBufferLength);
+	else if (provPerfConfig.packingLatencyBudget > 0)
+		fprintf(file,
+			"                 Packing: Yes(by reactor, %u usec latency budget)\n",
+			provPerfConfig.packingLatencyBudget);
 	else
 		fprintf(file,
 			"                 Packing: No\n");
@@ -421,12 +476,16 @@ void exitWithUsage()
 			"  -runTime <sec>                       Runtime of the application, in seconds\n"
 			"  -threads <thread list>               List of threads, by their bound CPU. Comma-separated list. -1 means do not bind.\n"
 			"                                        (e.g. \"-threads 0,1 \" creates two threads bound to CPU's 0 and 1)\n"
+			"  -workerThreads <thread list>         With -reactor, CPU's to bind the reactor worker thread of each provider\n"
+			"                                        thread to, in the same order as -threads. -1 means do not bind.\n"
 			"\n"
 			"  -preEnc                              Use Pre-Encoded updates\n"
 			"  -nanoTime                            Use nanosecond precision for latency information instead of microsecond.\n"
 			"  -measureEncode                       Measure encoding time of messages.\n"
 			"\n"
 			"  -reactor                             Use the VA Reactor instead of the UPA Channel for sending and receiving.\n"
+			"  -packLatencyBudget <usec>            Use the VA Reactor, and have it pack messages that it can send within this many\n"
+			"                                        microseconds of the first message in the buffer(cannot be used with -maxPackCount)\n"
 			"\n"
 			);
 #ifdef _WIN32
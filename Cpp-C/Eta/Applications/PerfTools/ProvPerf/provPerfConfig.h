@@ -33,6 +33,7 @@ typedef struct
 	RsslUInt32			writeStatsInterval;			/* Controls how often statistics are written. */
 	RsslBool			displayStats;				/* Controls whether stats appear on the screen. */
 	RsslBool			useReactor;					/* Use the VA Reactor instead of the UPA Channel for sending and receiving. */
+	RsslUInt32			packingLatencyBudget;		/* Latency budget, in microseconds, for the reactor to pack messages. See -packLatencyBudget */
 } ProvPerfConfig;
 
 /* Contains the global application configuration */
@@ -126,6 +126,7 @@ RSSL_THREAD_DECLARE(runReactorConnectionHandler, pArg)
 
 	// create reactor
 	rsslClearCreateReactorOptions(&reactorOpts);
+	reactorOpts.cpuBindWorkerThread = pProvThread->workerCpuId;
 
 	if (!(pProvThread->pReactor = rsslCreateReactor(&reactorOpts, &rsslErrorInfo)))
 	{
@@ -480,6 +481,7 @@ static RsslRet acceptReactorConnection(RsslServer *pRsslSrvr, RsslErrorInfo *pRs
 
 	rsslClearReactorAcceptOptions(&aopts);
 	aopts.rsslAcceptOptions.userSpecPtr = pProvSession;
+	aopts.packingLatencyBudget = provPerfConfig.packingLatencyBudget;
 
 	if ((ret = rsslReactorAccept(pProvThread->pReactor, pRsslSrvr, &aopts, (RsslReactorChannelRole*)&providerRole, &rsslErrorInfo))
 			!= RSSL_RET_SUCCESS)
@@ -935,6 +937,10 @@ static RsslRet processItemRequest(ProviderThread *pProvThread, ProviderSession *
 	switch(msg->msgBase.msgClass)
 	{
 	case RSSL_MC_REQUEST:
+		/* Items in a batch request are counted individually. */
+		if (msg->requestMsg.flags & RSSL_RQMF_HAS_BATCH)
+			return processBatchRequest(pProvThread, pProvSession, msg, dIter);
+
 		countStatIncr(&pProvThread->itemRequestCount);
 
 		/* get key */
@@ -1072,6 +1078,96 @@ static RsslRet processItemRequest(ProviderThread *pProvThread, ProviderSession *
 	return ret;
 }
 
+static RsslRet processBatchRequest(ProviderThread *pProvThread, ProviderSession *pProvSession, RsslMsg* msg, RsslDecodeIterator* dIter)
+{
+	RsslRet ret;
+	RsslElementList elementList;
+	RsslElementEntry elementEntry;
+	RsslArray batchArray;
+	RsslBuffer batchName;
+	RsslMsg itemMsg;
+	RsslInt32 itemStreamId = msg->msgBase.streamId;
+	RsslStatusMsg statusMsg;
+	RsslEncodeIterator eIter;
+	RsslChannel *pChannel = pProvSession->pChannelInfo->pChannel;
+
+	if (msg->msgBase.containerType != RSSL_DT_ELEMENT_LIST)
+	{
+		printf("\nReceived batch request with unexpected container type %d\n", msg->msgBase.containerType);
+		return RSSL_RET_FAILURE;
+	}
+
+	if ((ret = rsslDecodeElementList(dIter, &elementList, NULL)) != RSSL_RET_SUCCESS)
+	{
+		printf("\nrsslDecodeElementList() failed: %d\n", ret);
+		return ret;
+	}
+
+	while ((ret = rsslDecodeElementEntry(dIter, &elementEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (ret < RSSL_RET_SUCCESS)
+		{
+			printf("\nrsslDecodeElementEntry() failed: %d\n", ret);
+			return ret;
+		}
+
+		if (!rsslBufferIsEqual(&elementEntry.name, &RSSL_ENAME_BATCH_ITEM_LIST))
+			continue;
+
+		if ((ret = rsslDecodeArray(dIter, &batchArray)) < RSSL_RET_SUCCESS)
+		{
+			printf("\nrsslDecodeArray() failed: %d\n", ret);
+			return ret;
+		}
+
+		/* Each item is requested as if by its own request, on the streams following the batch stream. */
+		while ((ret = rsslDecodeArrayEntry(dIter, &batchName)) != RSSL_RET_END_OF_CONTAINER)
+		{
+			if (ret < RSSL_RET_SUCCESS)
+			{
+				printf("\nrsslDecodeArrayEntry() failed: %d\n", ret);
+				return ret;
+			}
+
+			itemMsg = *msg;
+			itemMsg.requestMsg.flags &= ~RSSL_RQMF_HAS_BATCH;
+			itemMsg.msgBase.streamId = ++itemStreamId;
+			itemMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+			itemMsg.msgBase.msgKey.flags |= RSSL_MKF_HAS_NAME;
+			itemMsg.msgBase.msgKey.name = batchName;
+
+			if ((ret = processItemRequest(pProvThread, pProvSession, &itemMsg, dIter)) < RSSL_RET_SUCCESS)
+				return ret;
+		}
+	}
+
+	/* Close the batch stream. */
+	if ((ret = getItemMsgBuffer(pProvThread, pProvSession, 128)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	rsslClearStatusMsg(&statusMsg);
+	statusMsg.msgBase.streamId = msg->msgBase.streamId;
+	statusMsg.msgBase.domainType = msg->msgBase.domainType;
+	statusMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	statusMsg.flags = RSSL_STMF_HAS_STATE;
+	statusMsg.state.streamState = RSSL_STREAM_CLOSED;
+	statusMsg.state.dataState = RSSL_DATA_OK;
+	statusMsg.state.code = RSSL_SC_NONE;
+
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorRWFVersion(&eIter, pChannel->majorVersion, pChannel->minorVersion);
+	rsslSetEncodeIteratorBuffer(&eIter, pProvSession->pWritingBuffer);
+
+	if ((ret = rsslEncodeMsg(&eIter, (RsslMsg*)&statusMsg)) < RSSL_RET_SUCCESS)
+	{
+		printf("\nrsslEncodeMsg() failed: %d\n", ret);
+		return ret;
+	}
+	pProvSession->pWritingBuffer->length = rsslGetEncodedBufferLength(&eIter);
+
+	return sendItemMsgBuffer(pProvThread, pProvSession, RSSL_TRUE);
+}
+
 static ItemInfo *findAlreadyOpenItem(ProviderSession *pProvSession, RsslMsg* msg, RsslItemAttributes* attribs)
 {
 	HashTableLink *pLink = hashTableFind(&pProvSession->itemAttributesTable, attribs);
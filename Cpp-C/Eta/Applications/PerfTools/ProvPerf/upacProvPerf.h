@@ -53,6 +53,9 @@ static RsslRet sendToLeastLoadedThread(RsslChannel *chnl);
 /* Adds an item request to the watchlist, if the request is legal. */
 static RsslRet processItemRequest(ProviderThread *pHandler, ProviderSession *watchlist, RsslMsg* msg, RsslDecodeIterator* dIter);
 
+/* Processes a batch request, adding a request for each of its items to the watchlist. */
+static RsslRet processBatchRequest(ProviderThread *pHandler, ProviderSession *watchlist, RsslMsg* msg, RsslDecodeIterator* dIter);
+
 /* Searches for an item in the watchlist that matches the given attributes.  */
 static ItemInfo *findAlreadyOpenItem(ProviderSession *watchlist, RsslMsg* msg, RsslItemAttributes* attribs);
 
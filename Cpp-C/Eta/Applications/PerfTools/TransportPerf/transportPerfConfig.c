@@ -39,6 +39,7 @@ static void clearTransportPerfConfig()
 	transportPerfConfig.maxFragmentSize = 6144;
 	transportPerfConfig.sendBufSize = 0;
 	transportPerfConfig.recvBufSize = 0;
+	transportPerfConfig.readAheadSize = 0;
 	transportPerfConfig.compressionType = RSSL_COMP_NONE;
 	transportPerfConfig.compressionLevel = 5;
 	transportPerfConfig.highWaterMark = 0;
@@ -54,6 +55,10 @@ static void clearTransportPerfConfig()
 	transportPerfConfig.sAddr = RSSL_FALSE;
 	transportPerfConfig.rAddr = RSSL_FALSE;
 	transportPerfConfig.takeMCastStats = RSSL_FALSE;
+	snprintf(transportPerfConfig.libsslName, sizeof(transportPerfConfig.libsslName), "");
+	snprintf(transportPerfConfig.libcryptoName, sizeof(transportPerfConfig.libcryptoName), "");
+	transportPerfConfig.sessionResumption = RSSL_TRUE;
+	transportPerfConfig.reconnectStormCount = 0;
 
 
 	transportPerfConfig.appType = APPTYPE_SERVER;
@@ -156,6 +161,25 @@ void initTransportPerfConfig(int argc, char **argv)
 			else
 				transportPerfConfig.connectionType = RSSL_CONN_TYPE_INIT; /* error */
 		}
+		else if (0 == strcmp("-libsslName", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			snprintf(transportPerfConfig.libsslName, sizeof(transportPerfConfig.libsslName), "%s", argv[iargs]);
+		}
+		else if (0 == strcmp("-libcryptoName", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			snprintf(transportPerfConfig.libcryptoName, sizeof(transportPerfConfig.libcryptoName), "%s", argv[iargs]);
+		}
+		else if (0 == strcmp("-noSessionResumption", argv[iargs]))
+		{
+			transportPerfConfig.sessionResumption = RSSL_FALSE;
+		}
+		else if (0 == strcmp("-reconnectStorm", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			transportPerfConfig.reconnectStormCount = atoi(argv[iargs]);
+		}
 		else if (0 == strcmp("-appType", argv[iargs]))
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -203,6 +227,11 @@ void initTransportPerfConfig(int argc, char **argv)
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
 			sscanf(argv[iargs], "%d", &transportPerfConfig.recvBufSize);
 		}
+		else if (0 == strcmp("-readAhead", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &transportPerfConfig.readAheadSize);
+		}
 		else if (0 == strcmp("-highWaterMark", argv[iargs]))
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -366,6 +395,20 @@ void initTransportPerfConfig(int argc, char **argv)
 		exitConfigError(argv);
 	}
 
+	if (transportPerfConfig.appType == APPTYPE_SERVER &&
+		transportPerfConfig.connectionType == RSSL_CONN_TYPE_ENCRYPTED)
+	{
+		/* Servers do not accept encrypted connections directly; see the readme for running behind a TLS endpoint. */
+		printf("Config Error: appType for encrypted connections must be client. Run the server with -connType socket behind a TLS endpoint.\n");
+		exitConfigError(argv);
+	}
+
+	if (transportPerfConfig.reconnectStormCount > 0 && transportPerfConfig.appType != APPTYPE_CLIENT)
+	{
+		printf("Config Error: -reconnectStorm requires appType client.\n");
+		exitConfigError(argv);
+	}
+
 	if (transportPerfConfig.connectionType == RSSL_CONN_TYPE_INIT)
 	{
 		printf("Config Error: Unknown connectionType. Valid types are \"socket\", \"http\", \"encrypted\", \"reliableMCast\", \"shmem\", \"seqMCast\" \n");
@@ -469,6 +512,7 @@ void printTransportPerfConfig(FILE *file)
 			"     Max Fragment Size: %u\n"
 			"      Send Buffer Size: %u%s\n"
 			"      Recv Buffer Size: %u%s\n"
+			"       Read-Ahead Size: %u%s\n"
 			"       High Water Mark: %u%s\n"
 			"      Compression Type: %s(%u)\n"
 			"     Compression Level: %u\n"
@@ -493,6 +537,7 @@ void printTransportPerfConfig(FILE *file)
 			transportPerfConfig.maxFragmentSize,
 			transportPerfConfig.sendBufSize, (transportPerfConfig.sendBufSize ? " bytes" : "(use default)"),
 			transportPerfConfig.recvBufSize, (transportPerfConfig.recvBufSize ? " bytes" : "(use default)"),
+			transportPerfConfig.readAheadSize, (transportPerfConfig.readAheadSize ? " bytes" : "(disabled)"),
 			transportPerfConfig.highWaterMark, (transportPerfConfig.highWaterMark ? " bytes" : "(use default)"),
 			compressionTypeToString(transportPerfConfig.compressionType),
 			transportPerfConfig.compressionType,
@@ -542,11 +587,17 @@ void exitWithUsage()
 			"  -maxFragmentSize <count>   Max size of buffers(configures maxFragmentSize in the RSSL bind/connection options)\n"
 			"  -sendBufSize <size>        System Send Buffer Size(configures sysSendBufSize in the RSSL bind/connection options)\n"
 			"  -recvBufSize <size>        System Receive Buffer Size(configures sysRecvBufSize in the RSSL bind/connection options)\n"
+			"  -readAhead <size>          Read as much as fits into an input buffer of this size on each read(configures tcpOpts.readAheadSize)\n"
 			"  -highWaterMark <bytes>     Number of queued bytes at which rsslWrite() internally flushes.\n"
 			"  -compressionType <type>    Type of compression to use(\"none\", \"zlib\")\n"
 			"  -compressionLevel <num>    Level of compression.\n"
 			"  -if <interface name>       Name of network interface to use\n"
 			"  -tcpDelay                  Turns off tcp_nodelay in RsslBindOpts, enabling Nagle's\n"
+			"  -libsslName <name>         Name of the libssl library to load for encrypted connections\n"
+			"  -libcryptoName <name>      Name of the libcrypto library to load for encrypted connections\n"
+			"  -noSessionResumption       Do a full TLS handshake on every encrypted connection, rather than resuming the last session\n"
+			"  -reconnectStorm <count>    Client only. Repeatedly opens this many connections at once and reports how long they\n"
+			"                               take to all become active, instead of exchanging messages\n"
 			"\n"
 			"  -tickRate <ticks/sec>      Ticks per second\n"
 			"  -msgRate <msgs/second>     Message rate per second\n"
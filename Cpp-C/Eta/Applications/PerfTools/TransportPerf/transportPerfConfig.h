@@ -45,6 +45,7 @@ typedef struct
 	RsslUInt32			maxFragmentSize;			/* Maximum Fragment Size. See -maxFragmentSize */
 	RsslUInt32			sendBufSize;				/* System Send Buffer Size(-sendBufSize) */
 	RsslUInt32			recvBufSize;				/* System Send Buffer Size(-recvBufSize) */
+	RsslUInt32			readAheadSize;				/* Read-ahead size for socket channels(-readAhead). 0 disables read-ahead. */
 	RsslUInt32			highWaterMark;				/* The "high water mark" (bytes) at which rsslWrite() will automatically flush. 
 													   See rsslIoctl() and RSSL_HIGH_WATER_MARK. */
 	char				summaryFilename[128];		/* Name of the summary log file(-summaryFile).. */
@@ -62,6 +63,11 @@ typedef struct
 	RsslBool			sAddr;						/* Whether an outbound address was specified. See -sa */
 	RsslBool			rAddr;						/* Whether an inbound address was specified. See -ra */
 	RsslBool			takeMCastStats;				/* Running a multicast connection and we want stats. */
+	char				libsslName[128];			/* Name of the libssl library to load for encrypted connections. See -libsslName */
+	char				libcryptoName[128];			/* Name of the libcrypto library to load for encrypted connections. See -libcryptoName */
+	RsslBool			sessionResumption;			/* Resume TLS sessions when reconnecting encrypted connections. See -noSessionResumption */
+	RsslUInt32			reconnectStormCount;		/* If nonzero, measures how long this many connections take to become active, 
+													 * rather than exchanging messages. See -reconnectStorm */
 
 } TransportPerfConfig;
 
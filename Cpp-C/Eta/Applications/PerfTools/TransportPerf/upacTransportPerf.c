@@ -54,6 +54,7 @@ static RsslUInt32 currentRuntimeSec = 0, intervalSeconds = 0;
 RsslUInt64 totalMsgSentCount = 0;
 RsslUInt64 totalBytesSent = 0;
 RsslUInt64 totalMsgReceivedCount = 0;
+RsslUInt64 totalTransportReads = 0;
 RsslUInt64 totalBytesReceived = 0;
 
 static const RsslUInt32 TEST_PROTOCOL_TYPE = 88;
@@ -489,6 +490,7 @@ int main(int argc, char **argv)
 	int i;
 	struct timeval time_interval;
 	RsslError error;
+	RsslInitializeExOpts initOpts = RSSL_INIT_INITIALIZE_EX_OPTS;
 	fd_set useRead;
 	fd_set useExcept;
 	int selRet;
@@ -527,13 +529,23 @@ int main(int argc, char **argv)
 	/* Initialize RSSL */
 	/* Multicast statistics are retrieved via rsslGetChannelInfo(), so set the per-channel-lock 
 	 * when taking them. */
-	if (rsslInitialize(transportPerfConfig.takeMCastStats ? RSSL_LOCK_GLOBAL_AND_CHANNEL :
-					(transportPerfConfig.threadCount > 1 ? RSSL_LOCK_GLOBAL : RSSL_LOCK_NONE),
-					 &error) != RSSL_RET_SUCCESS)
+	initOpts.rsslLocking = transportPerfConfig.takeMCastStats ? RSSL_LOCK_GLOBAL_AND_CHANNEL :
+					(transportPerfConfig.threadCount > 1 ? RSSL_LOCK_GLOBAL : RSSL_LOCK_NONE);
+	if (strlen(transportPerfConfig.libsslName)) initOpts.jitOpts.libsslName = transportPerfConfig.libsslName;
+	if (strlen(transportPerfConfig.libcryptoName)) initOpts.jitOpts.libcryptoName = transportPerfConfig.libcryptoName;
+
+	if (rsslInitializeEx(&initOpts, &error) != RSSL_RET_SUCCESS)
 	{
 		printf("RsslInitialize failed: %s\n", error.text);
 		exit(-1);
 	}
+	if (transportPerfConfig.reconnectStormCount > 0)
+	{
+		runReconnectStorm();
+		rsslUninitialize();
+		exit(0);
+	}
+
 	/* Initialize run-time */
 	initRuntime();
 
@@ -682,7 +694,7 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 {
 	RsslInt64 intervalMsgSentCount = 0, intervalBytesSent = 0,
 			  intervalMsgReceivedCount = 0, intervalBytesReceived = 0,
-			  intervalOutOfBuffersCount = 0;
+			  intervalOutOfBuffersCount = 0, intervalTransportReads = 0;
 	ValueStatistics intervalLatencyStats;
 	RsslRet ret;
 	RsslInt32 i;
@@ -744,10 +756,12 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 		intervalMsgReceivedCount = countStatGetChange(&sessionHandlerList[i].transportThread.msgsReceived);
 		intervalBytesReceived = countStatGetChange(&sessionHandlerList[i].transportThread.bytesReceived);
 		intervalOutOfBuffersCount = countStatGetChange(&sessionHandlerList[i].transportThread.outOfBuffersCount);
+		intervalTransportReads = countStatGetChange(&sessionHandlerList[i].transportThread.channelHandler.transportReads);
 
 		totalMsgSentCount += intervalMsgSentCount;
 		totalBytesSent += intervalBytesSent;
 		totalMsgReceivedCount += intervalMsgReceivedCount;
+		totalTransportReads += intervalTransportReads;
 		totalBytesReceived += intervalBytesReceived;
 
 		if (writeStats)
@@ -783,9 +797,10 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 					(double)intervalMsgSentCount / (double)timePassedSec,
 					(double)intervalBytesSent / (double)(1024*1024) / (double)timePassedSec);
 
-			printf("  Recv: MsgRate: %8.0f, DataRate:%8.3fMBps\n",
+			printf("  Recv: MsgRate: %8.0f, DataRate:%8.3fMBps, Reads/Msg: %.3f\n",
 					(double)intervalMsgReceivedCount / (double)timePassedSec,
-					(double)intervalBytesReceived / (double)(1024*1024) / (double)timePassedSec);
+					(double)intervalBytesReceived / (double)(1024*1024) / (double)timePassedSec,
+					intervalMsgReceivedCount ? (double)intervalTransportReads / (double)intervalMsgReceivedCount : 0.0);
 
 			if (intervalOutOfBuffersCount > 0)
 			{
@@ -865,6 +880,7 @@ static RsslServer* bindRsslServer(RsslError* error)
 	sopts.serviceName = transportPerfConfig.portNo;
 	sopts.sysSendBufSize = transportPerfConfig.sendBufSize;
 	sopts.sysRecvBufSize = transportPerfConfig.recvBufSize;
+	sopts.tcpOpts.readAheadSize = transportPerfConfig.readAheadSize;
 
 	if ((srvr = rsslBind(&sopts, error)) == 0)
 		return NULL;
@@ -944,12 +960,14 @@ static RsslChannel* startConnection()
 	copts.guaranteedOutputBuffers = transportPerfConfig.guaranteedOutputBuffers;
 	copts.sysSendBufSize = transportPerfConfig.sendBufSize;
 	copts.sysRecvBufSize = transportPerfConfig.recvBufSize;
+	copts.tcpOpts.readAheadSize = transportPerfConfig.readAheadSize;
 	copts.majorVersion = 0;
 	copts.minorVersion = 0;
 	copts.protocolType = TEST_PROTOCOL_TYPE;
 	copts.connectionType = transportPerfConfig.connectionType;
 	copts.tcp_nodelay = transportPerfConfig.tcpNoDelay;
 	copts.compressionType = transportPerfConfig.compressionType;
+	copts.encryptionOpts.sessionResumption = transportPerfConfig.sessionResumption;
 
 	if(copts.connectionType == RSSL_CONN_TYPE_SEQ_MCAST)
 	{
@@ -965,6 +983,86 @@ static RsslChannel* startConnection()
 	return chnl;
 }
 
+/* Number of times runReconnectStorm() connects its channels. The first round does full handshakes and
+ * the later ones show the effect of session resumption, if enabled. */
+#define RECONNECT_STORM_ROUNDS 5
+
+/* Repeatedly opens transportPerfConfig.reconnectStormCount connections at once, as clients would on a provider
+ * restart, and prints how long it takes until all of them are active. */
+static void runReconnectStorm()
+{
+	RsslUInt32 channelCount = transportPerfConfig.reconnectStormCount;
+	RsslChannel **channelList;
+	RsslConnectOptions copts;
+	RsslInProgInfo inProg = RSSL_INIT_IN_PROG_INFO;
+	RsslError error;
+	RsslUInt32 i, activeCount;
+	RsslInt32 round;
+	TimeValue startTime, endTime;
+	RsslRet ret;
+
+	channelList = (RsslChannel**)malloc(channelCount * sizeof(RsslChannel*));
+	assert(channelList);
+
+	rsslClearConnectOpts(&copts);
+	copts.connectionInfo.unified.address = transportPerfConfig.hostName;
+	copts.connectionInfo.unified.serviceName = transportPerfConfig.portNo;
+	copts.connectionInfo.unified.interfaceName = transportPerfConfig.interfaceName;
+	copts.guaranteedOutputBuffers = 10;
+	copts.protocolType = TEST_PROTOCOL_TYPE;
+	copts.connectionType = transportPerfConfig.connectionType;
+	copts.tcp_nodelay = transportPerfConfig.tcpNoDelay;
+	copts.encryptionOpts.sessionResumption = transportPerfConfig.sessionResumption;
+
+	printf("\nReconnect storm: %u connections to %s:%s, session resumption %s\n\n", channelCount,
+			transportPerfConfig.hostName, transportPerfConfig.portNo,
+			transportPerfConfig.sessionResumption ? "on" : "off");
+
+	for (round = 1; round <= RECONNECT_STORM_ROUNDS; ++round)
+	{
+		startTime = getTimeNano();
+
+		for (i = 0; i < channelCount; ++i)
+		{
+			if ((channelList[i] = rsslConnect(&copts, &error)) == NULL)
+			{
+				printf("rsslConnect() failed: %d(%s)\n", error.rsslErrorId, error.text);
+				exit(-1);
+			}
+		}
+
+		/* Initialize the channels until all are active. */
+		do
+		{
+			activeCount = 0;
+			for (i = 0; i < channelCount; ++i)
+			{
+				if (channelList[i]->state == RSSL_CH_STATE_ACTIVE)
+				{
+					++activeCount;
+					continue;
+				}
+
+				if ((ret = rsslInitChannel(channelList[i], &inProg, &error)) < RSSL_RET_SUCCESS)
+				{
+					printf("rsslInitChannel() failed: %d(%s)\n", ret, error.text);
+					exit(-1);
+				}
+			}
+		} while (activeCount < channelCount);
+
+		endTime = getTimeNano();
+
+		printf("Round %d: all %u connections active in %.3f ms (%.3f ms per connection)\n", round, channelCount,
+				(double)(endTime - startTime) / 1000000.0, (double)(endTime - startTime) / 1000000.0 / channelCount);
+
+		for (i = 0; i < channelCount; ++i)
+			rsslCloseChannel(channelList[i], &error);
+	}
+
+	free(channelList);
+}
+
 static void initRuntime()
 {
 	TimeValue currentTime = 0;
@@ -1097,7 +1195,8 @@ static void printSummaryStats(FILE *file)
 					"  Avg. Msg Sent Rate: %.0f\n"
 					"  Avg. Msg Recv Rate: %.0f\n"
 					"  Avg. Data Sent Rate (MB): %.2f\n"
-					"  Avg. Data Recv Rate (MB): %.2f\n\n",
+					"  Avg. Data Recv Rate (MB): %.2f\n"
+					"  Transport Reads per Msg Received: %.3f\n\n",
 					threadConnectedTime,
 					countStatGetTotal(&pThread->msgsSent),
 					countStatGetTotal(&pThread->msgsReceived),
@@ -1106,7 +1205,9 @@ static void printSummaryStats(FILE *file)
 					threadConnectedTime ? (double)countStatGetTotal(&pThread->msgsSent)/ threadConnectedTime : 0,
 					threadConnectedTime ? (double)countStatGetTotal(&pThread->msgsReceived)/ threadConnectedTime : 0,
 					threadConnectedTime ? (double)countStatGetTotal(&pThread->bytesSent) / 1048576.0 / threadConnectedTime : 0,
-					threadConnectedTime ? (double)countStatGetTotal(&pThread->bytesReceived) / 1048576.0 / threadConnectedTime : 0);
+					threadConnectedTime ? (double)countStatGetTotal(&pThread->bytesReceived) / 1048576.0 / threadConnectedTime : 0,
+					countStatGetTotal(&pThread->msgsReceived) ? 
+						(double)countStatGetTotal(&pThread->channelHandler.transportReads) / (double)countStatGetTotal(&pThread->msgsReceived) : 0);
 		}
 
 	}
@@ -1140,7 +1241,8 @@ static void printSummaryStats(FILE *file)
 			"  Avg. Msg Sent Rate: %.0f\n"
 			"  Avg. Msg Recv Rate: %.0f\n"
 			"  Avg. Data Sent Rate (MB): %.2f\n"
-			"  Avg. Data Recv Rate (MB): %.2f\n",
+			"  Avg. Data Recv Rate (MB): %.2f\n"
+			"  Transport Reads per Msg Received: %.3f\n",
 			connectedTime,
 			totalMsgSentCount,
 			totalMsgReceivedCount,
@@ -1149,7 +1251,8 @@ static void printSummaryStats(FILE *file)
 			connectedTime ? (double)totalMsgSentCount / connectedTime : 0,
 			connectedTime ? (double)totalMsgReceivedCount / connectedTime : 0,
 			connectedTime ? (double)totalBytesSent / 1048576.0 / connectedTime : 0,
-			connectedTime ? (double)totalBytesReceived / 1048576.0 / connectedTime : 0);
+			connectedTime ? (double)totalBytesReceived / 1048576.0 / connectedTime : 0,
+			totalMsgReceivedCount ? (double)totalTransportReads / (double)totalMsgReceivedCount : 0);
 
 	if (cpuUsageStats.count)
 	{
@@ -101,6 +101,9 @@ static RsslServer* bindRsslServer(RsslError* error);
 /* Attempts to connect. */
 static RsslChannel* startConnection();
 
+/* Measures how long a burst of connections takes to become active. See -reconnectStorm. */
+static void runReconnectStorm();
+
 /* Initializes application runtime. */
 static void initRuntime();
 
@@ -50,10 +50,22 @@ typedef struct {
 } RsslDictionaryInternal;
 
 typedef struct {
-	RsslEnumType	base;	/* Base enum object. */
-	RsslUInt16		flags;	/* Flags for this enum. See RsslEnumTypeFlags. */
+	RsslEnumType	base;			/* Base enum object. */
+	RsslUInt16		flags;			/* Flags for this enum. See RsslEnumTypeFlags. */
+	RsslUInt32		displayHash;	/* Hash of the display string, for the table's display index. */
 } RsslEnumTypeImpl;
 
+/* An enum type table and its contents, in one allocation. The enumTypes list points into enumTypeArray, 
+ * which holds the enum types in value order, and their display and meaning strings are stored after it. */
+typedef struct {
+	RsslEnumTypeTable	base;				/* Base table object. */
+	RsslEnumTypeImpl	*enumTypeArray;		/* The enum types present in the table. */
+	RsslUInt32			enumTypeCount;		/* Number of enum types in enumTypeArray. */
+	RsslUInt32			*displayIndex;		/* Open-addressed hash index of enumTypeArray by display string. Each slot holds
+											 * the position of an enum type plus one, or zero if the slot is empty. */
+	RsslUInt32			displayIndexMask;	/* Number of slots in displayIndex, minus one. */
+} RsslEnumTypeTableImpl;
+
 typedef enum {
 	RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY	= 0x1 /* This value is one of multiple values that correspond to the same display string. */
 } RsslEnumTypeFlags;
@@ -167,7 +179,7 @@ void _setError(RsslBuffer *errorText, char *format, ...)
 	}
 }
 
-void _freeLists( RsslReferenceFidStore *pFids, RsslEnumTypeStore *pEnumTypes, RsslBool success)
+void _freeLists( RsslReferenceFidStore *pFids, RsslEnumTypeStore *pEnumTypes)
 {
 	if (pFids)
 	{
@@ -189,12 +201,9 @@ void _freeLists( RsslReferenceFidStore *pFids, RsslEnumTypeStore *pEnumTypes, Rs
 			pTmpEnumType = pEnumTypes;
 			pEnumTypes = pEnumTypes->next;
 
-			if (!success)
-			{
-				/* If we failed, the enum table didn't make it into the dictionary. So free these. */
-				if (pTmpEnumType->enumType.display.data) free(pTmpEnumType->enumType.display.data);
-				if (pTmpEnumType->enumType.meaning.data) free(pTmpEnumType->enumType.meaning.data);
-			}
+			/* Tables keep their own copies of the strings. */
+			if (pTmpEnumType->enumType.display.data) free(pTmpEnumType->enumType.display.data);
+			if (pTmpEnumType->enumType.meaning.data) free(pTmpEnumType->enumType.meaning.data);
 			free(pTmpEnumType);
 		}
 	}
@@ -672,7 +681,7 @@ RsslRet _finishFailure(FILE *fp, RsslDataDictionary *pDict, RippleDefintion *pRi
 
 RsslRet _finishEnumLoadFailure(FILE *fp, RsslDataDictionary *pDict, RsslReferenceFidStore *pFids, RsslEnumTypeStore *pEnumTypes, TextFileReader *pReader)
 {
-	_freeLists(pFids, pEnumTypes, RSSL_FALSE);
+	_freeLists(pFids, pEnumTypes);
 
 	if (pDict)
 		rsslDeleteDataDictionary(pDict);
@@ -1691,21 +1700,7 @@ static void _deleteDictionaryEntry(RsslDataDictionary *pDictionary, RsslFieldId
 
 static void _deleteDictionaryEnumTable(RsslEnumTypeTable *pTable)
 {
-	int i;
-
-	for(i = 0; i <= pTable->maxValue; ++i)
-	{
-		RsslEnumType *pDef = pTable->enumTypes[i];
-
-		if (pDef != NULL)
-		{
-			if (pDef->display.data) free(pDef->display.data);
-			if (pDef->meaning.data) free(pDef->meaning.data);
-			free(pDef);
-		}
-	}
-
-	free(pTable->enumTypes);
+	/* The enum types and their strings are part of the table's allocation. */
 	free(pTable->fidReferences);
 	free(pTable);
 }
@@ -1986,11 +1981,74 @@ RSSL_API RsslRet rsslDecodeFieldDictionary(
 }
 
 
+/* Hashes an enum display string for the display index. */
+static RsslUInt32 _hashEnumDisplay(const RsslBuffer *pDisplay)
+{
+	/* FNV-1a */
+	RsslUInt32 hash = 2166136261U;
+	RsslUInt32 i;
+
+	for (i = 0; i < pDisplay->length; ++i)
+	{
+		hash ^= (unsigned char)pDisplay->data[i];
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+/* Adds an enum type to the display index of its table. If another enum type already has the same display string,
+ * both are marked as duplicates and the index is left unchanged. */
+static void _indexEnumDisplay(RsslEnumTypeTableImpl *pTableImpl, RsslUInt32 position)
+{
+	RsslEnumTypeImpl *pEnum = &pTableImpl->enumTypeArray[position];
+	RsslUInt32 slot = pEnum->displayHash & pTableImpl->displayIndexMask;
+
+	while (pTableImpl->displayIndex[slot] != 0)
+	{
+		RsslEnumTypeImpl *pOther = &pTableImpl->enumTypeArray[pTableImpl->displayIndex[slot] - 1];
+
+		if (pOther->displayHash == pEnum->displayHash && rsslBufferIsEqual(&pOther->base.display, &pEnum->base.display))
+		{
+			/* Values have the same display string; mark them as duplicates. */
+			pOther->flags |= RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY;
+			pEnum->flags |= RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY;
+			return;
+		}
+
+		slot = (slot + 1) & pTableImpl->displayIndexMask;
+	}
+
+	pTableImpl->displayIndex[slot] = position + 1;
+}
+
+/* Copies a string into the table's string storage, null-terminating it. */
+static void _copyEnumString(RsslBuffer *pDest, const RsslBuffer *pSource, char **ppStringData)
+{
+	pDest->length = pSource->length;
+
+	if (!pSource->data)
+	{
+		pDest->data = NULL;
+		return;
+	}
+
+	pDest->data = *ppStringData;
+	memcpy(pDest->data, pSource->data, pSource->length);
+	pDest->data[pSource->length] = '\0';
+	*ppStringData += pSource->length + 1;
+}
+
 RsslRet _addTableToDictionary( RsslDataDictionary *dictionary, RsslUInt32 fidsCount, RsslReferenceFidStore *pFids, RsslEnum maxValue, RsslEnumTypeStore *pEnumTypes, RsslBuffer *errorText, int lineNum)
 {
+	RsslEnumTypeTableImpl *pTableImpl;
 	RsslEnumTypeTable *pTable;
+	RsslEnumTypeStore *pEnumTypeStore;
 	RsslFieldId *fidRefs;
-	int i, j;
+	RsslUInt32 enumTypeCount = 0, stringLength = 0, displayIndexSize = 1, position = 0;
+	size_t enumTypeArrayOffset, displayIndexOffset, stringDataOffset;
+	char *pStringData;
+	RsslUInt32 i;
 
 	if (dictionary->enumTableCount == ENUM_TABLE_MAX_COUNT) /* Unlikely. */
 		return (_setError(errorText, "Cannot add more tables to this dictionary.", lineNum), RSSL_RET_FAILURE);
@@ -2001,41 +2059,76 @@ RsslRet _addTableToDictionary( RsslDataDictionary *dictionary, RsslUInt32 fidsCo
 		else
     		return (_setError(errorText, "No referencing FIDs found before enum table."), RSSL_RET_FAILURE);
 	}
-	
-	pTable = (RsslEnumTypeTable*)malloc(sizeof(RsslEnumTypeTable));
-	if (!pTable)
+
+	/* Size the table. The display index is kept at most half full. */
+	for (pEnumTypeStore = pEnumTypes; pEnumTypeStore; pEnumTypeStore = pEnumTypeStore->next)
+	{
+		RSSL_ASSERT(pEnumTypeStore->enumType.value <= maxValue, Invalid content);
+		++enumTypeCount;
+		stringLength += pEnumTypeStore->enumType.display.length + 1 + pEnumTypeStore->enumType.meaning.length + 1;
+	}
+
+	while (displayIndexSize < enumTypeCount * 2)
+		displayIndexSize <<= 1;
+
+	/* Lay out the table, its list of enum types by value, the enum types, the display index and the strings in one block. */
+	enumTypeArrayOffset = sizeof(RsslEnumTypeTableImpl) + ((size_t)maxValue + 1) * sizeof(RsslEnumType*);
+	displayIndexOffset = enumTypeArrayOffset + enumTypeCount * sizeof(RsslEnumTypeImpl);
+	stringDataOffset = displayIndexOffset + displayIndexSize * sizeof(RsslUInt32);
+
+	pTableImpl = (RsslEnumTypeTableImpl*)calloc(1, stringDataOffset + stringLength);
+	if (!pTableImpl)
 		return (_setError(errorText, "Unable to create memory for enumeration table."), RSSL_RET_FAILURE);
+
+	pTable = &pTableImpl->base;
 	pTable->maxValue = maxValue;
-	pTable->enumTypes = (RsslEnumType**)calloc(maxValue+1, sizeof(RsslEnumType*));
+	pTable->enumTypes = (RsslEnumType**)(pTableImpl + 1);
+	pTableImpl->enumTypeArray = (RsslEnumTypeImpl*)((char*)pTableImpl + enumTypeArrayOffset);
+	pTableImpl->enumTypeCount = enumTypeCount;
+	pTableImpl->displayIndex = (RsslUInt32*)((char*)pTableImpl + displayIndexOffset);
+	pTableImpl->displayIndexMask = displayIndexSize - 1;
+	pStringData = (char*)pTableImpl + stringDataOffset;
 
-	/* Create table and add it to dictionary */
-	while(pEnumTypes)
+	/* Find each value's definition, checking for duplicates. */
+	for (pEnumTypeStore = pEnumTypes; pEnumTypeStore; pEnumTypeStore = pEnumTypeStore->next)
 	{
-		RsslEnum value = pEnumTypes->enumType.value;
-
-		RSSL_ASSERT(pEnumTypes->enumType.value <= maxValue, Invalid content);
+		RsslEnum value = pEnumTypeStore->enumType.value;
 
 		if (pTable->enumTypes[value])
 		{
 			_setError(errorText, "Enum type table has Duplicate value: \"%u\"", value);
-			for(i = 0; i <= pTable->maxValue; ++i) if (pTable->enumTypes[i]) free(pTable->enumTypes[i]);
-			free(pTable->enumTypes);
-			free(pTable);
+			free(pTableImpl);
 			return RSSL_RET_FAILURE;
 		}
 
+		pTable->enumTypes[value] = &pEnumTypeStore->enumType;
+	}
+
+	/* Copy the definitions into the table in value order, and index their display strings. */
+	for (i = 0; i <= maxValue; ++i)
+	{
+		RsslEnumTypeImpl *pEnum;
+
+		if (!pTable->enumTypes[i])
+			continue;
+
+		pEnum = &pTableImpl->enumTypeArray[position];
+		pEnum->base.value = pTable->enumTypes[i]->value;
+		_copyEnumString(&pEnum->base.display, &pTable->enumTypes[i]->display, &pStringData);
+		_copyEnumString(&pEnum->base.meaning, &pTable->enumTypes[i]->meaning, &pStringData);
+		pEnum->displayHash = _hashEnumDisplay(&pEnum->base.display);
+		pTable->enumTypes[i] = &pEnum->base;
 
-		pTable->enumTypes[value] = (RsslEnumType*)malloc(sizeof(RsslEnumTypeImpl));
-		if (!pTable->enumTypes[value])
-			return (_setError(errorText, "Unable to create storage for enum type value."), RSSL_RET_FAILURE);
-		*pTable->enumTypes[value] = pEnumTypes->enumType;
-		((RsslEnumTypeImpl*)pTable->enumTypes[value])->flags = 0;
-		pEnumTypes = pEnumTypes->next;
+		_indexEnumDisplay(pTableImpl, position);
+		++position;
 	}
 
 	pTable->fidReferences = fidRefs = (RsslFieldId*)malloc(fidsCount*sizeof(RsslFieldId));
 	if (!pTable->fidReferences)
+	{
+		free(pTableImpl);
 		return (_setError(errorText, "Unable to create storage for fid cross references."), RSSL_RET_FAILURE);
+	}
 	pTable->fidReferenceCount = fidsCount;
 
 	/* Point all referencing fields at it */
@@ -2045,9 +2138,8 @@ RsslRet _addTableToDictionary( RsslDataDictionary *dictionary, RsslUInt32 fidsCo
 
 		if (_addFieldTableReferenceToDictionary(dictionary, pFids, pTable, errorText) != RSSL_RET_SUCCESS)
 		{
-			for(i = 0; i <= pTable->maxValue; ++i) if (pTable->enumTypes[i]) free(pTable->enumTypes[i]);
-			free(pTable->enumTypes);
-			free(pTable);
+			free(pTable->fidReferences);
+			free(pTableImpl);
 			return RSSL_RET_FAILURE;
 		}
 
@@ -2055,33 +2147,6 @@ RsslRet _addTableToDictionary( RsslDataDictionary *dictionary, RsslUInt32 fidsCo
 		pFids = pFids->next;
 	}
 
-	/* Look for enum values with the same display strings as other values. Mark them as duplicate. */
-	for (i = 1; i < pTable->maxValue; ++i)
-	{
-		RsslEnumTypeImpl *pEnum1 = (RsslEnumTypeImpl*)pTable->enumTypes[i];
-
-		/* If enum not in table, or we already know it's a duplicate, skip. */
-		if (pEnum1 == NULL || pEnum1->flags & RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY) 
-			continue; 
-
-		for (j = 0; j < i; ++j)
-		{
-			RsslEnumTypeImpl *pEnum2 = (RsslEnumTypeImpl*)pTable->enumTypes[j];
-
-			/* If enum not in table, skip. */
-			if (pEnum2 == NULL)
-				continue;
-
-			if (rsslBufferIsEqual(&pEnum1->base.display, &pEnum2->base.display))
-			{
-				/* Values have the same display string; mark them as duplicates. */
-				pEnum1->flags |= RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY;
-				pEnum2->flags |= RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY;
-				break;
-			}
-		}
-	}
-
 	RSSL_ASSERT(fidsCount == 0, Invalid content);
 	dictionary->enumTables[dictionary->enumTableCount++] = pTable;
 	return RSSL_RET_SUCCESS;
@@ -2167,7 +2232,7 @@ RSSL_API RsslRet rsslLoadEnumTypeDictionary(	const char				*filename,
 					return _finishEnumLoadFailure(0, dictionary, pFids, pEnumTypes, &textFileReader);
 
 				maxValue = 0; fidsCount = 0;
-				_freeLists(pFids, pEnumTypes, RSSL_TRUE); pFids = 0; pEnumTypes = 0;
+				_freeLists(pFids, pEnumTypes); pFids = 0; pEnumTypes = 0;
 			}
 			pTmpFid = pFids;
 			pFids = (RsslReferenceFidStore*)calloc(1, sizeof(RsslReferenceFidStore));
@@ -2271,7 +2336,7 @@ RSSL_API RsslRet rsslLoadEnumTypeDictionary(	const char				*filename,
 	if (_addTableToDictionary(dictionary, fidsCount, pFids, maxValue, pEnumTypes, errorText, -1) != RSSL_RET_SUCCESS)
 		return _finishEnumLoadFailure(0, dictionary, pFids, pEnumTypes, &textFileReader);
 
-	_freeLists(pFids, pEnumTypes, RSSL_TRUE); pFids = 0; pEnumTypes = 0;
+	_freeLists(pFids, pEnumTypes); pFids = 0; pEnumTypes = 0;
 	maxValue = 0; fidsCount = 0;
 
 	fclose(fp);
@@ -2510,7 +2575,7 @@ RSSL_API RsslRet rsslDecodeEnumTypeDictionary(
 		if (_addTableToDictionary(dictionary, fidRefs, pFids, maxValue, pEnumTypesHead, errorText, -1) != RSSL_RET_SUCCESS)
 			return _finishEnumLoadFailure(0, dictionary, pFids, pEnumTypesHead, NULL);
 
-		_freeLists(pFids, pEnumTypesHead, RSSL_TRUE); pFids = 0; pEnumTypesHead = 0; maxValue = 0; fidRefs = 0;
+		_freeLists(pFids, pEnumTypesHead); pFids = 0; pEnumTypesHead = 0; maxValue = 0; fidRefs = 0;
 	}
 
 	return RSSL_RET_SUCCESS;
@@ -3129,26 +3194,27 @@ RSSL_API RsslDictionaryEntry *rsslDictionaryGetEntryByFieldName(RsslDataDictiona
  
 RSSL_API RsslRet rsslDictionaryEntryGetEnumValueByDisplayString(const RsslDictionaryEntry *pEntry, const RsslBuffer *pEnumDisplay, RsslEnum *pEnumValue, RsslBuffer *errorText)
 {
-	RsslUInt32 i;
-	RsslEnumTypeTable *pEnumTypeTable = pEntry->pEnumTypeTable;
+	RsslEnumTypeTableImpl *pTableImpl = (RsslEnumTypeTableImpl*)pEntry->pEnumTypeTable;
+	RsslUInt32 displayHash, slot;
 
-	if (pEnumTypeTable == NULL)
+	if (pTableImpl == NULL)
 		return RSSL_RET_FAILURE;
 
 	/* Find a value matching the given display string. */
-	for (i = 0; i < pEnumTypeTable->maxValue; ++i)
+	displayHash = _hashEnumDisplay(pEnumDisplay);
+	for (slot = displayHash & pTableImpl->displayIndexMask; pTableImpl->displayIndex[slot] != 0;
+			slot = (slot + 1) & pTableImpl->displayIndexMask)
 	{
-		if (pEnumTypeTable->enumTypes[i] == NULL)
-			continue;
+		RsslEnumTypeImpl *pEnum = &pTableImpl->enumTypeArray[pTableImpl->displayIndex[slot] - 1];
 
-		if (rsslBufferIsEqual(pEnumDisplay, &pEnumTypeTable->enumTypes[i]->display))
+		if (pEnum->displayHash == displayHash && rsslBufferIsEqual(pEnumDisplay, &pEnum->base.display))
 		{
 			/* If there are multiple values corresponding to the given display string, return an error.
 			 * We cannot provide a correct value. */
-			if (((RsslEnumTypeImpl*)pEnumTypeTable->enumTypes[i])->flags & RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY)
+			if (pEnum->flags & RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY)
 				return RSSL_RET_DICT_DUPLICATE_ENUM_VALUE;
 
-			*pEnumValue = pEnumTypeTable->enumTypes[i]->value;
+			*pEnumValue = pEnum->base.value;
 			return RSSL_RET_SUCCESS;
 		}
 	}
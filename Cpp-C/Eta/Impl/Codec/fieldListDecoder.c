@@ -10,6 +10,7 @@
 #include "rtr/decoderTools.h"
 #include "rtr/rsslIteratorUtilsInt.h"
 #include "rtr/rsslSetData.h"
+#include "rtr/rsslFieldListColumns.h"
 
 /* rsslDecodeLocalFieldSetDefDb */
 #include "rtr/rsslMap.h"
@@ -134,7 +135,9 @@ RSSL_API RsslRet rsslDecodeFieldList(
 		else
 		{
 			_levelInfo->_setCount = 0;
-			_levelInfo->_nextEntryPtr = /* oIter->_curBufPtr = */ position + oFieldList->encSetData.length;
+			/* Skip to the standard entries, if any. Position is already past the set data when they are present. */
+			_levelInfo->_nextEntryPtr = /* oIter->_curBufPtr = */ oFieldList->encEntries.data ? 
+				oFieldList->encEntries.data : position + oFieldList->encSetData.length;
 			return RSSL_RET_SET_SKIPPED;
 		}
 	}
@@ -241,6 +244,177 @@ RSSL_API RsslRet rsslDecodeFieldEntry(
 	return RSSL_RET_SUCCESS;
 }
 
+/* Decodes the value of the entry the iterator is positioned on into row i of the columns. */
+RTR_C_INLINE RsslRet _rsslDecodeFieldColumnValue(RsslDecodeIterator *iIter, RsslFieldListColumns *pColumns, RsslUInt32 i, RsslUInt8 dataType)
+{
+	RsslRet ret;
+
+	switch(dataType)
+	{
+		case RSSL_DT_INT:
+		{
+			RsslInt64 intValue = 0;
+			ret = _rsslDecInt(iIter, &intValue);
+			if (pColumns->intValues) pColumns->intValues[i] = (ret == RSSL_RET_SUCCESS) ? intValue : 0;
+			return ret;
+		}
+		case RSSL_DT_UINT:
+		{
+			RsslUInt64 uintValue = 0;
+			ret = _rsslDecUInt(iIter, &uintValue);
+			if (pColumns->intValues) pColumns->intValues[i] = (ret == RSSL_RET_SUCCESS) ? (RsslInt64)uintValue : 0;
+			return ret;
+		}
+		case RSSL_DT_ENUM:
+		{
+			RsslEnum enumValue = 0;
+			ret = _rsslDecEnum(iIter, &enumValue);
+			if (pColumns->intValues) pColumns->intValues[i] = (ret == RSSL_RET_SUCCESS) ? enumValue : 0;
+			return ret;
+		}
+		case RSSL_DT_FLOAT:
+		{
+			RsslFloat floatValue = 0;
+			ret = _rsslDecFloat(iIter, &floatValue);
+			if (pColumns->doubleValues) pColumns->doubleValues[i] = (ret == RSSL_RET_SUCCESS) ? floatValue : 0;
+			return ret;
+		}
+		case RSSL_DT_DOUBLE:
+		{
+			RsslDouble doubleValue = 0;
+			ret = _rsslDecDouble(iIter, &doubleValue);
+			if (pColumns->doubleValues) pColumns->doubleValues[i] = (ret == RSSL_RET_SUCCESS) ? doubleValue : 0;
+			return ret;
+		}
+		case RSSL_DT_REAL:
+		{
+			RsslReal realValue;
+			ret = _rsslDecReal(iIter, &realValue);
+			if (pColumns->realValues) pColumns->realValues[i] = realValue;
+			return ret;
+		}
+		case RSSL_DT_DATE:
+		{
+			RsslDateTime dateTimeValue;
+			ret = _rsslDecDate(iIter, &dateTimeValue.date);
+			rsslBlankTime(&dateTimeValue.time);
+			if (pColumns->dateTimeValues) pColumns->dateTimeValues[i] = dateTimeValue;
+			return ret;
+		}
+		case RSSL_DT_TIME:
+		{
+			RsslDateTime dateTimeValue;
+			rsslBlankDate(&dateTimeValue.date);
+			ret = _rsslDecTime(iIter, &dateTimeValue.time);
+			if (pColumns->dateTimeValues) pColumns->dateTimeValues[i] = dateTimeValue;
+			return ret;
+		}
+		case RSSL_DT_DATETIME:
+		{
+			RsslDateTime dateTimeValue;
+			ret = _rsslDecDateTime(iIter, &dateTimeValue);
+			if (pColumns->dateTimeValues) pColumns->dateTimeValues[i] = dateTimeValue;
+			return ret;
+		}
+		default:
+			/* Strings, buffers and containers are left for the application to decode using the offset and length. */
+			return (iIter->_levelInfo[iIter->_decodingLevel + 1]._endBufPtr == iIter->_curBufPtr) ? RSSL_RET_BLANK_DATA : RSSL_RET_SUCCESS;
+	}
+}
+
+RSSL_API RsslRet rsslDecodeFieldListColumns(
+				RsslDecodeIterator		*iIter,
+				RsslDataDictionary		*pDictionary,
+				RsslLocalFieldSetDefDb	*iLocalSetDb,
+				RsslFieldListColumns	*pColumns )
+{
+	RsslFieldList		fieldList;
+	RsslFieldEntry		fieldEntry;
+	RsslDecodingLevel	*_levelInfo;
+	RsslDecodingLevel	*_nextLevelInfo;
+	RsslDictionaryEntry	*pDictionaryEntry;
+	RsslBuffer			encData;
+	char				*position;
+	char				*_endEntriesPtr;
+	RsslUInt8			dataType;
+	RsslUInt32			i;
+	RsslRet				ret, listRet;
+
+	RSSL_ASSERT(iIter && pColumns, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(pColumns->fieldIds && pColumns->dataTypes, Invalid parameters or parameters passed in as NULL);
+
+	pColumns->entryCount = 0;
+
+	if ((listRet = rsslDecodeFieldList(iIter, &fieldList, iLocalSetDb)) < RSSL_RET_SUCCESS
+			|| listRet == RSSL_RET_NO_DATA)
+		return listRet;
+
+	_levelInfo = &iIter->_levelInfo[iIter->_decodingLevel];
+	_nextLevelInfo = &iIter->_levelInfo[iIter->_decodingLevel + 1];
+
+	/* Leave the iterator at the start of the list, so the application can fall back to decoding it by entry. */
+	if (_levelInfo->_itemCount > pColumns->maxEntries)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+
+	if (pDictionary && !pDictionary->isInitialized)
+		pDictionary = NULL;
+
+	_endEntriesPtr = fieldList.encEntries.data + fieldList.encEntries.length;
+
+	for (i = 0; _levelInfo->_nextItemPosition < _levelInfo->_itemCount; ++i)
+	{
+		if (_levelInfo->_nextSetPosition < _levelInfo->_setCount)
+		{
+			/* Set-defined entries are typed by the set definition. */
+			if ((ret = rsslDecodeFieldEntry(iIter, &fieldEntry)) != RSSL_RET_SUCCESS)
+				return ret;
+
+			pColumns->fieldIds[i] = fieldEntry.fieldId;
+			dataType = fieldEntry.dataType;
+			encData = fieldEntry.encData;
+		}
+		else
+		{
+			/* Standard entries are parsed in place, as in rsslDecodeFieldEntry(), and typed by the dictionary. */
+			position = _levelInfo->_nextEntryPtr;
+
+			if (_endEntriesPtr - position < 3)
+				return RSSL_RET_INCOMPLETE_DATA;
+
+			position += rwfGet16(pColumns->fieldIds[i], position);
+			position += rwfGetBuffer16(&encData, position);
+			if (position > _levelInfo->_endBufPtr)
+				return RSSL_RET_INCOMPLETE_DATA;
+
+			iIter->_curBufPtr = encData.data;
+			_levelInfo->_nextEntryPtr = _nextLevelInfo->_endBufPtr = position;
+			_levelInfo->_nextItemPosition++;
+
+			dataType = (pDictionary && (pDictionaryEntry = getDictionaryEntry(pDictionary, pColumns->fieldIds[i])))
+				? pDictionaryEntry->rwfType : RSSL_DT_UNKNOWN;
+		}
+
+		pColumns->dataTypes[i] = dataType;
+
+		if (pColumns->dataOffsets)
+			pColumns->dataOffsets[i] = (RsslUInt32)(encData.data - iIter->_pBuffer->data);
+		if (pColumns->dataLengths)
+			pColumns->dataLengths[i] = encData.length;
+
+		if ((ret = _rsslDecodeFieldColumnValue(iIter, pColumns, i, dataType)) < RSSL_RET_SUCCESS)
+			return ret;
+
+		if (pColumns->blanks)
+			pColumns->blanks[i] = (ret == RSSL_RET_BLANK_DATA) ? RSSL_TRUE : RSSL_FALSE;
+	}
+
+	pColumns->entryCount = i;
+
+	_endOfList(iIter);
+
+	return (listRet == RSSL_RET_SET_SKIPPED) ? RSSL_RET_SET_SKIPPED : RSSL_RET_SUCCESS;
+}
+
 RSSL_API RsslRet rsslDecodeLocalFieldSetDefDb(
 				RsslDecodeIterator				*pIter,
 				RsslLocalFieldSetDefDb			*oLocalSetDb )
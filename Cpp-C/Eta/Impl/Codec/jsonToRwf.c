@@ -0,0 +1,885 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/rsslJsonConverter.h"
+#include "rtr/rsslDataPackage.h"
+#include "rtr/retmacros.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Reads JSON text sequentially from the caller's buffer. Values are used in place, so nothing is allocated. */
+typedef struct
+{
+	const char	*pos;			/* Next character to read */
+	const char	*start;			/* Start of the JSON text, for error positions */
+	const char	*end;			/* End of the JSON text */
+	RsslBuffer	*pErrorText;
+} JsonRwfReader;
+
+/* A JSON value read from the text. */
+typedef enum
+{
+	JSON_RWF_STRING,
+	JSON_RWF_NUMBER,
+	JSON_RWF_TRUE,
+	JSON_RWF_FALSE,
+	JSON_RWF_NULL
+} JsonRwfValueType;
+
+typedef struct
+{
+	JsonRwfValueType	type;
+	RsslBuffer			text;			/* Number text, or string content without its quotes and still escaped. */
+	RsslBool			hasEscapes;		/* The string contains backslash escapes. */
+	RsslBool			hasHighBytes;	/* The string contains non-ASCII bytes or \u escapes above 0x7F. */
+} JsonRwfValue;
+
+/* Escape sequence that designates UTF-8 text in an RMTES string. */
+static const char jsonRwfRmtesUtf8Designation[] = { 0x1B, 0x25, 0x30 };
+
+/* Longest field name or enum display string that may contain escapes. */
+#define JSON_RWF_MAX_NAME_LENGTH 128
+
+/* Longest number text accepted for float and double fields. */
+#define JSON_RWF_MAX_NUMBER_LENGTH 64
+
+#define JSON_RWF_UINT64_MAX 0xFFFFFFFFFFFFFFFFULL
+#define JSON_RWF_INT64_MAX 0x7FFFFFFFFFFFFFFFULL
+
+static RsslRet jsonRwfError(JsonRwfReader *pReader, RsslRet ret, const char *format, ...)
+{
+	va_list fmtArgs;
+	int length;
+
+	if (pReader->pErrorText && pReader->pErrorText->data && pReader->pErrorText->length > 0)
+	{
+		length = snprintf(pReader->pErrorText->data, pReader->pErrorText->length, "JSON position %u: ",
+				(RsslUInt32)(pReader->pos - pReader->start));
+
+		if (length > 0 && (RsslUInt32)length < pReader->pErrorText->length)
+		{
+			va_start(fmtArgs, format);
+			vsnprintf(pReader->pErrorText->data + length, pReader->pErrorText->length - length, format, fmtArgs);
+			va_end(fmtArgs);
+		}
+	}
+
+	return ret;
+}
+
+static void jsonRwfSkipWhitespace(JsonRwfReader *pReader)
+{
+	while (pReader->pos < pReader->end
+			&& (*pReader->pos == ' ' || *pReader->pos == '\t' || *pReader->pos == '\n' || *pReader->pos == '\r'))
+		++pReader->pos;
+}
+
+static RsslInt32 jsonRwfHexDigit(char c)
+{
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+/* Reads the four hex digits of a \u escape at pChar. Returns the code unit, or -1 if they are not valid. */
+static RsslInt32 jsonRwfReadCodeUnit(const char *pChar, const char *pEnd)
+{
+	RsslInt32 value = 0, digit, i;
+
+	if (pEnd - pChar < 4)
+		return -1;
+
+	for (i = 0; i < 4; ++i)
+	{
+		if ((digit = jsonRwfHexDigit(pChar[i])) < 0)
+			return -1;
+		value = (value << 4) | digit;
+	}
+
+	return value;
+}
+
+/* Reads a string with the reader positioned at its opening quote. The content is validated but not unescaped. */
+static RsslRet jsonRwfReadString(JsonRwfReader *pReader, JsonRwfValue *pValue)
+{
+	const char *pChar = pReader->pos + 1;
+	RsslInt32 codeUnit;
+
+	pValue->type = JSON_RWF_STRING;
+	pValue->hasEscapes = RSSL_FALSE;
+	pValue->hasHighBytes = RSSL_FALSE;
+
+	for (; pChar < pReader->end; ++pChar)
+	{
+		unsigned char c = (unsigned char)*pChar;
+
+		if (c == '"')
+		{
+			pValue->text.data = (char*)pReader->pos + 1;
+			pValue->text.length = (RsslUInt32)(pChar - pValue->text.data);
+			pReader->pos = pChar + 1;
+			return RSSL_RET_SUCCESS;
+		}
+
+		if (c >= 0x80)
+			pValue->hasHighBytes = RSSL_TRUE;
+		else if (c < 0x20)
+		{
+			pReader->pos = pChar;
+			return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Unescaped control character in string");
+		}
+		else if (c == '\\')
+		{
+			pValue->hasEscapes = RSSL_TRUE;
+			if (++pChar == pReader->end)
+				break;
+
+			switch(*pChar)
+			{
+				case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+					break;
+				case 'u':
+					if ((codeUnit = jsonRwfReadCodeUnit(pChar + 1, pReader->end)) < 0)
+					{
+						pReader->pos = pChar;
+						return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Invalid \\u escape");
+					}
+					if (codeUnit >= 0x80)
+						pValue->hasHighBytes = RSSL_TRUE;
+					pChar += 4;
+					break;
+				default:
+					pReader->pos = pChar;
+					return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Invalid escape '\\%c'", *pChar);
+			}
+		}
+	}
+
+	return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Unterminated string");
+}
+
+/* Reads a scalar value. Objects and arrays are not supported as field values. */
+static RsslRet jsonRwfReadValue(JsonRwfReader *pReader, JsonRwfValue *pValue)
+{
+	const char *pChar;
+	size_t remaining;
+
+	jsonRwfSkipWhitespace(pReader);
+	if (pReader->pos == pReader->end)
+		return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Expected a value");
+
+	remaining = pReader->end - pReader->pos;
+
+	switch(*pReader->pos)
+	{
+		case '"':
+			return jsonRwfReadString(pReader, pValue);
+
+		case 't':
+			if (remaining < 4 || memcmp(pReader->pos, "true", 4) != 0)
+				break;
+			pValue->type = JSON_RWF_TRUE;
+			pReader->pos += 4;
+			return RSSL_RET_SUCCESS;
+
+		case 'f':
+			if (remaining < 5 || memcmp(pReader->pos, "false", 5) != 0)
+				break;
+			pValue->type = JSON_RWF_FALSE;
+			pReader->pos += 5;
+			return RSSL_RET_SUCCESS;
+
+		case 'n':
+			if (remaining < 4 || memcmp(pReader->pos, "null", 4) != 0)
+				break;
+			pValue->type = JSON_RWF_NULL;
+			pReader->pos += 4;
+			return RSSL_RET_SUCCESS;
+
+		case '{':
+		case '[':
+			return jsonRwfError(pReader, RSSL_RET_UNSUPPORTED_DATA_TYPE, "Objects and arrays are not supported as field values");
+
+		default:
+			/* Number. Its syntax is checked when it is converted. */
+			for (pChar = pReader->pos; pChar < pReader->end; ++pChar)
+			{
+				if (!((*pChar >= '0' && *pChar <= '9') || *pChar == '-' || *pChar == '+' || *pChar == '.'
+							|| *pChar == 'e' || *pChar == 'E'))
+					break;
+			}
+
+			if (pChar == pReader->pos)
+				break;
+
+			pValue->type = JSON_RWF_NUMBER;
+			pValue->text.data = (char*)pReader->pos;
+			pValue->text.length = (RsslUInt32)(pChar - pReader->pos);
+			pValue->hasEscapes = RSSL_FALSE;
+			pValue->hasHighBytes = RSSL_FALSE;
+			pReader->pos = pChar;
+			return RSSL_RET_SUCCESS;
+	}
+
+	return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Invalid value");
+}
+
+/* Writes the code point as UTF-8. Returns the number of bytes written, at most 4. */
+static RsslUInt32 jsonRwfWriteUtf8(char *pDest, RsslUInt32 codePoint)
+{
+	if (codePoint < 0x80)
+	{
+		pDest[0] = (char)codePoint;
+		return 1;
+	}
+	else if (codePoint < 0x800)
+	{
+		pDest[0] = (char)(0xC0 | (codePoint >> 6));
+		pDest[1] = (char)(0x80 | (codePoint & 0x3F));
+		return 2;
+	}
+	else if (codePoint < 0x10000)
+	{
+		pDest[0] = (char)(0xE0 | (codePoint >> 12));
+		pDest[1] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+		pDest[2] = (char)(0x80 | (codePoint & 0x3F));
+		return 3;
+	}
+
+	pDest[0] = (char)(0xF0 | (codePoint >> 18));
+	pDest[1] = (char)(0x80 | ((codePoint >> 12) & 0x3F));
+	pDest[2] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+	pDest[3] = (char)(0x80 | (codePoint & 0x3F));
+	return 4;
+}
+
+/* Unescapes a string read by jsonRwfReadString() into pDest, which has room for destLength bytes. Returns
+ * RSSL_RET_BUFFER_TOO_SMALL if it does not fit. On success, pDestLength is set to the length written. */
+static RsslRet jsonRwfUnescape(JsonRwfReader *pReader, const RsslBuffer *pText, char *pDest, RsslUInt32 destLength,
+		RsslUInt32 *pDestLength)
+{
+	const char *pChar = pText->data, *pEnd = pText->data + pText->length;
+	char *pOut = pDest, *pOutEnd = pDest + destLength;
+	RsslUInt32 codePoint;
+	RsslInt32 lowSurrogate;
+
+	while (pChar < pEnd)
+	{
+		if (*pChar != '\\')
+		{
+			if (pOut == pOutEnd)
+				return RSSL_RET_BUFFER_TOO_SMALL;
+			*pOut++ = *pChar++;
+			continue;
+		}
+
+		++pChar;
+		switch(*pChar++)
+		{
+			case 'b': codePoint = '\b'; break;
+			case 'f': codePoint = '\f'; break;
+			case 'n': codePoint = '\n'; break;
+			case 'r': codePoint = '\r'; break;
+			case 't': codePoint = '\t'; break;
+			case 'u':
+				codePoint = (RsslUInt32)jsonRwfReadCodeUnit(pChar, pEnd);
+				pChar += 4;
+
+				if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+				{
+					/* A high surrogate must be followed by an escaped low surrogate. */
+					if (pEnd - pChar < 6 || pChar[0] != '\\' || pChar[1] != 'u'
+							|| (lowSurrogate = jsonRwfReadCodeUnit(pChar + 2, pEnd)) < 0xDC00 || lowSurrogate > 0xDFFF)
+						return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Unpaired surrogate in string");
+
+					codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+					pChar += 6;
+				}
+				else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF)
+					return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Unpaired surrogate in string");
+				break;
+			default: codePoint = (unsigned char)pChar[-1]; break;
+		}
+
+		if (pOutEnd - pOut < 4)
+			return RSSL_RET_BUFFER_TOO_SMALL;
+		pOut += jsonRwfWriteUtf8(pOut, codePoint);
+	}
+
+	*pDestLength = (RsslUInt32)(pOut - pDest);
+	return RSSL_RET_SUCCESS;
+}
+
+/* Gets the unescaped content of a string, in place if it has no escapes and in pStorage otherwise. */
+static RsslRet jsonRwfGetName(JsonRwfReader *pReader, const JsonRwfValue *pValue, char *pStorage, RsslBuffer *pName)
+{
+	if (!pValue->hasEscapes)
+	{
+		*pName = pValue->text;
+		return RSSL_RET_SUCCESS;
+	}
+
+	pName->data = pStorage;
+	if (jsonRwfUnescape(pReader, &pValue->text, pStorage, JSON_RWF_MAX_NAME_LENGTH, &pName->length) < RSSL_RET_SUCCESS)
+		return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Escaped name is longer than %u bytes", JSON_RWF_MAX_NAME_LENGTH);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Converts a JSON integer to a 64-bit value. */
+static RsslRet jsonRwfParseInt(JsonRwfReader *pReader, const RsslBuffer *pText, RsslBool isSigned, RsslUInt64 *pValue,
+		RsslBool *pIsNegative)
+{
+	const char *pChar = pText->data, *pEnd = pText->data + pText->length;
+	RsslUInt64 value = 0, limit;
+
+	*pIsNegative = RSSL_FALSE;
+	if (pChar < pEnd && *pChar == '-' && isSigned)
+	{
+		*pIsNegative = RSSL_TRUE;
+		++pChar;
+	}
+
+	if (pChar == pEnd)
+		return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Invalid integer '%.*s'", pText->length, pText->data);
+
+	limit = !isSigned ? JSON_RWF_UINT64_MAX : (*pIsNegative ? JSON_RWF_INT64_MAX + 1 : JSON_RWF_INT64_MAX);
+
+	for (; pChar < pEnd; ++pChar)
+	{
+		if (*pChar < '0' || *pChar > '9')
+			return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Invalid integer '%.*s'", pText->length, pText->data);
+
+		if (value > (limit - (*pChar - '0')) / 10)
+			return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Integer '%.*s' is out of range", pText->length, pText->data);
+
+		value = value * 10 + (*pChar - '0');
+	}
+
+	*pValue = value;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Converts a JSON number to an RsslReal, keeping its decimal places in the hint. Digits beyond the precision of
+ * the mantissa or the smallest exponent hint are truncated. */
+static RsslRet jsonRwfParseReal(JsonRwfReader *pReader, const RsslBuffer *pText, RsslReal *pReal)
+{
+	const char *pChar = pText->data, *pEnd = pText->data + pText->length;
+	RsslUInt64 mantissa = 0;
+	RsslInt32 exponent = 0, exponentValue = 0;
+	RsslBool isNegative = RSSL_FALSE, isExponentNegative = RSSL_FALSE, hasDigits = RSSL_FALSE;
+
+	if (pChar < pEnd && *pChar == '-')
+	{
+		isNegative = RSSL_TRUE;
+		++pChar;
+	}
+
+	for (; pChar < pEnd && *pChar >= '0' && *pChar <= '9'; ++pChar)
+	{
+		hasDigits = RSSL_TRUE;
+		if (mantissa < 100000000000000000ULL)
+			mantissa = mantissa * 10 + (*pChar - '0');
+		else
+			++exponent;
+	}
+
+	if (pChar < pEnd && *pChar == '.')
+	{
+		for (++pChar; pChar < pEnd && *pChar >= '0' && *pChar <= '9'; ++pChar)
+		{
+			hasDigits = RSSL_TRUE;
+			if (mantissa < 100000000000000000ULL)
+			{
+				mantissa = mantissa * 10 + (*pChar - '0');
+				--exponent;
+			}
+		}
+	}
+
+	if (hasDigits && pChar < pEnd && (*pChar == 'e' || *pChar == 'E'))
+	{
+		++pChar;
+		if (pChar < pEnd && (*pChar == '-' || *pChar == '+'))
+			isExponentNegative = (*pChar++ == '-');
+
+		if (pChar == pEnd)
+			hasDigits = RSSL_FALSE;
+
+		for (; pChar < pEnd && *pChar >= '0' && *pChar <= '9'; ++pChar)
+		{
+			if (exponentValue < 1000)
+				exponentValue = exponentValue * 10 + (*pChar - '0');
+		}
+
+		exponent += isExponentNegative ? -exponentValue : exponentValue;
+	}
+
+	if (!hasDigits || pChar != pEnd)
+		return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Invalid number '%.*s'", pText->length, pText->data);
+
+	while (exponent < RSSL_RH_MIN_EXP - RSSL_RH_EXPONENT0)
+	{
+		mantissa /= 10;
+		++exponent;
+	}
+
+	while (exponent > RSSL_RH_MAX_EXP - RSSL_RH_EXPONENT0)
+	{
+		if (mantissa > JSON_RWF_INT64_MAX / 10)
+			return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Number '%.*s' is out of range", pText->length, pText->data);
+		mantissa *= 10;
+		--exponent;
+	}
+
+	pReal->isBlank = RSSL_FALSE;
+	pReal->hint = (RsslUInt8)(RSSL_RH_EXPONENT0 + exponent);
+	pReal->value = isNegative ? -(RsslInt64)mantissa : (RsslInt64)mantissa;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Parses exactly count digits. Returns -1 if they are not all digits. */
+static RsslInt32 jsonRwfParseDigits(const char *pChar, const char *pEnd, RsslInt32 count)
+{
+	RsslInt32 value = 0;
+
+	if (pEnd - pChar < count)
+		return -1;
+
+	for (; count > 0; --count, ++pChar)
+	{
+		if (*pChar < '0' || *pChar > '9')
+			return -1;
+		value = value * 10 + (*pChar - '0');
+	}
+
+	return value;
+}
+
+/* Parses a date in the form YYYY-MM-DD. */
+static RsslBool jsonRwfParseIsoDate(const char *pChar, const char *pEnd, RsslDate *pDate)
+{
+	RsslInt32 year, month, day;
+
+	if (pEnd - pChar != 10 || pChar[4] != '-' || pChar[7] != '-'
+			|| (year = jsonRwfParseDigits(pChar, pEnd, 4)) < 0
+			|| (month = jsonRwfParseDigits(pChar + 5, pEnd, 2)) < 0
+			|| (day = jsonRwfParseDigits(pChar + 8, pEnd, 2)) < 0)
+		return RSSL_FALSE;
+
+	pDate->year = (RsslUInt16)year;
+	pDate->month = (RsslUInt8)month;
+	pDate->day = (RsslUInt8)day;
+	return RSSL_TRUE;
+}
+
+/* Parses a time in the form HH:MM[:SS[.fraction]], with up to nine fraction digits. */
+static RsslBool jsonRwfParseIsoTime(const char *pChar, const char *pEnd, RsslTime *pTime)
+{
+	RsslInt32 hour, minute, second = 255, fraction[3] = { 65535, 2047, 2047 };
+	RsslInt32 part, digits, value;
+
+	if (pEnd - pChar < 5 || pChar[2] != ':'
+			|| (hour = jsonRwfParseDigits(pChar, pEnd, 2)) < 0
+			|| (minute = jsonRwfParseDigits(pChar + 3, pEnd, 2)) < 0)
+		return RSSL_FALSE;
+	pChar += 5;
+
+	if (pChar < pEnd)
+	{
+		if (*pChar != ':' || (second = jsonRwfParseDigits(pChar + 1, pEnd, 2)) < 0)
+			return RSSL_FALSE;
+		pChar += 3;
+
+		if (pChar < pEnd)
+		{
+			if (*pChar++ != '.' || pChar == pEnd || pEnd - pChar > 9)
+				return RSSL_FALSE;
+
+			/* Milliseconds, microseconds and nanoseconds, padding the last part given with zeros. */
+			for (part = 0; part < 3 && pChar < pEnd; ++part)
+			{
+				for (digits = 0, value = 0; digits < 3; ++digits)
+				{
+					value *= 10;
+					if (pChar < pEnd)
+					{
+						if (*pChar < '0' || *pChar > '9')
+							return RSSL_FALSE;
+						value += *pChar++ - '0';
+					}
+				}
+				fraction[part] = value;
+			}
+
+			for (; part < 3; ++part)
+				fraction[part] = 0;
+		}
+	}
+
+	pTime->hour = (RsslUInt8)hour;
+	pTime->minute = (RsslUInt8)minute;
+	pTime->second = (RsslUInt8)second;
+	pTime->millisecond = (RsslUInt16)fraction[0];
+	pTime->microsecond = (RsslUInt16)fraction[1];
+	pTime->nanosecond = (RsslUInt16)fraction[2];
+	return RSSL_TRUE;
+}
+
+/* Decodes base64 text into pDest, which has room for destLength bytes. */
+static RsslRet jsonRwfDecodeBase64(JsonRwfReader *pReader, const RsslBuffer *pText, char *pDest, RsslUInt32 destLength,
+		RsslUInt32 *pDestLength)
+{
+	const char *pChar = pText->data, *pEnd = pText->data + pText->length;
+	char *pOut = pDest, *pOutEnd = pDest + destLength;
+	RsslUInt32 bits = 0, bitCount = 0;
+	RsslInt32 value;
+
+	for (; pChar < pEnd && *pChar != '='; ++pChar)
+	{
+		char c = *pChar;
+
+		if (c >= 'A' && c <= 'Z') value = c - 'A';
+		else if (c >= 'a' && c <= 'z') value = c - 'a' + 26;
+		else if (c >= '0' && c <= '9') value = c - '0' + 52;
+		else if (c == '+') value = 62;
+		else if (c == '/') value = 63;
+		else
+			return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Invalid base64 character '%c'", c);
+
+		bits = (bits << 6) | (RsslUInt32)value;
+		bitCount += 6;
+
+		if (bitCount >= 8)
+		{
+			bitCount -= 8;
+			if (pOut == pOutEnd)
+				return RSSL_RET_BUFFER_TOO_SMALL;
+			*pOut++ = (char)(bits >> bitCount);
+		}
+	}
+
+	*pDestLength = (RsslUInt32)(pOut - pDest);
+	return RSSL_RET_SUCCESS;
+}
+
+/* Encodes a string or buffer field whose content must be unescaped or decoded, writing it directly into the
+ * iterator's buffer. */
+static RsslRet jsonRwfEncodeBufferEntry(JsonRwfReader *pReader, RsslEncodeIterator *pIter, RsslFieldEntry *pFieldEntry,
+		const JsonRwfValue *pValue)
+{
+	RsslBuffer content;
+	RsslUInt32 prefixLength = 0, contentLength;
+	RsslRet ret;
+
+	if ((ret = rsslEncodeFieldEntryInit(pIter, pFieldEntry, 0)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if ((ret = rsslEncodeNonRWFDataTypeInit(pIter, &content)) < RSSL_RET_SUCCESS)
+	{
+		rsslEncodeFieldEntryComplete(pIter, RSSL_FALSE);
+		return ret;
+	}
+
+	if (pFieldEntry->dataType == RSSL_DT_BUFFER)
+		ret = jsonRwfDecodeBase64(pReader, &pValue->text, content.data, content.length, &contentLength);
+	else
+	{
+		/* Non-ASCII text in an RMTES field is marked as UTF-8. */
+		if (pFieldEntry->dataType == RSSL_DT_RMTES_STRING && pValue->hasHighBytes)
+		{
+			prefixLength = sizeof(jsonRwfRmtesUtf8Designation);
+			if (content.length < prefixLength)
+				ret = RSSL_RET_BUFFER_TOO_SMALL;
+			else
+				memcpy(content.data, jsonRwfRmtesUtf8Designation, prefixLength);
+		}
+
+		if (ret >= RSSL_RET_SUCCESS)
+			ret = jsonRwfUnescape(pReader, &pValue->text, content.data + prefixLength, content.length - prefixLength,
+					&contentLength);
+	}
+
+	if (ret < RSSL_RET_SUCCESS)
+	{
+		rsslEncodeNonRWFDataTypeComplete(pIter, &content, RSSL_FALSE);
+		rsslEncodeFieldEntryComplete(pIter, RSSL_FALSE);
+		return ret;
+	}
+
+	content.length = prefixLength + contentLength;
+	if ((ret = rsslEncodeNonRWFDataTypeComplete(pIter, &content, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+	{
+		rsslEncodeFieldEntryComplete(pIter, RSSL_FALSE);
+		return ret;
+	}
+
+	return rsslEncodeFieldEntryComplete(pIter, RSSL_TRUE);
+}
+
+/* Encodes one field from its JSON value, converting the value to the field's type in the dictionary. */
+static RsslRet jsonRwfEncodeField(JsonRwfReader *pReader, RsslEncodeIterator *pIter, const RsslDictionaryEntry *pEntry,
+		const JsonRwfValue *pValue)
+{
+	RsslFieldEntry fieldEntry;
+	union
+	{
+		RsslInt64		intValue;
+		RsslUInt64		uintValue;
+		RsslFloat		floatValue;
+		RsslDouble		doubleValue;
+		RsslReal		realValue;
+		RsslDate		dateValue;
+		RsslTime		timeValue;
+		RsslDateTime	dateTimeValue;
+		RsslEnum		enumValue;
+	} data;
+	char nameStorage[JSON_RWF_MAX_NAME_LENGTH], numberText[JSON_RWF_MAX_NUMBER_LENGTH];
+	RsslBuffer text;
+	const char *pEnd;
+	char *pNumberEnd;
+	RsslUInt64 uintValue;
+	RsslBool isNegative, isString = (pValue->type == JSON_RWF_STRING);
+	RsslRet ret;
+
+	rsslClearFieldEntry(&fieldEntry);
+	fieldEntry.fieldId = pEntry->fid;
+	fieldEntry.dataType = pEntry->rwfType;
+
+	if (pValue->type == JSON_RWF_NULL)
+		return rsslEncodeFieldEntry(pIter, &fieldEntry, NULL);
+
+	if (pValue->type == JSON_RWF_TRUE || pValue->type == JSON_RWF_FALSE)
+		return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Field %.*s cannot be a boolean",
+				pEntry->acronym.length, pEntry->acronym.data);
+
+	/* Numeric fields also accept their value as a string, as some producers quote all values. */
+	text = pValue->text;
+	if (isString && pValue->hasEscapes)
+	{
+		if ((ret = jsonRwfGetName(pReader, pValue, nameStorage, &text)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	switch(pEntry->rwfType)
+	{
+		case RSSL_DT_INT:
+			if ((ret = jsonRwfParseInt(pReader, &text, RSSL_TRUE, &uintValue, &isNegative)) < RSSL_RET_SUCCESS)
+				return ret;
+			data.intValue = isNegative ? (RsslInt64)((RsslUInt64)0 - uintValue) : (RsslInt64)uintValue;
+			break;
+
+		case RSSL_DT_UINT:
+			if ((ret = jsonRwfParseInt(pReader, &text, RSSL_FALSE, &data.uintValue, &isNegative)) < RSSL_RET_SUCCESS)
+				return ret;
+			break;
+
+		case RSSL_DT_ENUM:
+			if (!isString)
+			{
+				if ((ret = jsonRwfParseInt(pReader, &text, RSSL_FALSE, &uintValue, &isNegative)) < RSSL_RET_SUCCESS)
+					return ret;
+				if (uintValue > 0xFFFF)
+					return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Enum value %.*s is out of range", text.length, text.data);
+				data.enumValue = (RsslEnum)uintValue;
+			}
+			else if (rsslDictionaryEntryGetEnumValueByDisplayString(pEntry, &text, &data.enumValue, NULL) != RSSL_RET_SUCCESS)
+				return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Field %.*s has no unique enum value for \"%.*s\"",
+						pEntry->acronym.length, pEntry->acronym.data, text.length, text.data);
+			break;
+
+		case RSSL_DT_REAL:
+			rsslClearReal(&data.realValue);
+			if (isString && text.length == 3 && memcmp(text.data, "Inf", 3) == 0)
+				data.realValue.hint = RSSL_RH_INFINITY;
+			else if (isString && text.length == 4 && memcmp(text.data, "-Inf", 4) == 0)
+				data.realValue.hint = RSSL_RH_NEG_INFINITY;
+			else if (isString && text.length == 3 && memcmp(text.data, "NaN", 3) == 0)
+				data.realValue.hint = RSSL_RH_NOT_A_NUMBER;
+			else if ((ret = jsonRwfParseReal(pReader, &text, &data.realValue)) < RSSL_RET_SUCCESS)
+				return ret;
+			break;
+
+		case RSSL_DT_FLOAT:
+		case RSSL_DT_DOUBLE:
+			if (text.length == 0 || text.length >= sizeof(numberText))
+				return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Invalid number '%.*s'", text.length, text.data);
+			memcpy(numberText, text.data, text.length);
+			numberText[text.length] = '\0';
+			data.doubleValue = strtod(numberText, &pNumberEnd);
+			if (pNumberEnd != numberText + text.length)
+				return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Invalid number '%.*s'", text.length, text.data);
+			if (pEntry->rwfType == RSSL_DT_FLOAT)
+				data.floatValue = (RsslFloat)data.doubleValue;
+			break;
+
+		case RSSL_DT_DATE:
+			if (!isString)
+				return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Field %.*s must be a date string",
+						pEntry->acronym.length, pEntry->acronym.data);
+			if (!jsonRwfParseIsoDate(text.data, text.data + text.length, &data.dateValue)
+					&& rsslDateStringToDate(&data.dateValue, &text) != RSSL_RET_SUCCESS)
+				return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Invalid date \"%.*s\"", text.length, text.data);
+			break;
+
+		case RSSL_DT_TIME:
+			if (!isString)
+				return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Field %.*s must be a time string",
+						pEntry->acronym.length, pEntry->acronym.data);
+			if (!jsonRwfParseIsoTime(text.data, text.data + text.length, &data.timeValue)
+					&& rsslTimeStringToTime(&data.timeValue, &text) != RSSL_RET_SUCCESS)
+				return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Invalid time \"%.*s\"", text.length, text.data);
+			break;
+
+		case RSSL_DT_DATETIME:
+			if (!isString)
+				return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Field %.*s must be a date and time string",
+						pEntry->acronym.length, pEntry->acronym.data);
+			pEnd = text.data + text.length;
+			if (!(text.length > 11 && (text.data[10] == 'T' || text.data[10] == ' ')
+						&& jsonRwfParseIsoDate(text.data, text.data + 10, &data.dateTimeValue.date)
+						&& jsonRwfParseIsoTime(text.data + 11, pEnd, &data.dateTimeValue.time))
+					&& rsslDateTimeStringToDateTime(&data.dateTimeValue, &text) != RSSL_RET_SUCCESS)
+				return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Invalid date and time \"%.*s\"", text.length, text.data);
+			break;
+
+		case RSSL_DT_ASCII_STRING:
+		case RSSL_DT_UTF8_STRING:
+		case RSSL_DT_RMTES_STRING:
+		case RSSL_DT_BUFFER:
+			if (!isString)
+				return jsonRwfError(pReader, RSSL_RET_INVALID_DATA, "Field %.*s must be a string",
+						pEntry->acronym.length, pEntry->acronym.data);
+
+			/* Plain text is encoded straight from the JSON. */
+			if (pEntry->rwfType == RSSL_DT_BUFFER || pValue->hasEscapes
+					|| (pEntry->rwfType == RSSL_DT_RMTES_STRING && pValue->hasHighBytes))
+				return jsonRwfEncodeBufferEntry(pReader, pIter, &fieldEntry, pValue);
+
+			return rsslEncodeFieldEntry(pIter, &fieldEntry, (void*)&pValue->text);
+
+		default:
+			return jsonRwfError(pReader, RSSL_RET_UNSUPPORTED_DATA_TYPE, "Field %.*s has unsupported type %s",
+					pEntry->acronym.length, pEntry->acronym.data, rsslDataTypeToString(pEntry->rwfType));
+	}
+
+	return rsslEncodeFieldEntry(pIter, &fieldEntry, &data);
+}
+
+/* Finds a field by acronym, or by field ID if the name is a number. */
+static const RsslDictionaryEntry *jsonRwfFindField(RsslDataDictionary *pDictionary, const RsslBuffer *pName)
+{
+	const RsslDictionaryEntry *pEntry;
+	RsslInt32 fieldId = 0;
+	RsslUInt32 i = 0;
+	RsslBool isNegative = RSSL_FALSE;
+
+	if ((pEntry = rsslDictionaryGetEntryByFieldName(pDictionary, pName)) != NULL)
+		return pEntry;
+
+	if (pName->length > 0 && pName->data[0] == '-')
+	{
+		isNegative = RSSL_TRUE;
+		++i;
+	}
+
+	if (i == pName->length || pName->length - i > 5)
+		return NULL;
+
+	for (; i < pName->length; ++i)
+	{
+		if (pName->data[i] < '0' || pName->data[i] > '9')
+			return NULL;
+		fieldId = fieldId * 10 + (pName->data[i] - '0');
+	}
+
+	if (isNegative)
+		fieldId = -fieldId;
+
+	if (fieldId < RSSL_MIN_FID || fieldId > RSSL_MAX_FID)
+		return NULL;
+
+	return getDictionaryEntry(pDictionary, (RsslFieldId)fieldId);
+}
+
+RSSL_API RsslRet rsslConvertJsonToFieldEntries(RsslEncodeIterator *pIter, const RsslBuffer *pJson,
+		RsslDataDictionary *pDictionary, RsslBuffer *pErrorText)
+{
+	JsonRwfReader reader;
+	JsonRwfValue name, value;
+	RsslBuffer fieldName;
+	char nameStorage[JSON_RWF_MAX_NAME_LENGTH];
+	const RsslDictionaryEntry *pEntry;
+	RsslRet ret;
+
+	RSSL_ASSERT(pIter && pJson && pDictionary, Invalid parameters or parameters passed in as NULL);
+
+	reader.start = reader.pos = pJson->data;
+	reader.end = pJson->data + pJson->length;
+	reader.pErrorText = pErrorText;
+
+	jsonRwfSkipWhitespace(&reader);
+	if (reader.pos == reader.end || *reader.pos != '{')
+		return jsonRwfError(&reader, RSSL_RET_INVALID_DATA, "Expected '{'");
+	++reader.pos;
+
+	jsonRwfSkipWhitespace(&reader);
+	if (reader.pos < reader.end && *reader.pos == '}')
+		++reader.pos;
+	else
+	{
+		for (;;)
+		{
+			jsonRwfSkipWhitespace(&reader);
+			if (reader.pos == reader.end || *reader.pos != '"')
+				return jsonRwfError(&reader, RSSL_RET_INVALID_DATA, "Expected a field name");
+
+			if ((ret = jsonRwfReadString(&reader, &name)) < RSSL_RET_SUCCESS
+					|| (ret = jsonRwfGetName(&reader, &name, nameStorage, &fieldName)) < RSSL_RET_SUCCESS)
+				return ret;
+
+			if ((pEntry = jsonRwfFindField(pDictionary, &fieldName)) == NULL)
+				return jsonRwfError(&reader, RSSL_RET_INVALID_DATA, "Field %.*s is not in the dictionary",
+						fieldName.length, fieldName.data);
+
+			jsonRwfSkipWhitespace(&reader);
+			if (reader.pos == reader.end || *reader.pos != ':')
+				return jsonRwfError(&reader, RSSL_RET_INVALID_DATA, "Expected ':'");
+			++reader.pos;
+
+			if ((ret = jsonRwfReadValue(&reader, &value)) < RSSL_RET_SUCCESS
+					|| (ret = jsonRwfEncodeField(&reader, pIter, pEntry, &value)) < RSSL_RET_SUCCESS)
+				return ret;
+
+			jsonRwfSkipWhitespace(&reader);
+			if (reader.pos < reader.end && *reader.pos == ',')
+			{
+				++reader.pos;
+				continue;
+			}
+
+			if (reader.pos < reader.end && *reader.pos == '}')
+			{
+				++reader.pos;
+				break;
+			}
+
+			return jsonRwfError(&reader, RSSL_RET_INVALID_DATA, "Expected ',' or '}'");
+		}
+	}
+
+	jsonRwfSkipWhitespace(&reader);
+	if (reader.pos != reader.end)
+		return jsonRwfError(&reader, RSSL_RET_INVALID_DATA, "Unexpected text after the object");
+
+	return RSSL_RET_SUCCESS;
+}
@@ -985,6 +985,59 @@ RSSL_API RsslRet rsslExtractPostId(
 	return RSSL_RET_SUCCESS;
 }
 
+RSSL_API RsslRet rsslPeekMsgHeader(
+				const RsslDecodeIterator *dIter,
+				RsslMsgHeaderInfo *		pInfo )
+{
+	RsslUInt16 headerSize;
+	char *position, *endBufPtr;
+
+	RSSL_ASSERT(dIter && pInfo, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(dIter->_pBuffer, Invalid parameters or parameters passed in as NULL);
+
+	if (dIter->_decodingLevel + 1 >= RSSL_ITER_MAX_LEVELS)
+		return RSSL_RET_ITERATOR_OVERRUN;
+
+	position = dIter->_curBufPtr;
+	endBufPtr = dIter->_levelInfo[dIter->_decodingLevel + 1]._endBufPtr;
+
+	/* headerSize, msgClass, domainType, streamId, flags and containerType are always
+	 * at the front of the header, regardless of message class. */
+	if (endBufPtr - position < 10)
+		return RSSL_RET_INCOMPLETE_DATA;
+
+	position += rwfGet16(headerSize, position);
+
+	if ((position + headerSize) > endBufPtr)
+		return RSSL_RET_INCOMPLETE_DATA;
+
+	pInfo->encDataBody.data = position + headerSize;
+	pInfo->encDataBody.length = (rtrUInt32)(endBufPtr - pInfo->encDataBody.data);
+
+	position += rwfGet8(pInfo->msgClass, position);
+	/* Top three bits reserved for later use */
+	pInfo->msgClass &= 0x1F;
+
+	if (pInfo->msgClass < RSSL_MC_REQUEST || pInfo->msgClass > RSSL_MC_POST)
+		return RSSL_RET_FAILURE;
+
+	position += rwfGet8(pInfo->domainType, position);
+	position += rwfGet32(pInfo->streamId, position);
+	position += rwfGetResBitU15(&pInfo->flags, position);
+
+	if (position >= pInfo->encDataBody.data)
+		return RSSL_RET_INCOMPLETE_DATA;
+
+	rwfGet8(pInfo->containerType, position);
+	/* need to scale containerType */
+	pInfo->containerType += RSSL_DT_CONTAINER_TYPE_MIN;
+
+	if (pInfo->encDataBody.length == 0)
+		pInfo->encDataBody.data = 0;
+
+	return RSSL_RET_SUCCESS;
+}
+
 RSSL_API const RsslUInt32* rsslGetSeqNum( const RsslMsg * pMsg )
 {
 	switch (pMsg->msgBase.msgClass)
@@ -11,6 +11,12 @@ extern "C" {
 #endif
 
 #include "limits.h"
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RSSL_RMTES_SSE2
+#include <emmintrin.h>
+#endif
 
 #include "rtr/rsslTypes.h"
 
@@ -245,6 +251,40 @@ int UTF8ToUCS2(unsigned char *UTF_char, RsslUInt16* iter, unsigned char* endChar
 	return 0;
 }
 
+/* Returns the number of bytes from inIter that are printable ASCII(0x20 to 0x7E). While Reuters Basic 1 is 
+ * invoked into GL, these convert to themselves, so runs of them can be copied without going through the 
+ * character set state machine. */
+static size_t asciiRunLength(const unsigned char *inIter, const unsigned char *endInput)
+{
+	const unsigned char *pos = inIter;
+
+#ifdef RSSL_RMTES_SSE2
+	const __m128i lowBound = _mm_set1_epi8(0x20);
+	const __m128i deleteChar = _mm_set1_epi8(0x7F);
+
+	/* Check 16 bytes at a time. The signed comparison catches both control(below 0x20) 
+	 * and high(0x80 and above) bytes. */
+	while (endInput - pos >= 16)
+	{
+		__m128i chars = _mm_loadu_si128((const __m128i*)pos);
+		__m128i special = _mm_or_si128(_mm_cmplt_epi8(chars, lowBound), _mm_cmpeq_epi8(chars, deleteChar));
+
+		if (_mm_movemask_epi8(special) != 0)
+			break;
+
+		pos += 16;
+	}
+#endif
+
+	while (pos < endInput && *pos >= 0x20 && *pos < 0x7F)
+		++pos;
+
+	return (size_t)(pos - inIter);
+}
+
+/* Returns whether the ASCII fast path applies to the next character. */
+#define RMTES_ASCII_FAST_PATH(workingSet, shiftGL) ((shiftGL) == NULL && *(workingSet).GL == &_rsslReuterBasic1)
+
 /*	Parses the characters for a control group sequence for conversion ( first character is between 0x00 and 0x1F(CL) or between 0x70 and 0x8F(CR) ) 
 	If error returned, this means that the sequence is either invalid, or contains a partial update/repeat character sequence (these should be removed from the buffer with the applyToCache function)
 	Otherwise, returns codes for success if a working set change is correctly appiled, or that the next character is a shift value.
@@ -605,7 +645,18 @@ RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer
 	{
 		if(encType == TYPE_RMTES)
 		{
-			if(*inIter < 0x20)  /* CL character */
+			if (RMTES_ASCII_FAST_PATH(curWorkingSet, shiftGL) && *inIter >= 0x20 && *inIter < 0x7F)
+			{
+				size_t runLength = asciiRunLength(inIter, endInput);
+
+				if (runLength > (size_t)(endOutput - outIter))
+					return RSSL_RET_BUFFER_TOO_SMALL;
+
+				memcpy(outIter, inIter, runLength);
+				outIter += runLength;
+				inIter += runLength;
+			}
+			else if(*inIter < 0x20)  /* CL character */
 			{
 				if(shiftGL != NULL)
 					return RSSL_RET_FAILURE;
@@ -812,11 +863,17 @@ RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer
 				else
 					inIter += ret;
 			}
-			else /* Just copy the data, since it's already encoded in UTF8 */
+			else /* Just copy the data up to the next escape, since it's already encoded in UTF8 */
 			{
-				*outIter = *inIter;
-				outIter++;
-				inIter++;
+				unsigned char *escChar = (unsigned char*)memchr(inIter, 0x1B, (size_t)(endInput - inIter));
+				size_t runLength = (size_t)((escChar ? escChar : endInput) - inIter);
+
+				if (runLength > (size_t)(endOutput - outIter))
+					return RSSL_RET_BUFFER_TOO_SMALL;
+
+				memcpy(outIter, inIter, runLength);
+				outIter += runLength;
+				inIter += runLength;
 			}
 		}
 	}
@@ -867,7 +924,18 @@ RSSL_API RsslRet rsslRMTESToUCS2(RsslRmtesCacheBuffer *pRmtesBuffer, RsslU16Buff
 	{
 		if(encType == TYPE_RMTES)
 		{
-			if(*inIter < 0x20)  /* CL character */
+			if (RMTES_ASCII_FAST_PATH(curWorkingSet, shiftGL) && *inIter >= 0x20 && *inIter < 0x7F)
+			{
+				size_t runLength = asciiRunLength(inIter, endInput);
+				unsigned char *runEnd;
+
+				if (runLength > (size_t)(endOutput - outIter))
+					runLength = (size_t)(endOutput - outIter);
+
+				for (runEnd = inIter + runLength; inIter < runEnd; ++inIter, ++outIter)
+					*outIter = *inIter;
+			}
+			else if(*inIter < 0x20)  /* CL character */
 			{
 				if(shiftGL != NULL)
 					return RSSL_RET_FAILURE;
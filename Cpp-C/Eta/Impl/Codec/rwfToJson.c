@@ -0,0 +1,1618 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/rsslJsonConverter.h"
+#include "rtr/rsslMessagePackage.h"
+#include "rtr/rsslDataPackage.h"
+#include "rtr/rsslRmtes.h"
+#include "rtr/retmacros.h"
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+/* Writes JSON text sequentially into the caller's buffer. Every write first checks that it fits, so the output is
+ * never overrun and nothing needs to be allocated. */
+typedef struct
+{
+	char						*pos;			/* Next byte to write */
+	char						*end;			/* End of the output buffer */
+	const RsslDataDictionary	*pDictionary;
+} RwfJsonWriter;
+
+/* Storage for any primitive value decoded by rsslDecodePrimitiveType() or rsslDecodeMapEntry(). */
+typedef union
+{
+	RsslInt64		intValue;
+	RsslUInt64		uintValue;
+	RsslFloat		floatValue;
+	RsslDouble		doubleValue;
+	RsslReal		realValue;
+	RsslDate		dateValue;
+	RsslTime		timeValue;
+	RsslDateTime	dateTimeValue;
+	RsslQos			qosValue;
+	RsslState		stateValue;
+	RsslEnum		enumValue;
+	RsslBuffer		bufferValue;
+} RwfJsonPrimitive;
+
+/* RMTES strings longer than this are written without conversion to UTF-8. */
+#define RWF_JSON_MAX_RMTES_LENGTH 1024
+
+#define RWF_JSON_ENSURE(pWriter, count) \
+	if ((size_t)((pWriter)->end - (pWriter)->pos) < (size_t)(count)) return RSSL_RET_BUFFER_TOO_SMALL
+
+#define RWF_JSON_CHECK(ret) \
+	if ((ret) < RSSL_RET_SUCCESS) return (ret)
+
+/* Writes a string literal. */
+#define rwfJsonWriteLiteral(pWriter, literal) rwfJsonWriteRaw(pWriter, literal, sizeof(literal) - 1)
+
+/* Writes the name of an object member from a string literal, preceded by a comma if it is not the first member. */
+#define rwfJsonWriteKey(pWriter, pFirst, literal) rwfJsonWriteName(pWriter, pFirst, literal, sizeof(literal) - 1)
+
+static const char rwfJsonDigitPairs[] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+static const char rwfJsonHexDigits[] = "0123456789abcdef";
+
+static const char rwfJsonBase64Digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static const RsslUInt64 rwfJsonPowersOf10[] =
+{
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+	10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+	1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL
+};
+
+static RsslRet rwfJsonWriteData(RwfJsonWriter *pWriter, RsslDecodeIterator *pIter, RsslDataType dataType,
+		const RsslBuffer *pEncData);
+static RsslRet rwfJsonWriteContainerMember(RwfJsonWriter *pWriter, RsslDecodeIterator *pIter, RsslBool *pFirst,
+		RsslDataType containerType, const RsslBuffer *pEncData, void *pSetDb);
+static RsslRet rwfJsonWriteMsg(RwfJsonWriter *pWriter, RsslDecodeIterator *pIter, const RsslMsg *pMsg);
+
+/* Formats the digits of value into pDest, which must have room for 20 characters. Returns the number written. */
+static RsslUInt32 rwfJsonFormatDigits(char *pDest, RsslUInt64 value)
+{
+	char digits[20];
+	char *pDigit = digits + sizeof(digits);
+	RsslUInt32 pair, length;
+
+	while (value >= 100)
+	{
+		pair = (RsslUInt32)(value % 100) * 2;
+		value /= 100;
+		pDigit -= 2;
+		pDigit[0] = rwfJsonDigitPairs[pair];
+		pDigit[1] = rwfJsonDigitPairs[pair + 1];
+	}
+
+	if (value >= 10)
+	{
+		pair = (RsslUInt32)value * 2;
+		pDigit -= 2;
+		pDigit[0] = rwfJsonDigitPairs[pair];
+		pDigit[1] = rwfJsonDigitPairs[pair + 1];
+	}
+	else
+		*--pDigit = (char)('0' + value);
+
+	length = (RsslUInt32)(digits + sizeof(digits) - pDigit);
+	memcpy(pDest, pDigit, length);
+	return length;
+}
+
+/* Formats value into exactly width digits, padding with leading zeros. */
+static void rwfJsonFormatPadded(char *pDest, RsslUInt32 value, RsslUInt32 width)
+{
+	while (width > 0)
+	{
+		pDest[--width] = (char)('0' + value % 10);
+		value /= 10;
+	}
+}
+
+static RsslRet rwfJsonWriteRaw(RwfJsonWriter *pWriter, const char *pData, size_t length)
+{
+	RWF_JSON_ENSURE(pWriter, length);
+	memcpy(pWriter->pos, pData, length);
+	pWriter->pos += length;
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet rwfJsonWriteChar(RwfJsonWriter *pWriter, char c)
+{
+	RWF_JSON_ENSURE(pWriter, 1);
+	*pWriter->pos++ = c;
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet rwfJsonWriteName(RwfJsonWriter *pWriter, RsslBool *pFirst, const char *pName, size_t length)
+{
+	RWF_JSON_ENSURE(pWriter, length + 4);
+
+	if (*pFirst)
+		*pFirst = RSSL_FALSE;
+	else
+		*pWriter->pos++ = ',';
+
+	*pWriter->pos++ = '"';
+	memcpy(pWriter->pos, pName, length);
+	pWriter->pos += length;
+	*pWriter->pos++ = '"';
+	*pWriter->pos++ = ':';
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet rwfJsonWriteUInt(RwfJsonWriter *pWriter, RsslUInt64 value)
+{
+	RWF_JSON_ENSURE(pWriter, 20);
+	pWriter->pos += rwfJsonFormatDigits(pWriter->pos, value);
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet rwfJsonWriteInt(RwfJsonWriter *pWriter, RsslInt64 value)
+{
+	RWF_JSON_ENSURE(pWriter, 21);
+
+	if (value < 0)
+	{
+		*pWriter->pos++ = '-';
+		pWriter->pos += rwfJsonFormatDigits(pWriter->pos, (RsslUInt64)0 - (RsslUInt64)value);
+	}
+	else
+		pWriter->pos += rwfJsonFormatDigits(pWriter->pos, (RsslUInt64)value);
+
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet rwfJsonWriteBool(RwfJsonWriter *pWriter, RsslBool value)
+{
+	return value ? rwfJsonWriteLiteral(pWriter, "true") : rwfJsonWriteLiteral(pWriter, "false");
+}
+
+/* Writes a quoted string, escaping the characters JSON requires. Bytes above 0x7F are copied unchanged unless
+ * escapeHighBytes is set, in which case they are taken as Latin-1 and written as \u escapes. */
+static RsslRet rwfJsonWriteEscapedString(RwfJsonWriter *pWriter, const char *pData, RsslUInt32 length, RsslBool escapeHighBytes)
+{
+	const unsigned char *pChar = (const unsigned char*)pData;
+	const unsigned char *pEnd = pChar + length;
+	const unsigned char *pRun = pChar;
+	size_t runLength;
+
+	/* Room for the string and its quotes if nothing needs escaping. Escapes check for their extra space. */
+	RWF_JSON_ENSURE(pWriter, (size_t)length + 2);
+	*pWriter->pos++ = '"';
+
+	for (; pChar < pEnd; ++pChar)
+	{
+		unsigned char c = *pChar;
+
+		if (c >= 0x20 && c != '"' && c != '\\' && (c < 0x80 || !escapeHighBytes))
+			continue;
+
+		runLength = pChar - pRun;
+		memcpy(pWriter->pos, pRun, runLength);
+		pWriter->pos += runLength;
+		pRun = pChar + 1;
+
+		/* The escape, plus the rest of the string and the closing quote. */
+		RWF_JSON_ENSURE(pWriter, (size_t)(pEnd - pChar) + 6);
+		*pWriter->pos++ = '\\';
+		switch(c)
+		{
+			case '"': *pWriter->pos++ = '"'; break;
+			case '\\': *pWriter->pos++ = '\\'; break;
+			case '\b': *pWriter->pos++ = 'b'; break;
+			case '\f': *pWriter->pos++ = 'f'; break;
+			case '\n': *pWriter->pos++ = 'n'; break;
+			case '\r': *pWriter->pos++ = 'r'; break;
+			case '\t': *pWriter->pos++ = 't'; break;
+			default:
+				*pWriter->pos++ = 'u';
+				*pWriter->pos++ = '0';
+				*pWriter->pos++ = '0';
+				*pWriter->pos++ = rwfJsonHexDigits[c >> 4];
+				*pWriter->pos++ = rwfJsonHexDigits[c & 0xF];
+				break;
+		}
+	}
+
+	runLength = pEnd - pRun;
+	memcpy(pWriter->pos, pRun, runLength);
+	pWriter->pos += runLength;
+	*pWriter->pos++ = '"';
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet rwfJsonWriteString(RwfJsonWriter *pWriter, const char *pData, RsslUInt32 length)
+{
+	return rwfJsonWriteEscapedString(pWriter, pData, length, RSSL_FALSE);
+}
+
+static RsslRet rwfJsonWriteCString(RwfJsonWriter *pWriter, const char *pString)
+{
+	return rwfJsonWriteEscapedString(pWriter, pString, (RsslUInt32)strlen(pString), RSSL_FALSE);
+}
+
+/* Writes the OMM name of an enumerated value, or its number if it has no name. */
+static RsslRet rwfJsonWriteEnumName(RwfJsonWriter *pWriter, const char *pName, RsslUInt64 value)
+{
+	return pName ? rwfJsonWriteCString(pWriter, pName) : rwfJsonWriteUInt(pWriter, value);
+}
+
+/* Writes an RMTES string as UTF-8. Strings of plain ASCII are already UTF-8 and are written directly. */
+static RsslRet rwfJsonWriteRmtesString(RwfJsonWriter *pWriter, const RsslBuffer *pBuffer)
+{
+	char cacheData[RWF_JSON_MAX_RMTES_LENGTH];
+	char utf8Data[RWF_JSON_MAX_RMTES_LENGTH * 3];
+	RsslRmtesCacheBuffer cacheBuffer;
+	RsslBuffer utf8Buffer;
+	RsslUInt32 i;
+
+	for (i = 0; i < pBuffer->length; ++i)
+	{
+		if ((unsigned char)pBuffer->data[i] >= 0x80 || pBuffer->data[i] == 0x1B
+				|| pBuffer->data[i] == 0x0E || pBuffer->data[i] == 0x0F)
+			break;
+	}
+
+	if (i == pBuffer->length)
+		return rwfJsonWriteString(pWriter, pBuffer->data, pBuffer->length);
+
+	cacheBuffer.data = cacheData;
+	cacheBuffer.length = 0;
+	cacheBuffer.allocatedLength = sizeof(cacheData);
+	utf8Buffer.data = utf8Data;
+	utf8Buffer.length = sizeof(utf8Data);
+
+	if (pBuffer->length <= sizeof(cacheData)
+			&& rsslRMTESApplyToCache((RsslBuffer*)pBuffer, &cacheBuffer) >= RSSL_RET_SUCCESS
+			&& rsslRMTESToUTF8(&cacheBuffer, &utf8Buffer) >= RSSL_RET_SUCCESS)
+		return rwfJsonWriteString(pWriter, utf8Buffer.data, utf8Buffer.length);
+
+	/* Too long or not valid RMTES; write it as Latin-1 so the output is still valid JSON. */
+	return rwfJsonWriteEscapedString(pWriter, pBuffer->data, pBuffer->length, RSSL_TRUE);
+}
+
+static RsslRet rwfJsonWriteBase64(RwfJsonWriter *pWriter, const RsslBuffer *pBuffer)
+{
+	const unsigned char *pData = (const unsigned char*)pBuffer->data;
+	RsslUInt32 remaining = pBuffer->length;
+	RsslUInt32 bits;
+
+	RWF_JSON_ENSURE(pWriter, ((size_t)pBuffer->length + 2) / 3 * 4 + 2);
+	*pWriter->pos++ = '"';
+
+	for (; remaining >= 3; remaining -= 3, pData += 3)
+	{
+		bits = ((RsslUInt32)pData[0] << 16) | ((RsslUInt32)pData[1] << 8) | pData[2];
+		*pWriter->pos++ = rwfJsonBase64Digits[bits >> 18];
+		*pWriter->pos++ = rwfJsonBase64Digits[(bits >> 12) & 0x3F];
+		*pWriter->pos++ = rwfJsonBase64Digits[(bits >> 6) & 0x3F];
+		*pWriter->pos++ = rwfJsonBase64Digits[bits & 0x3F];
+	}
+
+	if (remaining > 0)
+	{
+		bits = (RsslUInt32)pData[0] << 16;
+		if (remaining == 2)
+			bits |= (RsslUInt32)pData[1] << 8;
+
+		*pWriter->pos++ = rwfJsonBase64Digits[bits >> 18];
+		*pWriter->pos++ = rwfJsonBase64Digits[(bits >> 12) & 0x3F];
+		*pWriter->pos++ = (remaining == 2) ? rwfJsonBase64Digits[(bits >> 6) & 0x3F] : '=';
+		*pWriter->pos++ = '=';
+	}
+
+	*pWriter->pos++ = '"';
+	return RSSL_RET_SUCCESS;
+}
+
+/* Writes an RsslReal exactly as it is encoded: exponent hints place the decimal point in the mantissa's digits,
+ * and fraction hints are expanded to their exact decimal value (1/2^n always has n decimal digits). */
+static RsslRet rwfJsonWriteReal(RwfJsonWriter *pWriter, const RsslReal *pReal)
+{
+	char digits[20];
+	RsslUInt64 magnitude;
+	RsslUInt32 length, decimals, shift;
+
+	if (pReal->isBlank)
+		return rwfJsonWriteLiteral(pWriter, "null");
+
+	switch(pReal->hint)
+	{
+		case RSSL_RH_INFINITY: return rwfJsonWriteLiteral(pWriter, "\"Inf\"");
+		case RSSL_RH_NEG_INFINITY: return rwfJsonWriteLiteral(pWriter, "\"-Inf\"");
+		case RSSL_RH_NOT_A_NUMBER: return rwfJsonWriteLiteral(pWriter, "\"NaN\"");
+		default: break;
+	}
+
+	if (pReal->hint > RSSL_RH_MAX_DIVISOR)
+		return RSSL_RET_INVALID_DATA;
+
+	/* Sign, 20 digits, and either 14 decimals with a leading "0.", 7 trailing zeros, or 8 fraction digits. */
+	RWF_JSON_ENSURE(pWriter, 40);
+
+	if (pReal->value < 0)
+	{
+		*pWriter->pos++ = '-';
+		magnitude = (RsslUInt64)0 - (RsslUInt64)pReal->value;
+	}
+	else
+		magnitude = (RsslUInt64)pReal->value;
+
+	if (pReal->hint < RSSL_RH_EXPONENT0)
+	{
+		decimals = RSSL_RH_EXPONENT0 - pReal->hint;
+		length = rwfJsonFormatDigits(digits, magnitude);
+
+		if (length <= decimals)
+		{
+			*pWriter->pos++ = '0';
+			*pWriter->pos++ = '.';
+			memset(pWriter->pos, '0', decimals - length);
+			pWriter->pos += decimals - length;
+			memcpy(pWriter->pos, digits, length);
+			pWriter->pos += length;
+		}
+		else
+		{
+			memcpy(pWriter->pos, digits, length - decimals);
+			pWriter->pos += length - decimals;
+			*pWriter->pos++ = '.';
+			memcpy(pWriter->pos, digits + length - decimals, decimals);
+			pWriter->pos += decimals;
+		}
+	}
+	else if (pReal->hint <= RSSL_RH_MAX_EXP)
+	{
+		pWriter->pos += rwfJsonFormatDigits(pWriter->pos, magnitude);
+
+		if (magnitude != 0)
+		{
+			memset(pWriter->pos, '0', pReal->hint - RSSL_RH_EXPONENT0);
+			pWriter->pos += pReal->hint - RSSL_RH_EXPONENT0;
+		}
+	}
+	else
+	{
+		shift = pReal->hint - RSSL_RH_FRACTION_1;
+		pWriter->pos += rwfJsonFormatDigits(pWriter->pos, magnitude >> shift);
+		magnitude &= ((RsslUInt64)1 << shift) - 1;
+
+		if (magnitude != 0)
+		{
+			/* magnitude/2^shift == magnitude*5^shift/10^shift */
+			magnitude *= rwfJsonPowersOf10[shift] >> shift;
+			while (magnitude % 10 == 0)
+			{
+				magnitude /= 10;
+				--shift;
+			}
+
+			*pWriter->pos++ = '.';
+			rwfJsonFormatPadded(pWriter->pos, (RsslUInt32)magnitude, shift);
+			pWriter->pos += shift;
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Writes a floating point value rounded to the given number of significant digits (at most 17), in plain notation
+ * where that is reasonably short and in exponent notation otherwise. */
+static RsslRet rwfJsonWriteDouble(RwfJsonWriter *pWriter, RsslDouble value, int significantDigits)
+{
+	char digits[20];
+	RsslUInt64 mantissa;
+	RsslUInt32 length;
+	int exponent, scale;
+	double scaled;
+
+	if (value != value)
+		return rwfJsonWriteLiteral(pWriter, "\"NaN\"");
+
+	if (value > DBL_MAX)
+		return rwfJsonWriteLiteral(pWriter, "\"Inf\"");
+
+	if (value < -DBL_MAX)
+		return rwfJsonWriteLiteral(pWriter, "\"-Inf\"");
+
+	/* Sign, 17 digits, and either 6 leading zeros with "0." or an exponent. */
+	RWF_JSON_ENSURE(pWriter, 32);
+
+	if (value < 0)
+	{
+		*pWriter->pos++ = '-';
+		value = -value;
+	}
+
+	if (value < 1e15 && value == floor(value))
+	{
+		pWriter->pos += rwfJsonFormatDigits(pWriter->pos, (RsslUInt64)value);
+		return RSSL_RET_SUCCESS;
+	}
+
+	/* Scale the value so its significant digits form an integer mantissa. */
+	exponent = (int)floor(log10(value));
+	scale = significantDigits - 1 - exponent;
+	scaled = (scale > 300) ? value * 1e100 * pow(10.0, scale - 100) : value * pow(10.0, scale);
+	mantissa = (RsslUInt64)(scaled + 0.5);
+
+	/* log10() and rounding can leave the mantissa one digit long or short. */
+	if (mantissa >= rwfJsonPowersOf10[significantDigits])
+	{
+		mantissa = (mantissa + 5) / 10;
+		++exponent;
+	}
+	else if (mantissa < rwfJsonPowersOf10[significantDigits - 1])
+	{
+		mantissa = (RsslUInt64)(scaled * 10 + 0.5);
+		--exponent;
+	}
+
+	while (mantissa % 10 == 0)
+		mantissa /= 10;
+
+	length = rwfJsonFormatDigits(digits, mantissa);
+
+	if (exponent >= 0 && exponent < significantDigits)
+	{
+		if (length <= (RsslUInt32)exponent + 1)
+		{
+			memcpy(pWriter->pos, digits, length);
+			pWriter->pos += length;
+			memset(pWriter->pos, '0', exponent + 1 - length);
+			pWriter->pos += exponent + 1 - length;
+		}
+		else
+		{
+			memcpy(pWriter->pos, digits, exponent + 1);
+			pWriter->pos += exponent + 1;
+			*pWriter->pos++ = '.';
+			memcpy(pWriter->pos, digits + exponent + 1, length - exponent - 1);
+			pWriter->pos += length - exponent - 1;
+		}
+	}
+	else if (exponent < 0 && exponent >= -6)
+	{
+		*pWriter->pos++ = '0';
+		*pWriter->pos++ = '.';
+		memset(pWriter->pos, '0', -exponent - 1);
+		pWriter->pos += -exponent - 1;
+		memcpy(pWriter->pos, digits, length);
+		pWriter->pos += length;
+	}
+	else
+	{
+		*pWriter->pos++ = digits[0];
+		if (length > 1)
+		{
+			*pWriter->pos++ = '.';
+			memcpy(pWriter->pos, digits + 1, length - 1);
+			pWriter->pos += length - 1;
+		}
+		*pWriter->pos++ = 'e';
+		if (exponent < 0)
+		{
+			*pWriter->pos++ = '-';
+			exponent = -exponent;
+		}
+		pWriter->pos += rwfJsonFormatDigits(pWriter->pos, (RsslUInt64)exponent);
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Formats a date as YYYY-MM-DD. Returns the number of characters written. */
+static RsslUInt32 rwfJsonFormatDate(char *pDest, const RsslDate *pDate)
+{
+	rwfJsonFormatPadded(pDest, pDate->year, 4);
+	pDest[4] = '-';
+	rwfJsonFormatPadded(pDest + 5, pDate->month, 2);
+	pDest[7] = '-';
+	rwfJsonFormatPadded(pDest + 8, pDate->day, 2);
+	return 10;
+}
+
+/* Formats a time as HH:MM:SS.mmmuuunnn, stopping at the first blank part and leaving out trailing sub-second
+ * parts that are zero. Returns the number of characters written. */
+static RsslUInt32 rwfJsonFormatTime(char *pDest, const RsslTime *pTime)
+{
+	char *pPos = pDest;
+
+	rwfJsonFormatPadded(pPos, pTime->hour, 2);
+	pPos += 2;
+	if (pTime->minute == 255)
+		return (RsslUInt32)(pPos - pDest);
+
+	*pPos++ = ':';
+	rwfJsonFormatPadded(pPos, pTime->minute, 2);
+	pPos += 2;
+	if (pTime->second == 255)
+		return (RsslUInt32)(pPos - pDest);
+
+	*pPos++ = ':';
+	rwfJsonFormatPadded(pPos, pTime->second, 2);
+	pPos += 2;
+	if (pTime->millisecond == 65535)
+		return (RsslUInt32)(pPos - pDest);
+
+	if (pTime->millisecond != 0
+			|| (pTime->microsecond != 0 && pTime->microsecond != 2047)
+			|| (pTime->nanosecond != 0 && pTime->nanosecond != 2047))
+	{
+		*pPos++ = '.';
+		rwfJsonFormatPadded(pPos, pTime->millisecond, 3);
+		pPos += 3;
+
+		if (pTime->microsecond != 2047
+				&& (pTime->microsecond != 0 || (pTime->nanosecond != 0 && pTime->nanosecond != 2047)))
+		{
+			rwfJsonFormatPadded(pPos, pTime->microsecond, 3);
+			pPos += 3;
+
+			if (pTime->nanosecond != 0 && pTime->nanosecond != 2047)
+			{
+				rwfJsonFormatPadded(pPos, pTime->nanosecond, 3);
+				pPos += 3;
+			}
+		}
+	}
+
+	return (RsslUInt32)(pPos - pDest);
+}
+
+static RsslRet rwfJsonWriteDate(RwfJsonWriter *pWriter, const RsslDate *pDate)
+{
+	RWF_JSON_ENSURE(pWriter, 12);
+	*pWriter->pos++ = '"';
+	pWriter->pos += rwfJsonFormatDate(pWriter->pos, pDate);
+	*pWriter->pos++ = '"';
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet rwfJsonWriteTime(RwfJsonWriter *pWriter, const RsslTime *pTime)
+{
+	RWF_JSON_ENSURE(pWriter, 20);
+	*pWriter->pos++ = '"';
+	pWriter->pos += rwfJsonFormatTime(pWriter->pos, pTime);
+	*pWriter->pos++ = '"';
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet rwfJsonWriteDateTime(RwfJsonWriter *pWriter, const RsslDateTime *pDateTime)
+{
+	RWF_JSON_ENSURE(pWriter, 31);
+	*pWriter->pos++ = '"';
+	pWriter->pos += rwfJsonFormatDate(pWriter->pos, &pDateTime->date);
+	*pWriter->pos++ = 'T';
+	pWriter->pos += rwfJsonFormatTime(pWriter->pos, &pDateTime->time);
+	*pWriter->pos++ = '"';
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet rwfJsonWriteQos(RwfJsonWriter *pWriter, const RsslQos *pQos)
+{
+	RsslBool first = RSSL_TRUE;
+	RsslRet ret;
+
+	if ((ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteKey(pWriter, &first, "Timeliness")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteEnumName(pWriter, rsslQosTimelinessToOmmString(pQos->timeliness), pQos->timeliness)) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteKey(pWriter, &first, "Rate")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteEnumName(pWriter, rsslQosRateToOmmString(pQos->rate), pQos->rate)) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteKey(pWriter, &first, "Dynamic")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteBool(pWriter, pQos->dynamic)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if (pQos->timeliness == RSSL_QOS_TIME_DELAYED)
+	{
+		if ((ret = rwfJsonWriteKey(pWriter, &first, "TimeInfo")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteUInt(pWriter, pQos->timeInfo)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if (pQos->rate == RSSL_QOS_RATE_TIME_CONFLATED)
+	{
+		if ((ret = rwfJsonWriteKey(pWriter, &first, "RateInfo")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteUInt(pWriter, pQos->rateInfo)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return rwfJsonWriteChar(pWriter, '}');
+}
+
+static RsslRet rwfJsonWriteState(RwfJsonWriter *pWriter, const RsslState *pState)
+{
+	RsslBool first = RSSL_TRUE;
+	RsslRet ret;
+
+	if ((ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteKey(pWriter, &first, "Stream")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteEnumName(pWriter, rsslStreamStateToOmmString(pState->streamState), pState->streamState)) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteKey(pWriter, &first, "Data")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteEnumName(pWriter, rsslDataStateToOmmString(pState->dataState), pState->dataState)) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteKey(pWriter, &first, "Code")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteEnumName(pWriter, rsslStateCodeToOmmString(pState->code), pState->code)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if (pState->text.length > 0)
+	{
+		if ((ret = rwfJsonWriteKey(pWriter, &first, "Text")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteString(pWriter, pState->text.data, pState->text.length)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return rwfJsonWriteChar(pWriter, '}');
+}
+
+/* Writes a decoded primitive value. */
+static RsslRet rwfJsonWritePrimitive(RwfJsonWriter *pWriter, RsslDataType dataType, const RwfJsonPrimitive *pValue)
+{
+	switch(dataType)
+	{
+		case RSSL_DT_INT: return rwfJsonWriteInt(pWriter, pValue->intValue);
+		case RSSL_DT_UINT: return rwfJsonWriteUInt(pWriter, pValue->uintValue);
+		case RSSL_DT_FLOAT: return rwfJsonWriteDouble(pWriter, pValue->floatValue, 7);
+		case RSSL_DT_DOUBLE: return rwfJsonWriteDouble(pWriter, pValue->doubleValue, 15);
+		case RSSL_DT_REAL: return rwfJsonWriteReal(pWriter, &pValue->realValue);
+		case RSSL_DT_DATE: return rwfJsonWriteDate(pWriter, &pValue->dateValue);
+		case RSSL_DT_TIME: return rwfJsonWriteTime(pWriter, &pValue->timeValue);
+		case RSSL_DT_DATETIME: return rwfJsonWriteDateTime(pWriter, &pValue->dateTimeValue);
+		case RSSL_DT_QOS: return rwfJsonWriteQos(pWriter, &pValue->qosValue);
+		case RSSL_DT_STATE: return rwfJsonWriteState(pWriter, &pValue->stateValue);
+		case RSSL_DT_ENUM: return rwfJsonWriteUInt(pWriter, pValue->enumValue);
+		case RSSL_DT_ASCII_STRING:
+		case RSSL_DT_UTF8_STRING:
+			return rwfJsonWriteString(pWriter, pValue->bufferValue.data, pValue->bufferValue.length);
+		case RSSL_DT_RMTES_STRING: return rwfJsonWriteRmtesString(pWriter, &pValue->bufferValue);
+		default: return rwfJsonWriteBase64(pWriter, &pValue->bufferValue);
+	}
+}
+
+/* Writes an array as {"Type":<primitive type>,"Data":[<values>]}. */
+static RsslRet rwfJsonWriteArray(RwfJsonWriter *pWriter, RsslDecodeIterator *pIter)
+{
+	RsslArray array;
+	RsslBuffer entry;
+	RwfJsonPrimitive value;
+	RsslBool first = RSSL_TRUE;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeArray(pIter, &array)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if ((ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteKey(pWriter, &first, "Type")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteEnumName(pWriter, rsslDataTypeToOmmString(array.primitiveType), array.primitiveType)) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteKey(pWriter, &first, "Data")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteChar(pWriter, '[')) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if (ret != RSSL_RET_BLANK_DATA)
+	{
+		first = RSSL_TRUE;
+		while ((ret = rsslDecodeArrayEntry(pIter, &entry)) != RSSL_RET_END_OF_CONTAINER)
+		{
+			RWF_JSON_CHECK(ret);
+
+			if (first)
+				first = RSSL_FALSE;
+			else if ((ret = rwfJsonWriteChar(pWriter, ',')) < RSSL_RET_SUCCESS)
+				return ret;
+
+			if ((ret = rsslDecodePrimitiveType(pIter, array.primitiveType, &value)) == RSSL_RET_BLANK_DATA)
+				ret = rwfJsonWriteLiteral(pWriter, "null");
+			else if (ret >= RSSL_RET_SUCCESS)
+				ret = rwfJsonWritePrimitive(pWriter, array.primitiveType, &value);
+
+			RWF_JSON_CHECK(ret);
+		}
+	}
+
+	return rwfJsonWriteLiteral(pWriter, "]}");
+}
+
+static RsslRet rwfJsonWriteFieldList(RwfJsonWriter *pWriter, RsslDecodeIterator *pIter, RsslLocalFieldSetDefDb *pSetDb)
+{
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslDictionaryEntry *pDictionaryEntry;
+	RsslDataType dataType;
+	RsslBool first = RSSL_TRUE;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeFieldList(pIter, &fieldList, pSetDb)) == RSSL_RET_NO_DATA)
+		return rwfJsonWriteLiteral(pWriter, "{}");
+	RWF_JSON_CHECK(ret);
+
+	if ((ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS)
+		return ret;
+
+	while ((ret = rsslDecodeFieldEntry(pIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		RWF_JSON_CHECK(ret);
+
+		pDictionaryEntry = pWriter->pDictionary ?
+			getDictionaryEntry((RsslDataDictionary*)pWriter->pDictionary, fieldEntry.fieldId) : NULL;
+
+		if (first)
+			first = RSSL_FALSE;
+		else if ((ret = rwfJsonWriteChar(pWriter, ',')) < RSSL_RET_SUCCESS)
+			return ret;
+
+		if (pDictionaryEntry)
+			ret = rwfJsonWriteString(pWriter, pDictionaryEntry->acronym.data, pDictionaryEntry->acronym.length);
+		else if ((ret = rwfJsonWriteChar(pWriter, '"')) >= RSSL_RET_SUCCESS
+				&& (ret = rwfJsonWriteInt(pWriter, fieldEntry.fieldId)) >= RSSL_RET_SUCCESS)
+			ret = rwfJsonWriteChar(pWriter, '"');
+
+		if (ret < RSSL_RET_SUCCESS || (ret = rwfJsonWriteChar(pWriter, ':')) < RSSL_RET_SUCCESS)
+			return ret;
+
+		if (fieldEntry.dataType != RSSL_DT_UNKNOWN)
+			dataType = fieldEntry.dataType;
+		else
+			dataType = pDictionaryEntry ? pDictionaryEntry->rwfType : RSSL_DT_UNKNOWN;
+
+		if ((ret = rwfJsonWriteData(pWriter, pIter, dataType, &fieldEntry.encData)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return rwfJsonWriteChar(pWriter, '}');
+}
+
+static RsslRet rwfJsonWriteElementList(RwfJsonWriter *pWriter, RsslDecodeIterator *pIter, RsslLocalElementSetDefDb *pSetDb)
+{
+	RsslElementList elementList;
+	RsslElementEntry elementEntry;
+	RsslBool first = RSSL_TRUE;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeElementList(pIter, &elementList, pSetDb)) == RSSL_RET_NO_DATA)
+		return rwfJsonWriteLiteral(pWriter, "{}");
+	RWF_JSON_CHECK(ret);
+
+	if ((ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS)
+		return ret;
+
+	while ((ret = rsslDecodeElementEntry(pIter, &elementEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		RWF_JSON_CHECK(ret);
+
+		if (first)
+			first = RSSL_FALSE;
+		else if ((ret = rwfJsonWriteChar(pWriter, ',')) < RSSL_RET_SUCCESS)
+			return ret;
+
+		if ((ret = rwfJsonWriteString(pWriter, elementEntry.name.data, elementEntry.name.length)) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteChar(pWriter, ':')) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteData(pWriter, pIter, elementEntry.dataType, &elementEntry.encData)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return rwfJsonWriteChar(pWriter, '}');
+}
+
+/* Decodes the local set definitions of a map, vector or series, if it has any. Returns the database to decode its
+ * entries with, or NULL. */
+static void *rwfJsonDecodeSetDefs(RsslDecodeIterator *pIter, RsslBool hasSetDefs, RsslContainerType containerType,
+		RsslLocalFieldSetDefDb *pFieldSetDb, RsslLocalElementSetDefDb *pElementSetDb)
+{
+	if (!hasSetDefs)
+		return NULL;
+
+	if (containerType == RSSL_DT_FIELD_LIST)
+	{
+		rsslClearLocalFieldSetDefDb(pFieldSetDb);
+		return (rsslDecodeLocalFieldSetDefDb(pIter, pFieldSetDb) >= RSSL_RET_SUCCESS) ? pFieldSetDb : NULL;
+	}
+	else if (containerType == RSSL_DT_ELEMENT_LIST)
+	{
+		rsslClearLocalElementSetDefDb(pElementSetDb);
+		return (rsslDecodeLocalElementSetDefDb(pIter, pElementSetDb) >= RSSL_RET_SUCCESS) ? pElementSetDb : NULL;
+	}
+
+	return NULL;
+}
+
+/* Writes ,"Summary":{<container>} for a map, vector or series. */
+static RsslRet rwfJsonWriteSummary(RwfJsonWriter *pWriter, RsslDecodeIterator *pIter, RsslBool *pFirst,
+		RsslContainerType containerType, const RsslBuffer *pEncSummaryData, void *pSetDb)
+{
+	RsslBool first = RSSL_TRUE;
+	RsslRet ret;
+
+	if ((ret = rwfJsonWriteKey(pWriter, pFirst, "Summary")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteContainerMember(pWriter, pIter, &first, containerType, pEncSummaryData, pSetDb)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	return rwfJsonWriteChar(pWriter, '}');
+}
+
+static RsslRet rwfJsonWriteMap(RwfJsonWriter *pWriter, RsslDecodeIterator *pIter)
+{
+	RsslMap map;
+	RsslMapEntry mapEntry;
+	RwfJsonPrimitive key;
+	RsslLocalFieldSetDefDb fieldSetDb;
+	RsslLocalElementSetDefDb elementSetDb;
+	void *pSetDb;
+	RsslBool first = RSSL_TRUE, firstEntry = RSSL_TRUE, firstMember;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeMap(pIter, &map)) == RSSL_RET_NO_DATA)
+		return rwfJsonWriteLiteral(pWriter, "{}");
+	RWF_JSON_CHECK(ret);
+
+	if ((ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteKey(pWriter, &first, "KeyType")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteEnumName(pWriter, rsslDataTypeToOmmString(map.keyPrimitiveType), map.keyPrimitiveType)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if (map.flags & RSSL_MPF_HAS_KEY_FIELD_ID)
+	{
+		if ((ret = rwfJsonWriteKey(pWriter, &first, "KeyFieldID")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteInt(pWriter, map.keyFieldId)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if (map.flags & RSSL_MPF_HAS_TOTAL_COUNT_HINT)
+	{
+		if ((ret = rwfJsonWriteKey(pWriter, &first, "CountHint")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteUInt(pWriter, map.totalCountHint)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	pSetDb = rwfJsonDecodeSetDefs(pIter, (map.flags & RSSL_MPF_HAS_SET_DEFS) != 0, map.containerType, &fieldSetDb, &elementSetDb);
+
+	if (map.flags & RSSL_MPF_HAS_SUMMARY_DATA)
+	{
+		if ((ret = rwfJsonWriteSummary(pWriter, pIter, &first, map.containerType, &map.encSummaryData, pSetDb)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if ((ret = rwfJsonWriteKey(pWriter, &first, "Entries")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteChar(pWriter, '[')) < RSSL_RET_SUCCESS)
+		return ret;
+
+	while ((ret = rsslDecodeMapEntry(pIter, &mapEntry, &key)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		RWF_JSON_CHECK(ret);
+
+		firstMember = RSSL_TRUE;
+		if ((!firstEntry && (ret = rwfJsonWriteChar(pWriter, ',')) < RSSL_RET_SUCCESS)
+				|| (ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteKey(pWriter, &firstMember, "Action")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteEnumName(pWriter, rsslMapEntryActionToOmmString(mapEntry.action), mapEntry.action)) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteKey(pWriter, &firstMember, "Key")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWritePrimitive(pWriter, map.keyPrimitiveType, &key)) < RSSL_RET_SUCCESS)
+			return ret;
+		firstEntry = RSSL_FALSE;
+
+		if (mapEntry.flags & RSSL_MPEF_HAS_PERM_DATA)
+		{
+			if ((ret = rwfJsonWriteKey(pWriter, &firstMember, "PermData")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteBase64(pWriter, &mapEntry.permData)) < RSSL_RET_SUCCESS)
+				return ret;
+		}
+
+		if (mapEntry.action != RSSL_MPEA_DELETE_ENTRY)
+		{
+			if ((ret = rwfJsonWriteContainerMember(pWriter, pIter, &firstMember, map.containerType, &mapEntry.encData, pSetDb)) < RSSL_RET_SUCCESS)
+				return ret;
+		}
+
+		if ((ret = rwfJsonWriteChar(pWriter, '}')) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return rwfJsonWriteLiteral(pWriter, "]}");
+}
+
+static RsslRet rwfJsonWriteVector(RwfJsonWriter *pWriter, RsslDecodeIterator *pIter)
+{
+	RsslVector vector;
+	RsslVectorEntry vectorEntry;
+	RsslLocalFieldSetDefDb fieldSetDb;
+	RsslLocalElementSetDefDb elementSetDb;
+	void *pSetDb;
+	RsslBool first = RSSL_TRUE, firstEntry = RSSL_TRUE, firstMember;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeVector(pIter, &vector)) == RSSL_RET_NO_DATA)
+		return rwfJsonWriteLiteral(pWriter, "{}");
+	RWF_JSON_CHECK(ret);
+
+	if ((ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if (vector.flags & RSSL_VTF_SUPPORTS_SORTING)
+	{
+		if ((ret = rwfJsonWriteKey(pWriter, &first, "Sortable")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteLiteral(pWriter, "true")) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if (vector.flags & RSSL_VTF_HAS_TOTAL_COUNT_HINT)
+	{
+		if ((ret = rwfJsonWriteKey(pWriter, &first, "CountHint")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteUInt(pWriter, vector.totalCountHint)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	pSetDb = rwfJsonDecodeSetDefs(pIter, (vector.flags & RSSL_VTF_HAS_SET_DEFS) != 0, vector.containerType, &fieldSetDb, &elementSetDb);
+
+	if (vector.flags & RSSL_VTF_HAS_SUMMARY_DATA)
+	{
+		if ((ret = rwfJsonWriteSummary(pWriter, pIter, &first, vector.containerType, &vector.encSummaryData, pSetDb)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if ((ret = rwfJsonWriteKey(pWriter, &first, "Entries")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteChar(pWriter, '[')) < RSSL_RET_SUCCESS)
+		return ret;
+
+	while ((ret = rsslDecodeVectorEntry(pIter, &vectorEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		RWF_JSON_CHECK(ret);
+
+		firstMember = RSSL_TRUE;
+		if ((!firstEntry && (ret = rwfJsonWriteChar(pWriter, ',')) < RSSL_RET_SUCCESS)
+				|| (ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteKey(pWriter, &firstMember, "Index")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteUInt(pWriter, vectorEntry.index)) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteKey(pWriter, &firstMember, "Action")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteEnumName(pWriter, rsslVectorEntryActionToOmmString(vectorEntry.action), vectorEntry.action)) < RSSL_RET_SUCCESS)
+			return ret;
+		firstEntry = RSSL_FALSE;
+
+		if (vectorEntry.flags & RSSL_VTEF_HAS_PERM_DATA)
+		{
+			if ((ret = rwfJsonWriteKey(pWriter, &firstMember, "PermData")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteBase64(pWriter, &vectorEntry.permData)) < RSSL_RET_SUCCESS)
+				return ret;
+		}
+
+		if (vectorEntry.action != RSSL_VTEA_DELETE_ENTRY && vectorEntry.action != RSSL_VTEA_CLEAR_ENTRY)
+		{
+			if ((ret = rwfJsonWriteContainerMember(pWriter, pIter, &firstMember, vector.containerType, &vectorEntry.encData, pSetDb)) < RSSL_RET_SUCCESS)
+				return ret;
+		}
+
+		if ((ret = rwfJsonWriteChar(pWriter, '}')) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return rwfJsonWriteLiteral(pWriter, "]}");
+}
+
+static RsslRet rwfJsonWriteSeries(RwfJsonWriter *pWriter, RsslDecodeIterator *pIter)
+{
+	RsslSeries series;
+	RsslSeriesEntry seriesEntry;
+	RsslLocalFieldSetDefDb fieldSetDb;
+	RsslLocalElementSetDefDb elementSetDb;
+	void *pSetDb;
+	RsslBool first = RSSL_TRUE, firstEntry = RSSL_TRUE, firstMember;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeSeries(pIter, &series)) == RSSL_RET_NO_DATA)
+		return rwfJsonWriteLiteral(pWriter, "{}");
+	RWF_JSON_CHECK(ret);
+
+	if ((ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if (series.flags & RSSL_SRF_HAS_TOTAL_COUNT_HINT)
+	{
+		if ((ret = rwfJsonWriteKey(pWriter, &first, "CountHint")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteUInt(pWriter, series.totalCountHint)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	pSetDb = rwfJsonDecodeSetDefs(pIter, (series.flags & RSSL_SRF_HAS_SET_DEFS) != 0, series.containerType, &fieldSetDb, &elementSetDb);
+
+	if (series.flags & RSSL_SRF_HAS_SUMMARY_DATA)
+	{
+		if ((ret = rwfJsonWriteSummary(pWriter, pIter, &first, series.containerType, &series.encSummaryData, pSetDb)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if ((ret = rwfJsonWriteKey(pWriter, &first, "Entries")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteChar(pWriter, '[')) < RSSL_RET_SUCCESS)
+		return ret;
+
+	while ((ret = rsslDecodeSeriesEntry(pIter, &seriesEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		RWF_JSON_CHECK(ret);
+
+		firstMember = RSSL_TRUE;
+		if ((!firstEntry && (ret = rwfJsonWriteChar(pWriter, ',')) < RSSL_RET_SUCCESS)
+				|| (ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteContainerMember(pWriter, pIter, &firstMember, series.containerType, &seriesEntry.encData, pSetDb)) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteChar(pWriter, '}')) < RSSL_RET_SUCCESS)
+			return ret;
+		firstEntry = RSSL_FALSE;
+	}
+
+	return rwfJsonWriteLiteral(pWriter, "]}");
+}
+
+static RsslRet rwfJsonWriteFilterList(RwfJsonWriter *pWriter, RsslDecodeIterator *pIter)
+{
+	RsslFilterList filterList;
+	RsslFilterEntry filterEntry;
+	RsslBool first = RSSL_TRUE, firstEntry = RSSL_TRUE, firstMember;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeFilterList(pIter, &filterList)) == RSSL_RET_NO_DATA)
+		return rwfJsonWriteLiteral(pWriter, "{}");
+	RWF_JSON_CHECK(ret);
+
+	if ((ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if (filterList.flags & RSSL_FTF_HAS_TOTAL_COUNT_HINT)
+	{
+		if ((ret = rwfJsonWriteKey(pWriter, &first, "CountHint")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteUInt(pWriter, filterList.totalCountHint)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if ((ret = rwfJsonWriteKey(pWriter, &first, "Entries")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteChar(pWriter, '[')) < RSSL_RET_SUCCESS)
+		return ret;
+
+	while ((ret = rsslDecodeFilterEntry(pIter, &filterEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		RWF_JSON_CHECK(ret);
+
+		firstMember = RSSL_TRUE;
+		if ((!firstEntry && (ret = rwfJsonWriteChar(pWriter, ',')) < RSSL_RET_SUCCESS)
+				|| (ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteKey(pWriter, &firstMember, "ID")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteUInt(pWriter, filterEntry.id)) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteKey(pWriter, &firstMember, "Action")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteEnumName(pWriter, rsslFilterEntryActionToOmmString(filterEntry.action), filterEntry.action)) < RSSL_RET_SUCCESS)
+			return ret;
+		firstEntry = RSSL_FALSE;
+
+		if (filterEntry.flags & RSSL_FTEF_HAS_PERM_DATA)
+		{
+			if ((ret = rwfJsonWriteKey(pWriter, &firstMember, "PermData")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteBase64(pWriter, &filterEntry.permData)) < RSSL_RET_SUCCESS)
+				return ret;
+		}
+
+		if (filterEntry.action != RSSL_FTEA_CLEAR_ENTRY)
+		{
+			if ((ret = rwfJsonWriteContainerMember(pWriter, pIter, &firstMember,
+							(filterEntry.flags & RSSL_FTEF_HAS_CONTAINER_TYPE) ? filterEntry.containerType : filterList.containerType,
+							&filterEntry.encData, NULL)) < RSSL_RET_SUCCESS)
+				return ret;
+		}
+
+		if ((ret = rwfJsonWriteChar(pWriter, '}')) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return rwfJsonWriteLiteral(pWriter, "]}");
+}
+
+/* Writes a container's contents, with the iterator positioned at the container. */
+static RsslRet rwfJsonWriteContainer(RwfJsonWriter *pWriter, RsslDecodeIterator *pIter, RsslDataType containerType,
+		const RsslBuffer *pEncData, void *pSetDb)
+{
+	RsslMsg msg;
+	RsslRet ret;
+
+	switch(containerType)
+	{
+		case RSSL_DT_FIELD_LIST: return rwfJsonWriteFieldList(pWriter, pIter, (RsslLocalFieldSetDefDb*)pSetDb);
+		case RSSL_DT_ELEMENT_LIST: return rwfJsonWriteElementList(pWriter, pIter, (RsslLocalElementSetDefDb*)pSetDb);
+		case RSSL_DT_MAP: return rwfJsonWriteMap(pWriter, pIter);
+		case RSSL_DT_VECTOR: return rwfJsonWriteVector(pWriter, pIter);
+		case RSSL_DT_SERIES: return rwfJsonWriteSeries(pWriter, pIter);
+		case RSSL_DT_FILTER_LIST: return rwfJsonWriteFilterList(pWriter, pIter);
+		case RSSL_DT_MSG:
+			rsslClearMsg(&msg);
+			if ((ret = rsslDecodeMsg(pIter, &msg)) < RSSL_RET_SUCCESS)
+				return ret;
+			return rwfJsonWriteMsg(pWriter, pIter, &msg);
+		case RSSL_DT_XML: return rwfJsonWriteString(pWriter, pEncData->data, pEncData->length);
+		case RSSL_DT_JSON:
+			return (pEncData->length > 0) ? rwfJsonWriteRaw(pWriter, pEncData->data, pEncData->length) : rwfJsonWriteLiteral(pWriter, "null");
+		default: return rwfJsonWriteBase64(pWriter, pEncData);
+	}
+}
+
+/* Writes ,"<container name>":<container> into an open object. Nothing is written for RSSL_DT_NO_DATA. */
+static RsslRet rwfJsonWriteContainerMember(RwfJsonWriter *pWriter, RsslDecodeIterator *pIter, RsslBool *pFirst,
+		RsslDataType containerType, const RsslBuffer *pEncData, void *pSetDb)
+{
+	RsslRet ret;
+
+	switch(containerType)
+	{
+		case RSSL_DT_NO_DATA: return RSSL_RET_SUCCESS;
+		case RSSL_DT_FIELD_LIST: ret = rwfJsonWriteKey(pWriter, pFirst, "Fields"); break;
+		case RSSL_DT_ELEMENT_LIST: ret = rwfJsonWriteKey(pWriter, pFirst, "Elements"); break;
+		case RSSL_DT_MAP: ret = rwfJsonWriteKey(pWriter, pFirst, "Map"); break;
+		case RSSL_DT_VECTOR: ret = rwfJsonWriteKey(pWriter, pFirst, "Vector"); break;
+		case RSSL_DT_SERIES: ret = rwfJsonWriteKey(pWriter, pFirst, "Series"); break;
+		case RSSL_DT_FILTER_LIST: ret = rwfJsonWriteKey(pWriter, pFirst, "FilterList"); break;
+		case RSSL_DT_MSG: ret = rwfJsonWriteKey(pWriter, pFirst, "Message"); break;
+		case RSSL_DT_XML: ret = rwfJsonWriteKey(pWriter, pFirst, "Xml"); break;
+		case RSSL_DT_JSON: ret = rwfJsonWriteKey(pWriter, pFirst, "Json"); break;
+		case RSSL_DT_ANSI_PAGE: ret = rwfJsonWriteKey(pWriter, pFirst, "AnsiPage"); break;
+		default: ret = rwfJsonWriteKey(pWriter, pFirst, "Opaque"); break;
+	}
+
+	if (ret < RSSL_RET_SUCCESS)
+		return ret;
+
+	return rwfJsonWriteContainer(pWriter, pIter, containerType, pEncData, pSetDb);
+}
+
+/* Writes the value of a field or element entry, with the iterator positioned at the entry's data. */
+static RsslRet rwfJsonWriteData(RwfJsonWriter *pWriter, RsslDecodeIterator *pIter, RsslDataType dataType,
+		const RsslBuffer *pEncData)
+{
+	RwfJsonPrimitive value;
+	RsslBool first = RSSL_TRUE;
+	RsslRet ret;
+
+	if (dataType == RSSL_DT_ARRAY)
+		return rwfJsonWriteArray(pWriter, pIter);
+
+	if (dataType == RSSL_DT_UNKNOWN)
+		return rwfJsonWriteBase64(pWriter, pEncData);
+
+	if (dataType < RSSL_DT_SET_PRIMITIVE_MIN)
+	{
+		if ((ret = rsslDecodePrimitiveType(pIter, dataType, &value)) == RSSL_RET_BLANK_DATA)
+			return rwfJsonWriteLiteral(pWriter, "null");
+		RWF_JSON_CHECK(ret);
+		return rwfJsonWritePrimitive(pWriter, dataType, &value);
+	}
+
+	if (dataType == RSSL_DT_NO_DATA)
+		return rwfJsonWriteLiteral(pWriter, "null");
+
+	/* Containers are written as an object holding the named container, as in a message payload. */
+	if ((ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteContainerMember(pWriter, pIter, &first, dataType, pEncData, NULL)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	return rwfJsonWriteChar(pWriter, '}');
+}
+
+static RsslRet rwfJsonWriteMsgKey(RwfJsonWriter *pWriter, RsslDecodeIterator *pIter, RsslBool *pFirst,
+		const RsslMsgKey *pKey, RsslBool isReqKey)
+{
+	RsslDecodeIterator attribIter;
+	RsslBool first = RSSL_TRUE;
+	RsslRet ret;
+
+	if ((ret = (isReqKey ? rwfJsonWriteKey(pWriter, pFirst, "ReqKey") : rwfJsonWriteKey(pWriter, pFirst, "Key"))) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if (pKey->flags & RSSL_MKF_HAS_SERVICE_ID)
+	{
+		if ((ret = rwfJsonWriteKey(pWriter, &first, "Service")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteUInt(pWriter, pKey->serviceId)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if (pKey->flags & RSSL_MKF_HAS_NAME)
+	{
+		if ((ret = rwfJsonWriteKey(pWriter, &first, "Name")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteString(pWriter, pKey->name.data, pKey->name.length)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if (pKey->flags & RSSL_MKF_HAS_NAME_TYPE)
+	{
+		if ((ret = rwfJsonWriteKey(pWriter, &first, "NameType")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteUInt(pWriter, pKey->nameType)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if (pKey->flags & RSSL_MKF_HAS_FILTER)
+	{
+		if ((ret = rwfJsonWriteKey(pWriter, &first, "Filter")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteUInt(pWriter, pKey->filter)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if (pKey->flags & RSSL_MKF_HAS_IDENTIFIER)
+	{
+		if ((ret = rwfJsonWriteKey(pWriter, &first, "Identifier")) < RSSL_RET_SUCCESS
+				|| (ret = rwfJsonWriteInt(pWriter, pKey->identifier)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if (pKey->flags & RSSL_MKF_HAS_ATTRIB)
+	{
+		/* The attrib is decoded with its own iterator, so the message's iterator stays at the payload. */
+		rsslClearDecodeIterator(&attribIter);
+		rsslSetDecodeIteratorRWFVersion(&attribIter, pIter->_majorVersion, pIter->_minorVersion);
+		rsslSetDecodeIteratorBuffer(&attribIter, (RsslBuffer*)&pKey->encAttrib);
+
+		if ((ret = rwfJsonWriteContainerMember(pWriter, &attribIter, &first, pKey->attribContainerType, &pKey->encAttrib, NULL)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return rwfJsonWriteChar(pWriter, '}');
+}
+
+/* Writes ,"<name>":true if the flag is set. */
+static RsslRet rwfJsonWriteFlag(RwfJsonWriter *pWriter, RsslBool *pFirst, RsslUInt16 flags, RsslUInt16 flag,
+		const char *pName, size_t nameLength)
+{
+	RsslRet ret;
+
+	if (!(flags & flag))
+		return RSSL_RET_SUCCESS;
+
+	if ((ret = rwfJsonWriteName(pWriter, pFirst, pName, nameLength)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	return rwfJsonWriteLiteral(pWriter, "true");
+}
+
+#define rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, flag, literal) \
+	rwfJsonWriteFlag(pWriter, pFirst, flags, flag, literal, sizeof(literal) - 1)
+
+static RsslRet rwfJsonWriteUIntMember(RwfJsonWriter *pWriter, RsslBool *pFirst, const char *pName, size_t nameLength,
+		RsslUInt64 value)
+{
+	RsslRet ret;
+
+	if ((ret = rwfJsonWriteName(pWriter, pFirst, pName, nameLength)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	return rwfJsonWriteUInt(pWriter, value);
+}
+
+#define rwfJsonWriteUIntLiteral(pWriter, pFirst, literal, value) \
+	rwfJsonWriteUIntMember(pWriter, pFirst, literal, sizeof(literal) - 1, value)
+
+static RsslRet rwfJsonWriteBase64Member(RwfJsonWriter *pWriter, RsslBool *pFirst, const char *pName, size_t nameLength,
+		const RsslBuffer *pBuffer)
+{
+	RsslRet ret;
+
+	if ((ret = rwfJsonWriteName(pWriter, pFirst, pName, nameLength)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	return rwfJsonWriteBase64(pWriter, pBuffer);
+}
+
+#define rwfJsonWriteBase64Literal(pWriter, pFirst, literal, pBuffer) \
+	rwfJsonWriteBase64Member(pWriter, pFirst, literal, sizeof(literal) - 1, pBuffer)
+
+static RsslRet rwfJsonWritePostUserInfo(RwfJsonWriter *pWriter, RsslBool *pFirst, const RsslPostUserInfo *pPostUserInfo)
+{
+	RsslBool first = RSSL_TRUE;
+	RsslUInt32 address = pPostUserInfo->postUserAddr;
+	int i;
+	RsslRet ret;
+
+	if ((ret = rwfJsonWriteKey(pWriter, pFirst, "PostUserInfo")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteKey(pWriter, &first, "Address")) < RSSL_RET_SUCCESS)
+		return ret;
+
+	/* Dotted-quad address, as rsslIPAddrUIntToString() writes it. */
+	RWF_JSON_ENSURE(pWriter, 17);
+	*pWriter->pos++ = '"';
+	for (i = 24; i >= 0; i -= 8)
+	{
+		pWriter->pos += rwfJsonFormatDigits(pWriter->pos, (address >> i) & 0xFF);
+		if (i > 0)
+			*pWriter->pos++ = '.';
+	}
+	*pWriter->pos++ = '"';
+
+	if ((ret = rwfJsonWriteUIntLiteral(pWriter, &first, "UserID", pPostUserInfo->postUserId)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	return rwfJsonWriteChar(pWriter, '}');
+}
+
+static RsslRet rwfJsonWriteStateMember(RwfJsonWriter *pWriter, RsslBool *pFirst, const RsslState *pState)
+{
+	RsslRet ret;
+
+	if ((ret = rwfJsonWriteKey(pWriter, pFirst, "State")) < RSSL_RET_SUCCESS)
+		return ret;
+
+	return rwfJsonWriteState(pWriter, pState);
+}
+
+static RsslRet rwfJsonWriteQosMember(RwfJsonWriter *pWriter, RsslBool *pFirst, const RsslQos *pQos, RsslBool isWorstQos)
+{
+	RsslRet ret;
+
+	if ((ret = (isWorstQos ? rwfJsonWriteKey(pWriter, pFirst, "WorstQos") : rwfJsonWriteKey(pWriter, pFirst, "Qos"))) < RSSL_RET_SUCCESS)
+		return ret;
+
+	return rwfJsonWriteQos(pWriter, pQos);
+}
+
+/* Writes the members specific to the message's class. */
+static RsslRet rwfJsonWriteMsgClassMembers(RwfJsonWriter *pWriter, RsslBool *pFirst, const RsslMsg *pMsg)
+{
+	RsslUInt16 flags;
+	RsslRet ret = RSSL_RET_SUCCESS;
+
+	switch(pMsg->msgBase.msgClass)
+	{
+		case RSSL_MC_UPDATE:
+		{
+			const RsslUpdateMsg *pUpdateMsg = &pMsg->updateMsg;
+			flags = pUpdateMsg->flags;
+
+			if ((ret = rwfJsonWriteKey(pWriter, pFirst, "UpdateType")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteEnumName(pWriter, rsslRDMUpdateEventTypeToOmmString(pUpdateMsg->updateType), pUpdateMsg->updateType)) < RSSL_RET_SUCCESS
+					|| ((flags & RSSL_UPMF_HAS_SEQ_NUM) && (ret = rwfJsonWriteUIntLiteral(pWriter, pFirst, "SeqNumber", pUpdateMsg->seqNum)) < RSSL_RET_SUCCESS))
+				return ret;
+
+			if (flags & RSSL_UPMF_HAS_CONF_INFO)
+			{
+				RsslBool first = RSSL_TRUE;
+
+				if ((ret = rwfJsonWriteKey(pWriter, pFirst, "ConflationInfo")) < RSSL_RET_SUCCESS
+						|| (ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS
+						|| (ret = rwfJsonWriteUIntLiteral(pWriter, &first, "Count", pUpdateMsg->conflationCount)) < RSSL_RET_SUCCESS
+						|| (ret = rwfJsonWriteUIntLiteral(pWriter, &first, "Time", pUpdateMsg->conflationTime)) < RSSL_RET_SUCCESS
+						|| (ret = rwfJsonWriteChar(pWriter, '}')) < RSSL_RET_SUCCESS)
+					return ret;
+			}
+
+			if ((ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_UPMF_DO_NOT_CACHE, "DoNotCache")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_UPMF_DO_NOT_CONFLATE, "DoNotConflate")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_UPMF_DO_NOT_RIPPLE, "DoNotRipple")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_UPMF_DISCARDABLE, "Discardable")) < RSSL_RET_SUCCESS
+					|| ((flags & RSSL_UPMF_HAS_PERM_DATA) && (ret = rwfJsonWriteBase64Literal(pWriter, pFirst, "PermData", &pUpdateMsg->permData)) < RSSL_RET_SUCCESS)
+					|| ((flags & RSSL_UPMF_HAS_POST_USER_INFO) && (ret = rwfJsonWritePostUserInfo(pWriter, pFirst, &pUpdateMsg->postUserInfo)) < RSSL_RET_SUCCESS))
+				return ret;
+			break;
+		}
+
+		case RSSL_MC_REFRESH:
+		{
+			const RsslRefreshMsg *pRefreshMsg = &pMsg->refreshMsg;
+			flags = pRefreshMsg->flags;
+
+			if ((ret = rwfJsonWriteStateMember(pWriter, pFirst, &pRefreshMsg->state)) < RSSL_RET_SUCCESS
+					|| ((flags & RSSL_RFMF_HAS_QOS) && (ret = rwfJsonWriteQosMember(pWriter, pFirst, &pRefreshMsg->qos, RSSL_FALSE)) < RSSL_RET_SUCCESS)
+					|| ((flags & RSSL_RFMF_HAS_SEQ_NUM) && (ret = rwfJsonWriteUIntLiteral(pWriter, pFirst, "SeqNumber", pRefreshMsg->seqNum)) < RSSL_RET_SUCCESS)
+					|| ((flags & RSSL_RFMF_HAS_PART_NUM) && (ret = rwfJsonWriteUIntLiteral(pWriter, pFirst, "PartNumber", pRefreshMsg->partNum)) < RSSL_RET_SUCCESS)
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_RFMF_SOLICITED, "Solicited")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_RFMF_REFRESH_COMPLETE, "Complete")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_RFMF_CLEAR_CACHE, "ClearCache")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_RFMF_DO_NOT_CACHE, "DoNotCache")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_RFMF_PRIVATE_STREAM, "Private")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_RFMF_QUALIFIED_STREAM, "Qualified")) < RSSL_RET_SUCCESS
+					|| (pRefreshMsg->groupId.length > 0 && (ret = rwfJsonWriteBase64Literal(pWriter, pFirst, "GroupID", &pRefreshMsg->groupId)) < RSSL_RET_SUCCESS)
+					|| ((flags & RSSL_RFMF_HAS_PERM_DATA) && (ret = rwfJsonWriteBase64Literal(pWriter, pFirst, "PermData", &pRefreshMsg->permData)) < RSSL_RET_SUCCESS)
+					|| ((flags & RSSL_RFMF_HAS_POST_USER_INFO) && (ret = rwfJsonWritePostUserInfo(pWriter, pFirst, &pRefreshMsg->postUserInfo)) < RSSL_RET_SUCCESS))
+				return ret;
+			break;
+		}
+
+		case RSSL_MC_REQUEST:
+		{
+			const RsslRequestMsg *pRequestMsg = &pMsg->requestMsg;
+			flags = pRequestMsg->flags;
+
+			if ((ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_RQMF_STREAMING, "Streaming")) < RSSL_RET_SUCCESS)
+				return ret;
+
+			if (flags & RSSL_RQMF_HAS_PRIORITY)
+			{
+				RsslBool first = RSSL_TRUE;
+
+				if ((ret = rwfJsonWriteKey(pWriter, pFirst, "Priority")) < RSSL_RET_SUCCESS
+						|| (ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS
+						|| (ret = rwfJsonWriteUIntLiteral(pWriter, &first, "Class", pRequestMsg->priorityClass)) < RSSL_RET_SUCCESS
+						|| (ret = rwfJsonWriteUIntLiteral(pWriter, &first, "Count", pRequestMsg->priorityCount)) < RSSL_RET_SUCCESS
+						|| (ret = rwfJsonWriteChar(pWriter, '}')) < RSSL_RET_SUCCESS)
+					return ret;
+			}
+
+			if (((flags & RSSL_RQMF_HAS_QOS) && (ret = rwfJsonWriteQosMember(pWriter, pFirst, &pRequestMsg->qos, RSSL_FALSE)) < RSSL_RET_SUCCESS)
+					|| ((flags & RSSL_RQMF_HAS_WORST_QOS) && (ret = rwfJsonWriteQosMember(pWriter, pFirst, &pRequestMsg->worstQos, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_RQMF_MSG_KEY_IN_UPDATES, "KeyInUpdates")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_RQMF_CONF_INFO_IN_UPDATES, "ConfInfoInUpdates")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_RQMF_NO_REFRESH, "NoRefresh")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_RQMF_PRIVATE_STREAM, "Private")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_RQMF_QUALIFIED_STREAM, "Qualified")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_RQMF_PAUSE, "Pause")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_RQMF_HAS_VIEW, "View")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_RQMF_HAS_BATCH, "Batch")) < RSSL_RET_SUCCESS)
+				return ret;
+			break;
+		}
+
+		case RSSL_MC_STATUS:
+		{
+			const RsslStatusMsg *pStatusMsg = &pMsg->statusMsg;
+			flags = pStatusMsg->flags;
+
+			if (((flags & RSSL_STMF_HAS_STATE) && (ret = rwfJsonWriteStateMember(pWriter, pFirst, &pStatusMsg->state)) < RSSL_RET_SUCCESS)
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_STMF_CLEAR_CACHE, "ClearCache")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_STMF_PRIVATE_STREAM, "Private")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_STMF_QUALIFIED_STREAM, "Qualified")) < RSSL_RET_SUCCESS
+					|| ((flags & RSSL_STMF_HAS_GROUP_ID) && (ret = rwfJsonWriteBase64Literal(pWriter, pFirst, "GroupID", &pStatusMsg->groupId)) < RSSL_RET_SUCCESS)
+					|| ((flags & RSSL_STMF_HAS_PERM_DATA) && (ret = rwfJsonWriteBase64Literal(pWriter, pFirst, "PermData", &pStatusMsg->permData)) < RSSL_RET_SUCCESS)
+					|| ((flags & RSSL_STMF_HAS_POST_USER_INFO) && (ret = rwfJsonWritePostUserInfo(pWriter, pFirst, &pStatusMsg->postUserInfo)) < RSSL_RET_SUCCESS))
+				return ret;
+			break;
+		}
+
+		case RSSL_MC_CLOSE:
+		{
+			flags = pMsg->closeMsg.flags;
+
+			if ((ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_CLMF_ACK, "Ack")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_CLMF_HAS_BATCH, "Batch")) < RSSL_RET_SUCCESS)
+				return ret;
+			break;
+		}
+
+		case RSSL_MC_ACK:
+		{
+			const RsslAckMsg *pAckMsg = &pMsg->ackMsg;
+			flags = pAckMsg->flags;
+
+			if ((ret = rwfJsonWriteUIntLiteral(pWriter, pFirst, "AckID", pAckMsg->ackId)) < RSSL_RET_SUCCESS)
+				return ret;
+
+			if (flags & RSSL_AKMF_HAS_NAK_CODE)
+			{
+				if ((ret = rwfJsonWriteKey(pWriter, pFirst, "NakCode")) < RSSL_RET_SUCCESS
+						|| (ret = rwfJsonWriteEnumName(pWriter, rsslNakCodeToOmmString(pAckMsg->nakCode), pAckMsg->nakCode)) < RSSL_RET_SUCCESS)
+					return ret;
+			}
+
+			if (flags & RSSL_AKMF_HAS_TEXT)
+			{
+				if ((ret = rwfJsonWriteKey(pWriter, pFirst, "Text")) < RSSL_RET_SUCCESS
+						|| (ret = rwfJsonWriteString(pWriter, pAckMsg->text.data, pAckMsg->text.length)) < RSSL_RET_SUCCESS)
+					return ret;
+			}
+
+			if (((flags & RSSL_AKMF_HAS_SEQ_NUM) && (ret = rwfJsonWriteUIntLiteral(pWriter, pFirst, "SeqNumber", pAckMsg->seqNum)) < RSSL_RET_SUCCESS)
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_AKMF_PRIVATE_STREAM, "Private")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_AKMF_QUALIFIED_STREAM, "Qualified")) < RSSL_RET_SUCCESS)
+				return ret;
+			break;
+		}
+
+		case RSSL_MC_GENERIC:
+		{
+			const RsslGenericMsg *pGenericMsg = &pMsg->genericMsg;
+			flags = pGenericMsg->flags;
+
+			if (((flags & RSSL_GNMF_HAS_SEQ_NUM) && (ret = rwfJsonWriteUIntLiteral(pWriter, pFirst, "SeqNumber", pGenericMsg->seqNum)) < RSSL_RET_SUCCESS)
+					|| ((flags & RSSL_GNMF_HAS_SECONDARY_SEQ_NUM) && (ret = rwfJsonWriteUIntLiteral(pWriter, pFirst, "SecondarySeqNumber", pGenericMsg->secondarySeqNum)) < RSSL_RET_SUCCESS)
+					|| ((flags & RSSL_GNMF_HAS_PART_NUM) && (ret = rwfJsonWriteUIntLiteral(pWriter, pFirst, "PartNumber", pGenericMsg->partNum)) < RSSL_RET_SUCCESS)
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_GNMF_MESSAGE_COMPLETE, "Complete")) < RSSL_RET_SUCCESS
+					|| ((flags & RSSL_GNMF_HAS_PERM_DATA) && (ret = rwfJsonWriteBase64Literal(pWriter, pFirst, "PermData", &pGenericMsg->permData)) < RSSL_RET_SUCCESS))
+				return ret;
+			break;
+		}
+
+		case RSSL_MC_POST:
+		{
+			const RsslPostMsg *pPostMsg = &pMsg->postMsg;
+			flags = pPostMsg->flags;
+
+			if ((ret = rwfJsonWritePostUserInfo(pWriter, pFirst, &pPostMsg->postUserInfo)) < RSSL_RET_SUCCESS
+					|| ((flags & RSSL_PSMF_HAS_POST_ID) && (ret = rwfJsonWriteUIntLiteral(pWriter, pFirst, "PostID", pPostMsg->postId)) < RSSL_RET_SUCCESS)
+					|| ((flags & RSSL_PSMF_HAS_SEQ_NUM) && (ret = rwfJsonWriteUIntLiteral(pWriter, pFirst, "SeqNumber", pPostMsg->seqNum)) < RSSL_RET_SUCCESS)
+					|| ((flags & RSSL_PSMF_HAS_PART_NUM) && (ret = rwfJsonWriteUIntLiteral(pWriter, pFirst, "PartNumber", pPostMsg->partNum)) < RSSL_RET_SUCCESS)
+					|| ((flags & RSSL_PSMF_HAS_POST_USER_RIGHTS) && (ret = rwfJsonWriteUIntLiteral(pWriter, pFirst, "PostUserRights", pPostMsg->postUserRights)) < RSSL_RET_SUCCESS)
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_PSMF_ACK, "Ack")) < RSSL_RET_SUCCESS
+					|| (ret = rwfJsonWriteFlagLiteral(pWriter, pFirst, flags, RSSL_PSMF_POST_COMPLETE, "Complete")) < RSSL_RET_SUCCESS
+					|| ((flags & RSSL_PSMF_HAS_PERM_DATA) && (ret = rwfJsonWriteBase64Literal(pWriter, pFirst, "PermData", &pPostMsg->permData)) < RSSL_RET_SUCCESS))
+				return ret;
+			break;
+		}
+
+		default:
+			return RSSL_RET_INVALID_DATA;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Writes a message, with the iterator positioned at its payload. */
+static RsslRet rwfJsonWriteMsg(RwfJsonWriter *pWriter, RsslDecodeIterator *pIter, const RsslMsg *pMsg)
+{
+	const RsslMsgKey *pKey;
+	const RsslBuffer *pExtendedHeader;
+	RsslBool first = RSSL_TRUE;
+	RsslRet ret;
+
+	if ((ret = rwfJsonWriteChar(pWriter, '{')) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteKey(pWriter, &first, "ID")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteInt(pWriter, pMsg->msgBase.streamId)) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteKey(pWriter, &first, "Type")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteEnumName(pWriter, rsslMsgClassToOmmString(pMsg->msgBase.msgClass), pMsg->msgBase.msgClass)) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteKey(pWriter, &first, "Domain")) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteEnumName(pWriter, rsslDomainTypeToOmmString(pMsg->msgBase.domainType), pMsg->msgBase.domainType)) < RSSL_RET_SUCCESS
+			|| (ret = rwfJsonWriteMsgClassMembers(pWriter, &first, pMsg)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if ((pKey = rsslGetMsgKey(pMsg)) != NULL)
+	{
+		if ((ret = rwfJsonWriteMsgKey(pWriter, pIter, &first, pKey, RSSL_FALSE)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if ((pKey = rsslGetReqMsgKey(pMsg)) != NULL)
+	{
+		if ((ret = rwfJsonWriteMsgKey(pWriter, pIter, &first, pKey, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if ((pExtendedHeader = rsslGetExtendedHeader(pMsg)) != NULL)
+	{
+		if ((ret = rwfJsonWriteBase64Literal(pWriter, &first, "ExtHdr", pExtendedHeader)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if ((ret = rwfJsonWriteContainerMember(pWriter, pIter, &first, pMsg->msgBase.containerType, &pMsg->msgBase.encDataBody, NULL)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	return rwfJsonWriteChar(pWriter, '}');
+}
+
+RSSL_API RsslRet rsslConvertMsgToJson(const RsslDecodeIterator *pIter, const RsslMsg *pMsg,
+		const RsslDataDictionary *pDictionary, RsslBuffer *pOutput)
+{
+	RwfJsonWriter writer;
+	RsslDecodeIterator payloadIter;
+	RsslRet ret;
+
+	RSSL_ASSERT(pIter && pMsg && pOutput, Invalid parameters or parameters passed in as NULL);
+
+	writer.pos = pOutput->data;
+	writer.end = pOutput->data + pOutput->length;
+	writer.pDictionary = pDictionary;
+
+	/* Decode the payload with a separate iterator so the caller's iterator is not changed. */
+	rsslClearDecodeIterator(&payloadIter);
+	rsslSetDecodeIteratorRWFVersion(&payloadIter, pIter->_majorVersion, pIter->_minorVersion);
+	rsslSetDecodeIteratorBuffer(&payloadIter, (RsslBuffer*)&pMsg->msgBase.encDataBody);
+
+	if ((ret = rwfJsonWriteMsg(&writer, &payloadIter, pMsg)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	pOutput->length = (RsslUInt32)(writer.pos - pOutput->data);
+	return RSSL_RET_SUCCESS;
+}
@@ -14,6 +14,8 @@
 #include "rtr/rsslQueue.h"
 #include "rtr/rsslThread.h"
 #include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
 #ifdef _WIN32
 #include <winsock2.h>
 #include <process.h>
@@ -1722,6 +1724,103 @@ static void populateBytesWritten(JNIEnv *env, RsslWriteOutArgs *writeOutArgs, jo
 	(*env)->CallIntMethod(env, *jwriteargs, uncompressedBytesWrittenMid, writeOutArgs->uncompressedBytesWritten);
 }
 
+/* gets the JNIChannel batch field ids used by rsslReadBatch and rsslWriteBatch */
+static RsslBool getBatchFieldIds(JNIEnv *env, jobject *jchnl, jfieldID *lengthFid, jfieldID *readCPtrFid, jfieldID *readRetValFid)
+{
+	static jclass jniChannelClass = NULL;
+	jclass localRefClass;
+	static jfieldID batchLengthFid = NULL, batchReadCPtrFid = NULL, batchReadRetValFid = NULL;
+
+	/* get the JNIChannel class */
+	if (jniChannelClass == NULL)
+	{
+		localRefClass =  (*env)->GetObjectClass(env, *jchnl);
+		if (localRefClass == NULL)
+		{
+			return RSSL_FALSE;
+		}
+		/* Create a global reference */
+		jniChannelClass = (*env)->NewGlobalRef(env, localRefClass);
+		(*env)->DeleteLocalRef(env, localRefClass);
+		if (jniChannelClass == NULL)
+		{
+			return RSSL_FALSE;
+		}
+	}
+
+	/* get the batch field ids */
+	if (batchLengthFid == NULL)
+	{
+		batchLengthFid = (*env)->GetFieldID(env, jniChannelClass, "_batchLength", "I");
+		batchReadCPtrFid = (*env)->GetFieldID(env, jniChannelClass, "_batchReadCPtr", "J");
+		batchReadRetValFid = (*env)->GetFieldID(env, jniChannelClass, "_batchReadRetVal", "I");
+		if (batchLengthFid == NULL || batchReadCPtrFid == NULL || batchReadRetValFid == NULL)
+		{
+			batchLengthFid = NULL;
+			return RSSL_FALSE;
+		}
+	}
+
+	*lengthFid = batchLengthFid;
+	*readCPtrFid = batchReadCPtrFid;
+	*readRetValFid = batchReadRetValFid;
+
+	return RSSL_TRUE;
+}
+
+/* copies the priority and flags of a Java WriteArgs class to a C RsslWriteInArgs structure */
+static RsslBool populateCWriteInArgs(JNIEnv *env, jobject *jwriteargs, RsslWriteInArgs *writeInArgs)
+{
+	static jclass writeArgsClass = NULL;
+	jclass localRefClass;
+	static jmethodID priorityMid = NULL, flagsMid = NULL;
+
+	/* get the WriteArgs class */
+	if (writeArgsClass == NULL)
+	{
+		localRefClass = (*env)->GetObjectClass(env, *jwriteargs);
+		if (localRefClass == NULL)
+		{
+			return RSSL_FALSE;
+		}
+		/* Create a global reference */
+		writeArgsClass = (*env)->NewGlobalRef(env, localRefClass);
+		(*env)->DeleteLocalRef(env, localRefClass);
+		if (writeArgsClass == NULL)
+		{
+			return RSSL_FALSE;
+		}
+	}
+
+	/* get the method ID for the priority() method */
+	if (priorityMid == NULL)
+	{
+		priorityMid = (*env)->GetMethodID(env, writeArgsClass, "priority", "()I");
+		if (priorityMid == NULL)
+		{
+			return RSSL_FALSE;
+		}
+	}
+
+	/* call priority() method to get the priority */
+	writeInArgs->rsslPriority = (RsslUInt8)(*env)->CallIntMethod(env, *jwriteargs, priorityMid);
+
+	/* get the method ID for the flags() method */
+	if (flagsMid == NULL)
+	{
+		flagsMid = (*env)->GetMethodID(env, writeArgsClass, "flags", "()I");
+		if (flagsMid == NULL)
+		{
+			return RSSL_FALSE;
+		}
+	}
+
+	/* call flags() method to get the flags */
+	writeInArgs->writeInFlags = (RsslUInt8)(*env)->CallIntMethod(env, *jwriteargs, flagsMid);
+
+	return RSSL_TRUE;
+}
+
 /* returns a Java TransportBuffer class copied from a C RsslBuffer structure */
 static jobject createJavaBuffer(JNIEnv *env, RsslBuffer *rsslBuffer)
 {
@@ -3744,6 +3843,153 @@ JNIEXPORT jobject JNICALL Java_com_thomsonreuters_upa_transport_JNIChannel_rsslR
 	return jbuffer;
 }
 
+/* size of the length that precedes each message in a batch buffer */
+#define RSSL_JNI_BATCH_LENGTH_SIZE 4
+
+/* puts a batch message length in network byte order, the default ByteBuffer order in Java */
+RTR_C_ALWAYS_INLINE void putBatchLength(char *data, RsslUInt32 length)
+{
+	data[0] = (char)(length >> 24);
+	data[1] = (char)(length >> 16);
+	data[2] = (char)(length >> 8);
+	data[3] = (char)length;
+}
+
+/* gets a batch message length in network byte order */
+RTR_C_ALWAYS_INLINE RsslUInt32 getBatchLength(const char *data)
+{
+	return ((RsslUInt32)(unsigned char)data[0] << 24) | ((RsslUInt32)(unsigned char)data[1] << 16) |
+		((RsslUInt32)(unsigned char)data[2] << 8) | (RsslUInt32)(unsigned char)data[3];
+}
+
+/*
+ * Class:     com_thomsonreuters_upa_transport_JNIChannel
+ * Method:    rsslReadBatch
+ * Signature: (Lcom/thomsonreuters/upa/transport/JNIChannel;Ljava/nio/ByteBuffer;IILcom/thomsonreuters/upa/transport/ReadArgsImpl;Lcom/thomsonreuters/upa/transport/ErrorImpl;)I
+ */
+JNIEXPORT jint JNICALL Java_com_thomsonreuters_upa_transport_JNIChannel_rsslReadBatch
+  (JNIEnv *env, jobject arg, jobject jchnl, jobject jdest, jint joffset, jint jlength, jobject jreadargs, jobject jerror)
+{
+	RsslRet rsslRetVal;
+	RsslReadInArgs readInArgs;
+	RsslReadOutArgs readOutArgs, batchOutArgs;
+	RsslError error;
+	RsslChannel *rsslChnl;
+	RsslBuffer *rsslBuffer;
+	jfieldID lengthFid, readCPtrFid, readRetValFid;
+	char *dest;
+	jint destLength = 0, msgCount = 0;
+	RsslBool heldBuffer;
+
+	error.channel = NULL;
+
+	rsslChnl = getCChannel(env, &jchnl);
+	if (rsslChnl == NULL)
+	{
+		return RSSL_RET_FAILURE;
+	}
+
+	if (!getBatchFieldIds(env, &jchnl, &lengthFid, &readCPtrFid, &readRetValFid))
+	{
+		return RSSL_RET_FAILURE;
+	}
+
+	dest = (char *)(*env)->GetDirectBufferAddress(env, jdest);
+	if (dest == NULL)
+	{
+		return RSSL_RET_FAILURE;
+	}
+	dest += joffset;
+
+	rsslClearReadOutArgs(&batchOutArgs);
+
+	/* a message that did not fit in the previous batch is still valid, since nothing has been read since */
+	rsslBuffer = (RsslBuffer *)(*env)->GetLongField(env, jchnl, readCPtrFid);
+	heldBuffer = (rsslBuffer != NULL);
+	if (heldBuffer)
+	{
+		rsslRetVal = (*env)->GetIntField(env, jchnl, readRetValFid);
+	}
+	else
+	{
+		if (!clearJavaChannel(env, &jchnl))
+		{
+			return RSSL_RET_FAILURE;
+		}
+
+		rsslClearReadInArgs(&readInArgs);
+		rsslClearReadOutArgs(&readOutArgs);
+		rsslBuffer = rsslReadEx(rsslChnl, &readInArgs, &readOutArgs, &rsslRetVal, &error);
+		batchOutArgs.bytesRead += readOutArgs.bytesRead;
+		batchOutArgs.uncompressedBytesRead += readOutArgs.uncompressedBytesRead;
+	}
+
+	/* copy messages until nothing more is buffered or one does not fit */
+	while (1)
+	{
+		if (rsslBuffer != NULL && rsslRetVal >= RSSL_RET_SUCCESS)
+		{
+			if (destLength + RSSL_JNI_BATCH_LENGTH_SIZE + (jint)rsslBuffer->length > jlength)
+			{
+				/* hold the message for the next batch */
+				(*env)->SetLongField(env, jchnl, readCPtrFid, (jlong)rsslBuffer);
+				(*env)->SetIntField(env, jchnl, readRetValFid, rsslRetVal);
+
+				if (msgCount == 0)
+				{
+					error.rsslErrorId = RSSL_RET_FAILURE;
+					error.sysError = 0;
+					snprintf(error.text, MAX_RSSL_ERROR_TEXT, "JNI rsslReadBatch() buffer of %d bytes is too small for a message of %u bytes", jlength, rsslBuffer->length);
+					populateJavaError(env, &error, &jerror, NULL);
+					msgCount = RSSL_RET_FAILURE;
+				}
+				break;
+			}
+
+			putBatchLength(dest + destLength, rsslBuffer->length);
+			memcpy(dest + destLength + RSSL_JNI_BATCH_LENGTH_SIZE, rsslBuffer->data, rsslBuffer->length);
+			destLength += RSSL_JNI_BATCH_LENGTH_SIZE + rsslBuffer->length;
+			++msgCount;
+
+			if (heldBuffer)
+			{
+				(*env)->SetLongField(env, jchnl, readCPtrFid, 0);
+				heldBuffer = RSSL_FALSE;
+			}
+		}
+		else if (rsslRetVal == RSSL_RET_READ_FD_CHANGE)
+		{
+			/* clear FDs */
+			getLock();
+			FD_CLR(rsslChnl->oldSocketId, &readfds);
+			releaseLock();
+		}
+		else if (rsslRetVal < RSSL_RET_SUCCESS && rsslRetVal != RSSL_RET_READ_WOULD_BLOCK && rsslRetVal != RSSL_RET_READ_PING)
+		{
+			populateJavaError(env, &error, &jerror, NULL);
+		}
+
+		/* stop once rsslRead has nothing more buffered, so a blocking channel does not block mid-batch */
+		if (rsslRetVal <= RSSL_RET_SUCCESS)
+		{
+			break;
+		}
+
+		rsslClearReadInArgs(&readInArgs);
+		rsslClearReadOutArgs(&readOutArgs);
+		rsslBuffer = rsslReadEx(rsslChnl, &readInArgs, &readOutArgs, &rsslRetVal, &error);
+		batchOutArgs.bytesRead += readOutArgs.bytesRead;
+		batchOutArgs.uncompressedBytesRead += readOutArgs.uncompressedBytesRead;
+	}
+
+	(*env)->SetIntField(env, jchnl, lengthFid, destLength);
+
+	/* populate return value and bytes read once for the whole batch */
+	populateReadReturnValue(env, rsslRetVal, &batchOutArgs, &jreadargs);
+
+	return msgCount;
+}
+
 /*
  * Class:     com_thomsonreuters_upa_transport_JNIChannel
  * Method:    rsslGetBuffer
@@ -3857,9 +4103,6 @@ JNIEXPORT jint JNICALL Java_com_thomsonreuters_upa_transport_JNIChannel_rsslWrit
 	RsslBuffer *rsslBuffer;
 	RsslWriteInArgs writeInArgs;
 	RsslWriteOutArgs writeOutArgs;
-	static jclass writeArgsClass = NULL;
-	jclass localRefClass;
-	static jmethodID priorityMid = NULL, flagsMid = NULL;
 
 	error.channel = NULL;
 
@@ -3874,49 +4117,12 @@ JNIEXPORT jint JNICALL Java_com_thomsonreuters_upa_transport_JNIChannel_rsslWrit
 	rsslClearWriteInArgs(&writeInArgs);
 	rsslClearWriteOutArgs(&writeOutArgs);
 
-	/* get the WriteArgs class */
-	if (writeArgsClass == NULL)
-	{
-		localRefClass = (*env)->GetObjectClass(env, jwriteargs);
-		if (localRefClass == NULL)
-		{
-			return RSSL_RET_FAILURE;
-		}
-		/* Create a global reference */
-		writeArgsClass = (*env)->NewGlobalRef(env, localRefClass);
-		(*env)->DeleteLocalRef(env, localRefClass);
-		if (writeArgsClass == NULL)
-		{
-			return RSSL_RET_FAILURE;
-		}
-	}
-
-	/* get the method ID for the priority() method */
-	if (priorityMid == NULL)
-	{
-		priorityMid = (*env)->GetMethodID(env, writeArgsClass, "priority", "()I");
-		if (priorityMid == NULL)
-		{
-			return RSSL_RET_FAILURE;
-		}
-	}
-
-	/* call priority() method to get the priority */
-	writeInArgs.rsslPriority = (RsslUInt8)(*env)->CallIntMethod(env, jwriteargs, priorityMid);
-
-	/* get the method ID for the flags() method */
-	if (flagsMid == NULL)
+	/* get the priority and flags from the WriteArgs object */
+	if (!populateCWriteInArgs(env, &jwriteargs, &writeInArgs))
 	{
-		flagsMid = (*env)->GetMethodID(env, writeArgsClass, "flags", "()I");
-		if (flagsMid == NULL)
-		{
-			return RSSL_RET_FAILURE;
-		}
+		return RSSL_RET_FAILURE;
 	}
 
-	/* call flags() method to get the flags */
-	writeInArgs.writeInFlags = (RsslUInt8)(*env)->CallIntMethod(env, jwriteargs, flagsMid);
-
 	rsslRetVal = rsslWriteEx(rsslChnl, rsslBuffer, &writeInArgs, &writeOutArgs, &error);
 	/* populate return error info in case of failure */
 	if (rsslRetVal < RSSL_RET_SUCCESS)
@@ -3961,6 +4167,123 @@ JNIEXPORT jint JNICALL Java_com_thomsonreuters_upa_transport_JNIChannel_rsslFlus
 	return rsslRetVal;
 }
 
+/*
+ * Class:     com_thomsonreuters_upa_transport_JNIChannel
+ * Method:    rsslWriteBatch
+ * Signature: (Lcom/thomsonreuters/upa/transport/JNIChannel;Ljava/nio/ByteBuffer;IILcom/thomsonreuters/upa/transport/WriteArgsImpl;Lcom/thomsonreuters/upa/transport/ErrorImpl;)I
+ */
+JNIEXPORT jint JNICALL Java_com_thomsonreuters_upa_transport_JNIChannel_rsslWriteBatch
+  (JNIEnv *env, jobject arg, jobject jchnl, jobject jsrc, jint joffset, jint jlength, jobject jwriteargs, jobject jerror)
+{
+	RsslRet rsslRetVal = RSSL_RET_SUCCESS;
+	RsslError error;
+	RsslChannel *rsslChnl;
+	RsslBuffer *rsslBuffer;
+	RsslWriteInArgs writeInArgs;
+	RsslWriteOutArgs writeOutArgs, batchOutArgs;
+	jfieldID lengthFid, readCPtrFid, readRetValFid;
+	char *src;
+	jint srcLength = 0;
+	RsslUInt32 msgLength;
+
+	error.channel = NULL;
+
+	rsslChnl = getCChannel(env, &jchnl);
+	if (rsslChnl == NULL)
+	{
+		return RSSL_RET_FAILURE;
+	}
+
+	if (!getBatchFieldIds(env, &jchnl, &lengthFid, &readCPtrFid, &readRetValFid))
+	{
+		return RSSL_RET_FAILURE;
+	}
+
+	src = (char *)(*env)->GetDirectBufferAddress(env, jsrc);
+	if (src == NULL)
+	{
+		return RSSL_RET_FAILURE;
+	}
+	src += joffset;
+
+	rsslClearWriteInArgs(&writeInArgs);
+	rsslClearWriteOutArgs(&batchOutArgs);
+
+	/* the same priority and flags apply to every message in the batch */
+	if (!populateCWriteInArgs(env, &jwriteargs, &writeInArgs))
+	{
+		return RSSL_RET_FAILURE;
+	}
+
+	/* write each complete message; a trailing partial message is left for the next batch */
+	while (srcLength + RSSL_JNI_BATCH_LENGTH_SIZE <= jlength)
+	{
+		msgLength = getBatchLength(src + srcLength);
+		if ((RsslUInt32)(jlength - srcLength - RSSL_JNI_BATCH_LENGTH_SIZE) < msgLength)
+		{
+			break;
+		}
+
+		rsslBuffer = rsslGetBuffer(rsslChnl, msgLength, RSSL_FALSE, &error);
+		if (rsslBuffer == NULL && error.rsslErrorId == RSSL_RET_BUFFER_NO_BUFFERS)
+		{
+			/* flush to free up output buffers, then try once more */
+			if ((rsslRetVal = rsslFlush(rsslChnl, &error)) < RSSL_RET_SUCCESS)
+			{
+				break;
+			}
+			rsslBuffer = rsslGetBuffer(rsslChnl, msgLength, RSSL_FALSE, &error);
+		}
+		if (rsslBuffer == NULL)
+		{
+			rsslRetVal = error.rsslErrorId;
+			break;
+		}
+
+		memcpy(rsslBuffer->data, src + srcLength + RSSL_JNI_BATCH_LENGTH_SIZE, msgLength);
+		rsslBuffer->length = msgLength;
+
+		rsslClearWriteOutArgs(&writeOutArgs);
+		while ((rsslRetVal = rsslWriteEx(rsslChnl, rsslBuffer, &writeInArgs, &writeOutArgs, &error)) == RSSL_RET_WRITE_CALL_AGAIN)
+		{
+			if ((rsslRetVal = rsslFlush(rsslChnl, &error)) < RSSL_RET_SUCCESS)
+			{
+				break;
+			}
+		}
+
+		if (rsslRetVal < RSSL_RET_SUCCESS && rsslRetVal != RSSL_RET_WRITE_FLUSH_FAILED)
+		{
+			rsslReleaseBuffer(rsslBuffer, &error);
+			break;
+		}
+
+		batchOutArgs.bytesWritten += writeOutArgs.bytesWritten;
+		batchOutArgs.uncompressedBytesWritten += writeOutArgs.uncompressedBytesWritten;
+		srcLength += RSSL_JNI_BATCH_LENGTH_SIZE + msgLength;
+	}
+
+	/* flush whatever the writes left queued once for the whole batch */
+	if (rsslRetVal > RSSL_RET_SUCCESS || rsslRetVal == RSSL_RET_WRITE_FLUSH_FAILED)
+	{
+		rsslRetVal = rsslFlush(rsslChnl, &error);
+	}
+
+	(*env)->SetIntField(env, jchnl, lengthFid, srcLength);
+
+	/* populate return error info in case of failure */
+	if (rsslRetVal < RSSL_RET_SUCCESS)
+	{
+		populateJavaError(env, &error, &jerror, NULL);
+	}
+	else /* populate WriteArgs object once for the whole batch */
+	{
+		populateBytesWritten(env, &batchOutArgs, &jwriteargs);
+	}
+
+	return rsslRetVal;
+}
+
 /*
  * Class:     com_thomsonreuters_upa_transport_JNIChannel
  * Method:    rsslPing
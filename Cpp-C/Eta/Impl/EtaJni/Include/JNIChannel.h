@@ -63,6 +63,14 @@ JNIEXPORT jint JNICALL Java_com_thomsonreuters_upa_transport_JNIChannel_rsslClos
 JNIEXPORT jobject JNICALL Java_com_thomsonreuters_upa_transport_JNIChannel_rsslRead
   (JNIEnv *, jobject, jobject, jobject, jobject);
 
+/*
+ * Class:     com_thomsonreuters_upa_transport_JNIChannel
+ * Method:    rsslReadBatch
+ * Signature: (Lcom/thomsonreuters/upa/transport/JNIChannel;Ljava/nio/ByteBuffer;IILcom/thomsonreuters/upa/transport/ReadArgsImpl;Lcom/thomsonreuters/upa/transport/ErrorImpl;)I
+ */
+JNIEXPORT jint JNICALL Java_com_thomsonreuters_upa_transport_JNIChannel_rsslReadBatch
+  (JNIEnv *, jobject, jobject, jobject, jint, jint, jobject, jobject);
+
 /*
  * Class:     com_thomsonreuters_upa_transport_JNIChannel
  * Method:    rsslGetBuffer
@@ -103,6 +111,14 @@ JNIEXPORT jint JNICALL Java_com_thomsonreuters_upa_transport_JNIChannel_rsslWrit
 JNIEXPORT jint JNICALL Java_com_thomsonreuters_upa_transport_JNIChannel_rsslFlush
   (JNIEnv *, jobject, jobject, jobject);
 
+/*
+ * Class:     com_thomsonreuters_upa_transport_JNIChannel
+ * Method:    rsslWriteBatch
+ * Signature: (Lcom/thomsonreuters/upa/transport/JNIChannel;Ljava/nio/ByteBuffer;IILcom/thomsonreuters/upa/transport/WriteArgsImpl;Lcom/thomsonreuters/upa/transport/ErrorImpl;)I
+ */
+JNIEXPORT jint JNICALL Java_com_thomsonreuters_upa_transport_JNIChannel_rsslWriteBatch
+  (JNIEnv *, jobject, jobject, jobject, jint, jint, jobject, jobject);
+
 /*
  * Class:     com_thomsonreuters_upa_transport_JNIChannel
  * Method:    rsslPing
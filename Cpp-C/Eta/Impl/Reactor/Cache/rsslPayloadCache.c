@@ -0,0 +1,419 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/rsslPayloadCacheImpl.h"
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Global cache state. The caches and shared dictionaries are protected by cacheGlobalLock. */
+static RSSL_STATIC_MUTEX_DECL(cacheGlobalLock);
+static RsslUInt32 cacheInitCount = 0;
+static RsslQueue cacheList;
+static RsslQueue cacheDictionaryList;
+
+void rsslCacheSetError(RsslCacheError *pError, RsslRet errorId, const char *format, ...)
+{
+	va_list fmtArgs;
+
+	if (!pError)
+		return;
+
+	pError->rsslErrorId = errorId;
+	va_start(fmtArgs, format);
+	vsnprintf(pError->text, MAX_OMM_CACHE_ERROR_TEXT, format, fmtArgs);
+	va_end(fmtArgs);
+}
+
+static void _cacheDictionaryRelease(RsslPayloadCacheDictionary *pDictionary)
+{
+	if (--pDictionary->refCount > 0)
+		return;
+
+	if (pDictionary->key)
+	{
+		rsslQueueRemoveLink(&cacheDictionaryList, &pDictionary->qlDictionaries);
+		free(pDictionary->key);
+	}
+	free(pDictionary);
+}
+
+static void _cacheDestroy(RsslPayloadCacheImpl *pCache)
+{
+	RsslQueueLink *pLink;
+
+	while ((pLink = rsslQueueRemoveFirstLink(&pCache->entryList)))
+		rsslPayloadEntryFree(RSSL_QUEUE_LINK_TO_OBJECT(RsslPayloadEntryImpl, qlEntries, pLink));
+
+	if (pCache->pDictionary)
+		_cacheDictionaryRelease(pCache->pDictionary);
+
+	RSSL_MUTEX_DESTROY(&pCache->entryLock);
+	free(pCache);
+}
+
+RSSL_VA_API RsslRet rsslPayloadCacheInitialize()
+{
+	RSSL_STATIC_MUTEX_LOCK(cacheGlobalLock);
+	if (cacheInitCount++ == 0)
+	{
+		rsslInitQueue(&cacheList);
+		rsslInitQueue(&cacheDictionaryList);
+	}
+	RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_VA_API void rsslPayloadCacheUninitialize()
+{
+	RsslQueueLink *pLink;
+
+	RSSL_STATIC_MUTEX_LOCK(cacheGlobalLock);
+	if (cacheInitCount == 0 || --cacheInitCount > 0)
+	{
+		RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+		return;
+	}
+
+	/* Destroy any caches the application did not. This also releases the shared dictionaries. */
+	while ((pLink = rsslQueueRemoveFirstLink(&cacheList)))
+		_cacheDestroy(RSSL_QUEUE_LINK_TO_OBJECT(RsslPayloadCacheImpl, qlCaches, pLink));
+
+	RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+}
+
+RSSL_VA_API RsslBool rsslPayloadCacheIsInitialized()
+{
+	RsslBool isInitialized;
+
+	RSSL_STATIC_MUTEX_LOCK(cacheGlobalLock);
+	isInitialized = (cacheInitCount > 0) ? RSSL_TRUE : RSSL_FALSE;
+	RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+	return isInitialized;
+}
+
+RSSL_VA_API RsslPayloadCacheHandle rsslPayloadCacheCreate(const RsslPayloadCacheConfigOptions* configOptions,
+							RsslCacheError* error)
+{
+	RsslPayloadCacheImpl *pCache;
+
+	if (!configOptions)
+	{
+		rsslCacheSetError(error, RSSL_RET_INVALID_ARGUMENT, "Cache configuration options not provided.");
+		return NULL;
+	}
+
+	RSSL_STATIC_MUTEX_LOCK(cacheGlobalLock);
+	if (cacheInitCount == 0)
+	{
+		RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+		rsslCacheSetError(error, RSSL_RET_INIT_NOT_INITIALIZED, "Cache is not initialized. Call rsslPayloadCacheInitialize() first.");
+		return NULL;
+	}
+
+	if (!(pCache = (RsslPayloadCacheImpl*)malloc(sizeof(RsslPayloadCacheImpl))))
+	{
+		RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+		rsslCacheSetError(error, RSSL_RET_FAILURE, "Memory allocation failure.");
+		return NULL;
+	}
+
+	memset(pCache, 0, sizeof(RsslPayloadCacheImpl));
+	RSSL_MUTEX_INIT(&pCache->entryLock);
+	rsslInitQueue(&pCache->entryList);
+	pCache->maxItems = configOptions->maxItems;
+
+	rsslQueueAddLinkToBack(&cacheList, &pCache->qlCaches);
+	RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+
+	return (RsslPayloadCacheHandle)pCache;
+}
+
+RSSL_VA_API void rsslPayloadCacheDestroy(RsslPayloadCacheHandle handle)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)handle;
+
+	if (!pCache)
+		return;
+
+	RSSL_STATIC_MUTEX_LOCK(cacheGlobalLock);
+	rsslQueueRemoveLink(&cacheList, &pCache->qlCaches);
+	_cacheDestroy(pCache);
+	RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+}
+
+/* Checks that a new dictionary can replace the current one, i.e. that every field in the current
+ * dictionary is present in the new dictionary with the same type. */
+static RsslBool _cacheDictionaryIsExtension(const RsslDataDictionary *pCurrent, const RsslDataDictionary *pNew)
+{
+	RsslInt32 fid;
+
+	if (pCurrent == pNew)
+		return RSSL_TRUE;
+
+	if (pNew->numberOfEntries < pCurrent->numberOfEntries
+			|| pNew->minFid > pCurrent->minFid || pNew->maxFid < pCurrent->maxFid)
+		return RSSL_FALSE;
+
+	for (fid = pCurrent->minFid; fid <= pCurrent->maxFid; ++fid)
+	{
+		RsslDictionaryEntry *pCurrentEntry = pCurrent->entriesArray[fid];
+		RsslDictionaryEntry *pNewEntry;
+
+		if (!pCurrentEntry)
+			continue;
+
+		pNewEntry = pNew->entriesArray[fid];
+		if (!pNewEntry || pNewEntry->rwfType != pCurrentEntry->rwfType)
+			return RSSL_FALSE;
+	}
+
+	return RSSL_TRUE;
+}
+
+static RsslPayloadCacheDictionary *_cacheFindSharedDictionary(const char *key)
+{
+	RsslQueueLink *pLink;
+
+	RSSL_QUEUE_FOR_EACH_LINK(&cacheDictionaryList, pLink)
+	{
+		RsslPayloadCacheDictionary *pDictionary = RSSL_QUEUE_LINK_TO_OBJECT(RsslPayloadCacheDictionary, qlDictionaries, pLink);
+		if (strcmp(pDictionary->key, key) == 0)
+			return pDictionary;
+	}
+
+	return NULL;
+}
+
+RSSL_VA_API RsslRet rsslPayloadCacheSetDictionary( RsslPayloadCacheHandle cacheHandle,
+							const RsslDataDictionary *rsslDictionary,
+							const char* dictionaryKey,
+							RsslCacheError* error)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslPayloadCacheDictionary *pDictionary;
+
+	if (!pCache || !rsslDictionary)
+	{
+		rsslCacheSetError(error, RSSL_RET_INVALID_ARGUMENT, "Invalid cache handle or dictionary.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (!rsslDictionary->isInitialized)
+	{
+		rsslCacheSetError(error, RSSL_RET_INVALID_ARGUMENT, "Dictionary is not initialized.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (dictionaryKey && dictionaryKey[0] == '\0')
+		dictionaryKey = NULL;
+
+	RSSL_STATIC_MUTEX_LOCK(cacheGlobalLock);
+
+	if (dictionaryKey && (pDictionary = _cacheFindSharedDictionary(dictionaryKey)))
+	{
+		/* Dictionary is shared with other caches. Replacing it updates it for all of them. */
+		if (pCache->pDictionary && pCache->pDictionary != pDictionary)
+		{
+			RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+			rsslCacheSetError(error, RSSL_RET_INVALID_ARGUMENT, "Cache already has a dictionary that is not shared with key '%s'.", dictionaryKey);
+			return RSSL_RET_INVALID_ARGUMENT;
+		}
+
+		if (!_cacheDictionaryIsExtension(pDictionary->pDictionary, rsslDictionary))
+		{
+			RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+			rsslCacheSetError(error, RSSL_RET_INVALID_ARGUMENT, "Dictionary does not contain all fields of the dictionary already shared with key '%s'.", dictionaryKey);
+			return RSSL_RET_INVALID_ARGUMENT;
+		}
+
+		pDictionary->pDictionary = rsslDictionary;
+		if (!pCache->pDictionary)
+		{
+			++pDictionary->refCount;
+			pCache->pDictionary = pDictionary;
+		}
+
+		RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+		return RSSL_RET_SUCCESS;
+	}
+
+	if ((pDictionary = pCache->pDictionary))
+	{
+		/* Replacing the cache's current dictionary. */
+		if (!_cacheDictionaryIsExtension(pDictionary->pDictionary, rsslDictionary))
+		{
+			RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+			rsslCacheSetError(error, RSSL_RET_INVALID_ARGUMENT, "Dictionary does not contain all fields of the cache's current dictionary.");
+			return RSSL_RET_INVALID_ARGUMENT;
+		}
+
+		if (dictionaryKey && pDictionary->key == NULL)
+		{
+			/* Share the cache's private dictionary under the new key. */
+			if (!(pDictionary->key = (char*)malloc(strlen(dictionaryKey) + 1)))
+			{
+				RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+				rsslCacheSetError(error, RSSL_RET_FAILURE, "Memory allocation failure.");
+				return RSSL_RET_FAILURE;
+			}
+			strcpy(pDictionary->key, dictionaryKey);
+			rsslQueueAddLinkToBack(&cacheDictionaryList, &pDictionary->qlDictionaries);
+		}
+
+		pDictionary->pDictionary = rsslDictionary;
+		RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+		return RSSL_RET_SUCCESS;
+	}
+
+	if (!(pDictionary = (RsslPayloadCacheDictionary*)malloc(sizeof(RsslPayloadCacheDictionary))))
+	{
+		RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+		rsslCacheSetError(error, RSSL_RET_FAILURE, "Memory allocation failure.");
+		return RSSL_RET_FAILURE;
+	}
+
+	memset(pDictionary, 0, sizeof(RsslPayloadCacheDictionary));
+	pDictionary->pDictionary = rsslDictionary;
+	pDictionary->refCount = 1;
+
+	if (dictionaryKey)
+	{
+		if (!(pDictionary->key = (char*)malloc(strlen(dictionaryKey) + 1)))
+		{
+			free(pDictionary);
+			RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+			rsslCacheSetError(error, RSSL_RET_FAILURE, "Memory allocation failure.");
+			return RSSL_RET_FAILURE;
+		}
+		strcpy(pDictionary->key, dictionaryKey);
+		rsslQueueAddLinkToBack(&cacheDictionaryList, &pDictionary->qlDictionaries);
+	}
+
+	pCache->pDictionary = pDictionary;
+	RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_VA_API RsslRet rsslPayloadCacheBindDictionary( RsslPayloadCacheHandle cacheHandle,
+							const RsslDataDictionary *rsslDictionary,
+							const char* dictionaryKey,
+							RsslCacheError* error)
+{
+	return rsslPayloadCacheSetDictionary(cacheHandle, rsslDictionary, dictionaryKey, error);
+}
+
+RSSL_VA_API RsslRet rsslPayloadCacheSetSharedDictionaryKey( RsslPayloadCacheHandle cacheHandle,
+							const char* dictionaryKey,
+							RsslCacheError *error)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslPayloadCacheDictionary *pDictionary;
+
+	if (!pCache || !dictionaryKey || dictionaryKey[0] == '\0')
+	{
+		rsslCacheSetError(error, RSSL_RET_INVALID_ARGUMENT, "Invalid cache handle or dictionary key.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	RSSL_STATIC_MUTEX_LOCK(cacheGlobalLock);
+
+	if (!(pDictionary = _cacheFindSharedDictionary(dictionaryKey)))
+	{
+		RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+		rsslCacheSetError(error, RSSL_RET_INVALID_ARGUMENT, "No dictionary is shared with key '%s'.", dictionaryKey);
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (pCache->pDictionary != pDictionary)
+	{
+		if (pCache->pDictionary)
+		{
+			RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+			rsslCacheSetError(error, RSSL_RET_INVALID_ARGUMENT, "Cache already has a dictionary.");
+			return RSSL_RET_INVALID_ARGUMENT;
+		}
+
+		++pDictionary->refCount;
+		pCache->pDictionary = pDictionary;
+	}
+
+	RSSL_STATIC_MUTEX_UNLOCK(cacheGlobalLock);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_VA_API RsslRet rsslPayloadCacheBindSharedDictionaryKey( RsslPayloadCacheHandle cacheHandle,
+							const char* dictionaryKey,
+							RsslCacheError *error)
+{
+	return rsslPayloadCacheSetSharedDictionaryKey(cacheHandle, dictionaryKey, error);
+}
+
+const RsslDataDictionary *rsslPayloadCacheGetDictionary(RsslPayloadCacheImpl *pCache)
+{
+	return pCache->pDictionary ? pCache->pDictionary->pDictionary : NULL;
+}
+
+RSSL_VA_API RsslUInt rsslPayloadCacheGetEntryCount(RsslPayloadCacheHandle cacheHandle)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslUInt count;
+
+	if (!pCache)
+		return 0;
+
+	RSSL_MUTEX_LOCK(&pCache->entryLock);
+	count = rsslQueueGetElementCount(&pCache->entryList);
+	RSSL_MUTEX_UNLOCK(&pCache->entryLock);
+	return count;
+}
+
+RSSL_VA_API RsslUInt rsslPayloadCacheGetEntryList(RsslPayloadCacheHandle cacheHandle,
+							RsslPayloadEntryHandle arrHandles[],
+							RsslUInt arrSize)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslQueueLink *pLink;
+	RsslUInt count = 0;
+
+	if (!pCache || !arrHandles)
+		return 0;
+
+	RSSL_MUTEX_LOCK(&pCache->entryLock);
+	RSSL_QUEUE_FOR_EACH_LINK(&pCache->entryList, pLink)
+	{
+		if (count == arrSize)
+			break;
+		arrHandles[count++] = (RsslPayloadEntryHandle)RSSL_QUEUE_LINK_TO_OBJECT(RsslPayloadEntryImpl, qlEntries, pLink);
+	}
+	RSSL_MUTEX_UNLOCK(&pCache->entryLock);
+	return count;
+}
+
+RSSL_VA_API void rsslPayloadCacheClearAll(RsslPayloadCacheHandle cacheHandle)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslQueueLink *pLink;
+
+	if (!pCache)
+		return;
+
+	RSSL_MUTEX_LOCK(&pCache->entryLock);
+	while ((pLink = rsslQueueRemoveFirstLink(&pCache->entryList)))
+		rsslPayloadEntryFree(RSSL_QUEUE_LINK_TO_OBJECT(RsslPayloadEntryImpl, qlEntries, pLink));
+	RSSL_MUTEX_UNLOCK(&pCache->entryLock);
+}
+
+void rsslPayloadCacheRemoveEntry(RsslPayloadCacheImpl *pCache, RsslPayloadEntryImpl *pEntry)
+{
+	RSSL_MUTEX_LOCK(&pCache->entryLock);
+	rsslQueueRemoveLink(&pCache->entryList, &pEntry->qlEntries);
+	RSSL_MUTEX_UNLOCK(&pCache->entryLock);
+}
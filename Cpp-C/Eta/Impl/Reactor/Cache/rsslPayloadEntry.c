@@ -0,0 +1,982 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/rsslPayloadCacheImpl.h"
+#include "rtr/rsslErrorInfo.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Smallest allocation for the data of a cached field. Encoded fields rarely grow past this, so
+ * most updates are copied in place. */
+#define CACHE_FIELD_MIN_CAPACITY 16
+
+/* Initial size of a field list's field ID index. */
+#define CACHE_FID_INDEX_MIN_SIZE 16
+
+/* Initial number of buckets in a map's entry table. The table grows as entries are added. */
+#define CACHE_MAP_TABLE_SIZE 31
+
+/* Copies data into a buffer owned by the cache, growing it if needed. */
+static RsslRet _cacheCopyBuffer(RsslBuffer *pDest, RsslUInt32 *pCapacity, const RsslBuffer *pSource)
+{
+	if (pSource->length > *pCapacity)
+	{
+		RsslUInt32 newCapacity = (pSource->length + CACHE_FIELD_MIN_CAPACITY - 1) & ~(RsslUInt32)(CACHE_FIELD_MIN_CAPACITY - 1);
+		char *newData = (char*)realloc(pDest->data, newCapacity);
+
+		if (!newData)
+			return RSSL_RET_FAILURE;
+
+		pDest->data = newData;
+		*pCapacity = newCapacity;
+	}
+
+	if (pSource->length)
+		memcpy(pDest->data, pSource->data, pSource->length);
+	pDest->length = pSource->length;
+	return RSSL_RET_SUCCESS;
+}
+
+/*** Field lists ***/
+
+RTR_C_INLINE RsslUInt32 _cacheFidHash(RsslFieldId fieldId)
+{
+	RsslUInt32 hash = (RsslUInt32)(RsslUInt16)fieldId * 2654435761U;
+	return hash ^ (hash >> 16);
+}
+
+static RsslCacheField *_cacheFieldListFind(RsslCacheFieldList *pList, RsslFieldId fieldId)
+{
+	RsslUInt32 slot, position;
+
+	if (!pList->fidIndex)
+		return NULL;
+
+	for (slot = _cacheFidHash(fieldId) & pList->fidIndexMask; (position = pList->fidIndex[slot]) != 0;
+			slot = (slot + 1) & pList->fidIndexMask)
+	{
+		if (pList->fields[position - 1].fieldId == fieldId)
+			return &pList->fields[position - 1];
+	}
+
+	return NULL;
+}
+
+static void _cacheFieldListIndexInsert(RsslCacheFieldList *pList, RsslUInt32 position)
+{
+	RsslUInt32 slot = _cacheFidHash(pList->fields[position].fieldId) & pList->fidIndexMask;
+
+	while (pList->fidIndex[slot] != 0)
+		slot = (slot + 1) & pList->fidIndexMask;
+
+	pList->fidIndex[slot] = position + 1;
+}
+
+/* Resizes the field ID index so that it stays at most half full. */
+static RsslRet _cacheFieldListGrowIndex(RsslCacheFieldList *pList)
+{
+	RsslUInt32 newSize = pList->fidIndex ? (pList->fidIndexMask + 1) * 2 : CACHE_FID_INDEX_MIN_SIZE;
+	RsslUInt32 *newIndex = (RsslUInt32*)calloc(newSize, sizeof(RsslUInt32));
+	RsslUInt32 ui;
+
+	if (!newIndex)
+		return RSSL_RET_FAILURE;
+
+	free(pList->fidIndex);
+	pList->fidIndex = newIndex;
+	pList->fidIndexMask = newSize - 1;
+
+	for (ui = 0; ui < pList->fieldCount; ++ui)
+		_cacheFieldListIndexInsert(pList, ui);
+
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet _cacheFieldListAdd(RsslCacheFieldList *pList, RsslFieldId fieldId, const RsslBuffer *pData)
+{
+	RsslCacheField *pField;
+
+	if (pList->fieldCount == pList->fieldCapacity)
+	{
+		RsslUInt32 newCapacity = pList->fieldCapacity ? pList->fieldCapacity * 2 : CACHE_FID_INDEX_MIN_SIZE / 2;
+		RsslCacheField *newFields = (RsslCacheField*)realloc(pList->fields, newCapacity * sizeof(RsslCacheField));
+
+		if (!newFields)
+			return RSSL_RET_FAILURE;
+
+		memset(&newFields[pList->fieldCapacity], 0, (newCapacity - pList->fieldCapacity) * sizeof(RsslCacheField));
+		pList->fields = newFields;
+		pList->fieldCapacity = newCapacity;
+	}
+
+	if (!pList->fidIndex || (pList->fieldCount + 1) * 2 > pList->fidIndexMask + 1)
+	{
+		if (_cacheFieldListGrowIndex(pList) != RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;
+	}
+
+	/* Fields past fieldCount keep their data allocation from before the list was last cleared. */
+	pField = &pList->fields[pList->fieldCount];
+	pField->fieldId = fieldId;
+	if (_cacheCopyBuffer(&pField->data, &pField->capacity, pData) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	_cacheFieldListIndexInsert(pList, pList->fieldCount);
+	++pList->fieldCount;
+	return RSSL_RET_SUCCESS;
+}
+
+static void _cacheFieldListClear(RsslCacheFieldList *pList)
+{
+	pList->flags = 0;
+	pList->fieldCount = 0;
+	if (pList->fidIndex)
+		memset(pList->fidIndex, 0, (pList->fidIndexMask + 1) * sizeof(RsslUInt32));
+}
+
+static void _cacheFieldListFree(RsslCacheFieldList *pList)
+{
+	RsslUInt32 ui;
+
+	for (ui = 0; ui < pList->fieldCapacity; ++ui)
+		free(pList->fields[ui].data.data);
+
+	free(pList->fields);
+	free(pList->fidIndex);
+	memset(pList, 0, sizeof(RsslCacheFieldList));
+}
+
+/* Applies an encoded field list to the cached field list.
+ * If addFields is RSSL_FALSE (i.e. an update), fields not already cached are ignored.
+ * Fields not in the dictionary, if one is set, are ignored. Ignored fields are counted in pIgnoredCount. */
+static RsslRet _cacheFieldListApply(RsslCacheFieldList *pList, RsslDecodeIterator *pIter,
+		const RsslDataDictionary *pDictionary, RsslBool addFields, RsslUInt32 *pIgnoredCount, RsslCacheError *pError)
+{
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeFieldList(pIter, &fieldList, NULL)) == RSSL_RET_NO_DATA)
+		return RSSL_RET_SUCCESS;
+
+	if (ret != RSSL_RET_SUCCESS)
+	{
+		rsslCacheSetError(pError, ret, "Failed to decode field list: %d.", ret);
+		return ret;
+	}
+
+	if (fieldList.flags & RSSL_FLF_HAS_SET_DATA)
+	{
+		rsslCacheSetError(pError, RSSL_RET_UNSUPPORTED_DATA_TYPE, "Set-defined field list data is not supported by the cache.");
+		return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+	}
+
+	if (fieldList.flags & RSSL_FLF_HAS_FIELD_LIST_INFO)
+	{
+		pList->flags |= RSSL_FLF_HAS_FIELD_LIST_INFO;
+		pList->dictionaryId = fieldList.dictionaryId;
+		pList->fieldListNum = fieldList.fieldListNum;
+	}
+
+	while ((ret = rsslDecodeFieldEntry(pIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		RsslCacheField *pField;
+
+		if (ret != RSSL_RET_SUCCESS)
+		{
+			rsslCacheSetError(pError, ret, "Failed to decode field entry: %d.", ret);
+			return ret;
+		}
+
+		if ((pField = _cacheFieldListFind(pList, fieldEntry.fieldId)))
+		{
+			if (_cacheCopyBuffer(&pField->data, &pField->capacity, &fieldEntry.encData) != RSSL_RET_SUCCESS)
+			{
+				rsslCacheSetError(pError, RSSL_RET_FAILURE, "Memory allocation failure.");
+				return RSSL_RET_FAILURE;
+			}
+			continue;
+		}
+
+		if (!addFields
+				|| (pDictionary && (fieldEntry.fieldId < pDictionary->minFid || fieldEntry.fieldId > pDictionary->maxFid
+						|| !pDictionary->entriesArray[fieldEntry.fieldId])))
+		{
+			++*pIgnoredCount;
+			continue;
+		}
+
+		if (_cacheFieldListAdd(pList, fieldEntry.fieldId, &fieldEntry.encData) != RSSL_RET_SUCCESS)
+		{
+			rsslCacheSetError(pError, RSSL_RET_FAILURE, "Memory allocation failure.");
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Encodes the cached field list. On failure, the field list is rolled back. */
+static RsslRet _cacheFieldListRetrieve(RsslCacheFieldList *pList, RsslEncodeIterator *pIter)
+{
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslUInt32 ui;
+	RsslRet ret;
+
+	rsslClearFieldList(&fieldList);
+	fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA | pList->flags;
+	fieldList.dictionaryId = pList->dictionaryId;
+	fieldList.fieldListNum = pList->fieldListNum;
+
+	if ((ret = rsslEncodeFieldListInit(pIter, &fieldList, NULL, 0)) != RSSL_RET_SUCCESS)
+	{
+		rsslEncodeFieldListComplete(pIter, RSSL_FALSE);
+		return ret;
+	}
+
+	rsslClearFieldEntry(&fieldEntry);
+	for (ui = 0; ui < pList->fieldCount; ++ui)
+	{
+		RsslCacheField *pField = &pList->fields[ui];
+
+		/* Data is pre-encoded, so the data type is not needed. */
+		fieldEntry.fieldId = pField->fieldId;
+		fieldEntry.encData = pField->data;
+		if ((ret = rsslEncodeFieldEntry(pIter, &fieldEntry, NULL)) != RSSL_RET_SUCCESS)
+		{
+			rsslEncodeFieldListComplete(pIter, RSSL_FALSE);
+			return ret;
+		}
+	}
+
+	return rsslEncodeFieldListComplete(pIter, RSSL_TRUE);
+}
+
+/*** Maps ***/
+
+static RsslCacheMap *_cacheMapCreate()
+{
+	RsslCacheMap *pMap = (RsslCacheMap*)malloc(sizeof(RsslCacheMap));
+	RsslErrorInfo errorInfo;
+
+	if (!pMap)
+		return NULL;
+
+	memset(pMap, 0, sizeof(RsslCacheMap));
+	if (rsslHashTableInit(&pMap->entryTable, CACHE_MAP_TABLE_SIZE, rsslHashBufferSum, rsslHashBufferCompare,
+				RSSL_TRUE, &errorInfo) != RSSL_RET_SUCCESS)
+	{
+		free(pMap);
+		return NULL;
+	}
+
+	return pMap;
+}
+
+static void _cacheMapClear(RsslCacheMap *pMap)
+{
+	RsslUInt32 ui;
+
+	for (ui = 0; ui < pMap->entryCount; ++ui)
+		rsslHashTableRemoveLink(&pMap->entryTable, &pMap->entries[ui]->hlEntry);
+
+	pMap->entryCount = 0;
+	pMap->flags = 0;
+	pMap->hasSummaryData = RSSL_FALSE;
+	_cacheFieldListClear(&pMap->summaryFieldList);
+	pMap->summaryData.length = 0;
+}
+
+static void _cacheMapFree(RsslCacheMap *pMap)
+{
+	RsslUInt32 ui;
+
+	for (ui = 0; ui < pMap->entryAllocCount; ++ui)
+	{
+		RsslCacheMapEntry *pMapEntry = pMap->entries[ui];
+		_cacheFieldListFree(&pMapEntry->fieldList);
+		free(pMapEntry->encKey.data);
+		free(pMapEntry->permData.data);
+		free(pMapEntry->encData.data);
+		free(pMapEntry);
+	}
+
+	free(pMap->entries);
+	_cacheFieldListFree(&pMap->summaryFieldList);
+	free(pMap->summaryData.data);
+	rsslHashTableCleanup(&pMap->entryTable);
+	free(pMap);
+}
+
+/* Adds an entry with the given key, reusing a previously deleted entry's storage if one is available. */
+static RsslCacheMapEntry *_cacheMapAddEntry(RsslCacheMap *pMap, const RsslBuffer *pKey, RsslUInt32 hashSum)
+{
+	RsslCacheMapEntry *pMapEntry;
+
+	if (pMap->entryCount == pMap->entryAllocCount)
+	{
+		if (pMap->entryAllocCount == pMap->entryCapacity)
+		{
+			RsslUInt32 newCapacity = pMap->entryCapacity ? pMap->entryCapacity * 2 : 16;
+			RsslCacheMapEntry **newEntries = (RsslCacheMapEntry**)realloc(pMap->entries, newCapacity * sizeof(RsslCacheMapEntry*));
+
+			if (!newEntries)
+				return NULL;
+
+			pMap->entries = newEntries;
+			pMap->entryCapacity = newCapacity;
+		}
+
+		if (!(pMapEntry = (RsslCacheMapEntry*)malloc(sizeof(RsslCacheMapEntry))))
+			return NULL;
+
+		memset(pMapEntry, 0, sizeof(RsslCacheMapEntry));
+		pMap->entries[pMap->entryAllocCount++] = pMapEntry;
+	}
+	else
+		pMapEntry = pMap->entries[pMap->entryCount];
+
+	if (_cacheCopyBuffer(&pMapEntry->encKey, &pMapEntry->keyCapacity, pKey) != RSSL_RET_SUCCESS)
+		return NULL;
+
+	pMapEntry->position = pMap->entryCount++;
+	pMapEntry->hasPermData = RSSL_FALSE;
+	pMapEntry->encData.length = 0;
+	_cacheFieldListClear(&pMapEntry->fieldList);
+	rsslHashTableInsertLink(&pMap->entryTable, &pMapEntry->hlEntry, &pMapEntry->encKey, &hashSum);
+	return pMapEntry;
+}
+
+/* Removes an entry. The last entry is moved into its position, and the removed entry's storage is kept for reuse. */
+static void _cacheMapDeleteEntry(RsslCacheMap *pMap, RsslCacheMapEntry *pMapEntry)
+{
+	RsslUInt32 position = pMapEntry->position;
+	RsslCacheMapEntry *pLastEntry = pMap->entries[pMap->entryCount - 1];
+
+	rsslHashTableRemoveLink(&pMap->entryTable, &pMapEntry->hlEntry);
+
+	pMap->entries[position] = pLastEntry;
+	pLastEntry->position = position;
+	pMap->entries[--pMap->entryCount] = pMapEntry;
+}
+
+static RsslRet _cacheMapEntryApplyData(RsslCacheMap *pMap, RsslCacheMapEntry *pMapEntry, RsslMapEntry *pDecodedEntry,
+		RsslDecodeIterator *pIter, const RsslDataDictionary *pDictionary, RsslBool addFields, RsslUInt32 *pIgnoredCount,
+		RsslCacheError *pError)
+{
+	if (pDecodedEntry->flags & RSSL_MPEF_HAS_PERM_DATA)
+	{
+		if (_cacheCopyBuffer(&pMapEntry->permData, &pMapEntry->permCapacity, &pDecodedEntry->permData) != RSSL_RET_SUCCESS)
+		{
+			rsslCacheSetError(pError, RSSL_RET_FAILURE, "Memory allocation failure.");
+			return RSSL_RET_FAILURE;
+		}
+		pMapEntry->hasPermData = RSSL_TRUE;
+	}
+
+	if (pMap->containerType == RSSL_DT_FIELD_LIST)
+	{
+		if (pDecodedEntry->encData.length == 0)
+			return RSSL_RET_SUCCESS;
+
+		return _cacheFieldListApply(&pMapEntry->fieldList, pIter, pDictionary, addFields, pIgnoredCount, pError);
+	}
+
+	if (_cacheCopyBuffer(&pMapEntry->encData, &pMapEntry->encDataCapacity, &pDecodedEntry->encData) != RSSL_RET_SUCCESS)
+	{
+		rsslCacheSetError(pError, RSSL_RET_FAILURE, "Memory allocation failure.");
+		return RSSL_RET_FAILURE;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet _cacheMapApply(RsslPayloadEntryImpl *pEntry, RsslDecodeIterator *pIter,
+		const RsslDataDictionary *pDictionary, RsslUInt32 *pIgnoredCount, RsslCacheError *pError)
+{
+	RsslCacheMap *pMap;
+	RsslMap map;
+	RsslMapEntry mapEntry;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeMap(pIter, &map)) == RSSL_RET_NO_DATA)
+		return RSSL_RET_SUCCESS;
+
+	if (ret != RSSL_RET_SUCCESS)
+	{
+		rsslCacheSetError(pError, ret, "Failed to decode map: %d.", ret);
+		return ret;
+	}
+
+	if (map.flags & RSSL_MPF_HAS_SET_DEFS)
+	{
+		rsslCacheSetError(pError, RSSL_RET_UNSUPPORTED_DATA_TYPE, "Maps with set definitions are not supported by the cache.");
+		return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+	}
+
+	if (!(pMap = pEntry->pMap))
+	{
+		if (!(pMap = pEntry->pMap = _cacheMapCreate()))
+		{
+			rsslCacheSetError(pError, RSSL_RET_FAILURE, "Memory allocation failure.");
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+	if (pEntry->dataType == RSSL_DT_MAP)
+	{
+		if (map.containerType != pMap->containerType || map.keyPrimitiveType != pMap->keyPrimitiveType)
+		{
+			rsslCacheSetError(pError, RSSL_RET_INVALID_DATA,
+					"Map container type %s or key type %s does not match the cached map (%s, %s).",
+					rsslDataTypeToString(map.containerType), rsslDataTypeToString(map.keyPrimitiveType),
+					rsslDataTypeToString(pMap->containerType), rsslDataTypeToString(pMap->keyPrimitiveType));
+			return RSSL_RET_INVALID_DATA;
+		}
+	}
+	else
+	{
+		pMap->containerType = map.containerType;
+		pMap->keyPrimitiveType = map.keyPrimitiveType;
+		pEntry->dataType = RSSL_DT_MAP;
+	}
+
+	if (map.flags & RSSL_MPF_HAS_KEY_FIELD_ID)
+	{
+		pMap->flags |= RSSL_MPF_HAS_KEY_FIELD_ID;
+		pMap->keyFieldId = map.keyFieldId;
+	}
+
+	if (map.flags & RSSL_MPF_HAS_TOTAL_COUNT_HINT)
+	{
+		pMap->flags |= RSSL_MPF_HAS_TOTAL_COUNT_HINT;
+		pMap->totalCountHint = map.totalCountHint;
+	}
+
+	if (map.flags & RSSL_MPF_HAS_SUMMARY_DATA)
+	{
+		pMap->hasSummaryData = RSSL_TRUE;
+
+		if (map.containerType == RSSL_DT_FIELD_LIST)
+		{
+			RsslDecodeIterator summaryIter;
+
+			rsslClearDecodeIterator(&summaryIter);
+			rsslSetDecodeIteratorRWFVersion(&summaryIter, pIter->_majorVersion, pIter->_minorVersion);
+			rsslSetDecodeIteratorBuffer(&summaryIter, &map.encSummaryData);
+			if ((ret = _cacheFieldListApply(&pMap->summaryFieldList, &summaryIter, pDictionary, RSSL_TRUE,
+							pIgnoredCount, pError)) != RSSL_RET_SUCCESS)
+				return ret;
+		}
+		else if (_cacheCopyBuffer(&pMap->summaryData, &pMap->summaryCapacity, &map.encSummaryData) != RSSL_RET_SUCCESS)
+		{
+			rsslCacheSetError(pError, RSSL_RET_FAILURE, "Memory allocation failure.");
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+	while ((ret = rsslDecodeMapEntry(pIter, &mapEntry, NULL)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		RsslCacheMapEntry *pMapEntry;
+		RsslHashLink *pLink;
+		RsslUInt32 hashSum;
+
+		if (ret != RSSL_RET_SUCCESS)
+		{
+			rsslCacheSetError(pError, ret, "Failed to decode map entry: %d.", ret);
+			return ret;
+		}
+
+		hashSum = rsslHashBufferSum(&mapEntry.encKey);
+		pLink = rsslHashTableFind(&pMap->entryTable, &mapEntry.encKey, &hashSum);
+		pMapEntry = pLink ? RSSL_HASH_LINK_TO_OBJECT(RsslCacheMapEntry, hlEntry, pLink) : NULL;
+
+		switch(mapEntry.action)
+		{
+			case RSSL_MPEA_ADD_ENTRY:
+				if (pMapEntry)
+				{
+					/* Replaces the existing entry. */
+					pMapEntry->hasPermData = RSSL_FALSE;
+					pMapEntry->encData.length = 0;
+					_cacheFieldListClear(&pMapEntry->fieldList);
+				}
+				else if (!(pMapEntry = _cacheMapAddEntry(pMap, &mapEntry.encKey, hashSum)))
+				{
+					rsslCacheSetError(pError, RSSL_RET_FAILURE, "Memory allocation failure.");
+					return RSSL_RET_FAILURE;
+				}
+
+				if ((ret = _cacheMapEntryApplyData(pMap, pMapEntry, &mapEntry, pIter, pDictionary, RSSL_TRUE,
+								pIgnoredCount, pError)) != RSSL_RET_SUCCESS)
+					return ret;
+				break;
+
+			case RSSL_MPEA_UPDATE_ENTRY:
+				if (!pMapEntry)
+				{
+					/* Update for an entry that was never added; may be ignored. */
+					++*pIgnoredCount;
+					break;
+				}
+
+				if ((ret = _cacheMapEntryApplyData(pMap, pMapEntry, &mapEntry, pIter, pDictionary, RSSL_FALSE,
+								pIgnoredCount, pError)) != RSSL_RET_SUCCESS)
+					return ret;
+				break;
+
+			case RSSL_MPEA_DELETE_ENTRY:
+				if (pMapEntry)
+					_cacheMapDeleteEntry(pMap, pMapEntry);
+				break;
+
+			default:
+				rsslCacheSetError(pError, RSSL_RET_INVALID_DATA, "Unknown map entry action %u.", mapEntry.action);
+				return RSSL_RET_INVALID_DATA;
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Encodes cached map entries, starting from pCursor->position. The summary data and total count hint
+ * are only encoded in the first part. If the cursor is NULL, all entries must fit. */
+static RsslRet _cacheMapRetrieve(RsslCacheMap *pMap, RsslEncodeIterator *pIter, RsslPayloadCursorImpl *pCursor,
+		RsslCacheError *pError)
+{
+	RsslMap map;
+	RsslMapEntry mapEntry;
+	RsslUInt32 position = pCursor ? pCursor->position : 0;
+	RsslBool isFirstPart = (!pCursor || !pCursor->isStarted) ? RSSL_TRUE : RSSL_FALSE;
+	RsslUInt32 startPosition = position;
+	RsslRet ret;
+
+	rsslClearMap(&map);
+	map.containerType = pMap->containerType;
+	map.keyPrimitiveType = pMap->keyPrimitiveType;
+	map.flags = pMap->flags & RSSL_MPF_HAS_KEY_FIELD_ID;
+	map.keyFieldId = pMap->keyFieldId;
+
+	if (isFirstPart)
+	{
+		map.flags |= pMap->flags & RSSL_MPF_HAS_TOTAL_COUNT_HINT;
+		map.totalCountHint = pMap->totalCountHint;
+
+		if (pMap->hasSummaryData)
+		{
+			map.flags |= RSSL_MPF_HAS_SUMMARY_DATA;
+			if (pMap->containerType != RSSL_DT_FIELD_LIST)
+				map.encSummaryData = pMap->summaryData;
+		}
+	}
+
+	if ((ret = rsslEncodeMapInit(pIter, &map, 0, 0)) != RSSL_RET_SUCCESS)
+	{
+		rsslEncodeMapComplete(pIter, RSSL_FALSE);
+		rsslCacheSetError(pError, ret, "Failed to encode map: %d.", ret);
+		return ret;
+	}
+
+	if (map.flags & RSSL_MPF_HAS_SUMMARY_DATA && pMap->containerType == RSSL_DT_FIELD_LIST)
+	{
+		if ((ret = _cacheFieldListRetrieve(&pMap->summaryFieldList, pIter)) != RSSL_RET_SUCCESS
+				|| (ret = rsslEncodeMapSummaryDataComplete(pIter, RSSL_TRUE)) != RSSL_RET_SUCCESS)
+		{
+			rsslEncodeMapComplete(pIter, RSSL_FALSE);
+			rsslCacheSetError(pError, ret, "Failed to encode map summary data: %d.", ret);
+			return ret;
+		}
+	}
+
+	rsslClearMapEntry(&mapEntry);
+	mapEntry.action = RSSL_MPEA_ADD_ENTRY;
+
+	for (; position < pMap->entryCount; ++position)
+	{
+		RsslCacheMapEntry *pMapEntry = pMap->entries[position];
+
+		mapEntry.encKey = pMapEntry->encKey;
+		if (pMapEntry->hasPermData)
+		{
+			mapEntry.flags = RSSL_MPEF_HAS_PERM_DATA;
+			mapEntry.permData = pMapEntry->permData;
+		}
+		else
+			mapEntry.flags = RSSL_MPEF_NONE;
+
+		if (pMap->containerType == RSSL_DT_FIELD_LIST)
+		{
+			if ((ret = rsslEncodeMapEntryInit(pIter, &mapEntry, NULL, 0)) == RSSL_RET_SUCCESS
+					&& (ret = _cacheFieldListRetrieve(&pMapEntry->fieldList, pIter)) == RSSL_RET_SUCCESS)
+				ret = rsslEncodeMapEntryComplete(pIter, RSSL_TRUE);
+
+			if (ret != RSSL_RET_SUCCESS)
+				rsslEncodeMapEntryComplete(pIter, RSSL_FALSE);
+		}
+		else
+		{
+			mapEntry.encData = pMapEntry->encData;
+			ret = rsslEncodeMapEntry(pIter, &mapEntry, NULL);
+		}
+
+		if (ret != RSSL_RET_SUCCESS)
+		{
+			/* Stop at this entry if it does not fit. At least one entry must fit in each part,
+			 * and all entries must fit if the retrieval is not multi-part. */
+			if (ret != RSSL_RET_BUFFER_TOO_SMALL || !pCursor || position == startPosition)
+			{
+				rsslEncodeMapComplete(pIter, RSSL_FALSE);
+				rsslCacheSetError(pError, ret, "Failed to encode map entry: %d.", ret);
+				return ret;
+			}
+			break;
+		}
+	}
+
+	if ((ret = rsslEncodeMapComplete(pIter, RSSL_TRUE)) != RSSL_RET_SUCCESS)
+	{
+		rsslCacheSetError(pError, ret, "Failed to complete map encoding: %d.", ret);
+		return ret;
+	}
+
+	if (pCursor)
+	{
+		pCursor->isStarted = RSSL_TRUE;
+		pCursor->position = position;
+		if (position >= pMap->entryCount)
+			pCursor->isComplete = RSSL_TRUE;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/*** Payload entries ***/
+
+RSSL_VA_API RsslPayloadEntryHandle rsslPayloadEntryCreate(RsslPayloadCacheHandle cacheHandle, RsslCacheError *error)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslPayloadEntryImpl *pEntry;
+
+	if (!pCache)
+	{
+		rsslCacheSetError(error, RSSL_RET_INVALID_ARGUMENT, "Invalid cache handle.");
+		return NULL;
+	}
+
+	if (!(pEntry = (RsslPayloadEntryImpl*)malloc(sizeof(RsslPayloadEntryImpl))))
+	{
+		rsslCacheSetError(error, RSSL_RET_FAILURE, "Memory allocation failure.");
+		return NULL;
+	}
+
+	memset(pEntry, 0, sizeof(RsslPayloadEntryImpl));
+	pEntry->pCache = pCache;
+	pEntry->dataType = RSSL_DT_UNKNOWN;
+
+	RSSL_MUTEX_LOCK(&pCache->entryLock);
+	if (pCache->maxItems && rsslQueueGetElementCount(&pCache->entryList) >= pCache->maxItems)
+	{
+		RSSL_MUTEX_UNLOCK(&pCache->entryLock);
+		free(pEntry);
+		rsslCacheSetError(error, RSSL_RET_FAILURE, "Cache is full (maxItems " RTR_LLU ").", pCache->maxItems);
+		return NULL;
+	}
+	rsslQueueAddLinkToBack(&pCache->entryList, &pEntry->qlEntries);
+	RSSL_MUTEX_UNLOCK(&pCache->entryLock);
+
+	return (RsslPayloadEntryHandle)pEntry;
+}
+
+void rsslPayloadEntryFree(RsslPayloadEntryImpl *pEntry)
+{
+	_cacheFieldListFree(&pEntry->fieldList);
+	if (pEntry->pMap)
+		_cacheMapFree(pEntry->pMap);
+	free(pEntry);
+}
+
+RSSL_VA_API void rsslPayloadEntryDestroy(RsslPayloadEntryHandle handle)
+{
+	RsslPayloadEntryImpl *pEntry = (RsslPayloadEntryImpl*)handle;
+
+	if (!pEntry)
+		return;
+
+	rsslPayloadCacheRemoveEntry(pEntry->pCache, pEntry);
+	rsslPayloadEntryFree(pEntry);
+}
+
+RSSL_VA_API void rsslPayloadEntryClear(RsslPayloadEntryHandle handle)
+{
+	RsslPayloadEntryImpl *pEntry = (RsslPayloadEntryImpl*)handle;
+
+	if (!pEntry)
+		return;
+
+	_cacheFieldListClear(&pEntry->fieldList);
+	if (pEntry->pMap)
+		_cacheMapClear(pEntry->pMap);
+	pEntry->dataType = RSSL_DT_UNKNOWN;
+}
+
+RSSL_VA_API RsslContainerType rsslPayloadEntryGetDataType(RsslPayloadEntryHandle handle)
+{
+	RsslPayloadEntryImpl *pEntry = (RsslPayloadEntryImpl*)handle;
+
+	return pEntry ? pEntry->dataType : RSSL_DT_UNKNOWN;
+}
+
+RSSL_VA_API RsslRet rsslPayloadEntryApply(RsslPayloadEntryHandle handle,
+			RsslDecodeIterator *dIter,
+			RsslMsg *msg,
+			RsslCacheError *errorInfo)
+{
+	RsslPayloadEntryImpl *pEntry = (RsslPayloadEntryImpl*)handle;
+	const RsslDataDictionary *pDictionary;
+	RsslBool isUpdate = RSSL_FALSE;
+	RsslUInt32 ignoredCount = 0;
+	RsslRet ret;
+
+	if (!pEntry || !dIter || !msg)
+	{
+		rsslCacheSetError(errorInfo, RSSL_RET_INVALID_ARGUMENT, "Invalid entry handle, iterator or message.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	switch(msg->msgBase.msgClass)
+	{
+		case RSSL_MC_REFRESH:
+			if (msg->refreshMsg.flags & RSSL_RFMF_CLEAR_CACHE)
+				rsslPayloadEntryClear(handle);
+			break;
+
+		case RSSL_MC_UPDATE:
+			isUpdate = RSSL_TRUE;
+			break;
+
+		case RSSL_MC_STATUS:
+			if (msg->statusMsg.flags & RSSL_STMF_CLEAR_CACHE)
+				rsslPayloadEntryClear(handle);
+			return RSSL_RET_SUCCESS;
+
+		default:
+			rsslCacheSetError(errorInfo, RSSL_RET_INVALID_ARGUMENT, "Message class %s cannot be applied to the cache.",
+					rsslMsgClassToString(msg->msgBase.msgClass));
+			return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (msg->msgBase.containerType == RSSL_DT_NO_DATA)
+		return RSSL_RET_SUCCESS;
+
+	if (pEntry->dataType != RSSL_DT_UNKNOWN && msg->msgBase.containerType != pEntry->dataType)
+	{
+		rsslCacheSetError(errorInfo, RSSL_RET_INVALID_DATA, "Message container type %s does not match the cached type %s.",
+				rsslDataTypeToString(msg->msgBase.containerType), rsslDataTypeToString(pEntry->dataType));
+		return RSSL_RET_INVALID_DATA;
+	}
+
+	pDictionary = rsslPayloadCacheGetDictionary(pEntry->pCache);
+
+	switch(msg->msgBase.containerType)
+	{
+		case RSSL_DT_FIELD_LIST:
+			if ((ret = _cacheFieldListApply(&pEntry->fieldList, dIter, pDictionary, !isUpdate, &ignoredCount, errorInfo))
+					!= RSSL_RET_SUCCESS)
+				return ret;
+			pEntry->dataType = RSSL_DT_FIELD_LIST;
+			break;
+
+		case RSSL_DT_MAP:
+			if ((ret = _cacheMapApply(pEntry, dIter, pDictionary, &ignoredCount, errorInfo)) != RSSL_RET_SUCCESS)
+				return ret;
+			break;
+
+		default:
+			rsslCacheSetError(errorInfo, RSSL_RET_UNSUPPORTED_DATA_TYPE, "Container type %s is not supported by the cache.",
+					rsslDataTypeToString(msg->msgBase.containerType));
+			return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+	}
+
+	if (ignoredCount)
+	{
+		/* Warning: the rest of the data was applied. */
+		rsslCacheSetError(errorInfo, RSSL_RET_SUCCESS, "%u field or map entries were not applied (not in the dictionary, or updated before being added).",
+				ignoredCount);
+		return RSSL_RET_FAILURE;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_VA_API RsslRet rsslPayloadEntryRetrieve(RsslPayloadEntryHandle handle,
+			RsslEncodeIterator *eIter,
+			RsslPayloadCursorHandle cursorHandle,
+			RsslCacheError *errorInfo)
+{
+	RsslPayloadEntryImpl *pEntry = (RsslPayloadEntryImpl*)handle;
+	RsslPayloadCursorImpl *pCursor = (RsslPayloadCursorImpl*)cursorHandle;
+	RsslRet ret;
+
+	if (!pEntry || !eIter)
+	{
+		rsslCacheSetError(errorInfo, RSSL_RET_INVALID_ARGUMENT, "Invalid entry handle or iterator.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (pCursor && pCursor->isComplete)
+		return RSSL_RET_SUCCESS;
+
+	switch(pEntry->dataType)
+	{
+		case RSSL_DT_FIELD_LIST:
+			if ((ret = _cacheFieldListRetrieve(&pEntry->fieldList, eIter)) != RSSL_RET_SUCCESS)
+			{
+				rsslCacheSetError(errorInfo, ret, "Failed to encode field list: %d.", ret);
+				return ret;
+			}
+			break;
+
+		case RSSL_DT_MAP:
+			return _cacheMapRetrieve(pEntry->pMap, eIter, pCursor, errorInfo);
+
+		default:
+			/* Nothing cached. */
+			break;
+	}
+
+	if (pCursor)
+	{
+		pCursor->isStarted = RSSL_TRUE;
+		pCursor->isComplete = RSSL_TRUE;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Writes a field list as XML, with the field names and values if a dictionary is available. */
+static void _cacheTraceFieldList(FILE *file, RsslCacheFieldList *pList, const RsslDataDictionary *pDictionary,
+		const char *indent, RsslUInt8 majorVersion, RsslUInt8 minorVersion)
+{
+	RsslUInt32 ui;
+	char valueText[256];
+
+	fprintf(file, "%s<fieldList flags=\"0x%X\"", indent, RSSL_FLF_HAS_STANDARD_DATA | pList->flags);
+	if (pList->flags & RSSL_FLF_HAS_FIELD_LIST_INFO)
+		fprintf(file, " dictionaryId=\"%d\" fieldListNum=\"%d\"", pList->dictionaryId, pList->fieldListNum);
+	fprintf(file, ">\n");
+
+	for (ui = 0; ui < pList->fieldCount; ++ui)
+	{
+		RsslCacheField *pField = &pList->fields[ui];
+		RsslDictionaryEntry *pDictionaryEntry = NULL;
+
+		if (pDictionary && pField->fieldId >= pDictionary->minFid && pField->fieldId <= pDictionary->maxFid)
+			pDictionaryEntry = pDictionary->entriesArray[pField->fieldId];
+
+		fprintf(file, "%s    <fieldEntry fieldId=\"%d\"", indent, pField->fieldId);
+
+		if (pDictionaryEntry)
+		{
+			fprintf(file, " name=\"%.*s\" dataType=\"%s\"", pDictionaryEntry->acronym.length, pDictionaryEntry->acronym.data,
+					rsslDataTypeToString(pDictionaryEntry->rwfType));
+
+			if (pField->data.length == 0)
+				fprintf(file, " data=\"\" />\n");
+			else if (pDictionaryEntry->rwfType <= RSSL_DT_BASE_PRIMITIVE_MAX)
+			{
+				RsslDecodeIterator dIter;
+				RsslBuffer valueBuffer;
+
+				valueBuffer.data = valueText;
+				valueBuffer.length = sizeof(valueText);
+
+				rsslClearDecodeIterator(&dIter);
+				rsslSetDecodeIteratorRWFVersion(&dIter, majorVersion, minorVersion);
+				rsslSetDecodeIteratorBuffer(&dIter, &pField->data);
+				if (rsslEncodedPrimitiveToString(&dIter, pDictionaryEntry->rwfType, &valueBuffer) == RSSL_RET_SUCCESS)
+					fprintf(file, " data=\"%.*s\" />\n", valueBuffer.length, valueBuffer.data);
+				else
+					fprintf(file, " length=\"%u\" />\n", pField->data.length);
+			}
+			else
+				fprintf(file, " length=\"%u\" />\n", pField->data.length);
+		}
+		else
+			fprintf(file, " length=\"%u\" />\n", pField->data.length);
+	}
+
+	fprintf(file, "%s</fieldList>\n", indent);
+}
+
+RSSL_VA_API RsslRet rsslPayloadEntryTrace(RsslPayloadEntryHandle handle,
+			RsslInt traceFormat,
+			FILE *file,
+			RsslDataDictionary *dictionary)
+{
+	RsslPayloadEntryImpl *pEntry = (RsslPayloadEntryImpl*)handle;
+	const RsslDataDictionary *pDictionary;
+	RsslUInt32 ui;
+
+	if (!pEntry || !file || traceFormat != PAYLOAD_ENTRY_TRACE_OPTION_XML)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	pDictionary = dictionary ? dictionary : rsslPayloadCacheGetDictionary(pEntry->pCache);
+
+	switch(pEntry->dataType)
+	{
+		case RSSL_DT_FIELD_LIST:
+			_cacheTraceFieldList(file, &pEntry->fieldList, pDictionary, "", RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+			break;
+
+		case RSSL_DT_MAP:
+		{
+			RsslCacheMap *pMap = pEntry->pMap;
+
+			fprintf(file, "<map keyPrimitiveType=\"%s\" containerType=\"%s\" countHint=\"%u\" entryCount=\"%u\">\n",
+					rsslDataTypeToString(pMap->keyPrimitiveType), rsslDataTypeToString(pMap->containerType),
+					pMap->totalCountHint, pMap->entryCount);
+
+			if (pMap->hasSummaryData)
+			{
+				fprintf(file, "    <summaryData>\n");
+				if (pMap->containerType == RSSL_DT_FIELD_LIST)
+					_cacheTraceFieldList(file, &pMap->summaryFieldList, pDictionary, "        ", RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+				fprintf(file, "    </summaryData>\n");
+			}
+
+			for (ui = 0; ui < pMap->entryCount; ++ui)
+			{
+				RsslCacheMapEntry *pMapEntry = pMap->entries[ui];
+				RsslUInt32 uj;
+
+				fprintf(file, "    <mapEntry key=\"");
+				for (uj = 0; uj < pMapEntry->encKey.length; ++uj)
+					fprintf(file, "%2.2X", (unsigned char)pMapEntry->encKey.data[uj]);
+				fprintf(file, "\">\n");
+
+				if (pMap->containerType == RSSL_DT_FIELD_LIST)
+					_cacheTraceFieldList(file, &pMapEntry->fieldList, pDictionary, "        ", RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+				else
+					fprintf(file, "        <data length=\"%u\" />\n", pMapEntry->encData.length);
+
+				fprintf(file, "    </mapEntry>\n");
+			}
+
+			fprintf(file, "</map>\n");
+			break;
+		}
+
+		default:
+			fprintf(file, "<!-- Cache entry is empty. -->\n");
+			break;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
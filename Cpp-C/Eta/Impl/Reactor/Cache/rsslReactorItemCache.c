@@ -0,0 +1,530 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/rsslReactorItemCache.h"
+#include "rtr/rsslMsgEncoders.h"
+#include "rtr/rsslRDM.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static RsslUInt32 _itemKeyHashSum(void *pKey)
+{
+	RsslReactorCachedItemKey *pItemKey = (RsslReactorCachedItemKey*)pKey;
+	RsslUInt32 i;
+	RsslUInt32 hashSum = pItemKey->serviceId + ((RsslUInt32)pItemKey->domainType << 16);
+
+	for(i = 0; i < pItemKey->name.length; ++i)
+	{
+		hashSum = (hashSum << 4) + (RsslUInt32)pItemKey->name.data[i];
+		hashSum ^= (hashSum >> 12);
+	}
+
+	return hashSum;
+}
+
+static RsslBool _itemKeyHashCompare(void *pKey1, void *pKey2)
+{
+	RsslReactorCachedItemKey *pItemKey1 = (RsslReactorCachedItemKey*)pKey1;
+	RsslReactorCachedItemKey *pItemKey2 = (RsslReactorCachedItemKey*)pKey2;
+
+	return (pItemKey1->domainType == pItemKey2->domainType
+			&& pItemKey1->serviceId == pItemKey2->serviceId
+			&& pItemKey1->nameType == pItemKey2->nameType
+			&& rsslBufferIsEqual(&pItemKey1->name, &pItemKey2->name)) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+static RsslUInt32 _streamKeyHashSum(void *pKey)
+{
+	RsslReactorCachedStreamKey *pStreamKey = (RsslReactorCachedStreamKey*)pKey;
+
+	return (RsslUInt32)pStreamKey->streamId ^ (RsslUInt32)((size_t)pStreamKey->pChannel >> 4);
+}
+
+static RsslBool _streamKeyHashCompare(void *pKey1, void *pKey2)
+{
+	RsslReactorCachedStreamKey *pStreamKey1 = (RsslReactorCachedStreamKey*)pKey1;
+	RsslReactorCachedStreamKey *pStreamKey2 = (RsslReactorCachedStreamKey*)pKey2;
+
+	return (pStreamKey1->pChannel == pStreamKey2->pChannel && pStreamKey1->streamId == pStreamKey2->streamId)
+		? RSSL_TRUE : RSSL_FALSE;
+}
+
+static RsslReactorCachedStream *_itemCacheFindStream(RsslReactorItemCache *pItemCache, void *pChannel, RsslInt32 streamId)
+{
+	RsslReactorCachedStreamKey streamKey;
+	RsslHashLink *pHashLink;
+
+	streamKey.pChannel = pChannel;
+	streamKey.streamId = streamId;
+
+	if ((pHashLink = rsslHashTableFind(&pItemCache->streamTable, &streamKey, NULL)) == NULL)
+		return NULL;
+
+	return RSSL_HASH_LINK_TO_OBJECT(RsslReactorCachedStream, hlStream, pHashLink);
+}
+
+static void _itemCacheDestroyItem(RsslReactorItemCache *pItemCache, RsslReactorCachedItem *pItem)
+{
+	rsslHashTableRemoveLink(&pItemCache->itemTable, &pItem->hlItem);
+	rsslPayloadEntryDestroy(pItem->entryHandle);
+	free(pItem->key.name.data);
+	free(pItem);
+}
+
+/* Removes a stream from its item. If it was the item's owner, the next stream becomes the owner. */
+static void _itemCacheRemoveStream(RsslReactorItemCache *pItemCache, RsslReactorCachedStream *pStream)
+{
+	RsslReactorCachedItem *pItem = pStream->pItem;
+
+	rsslHashTableRemoveLink(&pItemCache->streamTable, &pStream->hlStream);
+	rsslQueueRemoveLink(&pItem->streamList, &pStream->qlItem);
+	free(pStream);
+
+	if (rsslQueueGetElementCount(&pItem->streamList) == 0)
+	{
+		_itemCacheDestroyItem(pItemCache, pItem);
+		return;
+	}
+
+	if (pItem->pOwnerStream == pStream)
+		pItem->pOwnerStream = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorCachedStream, qlItem, rsslQueuePeekFront(&pItem->streamList));
+}
+
+RsslReactorItemCache *rsslReactorItemCacheCreate(RsslDataDictionary *pDictionary, RsslErrorInfo *pError)
+{
+	RsslReactorItemCache *pItemCache;
+	RsslPayloadCacheConfigOptions cacheConfig;
+
+	if (!(pItemCache = (RsslReactorItemCache*)malloc(sizeof(RsslReactorItemCache))))
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate item cache.");
+		return NULL;
+	}
+
+	memset(pItemCache, 0, sizeof(RsslReactorItemCache));
+
+	if (rsslPayloadCacheInitialize() != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to initialize payload cache.");
+		free(pItemCache);
+		return NULL;
+	}
+
+	cacheConfig.maxItems = 0;
+	if (!(pItemCache->cacheHandle = rsslPayloadCacheCreate(&cacheConfig, &pItemCache->cacheError)))
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create payload cache: %s",
+				pItemCache->cacheError.text);
+		rsslPayloadCacheUninitialize();
+		free(pItemCache);
+		return NULL;
+	}
+
+	if (pDictionary && rsslPayloadCacheSetDictionary(pItemCache->cacheHandle, pDictionary, NULL, &pItemCache->cacheError)
+			!= RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to set payload cache dictionary: %s",
+				pItemCache->cacheError.text);
+		rsslPayloadCacheDestroy(pItemCache->cacheHandle);
+		rsslPayloadCacheUninitialize();
+		free(pItemCache);
+		return NULL;
+	}
+
+	if (!(pItemCache->cursorHandle = rsslPayloadCursorCreate())
+			|| rsslHashTableInit(&pItemCache->itemTable, 10007, _itemKeyHashSum, _itemKeyHashCompare, RSSL_TRUE, pError) != RSSL_RET_SUCCESS)
+	{
+		rsslPayloadCursorDestroy(pItemCache->cursorHandle);
+		rsslPayloadCacheDestroy(pItemCache->cacheHandle);
+		rsslPayloadCacheUninitialize();
+		free(pItemCache);
+		return NULL;
+	}
+
+	if (rsslHashTableInit(&pItemCache->streamTable, 10007, _streamKeyHashSum, _streamKeyHashCompare, RSSL_TRUE, pError) != RSSL_RET_SUCCESS)
+	{
+		rsslHashTableCleanup(&pItemCache->itemTable);
+		rsslPayloadCursorDestroy(pItemCache->cursorHandle);
+		rsslPayloadCacheDestroy(pItemCache->cacheHandle);
+		rsslPayloadCacheUninitialize();
+		free(pItemCache);
+		return NULL;
+	}
+
+	return pItemCache;
+}
+
+void rsslReactorItemCacheDestroy(RsslReactorItemCache *pItemCache)
+{
+	RsslUInt32 i;
+
+	for (i = 0; i < pItemCache->streamTable.queueCount; ++i)
+	{
+		RsslQueueLink *pLink;
+
+		while ((pLink = rsslQueuePeekFront(&pItemCache->streamTable.queueList[i])))
+			_itemCacheRemoveStream(pItemCache, RSSL_HASH_LINK_TO_OBJECT(RsslReactorCachedStream, hlStream,
+						RSSL_HASH_LINK_FROM_QUEUE_LINK(pLink)));
+	}
+
+	rsslHashTableCleanup(&pItemCache->streamTable);
+	rsslHashTableCleanup(&pItemCache->itemTable);
+	rsslPayloadCursorDestroy(pItemCache->cursorHandle);
+	rsslPayloadCacheDestroy(pItemCache->cacheHandle);
+	rsslPayloadCacheUninitialize();
+	free(pItemCache);
+}
+
+RsslRet rsslReactorItemCacheProcessRequest(RsslReactorItemCache *pItemCache, void *pChannel,
+		RsslRequestMsg *pRequestMsg, RsslReactorCachedItem **ppItem, RsslErrorInfo *pError)
+{
+	RsslMsgKey *pKey = &pRequestMsg->msgBase.msgKey;
+	RsslReactorCachedItemKey itemKey;
+	RsslReactorCachedItem *pItem;
+	RsslReactorCachedStream *pStream;
+	RsslHashLink *pHashLink;
+	RsslUInt32 hashSum;
+
+	*ppItem = NULL;
+
+	if ((pKey->flags & (RSSL_MKF_HAS_SERVICE_ID | RSSL_MKF_HAS_NAME | RSSL_MKF_HAS_ATTRIB | RSSL_MKF_HAS_FILTER | RSSL_MKF_HAS_IDENTIFIER))
+				!= (RSSL_MKF_HAS_SERVICE_ID | RSSL_MKF_HAS_NAME)
+			|| pRequestMsg->flags & (RSSL_RQMF_PRIVATE_STREAM | RSSL_RQMF_HAS_VIEW | RSSL_RQMF_HAS_BATCH))
+		return RSSL_RET_SUCCESS;
+
+	if ((pStream = _itemCacheFindStream(pItemCache, pChannel, pRequestMsg->msgBase.streamId)))
+	{
+		/* Reissue. */
+		pItem = pStream->pItem;
+
+		if (!(pRequestMsg->flags & RSSL_RQMF_STREAMING))
+		{
+			/* Stream is becoming a snapshot, so it will close once refreshed. */
+			_itemCacheRemoveStream(pItemCache, pStream);
+			return RSSL_RET_SUCCESS;
+		}
+	}
+	else
+	{
+		itemKey.domainType = pRequestMsg->msgBase.domainType;
+		itemKey.serviceId = pKey->serviceId;
+		itemKey.nameType = (pKey->flags & RSSL_MKF_HAS_NAME_TYPE) ? pKey->nameType : RDM_INSTRUMENT_NAME_TYPE_RIC;
+		itemKey.name = pKey->name;
+
+		hashSum = _itemKeyHashSum(&itemKey);
+
+		if ((pHashLink = rsslHashTableFind(&pItemCache->itemTable, &itemKey, &hashSum)))
+		{
+			pItem = RSSL_HASH_LINK_TO_OBJECT(RsslReactorCachedItem, hlItem, pHashLink);
+
+			/* A request for a different QoS is a different item. Leave it to the application. */
+			if (pRequestMsg->flags & RSSL_RQMF_HAS_QOS && pItem->hasQos && !rsslQosIsEqual(&pRequestMsg->qos, &pItem->qos))
+				return RSSL_RET_SUCCESS;
+		}
+		else
+		{
+			/* Snapshots of items that are not cached are left to the application. */
+			if (!(pRequestMsg->flags & RSSL_RQMF_STREAMING))
+				return RSSL_RET_SUCCESS;
+
+			if (!(pItem = (RsslReactorCachedItem*)malloc(sizeof(RsslReactorCachedItem))))
+			{
+				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate cached item.");
+				return RSSL_RET_FAILURE;
+			}
+
+			memset(pItem, 0, sizeof(RsslReactorCachedItem));
+			rsslInitQueue(&pItem->streamList);
+			pItem->key = itemKey;
+
+			if (!(pItem->key.name.data = (char*)malloc(pKey->name.length ? pKey->name.length : 1)))
+			{
+				free(pItem);
+				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate cached item name.");
+				return RSSL_RET_FAILURE;
+			}
+			memcpy(pItem->key.name.data, pKey->name.data, pKey->name.length);
+
+			if (!(pItem->entryHandle = rsslPayloadEntryCreate(pItemCache->cacheHandle, &pItemCache->cacheError)))
+			{
+				free(pItem->key.name.data);
+				free(pItem);
+				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create payload entry: %s",
+						pItemCache->cacheError.text);
+				return RSSL_RET_FAILURE;
+			}
+
+			rsslHashTableInsertLink(&pItemCache->itemTable, &pItem->hlItem, &pItem->key, &hashSum);
+		}
+
+		if (pRequestMsg->flags & RSSL_RQMF_STREAMING)
+		{
+			if (!(pStream = (RsslReactorCachedStream*)malloc(sizeof(RsslReactorCachedStream))))
+			{
+				if (rsslQueueGetElementCount(&pItem->streamList) == 0)
+					_itemCacheDestroyItem(pItemCache, pItem);
+				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to allocate cached stream.");
+				return RSSL_RET_FAILURE;
+			}
+
+			pStream->key.pChannel = pChannel;
+			pStream->key.streamId = pRequestMsg->msgBase.streamId;
+			pStream->pItem = pItem;
+			rsslHashTableInsertLink(&pItemCache->streamTable, &pStream->hlStream, &pStream->key, NULL);
+			rsslQueueAddLinkToBack(&pItem->streamList, &pStream->qlItem);
+		}
+	}
+
+	if (pItem->isRefreshComplete && !(pRequestMsg->flags & RSSL_RQMF_NO_REFRESH))
+		*ppItem = pItem;
+
+	return RSSL_RET_SUCCESS;
+}
+
+void rsslReactorItemCacheProcessClose(RsslReactorItemCache *pItemCache, void *pChannel, RsslInt32 streamId)
+{
+	RsslReactorCachedStream *pStream;
+
+	if ((pStream = _itemCacheFindStream(pItemCache, pChannel, streamId)))
+		_itemCacheRemoveStream(pItemCache, pStream);
+}
+
+RsslRet rsslReactorItemCacheProcessSubmit(RsslReactorItemCache *pItemCache, void *pChannel,
+		RsslBuffer *pMsgBuffer, RsslUInt8 majorVersion, RsslUInt8 minorVersion, RsslErrorInfo *pError)
+{
+	RsslDecodeIterator dIter;
+	RsslMsgHeaderInfo headerInfo;
+	RsslReactorCachedStream *pStream;
+	RsslReactorCachedItem *pItem;
+	RsslMsg msg;
+	RsslRet ret;
+	const RsslState *pState = NULL;
+
+	if (pItemCache->isSendingRefresh)
+		return RSSL_RET_SUCCESS;
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorRWFVersion(&dIter, majorVersion, minorVersion);
+	rsslSetDecodeIteratorBuffer(&dIter, pMsgBuffer);
+
+	/* Most submitted messages are on streams that are not cached, so only the routing fields are read first. */
+	rsslClearMsgHeaderInfo(&headerInfo);
+	if (rsslPeekMsgHeader(&dIter, &headerInfo) != RSSL_RET_SUCCESS)
+		return RSSL_RET_SUCCESS;
+
+	switch(headerInfo.msgClass)
+	{
+		case RSSL_MC_REFRESH:
+		case RSSL_MC_UPDATE:
+		case RSSL_MC_STATUS:
+			break;
+		default:
+			return RSSL_RET_SUCCESS;
+	}
+
+	if (!(pStream = _itemCacheFindStream(pItemCache, pChannel, headerInfo.streamId)))
+		return RSSL_RET_SUCCESS;
+
+	pItem = pStream->pItem;
+
+	/* The first stream to be refreshed owns the item. */
+	if (!pItem->pOwnerStream && headerInfo.msgClass == RSSL_MC_REFRESH)
+		pItem->pOwnerStream = pStream;
+
+	if (pItem->pOwnerStream != pStream)
+	{
+		if (headerInfo.msgClass != RSSL_MC_UPDATE)
+		{
+			/* Still need to know if the stream is closing. */
+			rsslClearMsg(&msg);
+			if (rsslDecodeMsg(&dIter, &msg) == RSSL_RET_SUCCESS
+					&& (pState = (msg.msgBase.msgClass == RSSL_MC_REFRESH) ? &msg.refreshMsg.state
+						: (msg.statusMsg.flags & RSSL_STMF_HAS_STATE) ? &msg.statusMsg.state : NULL)
+					&& pState->streamState != RSSL_STREAM_OPEN)
+				_itemCacheRemoveStream(pItemCache, pStream);
+		}
+		return RSSL_RET_SUCCESS;
+	}
+
+	rsslClearMsg(&msg);
+	if ((ret = rsslDecodeMsg(&dIter, &msg)) != RSSL_RET_SUCCESS)
+	{
+		/* Cannot keep the cache consistent with this stream. */
+		pItem->isRefreshComplete = RSSL_FALSE;
+		return RSSL_RET_SUCCESS;
+	}
+
+	switch(msg.msgBase.msgClass)
+	{
+		case RSSL_MC_REFRESH:
+			if (msg.refreshMsg.flags & RSSL_RFMF_CLEAR_CACHE)
+				pItem->isRefreshComplete = RSSL_FALSE;
+
+			pState = &msg.refreshMsg.state;
+
+			if (msg.refreshMsg.flags & RSSL_RFMF_HAS_QOS)
+			{
+				pItem->hasQos = RSSL_TRUE;
+				pItem->qos = msg.refreshMsg.qos;
+			}
+			break;
+
+		case RSSL_MC_STATUS:
+			if (msg.statusMsg.flags & RSSL_STMF_CLEAR_CACHE)
+				pItem->isRefreshComplete = RSSL_FALSE;
+
+			if (msg.statusMsg.flags & RSSL_STMF_HAS_STATE)
+				pState = &msg.statusMsg.state;
+			break;
+
+		default:
+			break;
+	}
+
+	if (pState && pState->streamState != RSSL_STREAM_OPEN)
+	{
+		_itemCacheRemoveStream(pItemCache, pStream);
+		return RSSL_RET_SUCCESS;
+	}
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorRWFVersion(&dIter, majorVersion, minorVersion);
+	rsslSetDecodeIteratorBuffer(&dIter, &msg.msgBase.encDataBody);
+
+	if ((ret = rsslPayloadEntryApply(pItem->entryHandle, &dIter, &msg, &pItemCache->cacheError)) != RSSL_RET_SUCCESS
+			&& pItemCache->cacheError.rsslErrorId != RSSL_RET_SUCCESS)
+	{
+		/* Data that cannot be cached (e.g. an unsupported container type). Requests for this item will go to the application. */
+		pItem->isRefreshComplete = RSSL_FALSE;
+		rsslPayloadEntryClear(pItem->entryHandle);
+		return RSSL_RET_SUCCESS;
+	}
+
+	if (pState)
+	{
+		pItem->state = *pState;
+		rsslClearBuffer(&pItem->state.text);
+	}
+
+	if (msg.msgBase.msgClass == RSSL_MC_REFRESH && msg.refreshMsg.flags & RSSL_RFMF_REFRESH_COMPLETE)
+		pItem->isRefreshComplete = RSSL_TRUE;
+
+	return RSSL_RET_SUCCESS;
+}
+
+void rsslReactorItemCacheRemoveChannel(RsslReactorItemCache *pItemCache, void *pChannel)
+{
+	RsslUInt32 i;
+
+	for (i = 0; i < pItemCache->streamTable.queueCount; ++i)
+	{
+		RsslQueueLink *pLink;
+
+		RSSL_QUEUE_FOR_EACH_LINK(&pItemCache->streamTable.queueList[i], pLink)
+		{
+			RsslReactorCachedStream *pStream = RSSL_HASH_LINK_TO_OBJECT(RsslReactorCachedStream, hlStream,
+					RSSL_HASH_LINK_FROM_QUEUE_LINK(pLink));
+
+			if (pStream->key.pChannel == pChannel)
+				_itemCacheRemoveStream(pItemCache, pStream);
+		}
+	}
+}
+
+void rsslReactorItemCacheStartRefresh(RsslReactorItemCache *pItemCache)
+{
+	rsslPayloadCursorClear(pItemCache->cursorHandle);
+	pItemCache->isRefreshStarted = RSSL_FALSE;
+	pItemCache->isSendingRefresh = RSSL_TRUE;
+}
+
+void rsslReactorItemCacheEndRefresh(RsslReactorItemCache *pItemCache)
+{
+	pItemCache->isSendingRefresh = RSSL_FALSE;
+}
+
+RsslRet rsslReactorItemCacheEncodeRefresh(RsslReactorItemCache *pItemCache, RsslReactorCachedItem *pItem,
+		RsslRequestMsg *pRequestMsg, RsslEncodeIterator *pIter, RsslBool *pIsComplete, RsslErrorInfo *pError)
+{
+	RsslRefreshMsg refreshMsg;
+	RsslContainerType dataType = rsslPayloadEntryGetDataType(pItem->entryHandle);
+	RsslRet ret;
+
+	rsslClearRefreshMsg(&refreshMsg);
+	refreshMsg.msgBase.domainType = pItem->key.domainType;
+	refreshMsg.msgBase.streamId = pRequestMsg->msgBase.streamId;
+	refreshMsg.msgBase.containerType = (dataType == RSSL_DT_UNKNOWN) ? RSSL_DT_NO_DATA : dataType;
+	refreshMsg.flags = RSSL_RFMF_SOLICITED | RSSL_RFMF_HAS_MSG_KEY;
+
+	if (!pItemCache->isRefreshStarted)
+		refreshMsg.flags |= RSSL_RFMF_CLEAR_CACHE;
+
+	if (pItem->hasQos)
+	{
+		refreshMsg.flags |= RSSL_RFMF_HAS_QOS;
+		refreshMsg.qos = pItem->qos;
+	}
+
+	refreshMsg.msgBase.msgKey.flags = pRequestMsg->msgBase.msgKey.flags & (RSSL_MKF_HAS_SERVICE_ID | RSSL_MKF_HAS_NAME | RSSL_MKF_HAS_NAME_TYPE);
+	refreshMsg.msgBase.msgKey.serviceId = pRequestMsg->msgBase.msgKey.serviceId;
+	refreshMsg.msgBase.msgKey.name = pRequestMsg->msgBase.msgKey.name;
+	refreshMsg.msgBase.msgKey.nameType = pRequestMsg->msgBase.msgKey.nameType;
+
+	refreshMsg.state = pItem->state;
+	if (!(pRequestMsg->flags & RSSL_RQMF_STREAMING))
+		refreshMsg.state.streamState = RSSL_STREAM_NON_STREAMING;
+
+	*pIsComplete = RSSL_FALSE;
+
+	if (refreshMsg.msgBase.containerType == RSSL_DT_NO_DATA)
+	{
+		refreshMsg.flags |= RSSL_RFMF_REFRESH_COMPLETE;
+		if ((ret = rsslEncodeMsg(pIter, (RsslMsg*)&refreshMsg)) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, "Failed to encode cached refresh: %d", ret);
+			return ret;
+		}
+
+		*pIsComplete = RSSL_TRUE;
+		pItemCache->isRefreshStarted = RSSL_TRUE;
+		return RSSL_RET_SUCCESS;
+	}
+
+	if ((ret = rsslEncodeMsgInit(pIter, (RsslMsg*)&refreshMsg, 0)) != RSSL_RET_ENCODE_CONTAINER)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, "Failed to encode cached refresh: %d", ret);
+		return ret;
+	}
+
+	if ((ret = rsslPayloadEntryRetrieve(pItem->entryHandle, pIter, pItemCache->cursorHandle, &pItemCache->cacheError)) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, "Failed to retrieve cached refresh: %s",
+				pItemCache->cacheError.text);
+		return ret;
+	}
+
+	if (rsslPayloadCursorIsComplete(pItemCache->cursorHandle))
+	{
+		if ((ret = rsslSetRefreshCompleteFlag(pIter)) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, "Failed to set refresh complete flag: %d", ret);
+			return ret;
+		}
+		*pIsComplete = RSSL_TRUE;
+	}
+
+	if ((ret = rsslEncodeMsgComplete(pIter, RSSL_TRUE)) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, "Failed to complete cached refresh: %d", ret);
+		return ret;
+	}
+
+	pItemCache->isRefreshStarted = RSSL_TRUE;
+	return RSSL_RET_SUCCESS;
+}
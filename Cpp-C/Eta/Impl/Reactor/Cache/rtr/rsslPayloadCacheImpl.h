@@ -0,0 +1,140 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef RSSL_PAYLOAD_CACHE_IMPL_H
+#define RSSL_PAYLOAD_CACHE_IMPL_H
+
+#include "rtr/rsslPayloadCache.h"
+#include "rtr/rsslPayloadEntry.h"
+#include "rtr/rsslPayloadCursor.h"
+#include "rtr/rsslQueue.h"
+#include "rtr/rsslHashTable.h"
+#include "rtr/rsslThread.h"
+#include "rtr/rsslDataPackage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* In-tree implementation of the value-add payload cache.
+ *
+ * FieldList payloads are held as an array of fields in the order they were received, with an
+ * open-addressed index from field ID to position so that updates are applied in place.
+ * Map payloads are held as an array of entries with a hash table from the encoded key to the
+ * entry, so that adds, updates and deletes by key (e.g. order ID) do not search the map.
+ * Storage is kept when an entry or container is cleared, so that a refresh following a
+ * CLEAR_CACHE reuses the allocations of the previous image.
+ *
+ * Only FieldList and Map (with any payload container) are cached. Set-defined data is not supported.
+ *
+ * Payload entries are not locked; an application applying to and retrieving from the same entry
+ * on different threads must serialize those calls itself. */
+
+/* A dictionary registered with one or more caches. Caches sharing a dictionary key share one record. */
+typedef struct
+{
+	RsslQueueLink				qlDictionaries;	/* Link in the global list of shared dictionaries. */
+	char						*key;			/* Dictionary key, or NULL if the dictionary is private to one cache. */
+	const RsslDataDictionary	*pDictionary;	/* The dictionary. */
+	RsslUInt32					refCount;		/* Number of caches using this record. */
+} RsslPayloadCacheDictionary;
+
+typedef struct
+{
+	RsslQueueLink				qlCaches;		/* Link in the global list of caches. */
+	RsslMutex					entryLock;		/* Protects entryList. */
+	RsslQueue					entryList;		/* Entries created in this cache. */
+	RsslUInt					maxItems;		/* Limit on the number of entries, or zero for no limit. */
+	RsslPayloadCacheDictionary	*pDictionary;	/* Dictionary used by this cache, if set. */
+} RsslPayloadCacheImpl;
+
+/* A field of a cached field list. The encoded field data is stored as received. */
+typedef struct
+{
+	RsslFieldId		fieldId;
+	RsslBuffer		data;			/* Encoded data. A length of zero indicates blank. */
+	RsslUInt32		capacity;		/* Allocated size of data. */
+} RsslCacheField;
+
+typedef struct
+{
+	RsslUInt8		flags;			/* RSSL_FLF_HAS_FIELD_LIST_INFO if the info is present. */
+	RsslInt16		dictionaryId;
+	RsslInt16		fieldListNum;
+	RsslCacheField	*fields;		/* Fields, in the order they were added. */
+	RsslUInt32		fieldCount;		/* Number of fields in use. Fields beyond this keep their storage for reuse. */
+	RsslUInt32		fieldCapacity;	/* Number of fields allocated. */
+	RsslUInt32		*fidIndex;		/* Open-addressed index of field ID to position + 1 (0 indicates an empty slot). */
+	RsslUInt32		fidIndexMask;	/* Size of fidIndex - 1; fidIndex size is a power of two. */
+} RsslCacheFieldList;
+
+typedef struct
+{
+	RsslHashLink		hlEntry;		/* Link in the map's entry table, keyed by encKey. */
+	RsslUInt32			position;		/* Position in the map's entry array. */
+	RsslBuffer			encKey;
+	RsslUInt32			keyCapacity;
+	RsslBool			hasPermData;
+	RsslBuffer			permData;
+	RsslUInt32			permCapacity;
+	RsslCacheFieldList	fieldList;		/* Payload, when the map contains field lists. */
+	RsslBuffer			encData;		/* Payload, for other container types. */
+	RsslUInt32			encDataCapacity;
+} RsslCacheMapEntry;
+
+typedef struct
+{
+	RsslUInt16			flags;			/* RSSL_MPF_HAS_KEY_FIELD_ID and RSSL_MPF_HAS_TOTAL_COUNT_HINT, if present. */
+	RsslUInt8			keyPrimitiveType;
+	RsslContainerType	containerType;
+	RsslFieldId			keyFieldId;
+	RsslUInt32			totalCountHint;
+	RsslBool			hasSummaryData;
+	RsslCacheFieldList	summaryFieldList;	/* Summary data, when the map contains field lists. */
+	RsslBuffer			summaryData;		/* Summary data, for other container types. */
+	RsslUInt32			summaryCapacity;
+	RsslHashTable		entryTable;		/* Table of entries by encoded key. */
+	RsslCacheMapEntry	**entries;		/* Entries in use, followed by cleared entries kept for reuse. */
+	RsslUInt32			entryCount;		/* Number of entries in use. */
+	RsslUInt32			entryAllocCount;/* Number of entries allocated (in use or kept for reuse). */
+	RsslUInt32			entryCapacity;	/* Size of the entries array. */
+} RsslCacheMap;
+
+typedef struct
+{
+	RsslQueueLink			qlEntries;	/* Link in the owning cache's entry list. */
+	RsslPayloadCacheImpl	*pCache;
+	RsslContainerType		dataType;	/* RSSL_DT_UNKNOWN when empty. */
+	RsslCacheFieldList		fieldList;
+	RsslCacheMap			*pMap;		/* Created on first use. */
+} RsslPayloadEntryImpl;
+
+typedef struct
+{
+	RsslUInt32	position;	/* Next map entry to retrieve. */
+	RsslBool	isStarted;	/* Whether the first part has been retrieved. */
+	RsslBool	isComplete;	/* Whether the final part has been retrieved. */
+} RsslPayloadCursorImpl;
+
+/* Populates an RsslCacheError. */
+void rsslCacheSetError(RsslCacheError *pError, RsslRet errorId, const char *format, ...);
+
+/* Returns the dictionary used by a cache, if any. */
+const RsslDataDictionary *rsslPayloadCacheGetDictionary(RsslPayloadCacheImpl *pCache);
+
+/* Removes an entry from its cache. Called when the entry is destroyed. */
+void rsslPayloadCacheRemoveEntry(RsslPayloadCacheImpl *pCache, RsslPayloadEntryImpl *pEntry);
+
+/* Frees the storage of an entry. Used when the entry's cache is destroyed. */
+void rsslPayloadEntryFree(RsslPayloadEntryImpl *pEntry);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,127 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef RSSL_REACTOR_ITEM_CACHE_H
+#define RSSL_REACTOR_ITEM_CACHE_H
+
+#include "rtr/rsslPayloadCache.h"
+#include "rtr/rsslPayloadEntry.h"
+#include "rtr/rsslPayloadCursor.h"
+#include "rtr/rsslErrorInfo.h"
+#include "rtr/rsslQueue.h"
+#include "rtr/rsslHashTable.h"
+#include "rtr/rsslDataPackage.h"
+#include "rtr/rsslMsgDecoders.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Provider item cache.
+ *
+ * When enabled on the reactor, the payload of every refresh and update an interactive provider
+ * submits for a streaming item is applied to a payload cache entry for that item. Items are keyed by
+ * domain, service ID and name, so a request for an item that has already been published (on any
+ * channel of the reactor) can be answered with a refresh retrieved from the cache, without calling
+ * the application to produce it.
+ *
+ * Each item is published by one stream, its owner, which is the first stream the application
+ * refreshed. Messages submitted on other streams for the same item are sent as usual but not applied,
+ * since they carry the same data. When the owner stream closes, the next open stream for the item
+ * becomes the owner. The item is removed when its last stream closes.
+ *
+ * Only items with a key of service ID and name (and optionally name type) are cached; requests with
+ * attribs, views, batches or the private stream flag are always passed to the application. */
+
+typedef struct
+{
+	RsslUInt8	domainType;
+	RsslUInt16	serviceId;
+	RsslUInt8	nameType;
+	RsslBuffer	name;
+} RsslReactorCachedItemKey;
+
+typedef struct _RsslReactorCachedStream RsslReactorCachedStream;
+
+typedef struct
+{
+	RsslHashLink				hlItem;				/* Link in the item table. */
+	RsslReactorCachedItemKey	key;				/* Item key. The name is owned by the item. */
+	RsslQueue					streamList;			/* Open streams for this item. */
+	RsslReactorCachedStream		*pOwnerStream;		/* Stream whose messages are applied to the cache. */
+	RsslPayloadEntryHandle		entryHandle;		/* Cached payload. */
+	RsslBool					isRefreshComplete;	/* Whether a complete refresh has been applied. */
+	RsslState					state;				/* State from the last refresh or status (without text). */
+	RsslBool					hasQos;
+	RsslQos						qos;
+} RsslReactorCachedItem;
+
+typedef struct
+{
+	void		*pChannel;
+	RsslInt32	streamId;
+} RsslReactorCachedStreamKey;
+
+struct _RsslReactorCachedStream
+{
+	RsslHashLink				hlStream;	/* Link in the stream table. */
+	RsslQueueLink				qlItem;		/* Link in the item's stream list. */
+	RsslReactorCachedStreamKey	key;
+	RsslReactorCachedItem		*pItem;
+};
+
+typedef struct
+{
+	RsslPayloadCacheHandle	cacheHandle;
+	RsslPayloadCursorHandle	cursorHandle;	/* Used for retrieving cached refreshes. */
+	RsslHashTable			itemTable;		/* Items, by RsslReactorCachedItemKey. */
+	RsslHashTable			streamTable;	/* Streams, by RsslReactorCachedStreamKey. */
+	RsslCacheError			cacheError;
+	RsslBool				isRefreshStarted;	/* Whether the first part of the current cached refresh was encoded. */
+	RsslBool				isSendingRefresh;	/* Set while a cached refresh is being sent, so that it is not applied again. */
+} RsslReactorItemCache;
+
+/* Creates the item cache. The dictionary, if given, is used to validate field list data. */
+RsslReactorItemCache *rsslReactorItemCacheCreate(RsslDataDictionary *pDictionary, RsslErrorInfo *pError);
+
+/* Destroys the item cache. */
+void rsslReactorItemCacheDestroy(RsslReactorItemCache *pItemCache);
+
+/* Processes a request received on a provider channel. The stream is associated with the item if the request
+ * is streaming. If the item can be refreshed from the cache, it is returned in ppItem; otherwise ppItem is
+ * set to NULL and the application is expected to provide the refresh. */
+RsslRet rsslReactorItemCacheProcessRequest(RsslReactorItemCache *pItemCache, void *pChannel,
+		RsslRequestMsg *pRequestMsg, RsslReactorCachedItem **ppItem, RsslErrorInfo *pError);
+
+/* Processes a close received on a provider channel. */
+void rsslReactorItemCacheProcessClose(RsslReactorItemCache *pItemCache, void *pChannel, RsslInt32 streamId);
+
+/* Processes an encoded message the application is submitting on a provider channel. Refreshes, updates and
+ * statuses on item streams are applied to the cache. Applying the same message again (e.g. when the
+ * application resubmits a buffer after RSSL_RET_WRITE_CALL_AGAIN) leaves the cache unchanged. */
+RsslRet rsslReactorItemCacheProcessSubmit(RsslReactorItemCache *pItemCache, void *pChannel,
+		RsslBuffer *pMsgBuffer, RsslUInt8 majorVersion, RsslUInt8 minorVersion, RsslErrorInfo *pError);
+
+/* Removes all streams of a channel, e.g. when the channel goes down. */
+void rsslReactorItemCacheRemoveChannel(RsslReactorItemCache *pItemCache, void *pChannel);
+
+/* Starts and ends sending a refresh from the cache. Submitted messages are not applied in between. */
+void rsslReactorItemCacheStartRefresh(RsslReactorItemCache *pItemCache);
+void rsslReactorItemCacheEndRefresh(RsslReactorItemCache *pItemCache);
+
+/* Encodes the next part of a refresh from the cache, in response to the given request. pIsComplete is set
+ * when the final part has been encoded. RSSL_RET_BUFFER_TOO_SMALL indicates the part did not fit, and may be
+ * encoded again into a larger buffer. */
+RsslRet rsslReactorItemCacheEncodeRefresh(RsslReactorItemCache *pItemCache, RsslReactorCachedItem *pItem,
+		RsslRequestMsg *pRequestMsg, RsslEncodeIterator *pIter, RsslBool *pIsComplete, RsslErrorInfo *pError);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
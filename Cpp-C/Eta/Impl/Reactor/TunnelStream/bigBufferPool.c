@@ -12,12 +12,20 @@
 
 static TunnelBufferImpl* createBigBuffer(RsslUInt bufferSize, RsslUInt userSize, RsslUInt8 poolIndex);
 
-void bigBufferPoolInit(BigBufferPool *pBigBufferPool, RsslUInt fragmentSize, RsslUInt numBuffers)
+/* Size of the TunnelBufferImpl header of a slab entry, rounded up so the data that follows stays aligned. */
+#define BIG_BUFFER_SLAB_HEADER_SIZE ((sizeof(TunnelBufferImpl) + 7) & ~(size_t)7)
+
+RsslRet bigBufferPoolInit(BigBufferPool *pBigBufferPool, RsslUInt fragmentSize, RsslUInt numBuffers,
+		RsslUInt reservedBuffers, RsslErrorInfo *pErrorInfo)
 {
 	int i;
+	RsslUInt j;
+	size_t entrySize;
 
 	pBigBufferPool->_maxPool = 0;
 	pBigBufferPool->_currentNumBuffers = 0;
+	pBigBufferPool->_pSlab = NULL;
+	pBigBufferPool->_slabLength = 0;
 
     // this pool should be created after the tunnel stream fragment size is known
     pBigBufferPool->_fragmentSize = fragmentSize;
@@ -28,6 +36,38 @@ void bigBufferPoolInit(BigBufferPool *pBigBufferPool, RsslUInt fragmentSize, Rss
 	{
 		rsslInitQueue(&pBigBufferPool->_pools[i]);
 	}
+
+	if (reservedBuffers > numBuffers)
+		reservedBuffers = numBuffers;
+
+	if (reservedBuffers == 0)
+		return RSSL_RET_SUCCESS;
+
+	/* Reserve buffers of the first pool size as one slab, so that large messages
+	 * do not go to the heap while the window is filling. */
+	entrySize = BIG_BUFFER_SLAB_HEADER_SIZE + (size_t)pBigBufferPool->_maxSize;
+	if ((pBigBufferPool->_pSlab = (char*)malloc(entrySize * reservedBuffers)) == NULL)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, 
+			RSSL_RET_FAILURE, __FILE__, __LINE__, "Unable to allocate big buffer slab for tunnel stream.");
+		return RSSL_RET_FAILURE;
+	}
+	pBigBufferPool->_slabLength = entrySize * reservedBuffers;
+
+	for (j = 0; j < reservedBuffers; j++)
+	{
+		TunnelBufferImpl *pTSBuffer = (TunnelBufferImpl *)(pBigBufferPool->_pSlab + entrySize * j);
+
+		tunnelBufferImplClear(pTSBuffer);
+		pTSBuffer->_isBigBuffer = RSSL_TRUE;
+		pTSBuffer->_poolBuffer.buffer.data = (char*)pTSBuffer + BIG_BUFFER_SLAB_HEADER_SIZE;
+		pTSBuffer->_startPos = pTSBuffer->_poolBuffer.buffer.data;
+		pTSBuffer->_bigBufferPoolIndex = 0;
+
+		rsslQueueAddLinkToBack(&pBigBufferPool->_pools[0], &pTSBuffer->_tbpLink);
+	}
+
+	return RSSL_RET_SUCCESS;
 }
 
 PoolBuffer* bigBufferPoolGet(BigBufferPool *pBigBufferPool, RsslUInt32 size, RsslErrorInfo *pErrorInfo)
@@ -88,6 +128,7 @@ PoolBuffer* bigBufferPoolGet(BigBufferPool *pBigBufferPool, RsslUInt32 size, Rss
 			pBuffer = createBigBuffer(poolSize, size, poolIndex);
 			if (pBuffer == NULL)
 			{
+				pBigBufferPool->_currentNumBuffers--;
 				rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, 
 					RSSL_RET_FAILURE, __FILE__, __LINE__, "Unable to allocate big buffer for tunnel stream.");
 			}
@@ -152,11 +193,20 @@ void bigBufferPoolCleanup(BigBufferPool *pBigBufferPool)
 		while((pQueueLink = rsslQueueRemoveFirstLink(&pBigBufferPool->_pools[i])) != NULL)
 		{
 			TunnelBufferImpl *pBufferImpl = RSSL_QUEUE_LINK_TO_OBJECT(TunnelBufferImpl, _tbpLink, pQueueLink);
-			if (pBufferImpl != NULL)
+			if (pBufferImpl != NULL
+					&& ((char*)pBufferImpl < pBigBufferPool->_pSlab
+						|| (char*)pBufferImpl >= pBigBufferPool->_pSlab + pBigBufferPool->_slabLength))
 			{
 				free(pBufferImpl->_startPos);
 				free(pBufferImpl);
 			}
 		}
 	}
+
+	if (pBigBufferPool->_pSlab != NULL)
+	{
+		free(pBigBufferPool->_pSlab);
+		pBigBufferPool->_pSlab = NULL;
+		pBigBufferPool->_slabLength = 0;
+	}
 }
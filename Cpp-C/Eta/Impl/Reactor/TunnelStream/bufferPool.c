@@ -19,15 +19,38 @@ struct SliceableBuffer
 	RsslQueue		*_pParentQueue;
 };
 
+/* Size of each SliceableBuffer, including its data.
+ * Add 7 in case decoders try to bytewswap it (the leftover bytes will be correctly discarded).
+ * Rounded up so that buffers carved from the slab stay aligned. */
+static size_t _bufferPoolEntrySize(BufferPool *pBufferPool)
+{
+	return (sizeof(SliceableBuffer) + pBufferPool->_maxFragmentSize + 7 + 7) & ~(size_t)7;
+}
+
+/* Returns whether the buffer was carved from the pool's slab (and so must not be freed on its own). */
+static RsslBool _bufferPoolIsSlabBuffer(BufferPool *pBufferPool, SliceableBuffer *pSliceableBuffer)
+{
+	return (pBufferPool->_pSlab != NULL && (char*)pSliceableBuffer >= pBufferPool->_pSlab
+			&& (char*)pSliceableBuffer < pBufferPool->_pSlab + pBufferPool->_slabLength);
+}
+
+static void _bufferPoolFreeSliceableBuffer(BufferPool *pBufferPool, SliceableBuffer *pSliceableBuffer)
+{
+	if (!_bufferPoolIsSlabBuffer(pBufferPool, pSliceableBuffer))
+		free(pSliceableBuffer);
+}
+
 static SliceableBuffer* _bufferPoolAddSliceableBuffer(BufferPool *pBufferPool,
 		RsslErrorInfo *pErrorInfo)
 {
-	/* Add 7 in case decoders try to bytewswap it (the leftover bytes will be correctly discarded). */
-	SliceableBuffer *pSliceableBuffer = (SliceableBuffer*)malloc(sizeof(SliceableBuffer) + pBufferPool->_maxFragmentSize + 7);
+	SliceableBuffer *pSliceableBuffer = (SliceableBuffer*)malloc(_bufferPoolEntrySize(pBufferPool));
 
 	if (pSliceableBuffer == NULL)
+	{
 		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
 				__FILE__, __LINE__, "Failed to allocate buffer for pool.");
+		return NULL;
+	}
 
 	memset(pSliceableBuffer, 0, sizeof(SliceableBuffer));
 	pSliceableBuffer->_pCurPos = pSliceableBuffer->_pData = (char*)pSliceableBuffer + sizeof(SliceableBuffer);
@@ -41,6 +64,7 @@ RsslRet initBufferPool(BufferPool *pBufferPool,
 		RsslErrorInfo *pErrorInfo)
 {
 	RsslUInt32 i;
+	size_t entrySize;
 
 	rsslInitQueue(&pBufferPool->_bufferPool);
 	rsslInitQueue(&pBufferPool->_appBuffers);
@@ -48,16 +72,29 @@ RsslRet initBufferPool(BufferPool *pBufferPool,
 
 	pBufferPool->_maxFragmentSize = maxFragmentSize;
 	pBufferPool->_appBufferLimit = appBufferLimit;
+	pBufferPool->_pSlab = NULL;
+	pBufferPool->_slabLength = 0;
+
+	if (bufferCount == 0)
+		return RSSL_RET_SUCCESS;
+
+	/* Reserve the initial buffers as one contiguous slab, so that the send history
+	 * does not need to go to the heap while the window is filling. */
+	entrySize = _bufferPoolEntrySize(pBufferPool);
+	if ((pBufferPool->_pSlab = (char*)malloc(entrySize * bufferCount)) == NULL)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, 
+				__FILE__, __LINE__, "Failed to allocate buffer slab for pool.");
+		return RSSL_RET_FAILURE;
+	}
+	pBufferPool->_slabLength = entrySize * bufferCount;
 
 	for(i = 0; i < bufferCount; ++i)
 	{
-		SliceableBuffer *pSliceableBuffer;
-		if ((pSliceableBuffer = _bufferPoolAddSliceableBuffer(pBufferPool, pErrorInfo))
-			   	== NULL)
-		{
-			bufferPoolCleanup(pBufferPool);
-			return RSSL_RET_FAILURE;
-		}
+		SliceableBuffer *pSliceableBuffer = (SliceableBuffer*)(pBufferPool->_pSlab + entrySize * i);
+
+		memset(pSliceableBuffer, 0, sizeof(SliceableBuffer));
+		pSliceableBuffer->_pCurPos = pSliceableBuffer->_pData = (char*)pSliceableBuffer + sizeof(SliceableBuffer);
 
 		rsslQueueAddLinkToBack(&pBufferPool->_bufferPool,
 				&pSliceableBuffer->_qLink);
@@ -161,7 +198,7 @@ void bufferPoolCleanup(BufferPool *pBufferPool)
 	{
 		SliceableBuffer *pSliceableBuffer =
 			RSSL_QUEUE_LINK_TO_OBJECT(SliceableBuffer, _qLink, pLink);
-		free(pSliceableBuffer);
+		_bufferPoolFreeSliceableBuffer(pBufferPool, pSliceableBuffer);
 	}
 
 	while ((pLink = rsslQueueRemoveFirstLink(&pBufferPool->_appBuffers)) 
@@ -169,7 +206,7 @@ void bufferPoolCleanup(BufferPool *pBufferPool)
 	{
 		SliceableBuffer *pSliceableBuffer =
 			RSSL_QUEUE_LINK_TO_OBJECT(SliceableBuffer, _qLink, pLink);
-		free(pSliceableBuffer);
+		_bufferPoolFreeSliceableBuffer(pBufferPool, pSliceableBuffer);
 	}
 
 	while ((pLink = rsslQueueRemoveFirstLink(&pBufferPool->_intBuffers)) 
@@ -177,7 +214,14 @@ void bufferPoolCleanup(BufferPool *pBufferPool)
 	{
 		SliceableBuffer *pSliceableBuffer =
 			RSSL_QUEUE_LINK_TO_OBJECT(SliceableBuffer, _qLink, pLink);
-		free(pSliceableBuffer);
+		_bufferPoolFreeSliceableBuffer(pBufferPool, pSliceableBuffer);
+	}
+
+	if (pBufferPool->_pSlab != NULL)
+	{
+		free(pBufferPool->_pSlab);
+		pBufferPool->_pSlab = NULL;
+		pBufferPool->_slabLength = 0;
 	}
 
 	pBufferPool->_maxFragmentSize = 0;
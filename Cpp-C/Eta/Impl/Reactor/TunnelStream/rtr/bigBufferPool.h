@@ -13,8 +13,10 @@
 #include "rtr/rsslErrorInfo.h"
 #include "rtr/tunnelStreamImpl.h"
 
-/* Initializes the big buffer pool. */
-void bigBufferPoolInit(BigBufferPool *pBigBufferPool, RsslUInt fragmentSize, RsslUInt numBuffers);
+/* Initializes the big buffer pool. reservedBuffers buffers of the smallest size are
+ * pre-allocated as a single slab. */
+RsslRet bigBufferPoolInit(BigBufferPool *pBigBufferPool, RsslUInt fragmentSize, RsslUInt numBuffers,
+		RsslUInt reservedBuffers, RsslErrorInfo *pErrorInfo);
 
 /* Gets a big buffer from the pool. */
 PoolBuffer* bigBufferPoolGet(BigBufferPool *pBigBufferPool, RsslUInt32 size, RsslErrorInfo *pErrorInfo);
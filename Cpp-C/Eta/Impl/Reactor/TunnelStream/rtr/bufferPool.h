@@ -21,6 +21,8 @@ typedef struct
 	RsslQueue			_appBuffers;
 	RsslQueue			_intBuffers;
 	RsslUInt32			_appBufferLimit;
+	char				*_pSlab;				/* Contiguous storage for the buffers reserved at init. */
+	size_t				_slabLength;
 } BufferPool;
 
 typedef struct
@@ -31,7 +33,7 @@ typedef struct
 	SliceableBuffer*	_pSliceableBuffer;
 } PoolBuffer;
 
-/* Initializes the buffer pool. */
+/* Initializes the buffer pool. The initial bufferCount buffers are reserved as a single slab. */
 RsslRet initBufferPool(BufferPool *pBufferPool,
 		RsslUInt32 bufferCount,
 		RsslUInt32 maxFragmentSize,
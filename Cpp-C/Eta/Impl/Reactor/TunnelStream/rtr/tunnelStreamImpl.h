@@ -27,6 +27,8 @@ extern "C" {
 
 #define NUM_POOLS 32
 
+#define TS_MAX_RESERVED_WINDOW_SIZE (16 * 1024 * 1024) /* Largest flow control window that buffers are pre-reserved for. */
+
 typedef struct
 {
 	RsslQueue _pools[NUM_POOLS];
@@ -35,6 +37,8 @@ typedef struct
 	RsslUInt _fragmentSize;
 	RsslUInt _maxNumBuffers;
 	RsslUInt _currentNumBuffers;
+	char *_pSlab;			/* Contiguous storage for the buffers reserved at init. */
+	RsslUInt _slabLength;
 } BigBufferPool;
 
 typedef enum
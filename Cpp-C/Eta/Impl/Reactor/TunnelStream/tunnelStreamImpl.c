@@ -2960,14 +2960,43 @@ void tunnelStreamReleaseBuffer(
 static RsslRet _tunnelStreamHandleEstablished(TunnelStreamImpl *pTunnelImpl, RsslErrorInfo *pErrorInfo)
 {
 	RsslClassOfService *pCos = &pTunnelImpl->base.classOfService;
+	RsslUInt32 bufferCount = pTunnelImpl->_guaranteedOutputBuffersAppLimit;
+	RsslUInt bigBufferCount = 0;
+	RsslInt64 windowSize = 0;
+
+	/* Size the reserved buffers from the negotiated window, so that a full window
+	 * of messages (sent, or being reassembled) can be held without allocating. */
+	if (pCos->flowControl.type != RDM_COS_FC_NONE)
+	{
+		windowSize = pCos->flowControl.sendWindowSize;
+		if (pCos->flowControl.recvWindowSize > windowSize)
+			windowSize = pCos->flowControl.recvWindowSize;
+		if (windowSize > TS_MAX_RESERVED_WINDOW_SIZE)
+			windowSize = TS_MAX_RESERVED_WINDOW_SIZE;
+	}
+
+	if (windowSize > 0)
+	{
+		RsslUInt32 windowBufferCount = (RsslUInt32)(windowSize / (pCos->common.maxFragmentSize + TS_HEADER_MAX_LENGTH)) + 1;
+
+		if (windowBufferCount > bufferCount)
+			bufferCount = windowBufferCount;
+
+		bigBufferCount = (RsslUInt)windowSize / (pCos->common.maxFragmentSize * 2);
+	}
 
 	if (initBufferPool(&pTunnelImpl->_memoryBufferPool,
-		pTunnelImpl->_guaranteedOutputBuffersAppLimit,
+		bufferCount,
 		(RsslUInt32)pCos->common.maxFragmentSize + TS_HEADER_MAX_LENGTH, pTunnelImpl->_guaranteedOutputBuffersAppLimit, pErrorInfo)
 		!= RSSL_RET_SUCCESS)
 		return RSSL_RET_FAILURE;
 
-	bigBufferPoolInit(&pTunnelImpl->_bigBufferPool, pCos->common.maxFragmentSize, pTunnelImpl->_guaranteedOutputBuffersAppLimit);
+	if (bigBufferPoolInit(&pTunnelImpl->_bigBufferPool, pCos->common.maxFragmentSize, pTunnelImpl->_guaranteedOutputBuffersAppLimit,
+				bigBufferCount, pErrorInfo) != RSSL_RET_SUCCESS)
+	{
+		bufferPoolCleanup(&pTunnelImpl->_memoryBufferPool);
+		return RSSL_RET_FAILURE;
+	}
 
 	return RSSL_RET_SUCCESS;
 }
@@ -58,6 +58,27 @@ RTR_C_INLINE RsslInt64 getCurrentTimeMs(RsslInt64 ticksPerMsec)
 	return timeMs;
 }
 
+/* Gets the current time in microseconds. ticksPerMsec is used only on windows. */
+RTR_C_INLINE RsslInt64 getCurrentTimeUs(RsslInt64 ticksPerMsec)
+{
+	RsslInt64 timeUs;
+#ifdef WIN32
+	LARGE_INTEGER	queryTime;
+
+	QueryPerformanceCounter(&queryTime);
+	timeUs = (RsslInt64)((double)queryTime.QuadPart * 1000 / ticksPerMsec);
+#else
+	struct timeval currentTime;
+
+	gettimeofday(&currentTime, NULL);
+
+	timeUs = currentTime.tv_sec;
+	timeUs *= 1000000;
+	timeUs += currentTime.tv_usec;
+#endif
+	return timeUs;
+}
+
 /* Estimates the encoded length of an RsslMsg.  */
 RTR_C_INLINE RsslUInt32 rsslGetEstimatedEncodedLength(RsslMsg *pRsslMsg)
 {
@@ -44,6 +44,7 @@ RsslWatchlist *rsslWatchlistCreate(RsslWatchlistCreateOptions *pCreateOptions,
 	baseInitOpts.ticksPerMsec = pCreateOptions->ticksPerMsec;
 	baseInitOpts.maxOutstandingPosts = pCreateOptions->maxOutstandingPosts;
 	baseInitOpts.postAckTimeout = pCreateOptions->postAckTimeout;
+	baseInitOpts.coalesceItemRequests = pCreateOptions->coalesceItemRequests;
 
 	if ((ret = wlBaseInit(&pWatchlistImpl->base, &baseInitOpts, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
@@ -66,6 +67,22 @@ RsslWatchlist *rsslWatchlistCreate(RsslWatchlistCreateOptions *pCreateOptions,
 	rsslInitQueue(&pWatchlistImpl->directory.openDirectoryRequests);
 	rsslInitQueue(&pWatchlistImpl->services);
 
+	if (pCreateOptions->itemSnapshotFile)
+	{
+		WlItemSnapshotOpenOptions snapshotOpts;
+
+		wlItemSnapshotOpenOptionsClear(&snapshotOpts);
+		snapshotOpts.filename = pCreateOptions->itemSnapshotFile;
+		if (pCreateOptions->itemCountHint > snapshotOpts.recordCount)
+			snapshotOpts.recordCount = pCreateOptions->itemCountHint;
+
+		if (!(pWatchlistImpl->items.pItemSnapshot = wlItemSnapshotOpen(&snapshotOpts, pErrorInfo)))
+		{
+			rsslWatchlistDestroy((RsslWatchlist*)pWatchlistImpl);
+			return NULL;
+		}
+	}
+
 	return (RsslWatchlist*)pWatchlistImpl;
 }
 
@@ -92,6 +109,9 @@ RsslRet rsslWatchlistSetChannel(RsslWatchlist *pWatchlist, RsslChannel *pChannel
 		if (pWatchlistImpl->directory.pStream)
 			wlUnsetStreamPendingResponse(&pWatchlistImpl->base, &pWatchlistImpl->directory.pStream->base);
 
+		/* Batch requests will not be answered on a new channel. */
+		wlBaseClearBatchStreams(&pWatchlistImpl->base);
+
 		return wlRecoverAllItems(pWatchlistImpl, pErrorInfo);
 	}
 
@@ -289,6 +309,19 @@ RsslRet rsslWatchlistDispatch(RsslWatchlist *pWatchlist, RsslInt64 currentTime,
 					rsslQueueAddLinkToBack(&pItemRequest->pRequestedService->recoveringList, 
 							&pItemRequest->base.qlStateQueue);
 
+					if (pWatchlistImpl->items.pItemSnapshot)
+					{
+						RsslBool requestClosed;
+
+						if ((ret = wlItemRequestSendSnapshotImage(pWatchlistImpl, pItemRequest,
+										&requestClosed, pErrorInfo)) != RSSL_RET_SUCCESS)
+							return ret;
+
+						/* Application closed the request when given the image. */
+						if (requestClosed)
+							break;
+					}
+
 					if ((ret = wlItemRequestFindStream(&pWatchlistImpl->base, &pWatchlistImpl->items, 
 									pItemRequest, pErrorInfo, RSSL_TRUE)) != RSSL_RET_SUCCESS)
 						return ret;
@@ -444,8 +477,17 @@ RsslRet rsslWatchlistDispatch(RsslWatchlist *pWatchlist, RsslInt64 currentTime,
 	{
 		WlStream *pStream = RSSL_QUEUE_LINK_TO_OBJECT(WlStream,
 				base.qlStreamsPendingRequest, pLink);
-		if ((ret = wlStreamSubmitMsg(pWatchlistImpl, pStream,
-						pErrorInfo)) < RSSL_RET_SUCCESS)
+		RsslBool sent = RSSL_FALSE;
+
+		if (wlStreamCanBatch(pWatchlistImpl, pStream))
+			ret = wlStreamSubmitBatch(pWatchlistImpl, pStream, &sent, pErrorInfo);
+		else
+			ret = RSSL_RET_SUCCESS;
+
+		if (ret >= RSSL_RET_SUCCESS && !sent)
+			ret = wlStreamSubmitMsg(pWatchlistImpl, pStream, pErrorInfo);
+
+		if (ret < RSSL_RET_SUCCESS)
 		{
 			switch(ret)
 			{
@@ -1205,6 +1247,7 @@ RsslRet rsslWatchlistReadMsg(RsslWatchlist *pWatchlist,
 				pStreamBase->domainType = pOptions->pRsslMsg->msgBase.domainType;
 				pStreamBase->isClosing = RSSL_TRUE;
 				pStreamBase->tempStream = RSSL_TRUE;
+				pStreamBase->isBatchStream = RSSL_FALSE;
 				pStreamBase->requestState = WL_STRS_NONE;
 
 				wlSetStreamMsgPending(&pWatchlistImpl->base, pStreamBase);
@@ -1215,11 +1258,26 @@ RsslRet rsslWatchlistReadMsg(RsslWatchlist *pWatchlist,
 				|| pWatchlistImpl->base.newRequests.count) ? 1 : RSSL_RET_SUCCESS;
 	}
 
+	if (pStream->base.isBatchStream)
+	{
+		/* Response to a batch request sent by the watchlist. The items of the batch
+		 * are answered on their own streams, so nothing is forwarded. Once the batch
+		 * stream is closed (normally right away), its ID can be released. */
+		const RsslState *pState = rsslGetState(pOptions->pRsslMsg);
+
+		if (!pState || pState->streamState != RSSL_STREAM_OPEN)
+			wlBaseRemoveBatchStream(&pWatchlistImpl->base, &pStream->base);
+
+		return (pWatchlistImpl->base.streamsPendingRequest.count 
+				|| pWatchlistImpl->base.newRequests.count) ? 1 : RSSL_RET_SUCCESS;
+	}
+
 	wlMsgEventClear(&msgEvent);
 	msgEvent.pRsslBuffer = pOptions->pRsslBuffer;
 	msgEvent.pRsslMsg = pOptions->pRsslMsg;
 	msgEvent.pSeqNum = pOptions->pSeqNum;
 	msgEvent.pFTGroupId = pOptions->pFTGroupId;
+	msgEvent.pRecvTimestamp = pOptions->pRecvTimestamp;
 
 	switch(pStream->base.domainType)
 	{
@@ -2169,6 +2227,8 @@ static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStr
 		case RSSL_MC_REFRESH:
 		{
 			RsslRefreshMsg *pRefreshMsg = &pRsslMsg->refreshMsg;
+			RsslBool isRefreshPart = (pItemStream->refreshState == WL_ISRS_PENDING_REFRESH_COMPLETE
+					|| (pRefreshMsg->flags & RSSL_RFMF_HAS_PART_NUM && pRefreshMsg->partNum > 0));
 			pState = &pRefreshMsg->state;
 
 			if (pRefreshMsg->flags & RSSL_RFMF_SOLICITED
@@ -2230,6 +2290,20 @@ static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStr
 			{
 				case RSSL_STREAM_OPEN:
 
+					/* Store complete, single-part images. */
+					if (pWatchlistImpl->items.pItemSnapshot
+							&& pRefreshMsg->flags & RSSL_RFMF_REFRESH_COMPLETE && !isRefreshPart
+							&& pRefreshMsg->state.dataState == RSSL_DATA_OK
+							&& pEvent->pRsslBuffer && pWatchlistImpl->base.pRsslChannel)
+					{
+						WlItemSnapshotKey snapshotKey;
+
+						if (wlItemStreamGetSnapshotKey(pItemStream, &snapshotKey))
+							wlItemSnapshotSave(pWatchlistImpl->items.pItemSnapshot, &snapshotKey,
+									pEvent->pRsslBuffer, pWatchlistImpl->base.pRsslChannel->majorVersion,
+									pWatchlistImpl->base.pRsslChannel->minorVersion);
+					}
+
 					if ((ret = wlItemGroupAddStream(&pWatchlistImpl->items, &pRsslMsg->refreshMsg.groupId, pItemStream,
 									pErrorInfo))
 							!= RSSL_RET_SUCCESS)
@@ -2597,6 +2671,17 @@ static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStr
 	isPrivate = (pItemStream->flags & WL_IOSF_PRIVATE) ? RSSL_TRUE : RSSL_FALSE;
 	qos = pItemStream->streamAttributes.qos;
 
+	/* Item is gone, so its stored image should not be used again. */
+	if (pWatchlistImpl->items.pItemSnapshot && pState->streamState == RSSL_STREAM_CLOSED)
+	{
+		WlItemSnapshotKey snapshotKey;
+		WlItemSnapshotEntry *pEntry;
+
+		if (wlItemStreamGetSnapshotKey(pItemStream, &snapshotKey)
+				&& (pEntry = wlItemSnapshotFind(pWatchlistImpl->items.pItemSnapshot, &snapshotKey)))
+			wlItemSnapshotRemove(pWatchlistImpl->items.pItemSnapshot, pEntry);
+	}
+
 	if (!(pEvent->_flags & WL_MEF_SEND_CLOSE))
 		pItemStream->flags |= WL_IOSF_CLOSED;
 	wlItemStreamClose(&pWatchlistImpl->base, &pWatchlistImpl->items,
@@ -3819,6 +3904,83 @@ static RsslRet wlEncodeAndSubmitMsg(RsslWatchlistImpl *pWatchlistImpl,
 	} while (1);
 }
 
+/* Updates an item stream's state after its request message was sent. */
+static void wlItemStreamCommitRequest(RsslWatchlistImpl *pWatchlistImpl, WlItemStream *pItemStream,
+		RsslRequestMsg *pRequestMsg, RsslBool hasViewFlag, WlAggregateView *pView)
+{
+	if (!(pRequestMsg->flags & RSSL_RQMF_NO_REFRESH))
+	{
+		RsslQueueLink *pLink;
+		RSSL_QUEUE_FOR_EACH_LINK(&pItemStream->requestsRecovering, pLink)
+		{
+			WlRequest *pRequest = RSSL_QUEUE_LINK_TO_OBJECT(WlRequest, base.qlStateQueue, pLink);
+			pRequest->base.pStateQueue = &pItemStream->requestsPendingRefresh;
+		}
+
+		assert(pItemStream->refreshState == WL_ISRS_REQUEST_REFRESH);
+		rsslQueueAppend(&pItemStream->requestsPendingRefresh,
+				&pItemStream->requestsRecovering);
+		pItemStream->refreshState = WL_ISRS_PENDING_REFRESH;
+
+		if (!(pRequestMsg->flags & RSSL_RQMF_STREAMING))
+			pItemStream->flags |= WL_IOSF_PENDING_SNAPSHOT;
+
+		/* Restart buffering. */
+		if (pItemStream->flags & WL_IOSF_HAS_BC_SEQ_NUM)
+		{
+			assert(pItemStream->flags & WL_IOSF_HAS_UC_SEQ_NUM);
+			/* Use the last broadcast sequence number as the
+			 * new starting point instead of the original. */
+			pItemStream->flags &= ~WL_IOSF_HAS_BC_SEQ_NUM;
+		}
+
+		if (pWatchlistImpl->base.pRsslChannel)
+			wlSetStreamPendingResponse(&pWatchlistImpl->base, &pItemStream->base);
+
+	}
+
+	wlUnsetStreamMsgPending(&pWatchlistImpl->base, &pItemStream->base);
+
+	/* If we sent new priority info, commit the change. */
+	pItemStream->flags &= ~WL_IOSF_PENDING_PRIORITY_CHANGE;
+	if (pRequestMsg->flags & RSSL_RQMF_HAS_PRIORITY)
+	{
+		pItemStream->priorityClass = pRequestMsg->priorityClass;
+		pItemStream->priorityCount = pRequestMsg->priorityCount;
+	}
+
+	/* New encDataBody/extendedHeader sent (if it was present). */
+	pItemStream->pRequestWithExtraInfo = NULL;
+
+	if (pWatchlistImpl->base.config.supportViewRequests)
+	{
+		if (pItemStream->flags & WL_IOSF_PENDING_VIEW_CHANGE)
+		{
+			/* Sent the new view, commit changes. */
+			pItemStream->flags &= ~WL_IOSF_PENDING_VIEW_CHANGE;
+
+			if (!(pRequestMsg->flags & RSSL_RQMF_NO_REFRESH))
+				pItemStream->flags |= WL_IOSF_PENDING_VIEW_REFRESH;
+
+			if (pView) 
+			{
+				pItemStream->flags |= WL_IOSF_VIEWED;
+				wlAggregateViewCommitViews(pItemStream->pAggregateView);
+			}
+			else if (!hasViewFlag)
+				pItemStream->flags &= ~WL_IOSF_VIEWED;
+
+			/* Destroy view if no longer needed. */
+			if(pItemStream->pAggregateView
+					&& pItemStream->requestsWithViewCount == 0)
+			{
+				wlAggregateViewDestroy(pItemStream->pAggregateView);
+				pItemStream->pAggregateView = NULL;
+			}
+		}
+	}
+}
+
 static RsslRet wlStreamSubmitMsg(RsslWatchlistImpl *pWatchlistImpl,
 		WlStream *pStream, RsslErrorInfo *pError)
 {
@@ -4099,90 +4261,367 @@ static RsslRet wlStreamSubmitMsg(RsslWatchlistImpl *pWatchlistImpl,
 
 				if (ret >= RSSL_RET_SUCCESS)
 				{
-					if (!(requestMsg.flags & RSSL_RQMF_NO_REFRESH))
-					{
-						RsslQueueLink *pLink;
-						RSSL_QUEUE_FOR_EACH_LINK(&pItemStream->requestsRecovering, pLink)
-						{
-							WlRequest *pRequest = RSSL_QUEUE_LINK_TO_OBJECT(WlRequest, base.qlStateQueue, pLink);
-							pRequest->base.pStateQueue = &pItemStream->requestsPendingRefresh;
-						}
+					if (sendMsg)
+						pItemStream->flags |= WL_IOSF_REQUESTED;
 
-						assert(pItemStream->refreshState == WL_ISRS_REQUEST_REFRESH);
-						rsslQueueAppend(&pItemStream->requestsPendingRefresh,
-								&pItemStream->requestsRecovering);
-						pItemStream->refreshState = WL_ISRS_PENDING_REFRESH;
+					wlItemStreamCommitRequest(pWatchlistImpl, pItemStream, &requestMsg, hasViewFlag, pView);
+					return ret;
+				}
 
-						if (!(requestMsg.flags & RSSL_RQMF_STREAMING))
-							pItemStream->flags |= WL_IOSF_PENDING_SNAPSHOT;
+				break;
+			}
+		}
 
-						/* Restart buffering. */
-						if (pItemStream->flags & WL_IOSF_HAS_BC_SEQ_NUM)
-						{
-							assert(pItemStream->flags & WL_IOSF_HAS_UC_SEQ_NUM);
-							/* Use the last broadcast sequence number as the
-							 * new starting point instead of the original. */
-							pItemStream->flags &= ~WL_IOSF_HAS_BC_SEQ_NUM;
-						}
+	}
 
-						if (pWatchlistImpl->base.pRsslChannel)
-							wlSetStreamPendingResponse(&pWatchlistImpl->base, &pItemStream->base);
+	return ret;
+}
 
-					}
+static RsslBool wlStreamCanBatch(RsslWatchlistImpl *pWatchlistImpl, WlStream *pStream)
+{
+	WlItemStream *pItemStream;
+	RsslMsgKey *pKey;
+	RsslUInt8 priorityClass;
+	RsslUInt16 priorityCount;
 
-					wlUnsetStreamMsgPending(&pWatchlistImpl->base, &pItemStream->base);
+	if (!pWatchlistImpl->base.config.coalesceItemRequests
+			|| !(pWatchlistImpl->base.config.supportBatchRequests & RDM_LOGIN_BATCH_SUPPORT_REQUESTS))
+		return RSSL_FALSE;
 
-					/* If we sent new priority info, commit the change. */
-					pItemStream->flags &= ~WL_IOSF_PENDING_PRIORITY_CHANGE;
-					if (requestMsg.flags & RSSL_RQMF_HAS_PRIORITY)
-					{
-						pItemStream->priorityClass = requestMsg.priorityClass;
-						pItemStream->priorityCount = requestMsg.priorityCount;
-					}
+	if (pStream->base.isClosing || pStream->base.tempStream)
+		return RSSL_FALSE;
 
-					/* New encDataBody/extendedHeader sent (if it was present). */
-					pItemStream->pRequestWithExtraInfo = NULL;
+	switch(pStream->base.domainType)
+	{
+		case RSSL_DMT_LOGIN:
+		case RSSL_DMT_SOURCE:
+		case RSSL_DMT_DICTIONARY:
+		case RSSL_DMT_SYMBOL_LIST:
+			return RSSL_FALSE;
+		default:
+			break;
+	}
 
-					if (pWatchlistImpl->base.config.supportViewRequests)
-					{
-						if (pItemStream->flags & WL_IOSF_PENDING_VIEW_CHANGE)
-						{
-							/* Sent the new view, commit changes. */
-							pItemStream->flags &= ~WL_IOSF_PENDING_VIEW_CHANGE;
+	pItemStream = (WlItemStream*)pStream;
+
+	/* Only the first request of a stream is coalesced, since the stream is moved to a new ID
+	 * for it. Everything but the name is shared by the items of a batch, so streams with views, 
+	 * pause, priority or extra request information are requested individually. */
+	if (!pItemStream->pWlService
+			|| pItemStream->refreshState != WL_ISRS_REQUEST_REFRESH
+			|| pItemStream->flags & (WL_IOSF_REQUESTED | WL_IOSF_PRIVATE | WL_IOSF_QUALIFIED)
+			|| pItemStream->requestsStreamingCount == 0
+			|| pItemStream->requestsPausedCount
+			|| pItemStream->requestsWithViewCount
+			|| pItemStream->pRequestWithExtraInfo)
+		return RSSL_FALSE;
+
+	if (pItemStream->flags & WL_IOSF_PENDING_PRIORITY_CHANGE
+			&& wlItemStreamMergePriority(pItemStream, &priorityClass, &priorityCount))
+		return RSSL_FALSE;
+
+	pKey = &pItemStream->streamAttributes.msgKey;
+	return ((pKey->flags & ~(RSSL_MKF_HAS_SERVICE_ID | RSSL_MKF_HAS_NAME_TYPE)) == RSSL_MKF_HAS_NAME);
+}
 
-							if (!(requestMsg.flags & RSSL_RQMF_NO_REFRESH))
-								pItemStream->flags |= WL_IOSF_PENDING_VIEW_REFRESH;
+/* Checks whether two streams can be requested in the same batch. */
+static RsslBool wlItemStreamIsSameBatch(WlItemStream *pItemStream1, WlItemStream *pItemStream2)
+{
+	RsslMsgKey *pKey1 = &pItemStream1->streamAttributes.msgKey;
+	RsslMsgKey *pKey2 = &pItemStream2->streamAttributes.msgKey;
+
+	return (pItemStream1->pWlService == pItemStream2->pWlService
+			&& pItemStream1->base.domainType == pItemStream2->base.domainType
+			&& rsslQosIsEqual(&pItemStream1->streamAttributes.qos, &pItemStream2->streamAttributes.qos)
+			&& (pKey1->flags & RSSL_MKF_HAS_NAME_TYPE) == (pKey2->flags & RSSL_MKF_HAS_NAME_TYPE)
+			&& (!(pKey1->flags & RSSL_MKF_HAS_NAME_TYPE) || pKey1->nameType == pKey2->nameType));
+}
 
-							if (pView) 
-							{
-								pItemStream->flags |= WL_IOSF_VIEWED;
-								wlAggregateViewCommitViews(pItemStream->pAggregateView);
-							}
-							else if (!hasViewFlag)
-								pItemStream->flags &= ~WL_IOSF_VIEWED;
+/* Room left in a fragment for the request header and the element list around the batch's names 
+ * (wlEncodeAndSubmitMsg reserves 128 bytes beyond the payload). */
+static const RsslUInt32 WL_BATCH_OVERHEAD_LENGTH = 160;
 
-							/* Destroy view if no longer needed. */
-							if(pItemStream->pAggregateView
-									&& pItemStream->requestsWithViewCount == 0)
-							{
-								wlAggregateViewDestroy(pItemStream->pAggregateView);
-								pItemStream->pAggregateView = NULL;
-							}
-						}
-					}
+static RsslRet wlStreamSubmitBatch(RsslWatchlistImpl *pWatchlistImpl,
+		WlStream *pStream, RsslBool *pSent, RsslErrorInfo *pError)
+{
+	WlBase *pBase = &pWatchlistImpl->base;
+	WlItemStream *pFirstStream = (WlItemStream*)pStream;
+	RsslMsgKey *pFirstKey = &pFirstStream->streamAttributes.msgKey;
+	RsslQueueLink *pLink;
+	RsslUInt32 streamCount = 0, namesLength = 0, maxNamesLength, i;
+	RsslInt32 batchStreamId;
+	WlStreamBase *pBatchStream;
+	RsslRequestMsg requestMsg;
+	RsslEncodeIterator eIter;
+	RsslElementList elementList;
+	RsslElementEntry elementEntry;
+	RsslArray batchArray;
+	RsslBuffer payload;
+	RsslRet ret;
 
-					return ret;
-				}
+	*pSent = RSSL_FALSE;
+
+	/* Size the batch to fit in one fragment. The streams waiting to send a request are
+	 * already limited by the service's OpenWindow (see wlItemStreamSetMsgPending). */
+	if (pBase->channelMaxFragmentSize <= WL_BATCH_OVERHEAD_LENGTH)
+		return RSSL_RET_SUCCESS;
+	maxNamesLength = pBase->channelMaxFragmentSize - WL_BATCH_OVERHEAD_LENGTH;
+
+	for (pLink = &pFirstStream->base.qlStreamsPendingRequest; pLink != NULL;
+			pLink = rsslQueuePeekNext(&pBase->streamsPendingRequest, pLink))
+	{
+		WlStream *pNextStream = RSSL_QUEUE_LINK_TO_OBJECT(WlStream, base.qlStreamsPendingRequest, pLink);
+		RsslUInt32 nameLength;
+
+		if (pNextStream != pStream
+				&& (!wlStreamCanBatch(pWatchlistImpl, pNextStream)
+					|| !wlItemStreamIsSameBatch(pFirstStream, (WlItemStream*)pNextStream)))
+			continue;
+
+		/* Each array entry has a length specifier of up to 3 bytes. */
+		nameLength = pNextStream->item.streamAttributes.msgKey.name.length + 3;
+		if (namesLength + nameLength > maxNamesLength)
+			break;
+		namesLength += nameLength;
+
+		if (streamCount == pBase->batchStreamListSize)
+		{
+			RsslUInt32 newSize = pBase->batchStreamListSize ? pBase->batchStreamListSize * 2 : 256;
+			WlStreamBase **newList = (WlStreamBase**)realloc(pBase->batchStreamList,
+					newSize * sizeof(WlStreamBase*));
+			verify_malloc(newList, pError, RSSL_RET_FAILURE);
+			pBase->batchStreamList = newList;
+			pBase->batchStreamListSize = newSize;
+		}
+
+		pBase->batchStreamList[streamCount++] = &pNextStream->base;
+	}
+
+	if (streamCount < 2)
+		return RSSL_RET_SUCCESS;
 
+	/* Encode the :ItemList payload. */
+	if (pBase->tempEncodeBuffer.length < pBase->channelMaxFragmentSize
+			&& rsslHeapBufferResize(&pBase->tempEncodeBuffer, pBase->channelMaxFragmentSize, RSSL_FALSE)
+			!= RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Memory allocation failure.");
+		return RSSL_RET_FAILURE;
+	}
+
+	payload = pBase->tempEncodeBuffer;
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorRWFVersion(&eIter, pBase->pRsslChannel->majorVersion,
+			pBase->pRsslChannel->minorVersion);
+	rsslSetEncodeIteratorBuffer(&eIter, &payload);
+
+	do
+	{
+		rsslClearElementList(&elementList);
+		elementList.flags = RSSL_ELF_HAS_STANDARD_DATA;
+		if ((ret = rsslEncodeElementListInit(&eIter, &elementList, NULL, 0)) != RSSL_RET_SUCCESS)
+			break;
+
+		rsslClearElementEntry(&elementEntry);
+		elementEntry.name = RSSL_ENAME_BATCH_ITEM_LIST;
+		elementEntry.dataType = RSSL_DT_ARRAY;
+		if ((ret = rsslEncodeElementEntryInit(&eIter, &elementEntry, payload.length)) != RSSL_RET_SUCCESS)
+			break;
+
+		rsslClearArray(&batchArray);
+		batchArray.primitiveType = RSSL_DT_ASCII_STRING;
+		if ((ret = rsslEncodeArrayInit(&eIter, &batchArray)) != RSSL_RET_SUCCESS)
+			break;
+
+		for (i = 0; i < streamCount; ++i)
+		{
+			WlItemStream *pItemStream = (WlItemStream*)pBase->batchStreamList[i];
+			if ((ret = rsslEncodeArrayEntry(&eIter, NULL, 
+							&pItemStream->streamAttributes.msgKey.name)) != RSSL_RET_SUCCESS)
 				break;
-			}
 		}
+		if (ret != RSSL_RET_SUCCESS)
+			break;
+
+		if ((ret = rsslEncodeArrayComplete(&eIter, RSSL_TRUE)) != RSSL_RET_SUCCESS)
+			break;
+
+		if ((ret = rsslEncodeElementEntryComplete(&eIter, RSSL_TRUE)) != RSSL_RET_SUCCESS)
+			break;
+
+		ret = rsslEncodeElementListComplete(&eIter, RSSL_TRUE);
+	} while(0);
+
+	if (ret != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, 
+				"Batch request encoding failure -- %d.", ret);
+		return (ret < RSSL_RET_SUCCESS) ? ret : RSSL_RET_FAILURE;
+	}
+
+	payload.length = rsslGetEncodedBufferLength(&eIter);
+
+	/* The provider opens the items on the stream ID's following the batch's. */
+	batchStreamId = wlBaseTakeStreamIdBlock(pBase, streamCount + 1);
+
+	rsslClearRequestMsg(&requestMsg);
+	requestMsg.msgBase.streamId = batchStreamId;
+	requestMsg.msgBase.domainType = pFirstStream->base.domainType;
+	requestMsg.msgBase.containerType = RSSL_DT_ELEMENT_LIST;
+	requestMsg.msgBase.encDataBody = payload;
+	requestMsg.flags = RSSL_RQMF_STREAMING | RSSL_RQMF_HAS_BATCH;
 
+	requestMsg.msgBase.msgKey.flags = RSSL_MKF_HAS_SERVICE_ID;
+	requestMsg.msgBase.msgKey.serviceId = (RsslUInt16)pFirstStream->pWlService->pService->rdm.serviceId;
+	if (pFirstKey->flags & RSSL_MKF_HAS_NAME_TYPE)
+	{
+		requestMsg.msgBase.msgKey.flags |= RSSL_MKF_HAS_NAME_TYPE;
+		requestMsg.msgBase.msgKey.nameType = pFirstKey->nameType;
 	}
 
+	if (pFirstStream->streamAttributes.qos.timeliness != RSSL_QOS_TIME_UNSPECIFIED)
+	{
+		requestMsg.flags |= RSSL_RQMF_HAS_QOS;
+		requestMsg.qos = pFirstStream->streamAttributes.qos;
+	}
+
+	if (!(pBatchStream = wlBaseAddBatchStream(pBase, batchStreamId, requestMsg.msgBase.domainType,
+					pError)))
+		return RSSL_RET_FAILURE;
+
+	if ((ret = wlEncodeAndSubmitMsg(pWatchlistImpl, (RsslMsg*)&requestMsg, NULL, RSSL_FALSE, NULL, 
+					pError)) < RSSL_RET_SUCCESS)
+	{
+		wlBaseRemoveBatchStream(pBase, pBatchStream);
+		return ret;
+	}
+
+	/* Move the streams to their new ID's and update them as if each had sent its own request. */
+	requestMsg.flags &= ~RSSL_RQMF_HAS_BATCH;
+	for (i = 0; i < streamCount; ++i)
+	{
+		WlItemStream *pItemStream = (WlItemStream*)pBase->batchStreamList[i];
+
+		wlItemStreamSetStreamId(pBase, pItemStream, batchStreamId + 1 + (RsslInt32)i);
+		pItemStream->flags |= WL_IOSF_REQUESTED;
+		wlItemStreamCommitRequest(pWatchlistImpl, pItemStream, &requestMsg, RSSL_FALSE, NULL);
+	}
+
+	*pSent = RSSL_TRUE;
 	return ret;
 }
 
+static RsslBool wlItemStreamGetSnapshotKey(WlItemStream *pItemStream, WlItemSnapshotKey *pKey)
+{
+	RsslMsgKey *pMsgKey = &pItemStream->streamAttributes.msgKey;
+	RsslRDMService *pService;
+
+	/* Only store full images of items identified by name. */
+	if (pItemStream->flags & (WL_IOSF_PRIVATE | WL_IOSF_QUALIFIED | WL_IOSF_VIEWED)
+			|| pItemStream->requestsWithViewCount
+			|| !pItemStream->pWlService
+			|| pItemStream->streamAttributes.domainType == RSSL_DMT_SYMBOL_LIST
+			|| pItemStream->streamAttributes.domainType == RSSL_DMT_DICTIONARY
+			|| !(pMsgKey->flags & RSSL_MKF_HAS_NAME)
+			|| pMsgKey->flags & ~(RSSL_MKF_HAS_NAME | RSSL_MKF_HAS_NAME_TYPE | RSSL_MKF_HAS_SERVICE_ID))
+		return RSSL_FALSE;
+
+	pService = &pItemStream->pWlService->pService->rdm;
+
+	wlItemSnapshotKeyClear(pKey);
+	pKey->domainType = pItemStream->streamAttributes.domainType;
+	pKey->name = pMsgKey->name;
+	if (pMsgKey->flags & RSSL_MKF_HAS_NAME_TYPE)
+		pKey->nameType = pMsgKey->nameType;
+	pKey->serviceId = (RsslUInt16)pService->serviceId;
+	if (pService->flags & RDM_SVCF_HAS_INFO)
+		pKey->serviceName = pService->info.serviceName;
+
+	return RSSL_TRUE;
+}
+
+static RsslRet wlItemRequestSendSnapshotImage(RsslWatchlistImpl *pWatchlistImpl, 
+		WlItemRequest *pItemRequest, RsslBool *pRequestClosed, RsslErrorInfo *pErrorInfo)
+{
+	WlItemSnapshot *pSnapshot = pWatchlistImpl->items.pItemSnapshot;
+	WlRequestedService *pRequestedService = pItemRequest->pRequestedService;
+	RsslMsgKey *pMsgKey = &pItemRequest->msgKey;
+	WlItemSnapshotKey snapshotKey;
+	WlItemSnapshotEntry *pEntry;
+	RsslBuffer image;
+	RsslDecodeIterator dIter;
+	RsslMsg rsslMsg;
+	RsslWatchlistMsgEvent msgEvent;
+	RsslRet ret;
+
+	*pRequestClosed = RSSL_FALSE;
+
+	/* The image is provided as suspect data, to streaming requests that would
+	 * otherwise wait for a full refresh. Recovering requests have already had one. */
+	if (!pWatchlistImpl->base.config.allowSuspectData
+			|| !(pItemRequest->requestMsgFlags & RSSL_RQMF_STREAMING)
+			|| pItemRequest->requestMsgFlags & RSSL_RQMF_NO_REFRESH
+			|| pItemRequest->flags & (WL_IRQF_PRIVATE | WL_IRQF_PROV_DRIVEN | WL_IRQF_QUALIFIED
+				| WL_IRQF_REFRESHED | WL_IRQF_SNAPSHOT_SENT)
+			|| pItemRequest->pView
+			|| pItemRequest->base.domainType == RSSL_DMT_SYMBOL_LIST
+			|| pItemRequest->base.domainType == RSSL_DMT_DICTIONARY
+			|| !(pMsgKey->flags & RSSL_MKF_HAS_NAME)
+			|| pMsgKey->flags & ~(RSSL_MKF_HAS_NAME | RSSL_MKF_HAS_NAME_TYPE | RSSL_MKF_HAS_SERVICE_ID))
+		return RSSL_RET_SUCCESS;
+
+	wlItemSnapshotKeyClear(&snapshotKey);
+	snapshotKey.domainType = pItemRequest->base.domainType;
+	snapshotKey.name = pMsgKey->name;
+	if (pMsgKey->flags & RSSL_MKF_HAS_NAME_TYPE)
+		snapshotKey.nameType = pMsgKey->nameType;
+	if (pRequestedService->flags & WL_RSVC_HAS_NAME)
+		snapshotKey.serviceName = pRequestedService->serviceName;
+	else
+		snapshotKey.serviceId = (RsslUInt16)pRequestedService->serviceId;
+
+	if (!(pEntry = wlItemSnapshotFind(pSnapshot, &snapshotKey)))
+		return RSSL_RET_SUCCESS;
+
+	wlItemSnapshotGetImage(pSnapshot, pEntry, &image);
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorRWFVersion(&dIter, pEntry->majorVersion, pEntry->minorVersion);
+	rsslSetDecodeIteratorBuffer(&dIter, &image);
+	if (rsslDecodeMsg(&dIter, &rsslMsg) != RSSL_RET_SUCCESS
+			|| rsslMsg.msgBase.msgClass != RSSL_MC_REFRESH)
+	{
+		/* Stored image is not usable. */
+		wlItemSnapshotRemove(pSnapshot, pEntry);
+		return RSSL_RET_SUCCESS;
+	}
+
+	pItemRequest->flags |= WL_IRQF_SNAPSHOT_SENT;
+
+	/* The sequence number belonged to the stream that provided the image. */
+	rsslMsg.refreshMsg.flags &= ~RSSL_RFMF_HAS_SEQ_NUM;
+	rsslMsg.refreshMsg.state.streamState = RSSL_STREAM_OPEN;
+	rsslMsg.refreshMsg.state.dataState = RSSL_DATA_SUSPECT;
+	rsslMsg.refreshMsg.state.code = RSSL_SC_NONE;
+	rssl_set_buffer_to_string(rsslMsg.refreshMsg.state.text, "Stored image");
+
+	wlMsgEventClear(&msgEvent);
+	msgEvent.pRsslMsg = &rsslMsg;
+
+	pWatchlistImpl->items.pCurrentSnapshotRequest = pItemRequest;
+
+	if ((ret = wlSendMsgEventToItemRequest(pWatchlistImpl, &msgEvent, pItemRequest, pErrorInfo))
+			!= RSSL_RET_SUCCESS)
+		return ret;
+
+	if (pWatchlistImpl->items.pCurrentSnapshotRequest == NULL)
+		*pRequestClosed = RSSL_TRUE;
+	pWatchlistImpl->items.pCurrentSnapshotRequest = NULL;
+
+	return RSSL_RET_SUCCESS;
+}
+
 static RsslRet wlSendRefreshEventToItemRequest(RsslWatchlistImpl *pWatchlistImpl,
 		RsslWatchlistMsgEvent *pEvent, WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo)
 {
@@ -50,6 +50,7 @@ struct RsslWatchlistMsgEvent
 	RsslWatchlistStreamInfo *pStreamInfo;
 	RsslUInt32				*pSeqNum;
 	RsslUInt8				*pFTGroupId;
+	RsslUInt64				*pRecvTimestamp;
 
 	/* For internal use by the watchlist only. */
 	RsslUInt8				_flags;
@@ -101,6 +102,8 @@ typedef struct
 	RsslUInt32					maxOutstandingPosts;
 	RsslUInt32					postAckTimeout;
 	RsslInt64					ticksPerMsec;
+	RsslBool					coalesceItemRequests;
+	char						*itemSnapshotFile;
 } RsslWatchlistCreateOptions;
 
 /* Reactor-facing watchlist structure. */
@@ -149,6 +152,7 @@ typedef struct
 	RsslUInt32			minorVersion;
 	RsslUInt8			*pFTGroupId;
 	RsslUInt32			*pSeqNum;
+	RsslUInt64			*pRecvTimestamp;
 } RsslWatchlistProcessMsgOptions;
 
 RTR_C_INLINE void rsslWatchlistClearProcessMsgOptions(RsslWatchlistProcessMsgOptions *pOptions)
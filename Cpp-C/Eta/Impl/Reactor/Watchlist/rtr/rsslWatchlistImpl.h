@@ -71,10 +71,26 @@ static RsslRet wlSendRefreshEventToItemRequest(RsslWatchlistImpl *pWatchlistImpl
 static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStream *pItemStream,
 		RsslWatchlistMsgEvent *pEvent, RsslErrorInfo *pErrorInfo);
 
+/* Gets the key used to store a stream's images in the item snapshot.
+ * Returns RSSL_FALSE if the stream's images are not stored. */
+static RsslBool wlItemStreamGetSnapshotKey(WlItemStream *pItemStream, WlItemSnapshotKey *pKey);
+
+/* Gives a new request the item's stored image, if there is one. */
+static RsslRet wlItemRequestSendSnapshotImage(RsslWatchlistImpl *pWatchlistImpl, 
+		WlItemRequest *pItemRequest, RsslBool *pRequestClosed, RsslErrorInfo *pErrorInfo);
+
 /* Constructs and sends a request message for a stream. */
 static RsslRet wlStreamSubmitMsg(RsslWatchlistImpl *pWatchlistImpl,
 		WlStream *pStream, RsslErrorInfo *pError);
 
+/* Checks whether a stream's request may be coalesced into a batch request. */
+static RsslBool wlStreamCanBatch(RsslWatchlistImpl *pWatchlistImpl, WlStream *pStream);
+
+/* Sends the request of a stream, along with those of other pending streams like it, as a batch request. 
+ * pSent is set to RSSL_FALSE if there was nothing to coalesce it with. */
+static RsslRet wlStreamSubmitBatch(RsslWatchlistImpl *pWatchlistImpl,
+		WlStream *pStream, RsslBool *pSent, RsslErrorInfo *pError);
+
 static RsslRet wlProcessRemovedService(RsslWatchlistImpl *pWatchlistImpl,
 		WlService *pWlService, RsslErrorInfo *pErrorInfo);
 
@@ -97,6 +97,7 @@ struct WlStreamBase
 	RsslInt64		requestExpireTime;			/* Time at which the request is considered timed out. */
 	RsslBool		isClosing;
 	RsslBool		tempStream;
+	RsslBool		isBatchStream;				/* Stream only reserves the ID of a batch request sent to the provider. */
 	RsslUInt8		requestState;
 };
 
@@ -118,6 +119,8 @@ typedef struct
 	RsslWatchlistMsgCallback	*msgCallback;					/* Callback the watchlist should use to forward messages. */
 	RsslBool					obeyOpenWindow;					/* Whether the watchlist obeys a service's OpenWindow. */
 	RsslUInt32					requestTimeout;					/* Request timeout, in milliseconds. */
+	RsslUInt					supportBatchRequests;			/* Login refresh parameter, SupportBatchRequests (as received from the provider). */
+	RsslBool					coalesceItemRequests;			/* Whether the watchlist sends pending item requests as batch requests. */
 } WlConfig;
 
 /* Represents the state of the current channel session. */
@@ -155,6 +158,9 @@ typedef struct WlBase
 	WlServiceCache		*pServiceCache;			/* Serivce cache. */
 	RsslQueue			streamsPendingRequest;	/* Streams that need to send a request. */
 	RsslQueue			streamsPendingResponse;	/* Streams opened but waiting for a response. */
+	RsslQueue			batchStreams;			/* Stream ID placeholders of batch requests waiting for a response. */
+	WlStreamBase		**batchStreamList;		/* Reusable list of streams being coalesced into a batch request. */
+	RsslUInt32			batchStreamListSize;	/* Size of batchStreamList. */
 	RsslMemoryPool		requestPool;			/* Pool of WlRequest structures. */
 	RsslMemoryPool		streamPool;				/* Pool of WlStream structures. */
 	RsslInt64			currentTime;			/* Latest timestamp set by caller, in milliseconds. */
@@ -183,6 +189,7 @@ typedef struct
 	RsslInt64						ticksPerMsec;			/* Ticks per millisecond. Used when getting current time (windows only) */
 	RsslUInt32						maxOutstandingPosts;	/* Acknowledgement pool limit. */
 	RsslUInt32						postAckTimeout;			/* Timeout for acks of onstream posts. */
+	RsslBool						coalesceItemRequests;	/* Whether to send pending item requests as batch requests. */
 } WlBaseInitOptions;
 
 /* Initializes a WlBase structure. */
@@ -243,6 +250,19 @@ RsslInt32 wlBaseTakeStreamId(WlBase *pBase);
 /* Retrieves an unused stream ID. */
 RsslInt32 wlBaseTakeProviderStreamId(WlBase *pBase);
 
+/* Retrieves the first of a block of consecutive unused stream ID's. */
+RsslInt32 wlBaseTakeStreamIdBlock(WlBase *pBase, RsslUInt32 count);
+
+/* Reserves the stream ID of a batch request until the provider responds to it. */
+WlStreamBase *wlBaseAddBatchStream(WlBase *pBase, RsslInt32 streamId, RsslUInt8 domainType,
+		RsslErrorInfo *pErrorInfo);
+
+/* Releases the stream ID of a batch request. */
+void wlBaseRemoveBatchStream(WlBase *pBase, WlStreamBase *pStreamBase);
+
+/* Releases the stream ID's of all batch requests (e.g. when the channel goes down). */
+void wlBaseClearBatchStreams(WlBase *pBase);
+
 #ifdef __cplusplus
 }
 #endif
@@ -13,6 +13,7 @@
 #include "rtr/rsslRequestMsg.h"
 #include "rtr/wlService.h"
 #include "rtr/wlMsgReorderQueue.h"
+#include "rtr/wlItemSnapshot.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -58,7 +59,8 @@ typedef enum
 	WL_IOSF_BC_BEHIND_UC				= 0x1000,	/* Broadcast stream is behind unicast stream. */
 	WL_IOSF_HAS_BC_SYNCH_SEQ_NUM		= 0x2000,	/* WlItemStream::bcSynchSeqNum contains the sequence number of a broadcast message that was used to syncrhonize. */
 	WL_IOSF_CLOSED						= 0x4000,	/* If closing this stream, do we need to send a close upstream? */
-	WL_IOSF_QUALIFIED					= 0x8000	/* Stream is qualified. */
+	WL_IOSF_QUALIFIED					= 0x8000,	/* Stream is qualified. */
+	WL_IOSF_REQUESTED					= 0x10000	/* A request has been sent on this stream's ID. */
 } WlItemStreamFlags;
 
 /* Maintains information about a stream open on the network. */
@@ -110,6 +112,9 @@ WlItemStream *wlCreateItemStream(WlBase *pBase, WlStreamAttributes *pStreamAttri
 /* Destroys an item stream. */
 void wlItemStreamDestroy(WlBase *pBase, WlItemStream *pItemStream);
 
+/* Moves an item stream that has not yet sent a request to a new stream ID. */
+void wlItemStreamSetStreamId(WlBase *pBase, WlItemStream *pItemStream, RsslInt32 streamId);
+
 /* Aggregates priority from stream's requests. */
 RsslBool wlItemStreamMergePriority(WlItemStream *pItemStream, RsslUInt8 *pPriorityClass,
 		RsslUInt16 *pPriorityCount);
@@ -125,7 +130,8 @@ typedef enum
 	WL_IRQF_BATCH			= 0x10,	/* Request is a batch request and needs acknowledgement. */
 	WL_IRQF_HAS_PROV_KEY	= 0x20,	/* Request is provider driven but has received a message with 
 									 * a key. */
-	WL_IRQF_QUALIFIED		= 0x40	/* Request is for a qualified stream. */
+	WL_IRQF_QUALIFIED		= 0x40,	/* Request is for a qualified stream. */
+	WL_IRQF_SNAPSHOT_SENT	= 0x80	/* Request has been given the item's stored image. */
 } WlItemRequestFlags;
 
 struct WlItemRequest
@@ -247,6 +253,9 @@ struct WlItems
 												 * fanning out. */
 	WlItemGroup		*pCurrentFanoutGroup;
 	WlFTGroup		*pCurrentFanoutFTGroup;
+	WlItemSnapshot	*pItemSnapshot;				/* Stored item images, if enabled. */
+	WlItemRequest	*pCurrentSnapshotRequest;	/* Used to detect a close of a request while
+												 * providing its stored image. */
 };
 
 /* Initializes the WlItems structure. */
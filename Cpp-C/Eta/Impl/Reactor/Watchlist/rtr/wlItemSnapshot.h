@@ -0,0 +1,126 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright Thomson Reuters 2015. All rights reserved.
+*/
+
+#ifndef WL_ITEM_SNAPSHOT_H
+#define WL_ITEM_SNAPSHOT_H
+
+#include "rtr/rsslReactorUtils.h"
+#include "rtr/rsslHashTable.h"
+#include "rtr/rsslRDM.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Keeps the last complete refresh of each item in a file.  When a consumer restarts with the
+ * same file, requests for those items can be given the stored image right away, while the
+ * watchlist requests a fresh refresh from the provider.
+ *
+ * The file is divided into a fixed number of fixed-size records, set when the file is created,
+ * and is mapped into memory.  A refresh is stored by copying it into its item's record, and the
+ * system writes changed pages to the file in the background, so storing and reading images
+ * makes no system calls.  The index of records is kept in memory and rebuilt from the file when
+ * it is opened.  Each record holds a CRC of its contents, and records that fail it (for
+ * instance, because the system stopped while they were being written) are dropped. */
+
+/* Default space for an item's name, service name and refresh image. Larger images are not stored. */
+#define WL_ITEM_SNAPSHOT_DEFAULT_MAX_RECORD_LENGTH 6144
+
+/* Minimum number of records in a new file. */
+#define WL_ITEM_SNAPSHOT_MIN_RECORD_COUNT 1000
+
+/* Identifies an item in the snapshot. */
+typedef struct
+{
+	RsslUInt8	domainType;		/* Domain of the item. */
+	RsslUInt8	nameType;		/* Name type of the item. */
+	RsslUInt16	serviceId;		/* ID of the item's service. */
+	RsslBuffer	serviceName;	/* Name of the item's service. If present when looking up an item,
+								 * it is matched instead of the service ID. */
+	RsslBuffer	name;			/* Name of the item. */
+} WlItemSnapshotKey;
+
+/* Clears a WlItemSnapshotKey. */
+RTR_C_INLINE void wlItemSnapshotKeyClear(WlItemSnapshotKey *pKey)
+{
+	memset(pKey, 0, sizeof(WlItemSnapshotKey));
+	pKey->nameType = RDM_INSTRUMENT_NAME_TYPE_RIC;
+}
+
+/* An item stored in the snapshot. */
+typedef struct
+{
+	RsslHashLink		hlItems;
+	RsslQueueLink		qlFree;
+	WlItemSnapshotKey	key;			/* Key of the stored item. Its names point into the record. */
+	RsslUInt32			recordIndex;	/* Record used by this item in the file. */
+	RsslUInt32			imageLength;	/* Length of the stored refresh. */
+	RsslUInt8			majorVersion;	/* RWF version used to encode the refresh. */
+	RsslUInt8			minorVersion;
+} WlItemSnapshotEntry;
+
+typedef struct
+{
+#ifdef WIN32
+	HANDLE				file;
+	HANDLE				fileMapping;
+#else
+	int					file;
+#endif
+	char				*pFileMemory;		/* The file, mapped into memory. */
+	RsslUInt64			fileMemoryLength;	/* Length of the mapping. */
+	RsslUInt32			recordCount;		/* Number of records in the file. */
+	RsslUInt32			maxRecordLength;	/* Space for names and image in each record. */
+	WlItemSnapshotEntry	*entries;			/* One entry per record. */
+	RsslQueue			freeEntries;		/* Entries whose records are unused. */
+	RsslHashTable		entriesByKey;		/* Stored items, by WlItemSnapshotKey. */
+	RsslUInt32			crcTable[8][256];	/* Tables for computing record CRCs. */
+} WlItemSnapshot;
+
+/* Options for wlItemSnapshotOpen. */
+typedef struct
+{
+	char		*filename;			/* Name of the file. It is created if it does not exist. */
+	RsslUInt32	recordCount;		/* Number of records in a new file. */
+	RsslUInt32	maxRecordLength;	/* Space for names and image in each record of a new file. */
+} WlItemSnapshotOpenOptions;
+
+/* Clears a WlItemSnapshotOpenOptions structure. */
+RTR_C_INLINE void wlItemSnapshotOpenOptionsClear(WlItemSnapshotOpenOptions *pOptions)
+{
+	memset(pOptions, 0, sizeof(WlItemSnapshotOpenOptions));
+	pOptions->recordCount = WL_ITEM_SNAPSHOT_MIN_RECORD_COUNT;
+	pOptions->maxRecordLength = WL_ITEM_SNAPSHOT_DEFAULT_MAX_RECORD_LENGTH;
+}
+
+/* Opens a snapshot file, creating it if it does not exist, and loads its index.
+ * An existing file keeps the record count and length it was created with. */
+WlItemSnapshot *wlItemSnapshotOpen(WlItemSnapshotOpenOptions *pOpts, RsslErrorInfo *pErrorInfo);
+
+/* Closes the file and cleans up the snapshot. */
+void wlItemSnapshotClose(WlItemSnapshot *pSnapshot);
+
+/* Finds a stored item. */
+WlItemSnapshotEntry *wlItemSnapshotFind(WlItemSnapshot *pSnapshot, WlItemSnapshotKey *pKey);
+
+/* Stores an encoded refresh for an item, replacing any image already stored for it. If the image does
+ * not fit in a record, or there are no unused records, the item is not stored. */
+void wlItemSnapshotSave(WlItemSnapshot *pSnapshot, WlItemSnapshotKey *pKey, RsslBuffer *pImage,
+		RsslUInt8 majorVersion, RsslUInt8 minorVersion);
+
+/* Gets the stored image of an item. pImage points into the item's record, and is valid
+ * until the item is next stored or removed. */
+void wlItemSnapshotGetImage(WlItemSnapshot *pSnapshot, WlItemSnapshotEntry *pEntry, RsslBuffer *pImage);
+
+/* Removes a stored item. */
+void wlItemSnapshotRemove(WlItemSnapshot *pSnapshot, WlItemSnapshotEntry *pEntry);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -48,6 +48,8 @@ typedef struct
 	RsslQueue			linkList;
 	RsslHashTable		linkTable;				/* Table of sources for the Link filter. */
 	RsslBuffer			tempLinkArrayBuffer;
+	RsslBuffer			infoListBuffer;			/* Memory for the lists and strings of the Info filter
+												 * (other than the service name). */
 
 } RDMCachedService;
 
@@ -75,6 +75,7 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 {
 	WlServiceCacheCreateOptions		serviceCacheOpts;
 	WlServiceCache					*pServiceCache;
+	RsslMemoryPoolOptions			poolOpts;
 	RsslRet ret;
 
 	wlServiceCacheClearCreateOptions(&serviceCacheOpts);
@@ -108,6 +109,7 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	pBase->config.msgCallback = pOpts->msgCallback;
 	pBase->config.obeyOpenWindow = pOpts->obeyOpenWindow;
 	pBase->config.requestTimeout = pOpts->requestTimeout;
+	pBase->config.coalesceItemRequests = pOpts->coalesceItemRequests;
 	pBase->watchlist.state = 0;
 	pBase->channelState = WL_CHS_START;
 	pBase->pRsslChannel = NULL;
@@ -158,17 +160,25 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	rsslInitQueue(&pBase->streamsPendingRequest);
 
 	rsslInitQueue(&pBase->streamsPendingResponse);
+	rsslInitQueue(&pBase->batchStreams);
 	rsslInitQueue(&pBase->openStreams);
 
-	if ((ret = rsslMemoryPoolInit(&pBase->streamPool, pOpts->streamPoolBlockSize, 
-					pOpts->streamPoolCount, pErrorInfo)) != RSSL_RET_SUCCESS)
+	/* Large pools (from a large item count hint) are backed by huge pages where available. */
+	rsslClearMemoryPoolOptions(&poolOpts);
+	poolOpts.blockSize = pOpts->streamPoolBlockSize;
+	poolOpts.blockCount = pOpts->streamPoolCount;
+	poolOpts.useHugePages = RSSL_TRUE;
+	if ((ret = rsslMemoryPoolInitEx(&pBase->streamPool, &poolOpts, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
 		return ret;
 	}
 
-	if ((ret = rsslMemoryPoolInit(&pBase->requestPool, pOpts->requestPoolBlockSize, 
-					pOpts->requestPoolCount, pErrorInfo)) != RSSL_RET_SUCCESS)
+	rsslClearMemoryPoolOptions(&poolOpts);
+	poolOpts.blockSize = pOpts->requestPoolBlockSize;
+	poolOpts.blockCount = pOpts->requestPoolCount;
+	poolOpts.useHugePages = RSSL_TRUE;
+	if ((ret = rsslMemoryPoolInitEx(&pBase->requestPool, &poolOpts, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
 		return ret;
@@ -191,6 +201,8 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 void wlBaseCleanup(WlBase *pBase)
 {
 	wlServiceCacheDestroy(pBase->pServiceCache);
+	wlBaseClearBatchStreams(pBase);
+	free(pBase->batchStreamList);
 	rsslHeapBufferCleanup(&pBase->tempDecodeBuffer);
 	rsslHeapBufferCleanup(&pBase->tempEncodeBuffer);
 	rsslHashTableCleanup(&pBase->requestsByStreamId);
@@ -305,3 +317,62 @@ RsslInt32 wlBaseTakeProviderStreamId(WlBase *pBase)
 	} while (rsslHashTableFind(&pBase->streamsById, &streamId, NULL));
 	return streamId;
 }
+
+RsslInt32 wlBaseTakeStreamIdBlock(WlBase *pBase, RsslUInt32 count)
+{
+	RsslInt32 firstStreamId;
+	RsslUInt32 i;
+
+	while (1)
+	{
+		firstStreamId = wlBaseTakeStreamId(pBase);
+
+		/* Block would wrap past the maximum ID; start over from the minimum. */
+		if (firstStreamId > MAX_STREAM_ID - (RsslInt32)count)
+		{
+			pBase->nextStreamId = MIN_STREAM_ID - 1;
+			continue;
+		}
+
+		for (i = 1; i < count; ++i)
+		{
+			pBase->nextStreamId = firstStreamId + (RsslInt32)i;
+			if (rsslHashTableFind(&pBase->streamsById, &pBase->nextStreamId, NULL))
+				break;
+		}
+
+		if (i == count)
+			return firstStreamId;
+	}
+}
+
+WlStreamBase *wlBaseAddBatchStream(WlBase *pBase, RsslInt32 streamId, RsslUInt8 domainType,
+		RsslErrorInfo *pErrorInfo)
+{
+	WlStreamBase *pStreamBase = (WlStreamBase*)malloc(sizeof(WlStreamBase));
+	verify_malloc(pStreamBase, pErrorInfo, NULL);
+
+	wlStreamBaseInit(pStreamBase, streamId, domainType);
+	pStreamBase->isBatchStream = RSSL_TRUE;
+
+	rsslQueueAddLinkToBack(&pBase->batchStreams, &pStreamBase->qlStreamsList);
+	rsslHashTableInsertLink(&pBase->streamsById, &pStreamBase->hlStreamId,
+			(void*)&pStreamBase->streamId, NULL);
+	return pStreamBase;
+}
+
+void wlBaseRemoveBatchStream(WlBase *pBase, WlStreamBase *pStreamBase)
+{
+	assert(pStreamBase->isBatchStream);
+	rsslQueueRemoveLink(&pBase->batchStreams, &pStreamBase->qlStreamsList);
+	rsslHashTableRemoveLink(&pBase->streamsById, &pStreamBase->hlStreamId);
+	free(pStreamBase);
+}
+
+void wlBaseClearBatchStreams(WlBase *pBase)
+{
+	RsslQueueLink *pLink;
+
+	while ((pLink = rsslQueuePeekFront(&pBase->batchStreams)))
+		wlBaseRemoveBatchStream(pBase, RSSL_QUEUE_LINK_TO_OBJECT(WlStreamBase, qlStreamsList, pLink));
+}
@@ -102,6 +102,9 @@ RsslRet wlItemsInit(WlItems *pItems, RsslErrorInfo *pErrorInfo)
 void wlItemsCleanup(WlItems *pItems)
 {
 	rsslHashTableCleanup(&pItems->providerRequestsByAttrib);
+
+	if (pItems->pItemSnapshot)
+		wlItemSnapshotClose(pItems->pItemSnapshot);
 }
 
 RsslRet wlItemCopyKey(RsslMsgKey *pNewMsgKey, RsslMsgKey *pOldMsgKey, char **pMemoryBuffer,
@@ -411,6 +414,16 @@ void wlItemStreamDestroy(WlBase *pBase, WlItemStream *pItemStream)
 	rsslMemoryPoolPut(&pBase->streamPool, pItemStream);
 }
 
+void wlItemStreamSetStreamId(WlBase *pBase, WlItemStream *pItemStream, RsslInt32 streamId)
+{
+	assert(!(pItemStream->flags & WL_IOSF_REQUESTED));
+
+	rsslHashTableRemoveLink(&pBase->streamsById, &pItemStream->base.hlStreamId);
+	pItemStream->base.streamId = streamId;
+	rsslHashTableInsertLink(&pBase->streamsById, &pItemStream->base.hlStreamId,
+			(void*)&pItemStream->base.streamId, NULL);
+}
+
 static void wlItemStreamMergePriorityFromRequest(WlItemRequest *pItemRequest,
 		RsslUInt8 *pPriorityClass, RsslUInt16 *pPriorityCount)
 {
@@ -955,6 +968,9 @@ void wlItemRequestClose(WlBase *pBase, WlItems *pItems, WlItemRequest *pItemRequ
 	WlItemStream *pItemStream = (WlItemStream*)pItemRequest->base.pStream;
 	RsslQueueLink *pLink;
 
+	if (pItems->pCurrentSnapshotRequest == pItemRequest)
+		pItems->pCurrentSnapshotRequest = NULL;
+
 	if (pItemRequest->flags & WL_IRQF_PROV_DRIVEN
 			&& pItemRequest->requestMsgFlags & RSSL_RQMF_STREAMING)
 	{
@@ -0,0 +1,491 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright Thomson Reuters 2015. All rights reserved.
+*/
+
+#include "rtr/wlItemSnapshot.h"
+#include <stdlib.h>
+#include <assert.h>
+#include <sys/types.h>
+
+#ifdef WIN32
+#define rssl_errno (GetLastError())
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#define rssl_errno errno
+#endif
+
+/* Snapshot file format version. */
+#define WL_SNP_VERSION 2
+
+/* Snapshot file header positions. */
+typedef enum
+{
+	WL_SNP_HP_VERSION			= 0,
+	WL_SNP_HP_RECORD_COUNT		= WL_SNP_HP_VERSION + 4,
+	WL_SNP_HP_MAX_RECORD_LEN	= WL_SNP_HP_RECORD_COUNT + 4,
+	WL_SNP_HP_END				= WL_SNP_HP_MAX_RECORD_LEN + 4
+} WlItemSnapshotHeaderPosition;
+
+/* Record positions. The record's data holds the item name, the service name, then the image. */
+typedef enum
+{
+	WL_SNP_RP_IMAGE_LEN			= 0,	/* Zero if the record is unused. */
+	WL_SNP_RP_SERVICE_ID		= WL_SNP_RP_IMAGE_LEN + 4,
+	WL_SNP_RP_NAME_LEN			= WL_SNP_RP_SERVICE_ID + 2,
+	WL_SNP_RP_SERVICE_NAME_LEN	= WL_SNP_RP_NAME_LEN + 2,
+	WL_SNP_RP_DOMAIN			= WL_SNP_RP_SERVICE_NAME_LEN + 2,
+	WL_SNP_RP_NAME_TYPE			= WL_SNP_RP_DOMAIN + 1,
+	WL_SNP_RP_MAJOR_VERSION		= WL_SNP_RP_NAME_TYPE + 1,
+	WL_SNP_RP_MINOR_VERSION		= WL_SNP_RP_MAJOR_VERSION + 1,
+	WL_SNP_RP_CRC				= WL_SNP_RP_MINOR_VERSION + 3,	/* Two bytes reserved. CRC of the rest of the
+																 * header and the data. */
+	WL_SNP_RP_DATA				= WL_SNP_RP_CRC + 4
+} WlItemSnapshotRecordPosition;
+
+static RsslUInt32 wlItemSnapshotKeyHashSum(void *pKey)
+{
+	WlItemSnapshotKey *pSnapshotKey = (WlItemSnapshotKey*)pKey;
+	return rsslHashBufferSum(&pSnapshotKey->name) ^ pSnapshotKey->domainType;
+}
+
+static RsslBool wlItemSnapshotKeyHashCompare(void *pKey1, void *pKey2)
+{
+	WlItemSnapshotKey *pSnapshotKey1 = (WlItemSnapshotKey*)pKey1;
+	WlItemSnapshotKey *pSnapshotKey2 = (WlItemSnapshotKey*)pKey2;
+
+	if (pSnapshotKey1->domainType != pSnapshotKey2->domainType
+			|| pSnapshotKey1->nameType != pSnapshotKey2->nameType
+			|| !rsslBufferIsEqual(&pSnapshotKey1->name, &pSnapshotKey2->name))
+		return RSSL_FALSE;
+
+	/* Services are matched by name when it is given, since a service's ID may change. */
+	if (pSnapshotKey1->serviceName.length)
+		return rsslBufferIsEqual(&pSnapshotKey1->serviceName, &pSnapshotKey2->serviceName);
+	else
+		return (pSnapshotKey1->serviceId == pSnapshotKey2->serviceId) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+RTR_C_INLINE RsslUInt64 wlItemSnapshotRecordPosition(WlItemSnapshot *pSnapshot, RsslUInt32 recordIndex)
+{
+	return WL_SNP_HP_END + (RsslUInt64)recordIndex * (WL_SNP_RP_DATA + pSnapshot->maxRecordLength);
+}
+
+RTR_C_INLINE char *wlItemSnapshotRecord(WlItemSnapshot *pSnapshot, RsslUInt32 recordIndex)
+{
+	return pSnapshot->pFileMemory + (size_t)wlItemSnapshotRecordPosition(pSnapshot, recordIndex);
+}
+
+/* Builds the tables for the CRC-32 polynomial used by zlib and Ethernet. Table k gives the CRC of a byte
+ * followed by k zero bytes, so that eight bytes can be processed at a time. */
+static void wlItemSnapshotInitCrcTable(WlItemSnapshot *pSnapshot)
+{
+	RsslUInt32 i, j, crc;
+
+	for (i = 0; i < 256; ++i)
+	{
+		crc = i;
+		for (j = 0; j < 8; ++j)
+			crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+		pSnapshot->crcTable[0][i] = crc;
+	}
+
+	for (i = 0; i < 256; ++i)
+		for (j = 1; j < 8; ++j)
+			pSnapshot->crcTable[j][i] = (pSnapshot->crcTable[j - 1][i] >> 8)
+				^ pSnapshot->crcTable[0][pSnapshot->crcTable[j - 1][i] & 0xFF];
+}
+
+/* Continues a CRC over more data. */
+static RsslUInt32 wlItemSnapshotCrc(WlItemSnapshot *pSnapshot, RsslUInt32 crc, const char *pData, RsslUInt32 length)
+{
+	RsslUInt32 (*crcTable)[256] = pSnapshot->crcTable;
+	const RsslUInt8 *pBytes = (const RsslUInt8*)pData;
+
+	crc = ~crc;
+
+	for (; length >= 8; length -= 8, pBytes += 8)
+	{
+		crc ^= (RsslUInt32)pBytes[0] | (RsslUInt32)pBytes[1] << 8 | (RsslUInt32)pBytes[2] << 16
+			| (RsslUInt32)pBytes[3] << 24;
+		crc = crcTable[7][crc & 0xFF] ^ crcTable[6][(crc >> 8) & 0xFF] ^ crcTable[5][(crc >> 16) & 0xFF]
+			^ crcTable[4][crc >> 24] ^ crcTable[3][pBytes[4]] ^ crcTable[2][pBytes[5]] ^ crcTable[1][pBytes[6]]
+			^ crcTable[0][pBytes[7]];
+	}
+
+	for (; length > 0; --length, ++pBytes)
+		crc = crcTable[0][(crc ^ *pBytes) & 0xFF] ^ (crc >> 8);
+
+	return ~crc;
+}
+
+/* Computes the CRC of a record, whose data has the given length. */
+RTR_C_INLINE RsslUInt32 wlItemSnapshotRecordCrc(WlItemSnapshot *pSnapshot, const char *pRecord, RsslUInt32 dataLength)
+{
+	return wlItemSnapshotCrc(pSnapshot, wlItemSnapshotCrc(pSnapshot, 0, pRecord, WL_SNP_RP_CRC),
+			pRecord + WL_SNP_RP_DATA, dataLength);
+}
+
+/* Sets an entry's key, whose names are in its record. */
+static void wlItemSnapshotEntrySetKey(WlItemSnapshotEntry *pEntry, char *pRecord, WlItemSnapshotKey *pKey)
+{
+	pEntry->key = *pKey;
+	pEntry->key.name.data = pRecord + WL_SNP_RP_DATA;
+	pEntry->key.serviceName.data = pKey->serviceName.length ? pRecord + WL_SNP_RP_DATA + pKey->name.length : NULL;
+}
+
+/* Checks a record, and adds it to the index if it is in use. */
+static void wlItemSnapshotLoadRecord(WlItemSnapshot *pSnapshot, WlItemSnapshotEntry *pEntry)
+{
+	char *pRecord = wlItemSnapshotRecord(pSnapshot, pEntry->recordIndex);
+	RsslUInt16 nameLength, serviceNameLength;
+	RsslUInt32 crc;
+	WlItemSnapshotKey key;
+
+	memcpy(&pEntry->imageLength, pRecord + WL_SNP_RP_IMAGE_LEN, 4);
+	if (pEntry->imageLength == 0)
+	{
+		rsslQueueAddLinkToBack(&pSnapshot->freeEntries, &pEntry->qlFree);
+		return;
+	}
+
+	wlItemSnapshotKeyClear(&key);
+	memcpy(&key.serviceId, pRecord + WL_SNP_RP_SERVICE_ID, 2);
+	memcpy(&nameLength, pRecord + WL_SNP_RP_NAME_LEN, 2);
+	memcpy(&serviceNameLength, pRecord + WL_SNP_RP_SERVICE_NAME_LEN, 2);
+	memcpy(&crc, pRecord + WL_SNP_RP_CRC, 4);
+	key.domainType = (RsslUInt8)pRecord[WL_SNP_RP_DOMAIN];
+	key.nameType = (RsslUInt8)pRecord[WL_SNP_RP_NAME_TYPE];
+	key.name.length = nameLength;
+	key.serviceName.length = serviceNameLength;
+	pEntry->majorVersion = (RsslUInt8)pRecord[WL_SNP_RP_MAJOR_VERSION];
+	pEntry->minorVersion = (RsslUInt8)pRecord[WL_SNP_RP_MINOR_VERSION];
+
+	/* Drop records that were not completely written. */
+	if (nameLength == 0
+			|| (RsslUInt64)nameLength + serviceNameLength + pEntry->imageLength > pSnapshot->maxRecordLength
+			|| crc != wlItemSnapshotRecordCrc(pSnapshot, pRecord, nameLength + serviceNameLength + pEntry->imageLength))
+	{
+		pEntry->imageLength = 0;
+		rsslQueueAddLinkToBack(&pSnapshot->freeEntries, &pEntry->qlFree);
+		return;
+	}
+
+	wlItemSnapshotEntrySetKey(pEntry, pRecord, &key);
+
+	/* Keep only the first record for an item. */
+	if (rsslHashTableFind(&pSnapshot->entriesByKey, &pEntry->key, NULL))
+	{
+		pEntry->imageLength = 0;
+		rsslQueueAddLinkToBack(&pSnapshot->freeEntries, &pEntry->qlFree);
+		return;
+	}
+
+	rsslHashTableInsertLink(&pSnapshot->entriesByKey, &pEntry->hlItems, &pEntry->key, NULL);
+}
+
+/* Maps the file into memory. */
+static RsslRet wlItemSnapshotMapFile(WlItemSnapshot *pSnapshot, RsslUInt64 length, RsslErrorInfo *pErrorInfo)
+{
+#ifdef WIN32
+	if (!(pSnapshot->fileMapping = CreateFileMapping(pSnapshot->file, NULL, PAGE_READWRITE,
+					(DWORD)(length >> 32), (DWORD)length, NULL))
+			|| !(pSnapshot->pFileMemory = (char*)MapViewOfFile(pSnapshot->fileMapping, FILE_MAP_ALL_ACCESS,
+					0, 0, (SIZE_T)length)))
+#else
+	if ((pSnapshot->pFileMemory = (char*)mmap(NULL, (size_t)length, PROT_READ | PROT_WRITE, MAP_SHARED,
+					pSnapshot->file, 0)) == MAP_FAILED)
+#endif
+	{
+		pSnapshot->pFileMemory = NULL;
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE,
+				__FILE__, __LINE__, "Failed to map item snapshot file: SysError %d", rssl_errno);
+		pErrorInfo->rsslError.sysError = rssl_errno;
+		return RSSL_RET_FAILURE;
+	}
+
+	pSnapshot->fileMemoryLength = length;
+	return RSSL_RET_SUCCESS;
+}
+
+WlItemSnapshot *wlItemSnapshotOpen(WlItemSnapshotOpenOptions *pOpts, RsslErrorInfo *pErrorInfo)
+{
+	WlItemSnapshot *pSnapshot;
+	RsslUInt64 fileSize, expectedFileSize;
+	RsslUInt32 header[3];
+	RsslUInt32 i;
+#ifdef WIN32
+	LARGE_INTEGER largeFileSize;
+#else
+	struct stat fileStat;
+	struct flock flockOpts;
+#endif
+
+	assert(pOpts->filename);
+
+	pSnapshot = (WlItemSnapshot*)malloc(sizeof(WlItemSnapshot));
+	verify_malloc(pSnapshot, pErrorInfo, NULL);
+
+	memset(pSnapshot, 0, sizeof(WlItemSnapshot));
+	rsslInitQueue(&pSnapshot->freeEntries);
+	wlItemSnapshotInitCrcTable(pSnapshot);
+
+	/* The file is opened for exclusive use, since records are assigned by this process. */
+#ifdef WIN32
+	if ((pSnapshot->file = CreateFile(pOpts->filename, GENERIC_READ | GENERIC_WRITE, 0, NULL,
+		OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL)) == INVALID_HANDLE_VALUE)
+#else
+	if ((pSnapshot->file = open(pOpts->filename, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH)) < 0)
+#endif
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE,
+				__FILE__, __LINE__, "Failed to open item snapshot file: SysError %d", rssl_errno);
+		pErrorInfo->rsslError.sysError = rssl_errno;
+		wlItemSnapshotClose(pSnapshot);
+		return NULL;
+	}
+
+#ifndef WIN32
+	memset(&flockOpts, 0, sizeof(flockOpts));
+	flockOpts.l_type = F_WRLCK;
+	flockOpts.l_whence = SEEK_SET;
+	if (fcntl(pSnapshot->file, F_SETLK, &flockOpts) < 0)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE,
+				__FILE__, __LINE__, "Item snapshot file is already locked; it may be in use.");
+		pErrorInfo->rsslError.sysError = rssl_errno;
+		wlItemSnapshotClose(pSnapshot);
+		return NULL;
+	}
+#endif
+
+#ifdef WIN32
+	if (GetFileSizeEx(pSnapshot->file, &largeFileSize) == 0)
+#else
+	if (fstat(pSnapshot->file, &fileStat) < 0)
+#endif
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE,
+				__FILE__, __LINE__, "Failed to get item snapshot file size: SysError %d", rssl_errno);
+		pErrorInfo->rsslError.sysError = rssl_errno;
+		wlItemSnapshotClose(pSnapshot);
+		return NULL;
+	}
+
+#ifdef WIN32
+	fileSize = (RsslUInt64)largeFileSize.QuadPart;
+#else
+	fileSize = (RsslUInt64)fileStat.st_size;
+#endif
+
+	if (fileSize == 0)
+	{
+		/* New file. Size it for all records, then write the header. */
+		pSnapshot->recordCount = pOpts->recordCount;
+		pSnapshot->maxRecordLength = pOpts->maxRecordLength;
+		expectedFileSize = wlItemSnapshotRecordPosition(pSnapshot, pSnapshot->recordCount);
+
+#ifdef WIN32
+		largeFileSize.QuadPart = (LONGLONG)expectedFileSize;
+		if (SetFilePointerEx(pSnapshot->file, largeFileSize, NULL, FILE_BEGIN) == 0
+				|| SetEndOfFile(pSnapshot->file) == 0)
+#else
+		if (ftruncate(pSnapshot->file, (off_t)expectedFileSize) < 0)
+#endif
+		{
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE,
+					__FILE__, __LINE__, "Failed to set item snapshot file size: SysError %d", rssl_errno);
+			pErrorInfo->rsslError.sysError = rssl_errno;
+			wlItemSnapshotClose(pSnapshot);
+			return NULL;
+		}
+
+		if (wlItemSnapshotMapFile(pSnapshot, expectedFileSize, pErrorInfo) != RSSL_RET_SUCCESS)
+		{
+			wlItemSnapshotClose(pSnapshot);
+			return NULL;
+		}
+
+		header[0] = WL_SNP_VERSION;
+		header[1] = pSnapshot->recordCount;
+		header[2] = pSnapshot->maxRecordLength;
+		memcpy(pSnapshot->pFileMemory + WL_SNP_HP_VERSION, header, WL_SNP_HP_END);
+	}
+	else
+	{
+		if (fileSize < WL_SNP_HP_END)
+		{
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE,
+					__FILE__, __LINE__, "File is not an item snapshot file.");
+			wlItemSnapshotClose(pSnapshot);
+			return NULL;
+		}
+
+		if (wlItemSnapshotMapFile(pSnapshot, fileSize, pErrorInfo) != RSSL_RET_SUCCESS)
+		{
+			wlItemSnapshotClose(pSnapshot);
+			return NULL;
+		}
+
+		memcpy(header, pSnapshot->pFileMemory + WL_SNP_HP_VERSION, WL_SNP_HP_END);
+		if (header[0] != WL_SNP_VERSION)
+		{
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE,
+					__FILE__, __LINE__, "File is not an item snapshot file, or is from another version.");
+			wlItemSnapshotClose(pSnapshot);
+			return NULL;
+		}
+
+		pSnapshot->recordCount = header[1];
+		pSnapshot->maxRecordLength = header[2];
+
+		expectedFileSize = wlItemSnapshotRecordPosition(pSnapshot, pSnapshot->recordCount);
+		if (pSnapshot->recordCount == 0 || fileSize < expectedFileSize)
+		{
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE,
+					__FILE__, __LINE__, "Item snapshot file is truncated.");
+			wlItemSnapshotClose(pSnapshot);
+			return NULL;
+		}
+	}
+
+	pSnapshot->entries = (WlItemSnapshotEntry*)calloc(pSnapshot->recordCount, sizeof(WlItemSnapshotEntry));
+	if (!pSnapshot->entries)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Memory allocation failure.");
+		wlItemSnapshotClose(pSnapshot);
+		return NULL;
+	}
+
+	if (rsslHashTableInit(&pSnapshot->entriesByKey, pSnapshot->recordCount, wlItemSnapshotKeyHashSum,
+				wlItemSnapshotKeyHashCompare, RSSL_FALSE, pErrorInfo) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Memory allocation failure.");
+		wlItemSnapshotClose(pSnapshot);
+		return NULL;
+	}
+
+	for (i = 0; i < pSnapshot->recordCount; ++i)
+	{
+		WlItemSnapshotEntry *pEntry = &pSnapshot->entries[i];
+		pEntry->recordIndex = i;
+
+		if (fileSize == 0)
+			rsslQueueAddLinkToBack(&pSnapshot->freeEntries, &pEntry->qlFree);
+		else
+			wlItemSnapshotLoadRecord(pSnapshot, pEntry);
+	}
+
+	return pSnapshot;
+}
+
+void wlItemSnapshotClose(WlItemSnapshot *pSnapshot)
+{
+#ifdef WIN32
+	if (pSnapshot->pFileMemory)
+		UnmapViewOfFile(pSnapshot->pFileMemory);
+	if (pSnapshot->fileMapping)
+		CloseHandle(pSnapshot->fileMapping);
+	if (pSnapshot->file != INVALID_HANDLE_VALUE && pSnapshot->file != 0)
+		CloseHandle(pSnapshot->file);
+#else
+	if (pSnapshot->pFileMemory)
+		munmap(pSnapshot->pFileMemory, (size_t)pSnapshot->fileMemoryLength);
+	if (pSnapshot->file > 0)
+		close(pSnapshot->file);
+#endif
+
+	free(pSnapshot->entries);
+	rsslHashTableCleanup(&pSnapshot->entriesByKey);
+	free(pSnapshot);
+}
+
+WlItemSnapshotEntry *wlItemSnapshotFind(WlItemSnapshot *pSnapshot, WlItemSnapshotKey *pKey)
+{
+	RsslHashLink *pHashLink;
+
+	if (!(pHashLink = rsslHashTableFind(&pSnapshot->entriesByKey, pKey, NULL)))
+		return NULL;
+
+	return RSSL_HASH_LINK_TO_OBJECT(WlItemSnapshotEntry, hlItems, pHashLink);
+}
+
+void wlItemSnapshotSave(WlItemSnapshot *pSnapshot, WlItemSnapshotKey *pKey, RsslBuffer *pImage,
+		RsslUInt8 majorVersion, RsslUInt8 minorVersion)
+{
+	RsslQueueLink *pLink;
+	char *pRecord;
+	RsslUInt16 nameLength, serviceNameLength;
+	RsslUInt32 crc;
+	WlItemSnapshotEntry *pEntry = wlItemSnapshotFind(pSnapshot, pKey);
+
+	if (pKey->name.length == 0 || pImage->length == 0
+			|| (RsslUInt64)pKey->name.length + pKey->serviceName.length + pImage->length
+			> pSnapshot->maxRecordLength)
+	{
+		/* Can't store this image, so don't keep an older one. */
+		if (pEntry)
+			wlItemSnapshotRemove(pSnapshot, pEntry);
+		return;
+	}
+
+	if (pEntry)
+		rsslHashTableRemoveLink(&pSnapshot->entriesByKey, &pEntry->hlItems);
+	else if ((pLink = rsslQueueRemoveFirstLink(&pSnapshot->freeEntries)))
+		pEntry = RSSL_QUEUE_LINK_TO_OBJECT(WlItemSnapshotEntry, qlFree, pLink);
+	else
+		return;
+
+	/* Build the record in place. The key is rewritten as well, since the service's ID or name may have changed. */
+	pRecord = wlItemSnapshotRecord(pSnapshot, pEntry->recordIndex);
+	pEntry->imageLength = pImage->length;
+	pEntry->majorVersion = majorVersion;
+	pEntry->minorVersion = minorVersion;
+
+	nameLength = (RsslUInt16)pKey->name.length;
+	serviceNameLength = (RsslUInt16)pKey->serviceName.length;
+	memset(pRecord, 0, WL_SNP_RP_DATA);
+	memcpy(pRecord + WL_SNP_RP_IMAGE_LEN, &pEntry->imageLength, 4);
+	memcpy(pRecord + WL_SNP_RP_SERVICE_ID, &pKey->serviceId, 2);
+	memcpy(pRecord + WL_SNP_RP_NAME_LEN, &nameLength, 2);
+	memcpy(pRecord + WL_SNP_RP_SERVICE_NAME_LEN, &serviceNameLength, 2);
+	pRecord[WL_SNP_RP_DOMAIN] = (char)pKey->domainType;
+	pRecord[WL_SNP_RP_NAME_TYPE] = (char)pKey->nameType;
+	pRecord[WL_SNP_RP_MAJOR_VERSION] = (char)majorVersion;
+	pRecord[WL_SNP_RP_MINOR_VERSION] = (char)minorVersion;
+	memcpy(pRecord + WL_SNP_RP_DATA, pKey->name.data, nameLength);
+	memcpy(pRecord + WL_SNP_RP_DATA + nameLength, pKey->serviceName.data, serviceNameLength);
+	memcpy(pRecord + WL_SNP_RP_DATA + nameLength + serviceNameLength, pImage->data, pImage->length);
+
+	crc = wlItemSnapshotRecordCrc(pSnapshot, pRecord, nameLength + serviceNameLength + pImage->length);
+	memcpy(pRecord + WL_SNP_RP_CRC, &crc, 4);
+
+	wlItemSnapshotEntrySetKey(pEntry, pRecord, pKey);
+	rsslHashTableInsertLink(&pSnapshot->entriesByKey, &pEntry->hlItems, &pEntry->key, NULL);
+}
+
+void wlItemSnapshotGetImage(WlItemSnapshot *pSnapshot, WlItemSnapshotEntry *pEntry, RsslBuffer *pImage)
+{
+	pImage->data = wlItemSnapshotRecord(pSnapshot, pEntry->recordIndex) + WL_SNP_RP_DATA
+		+ pEntry->key.name.length + pEntry->key.serviceName.length;
+	pImage->length = pEntry->imageLength;
+}
+
+void wlItemSnapshotRemove(WlItemSnapshot *pSnapshot, WlItemSnapshotEntry *pEntry)
+{
+	RsslUInt32 imageLength = 0;
+
+	rsslHashTableRemoveLink(&pSnapshot->entriesByKey, &pEntry->hlItems);
+	pEntry->imageLength = 0;
+	rsslQueueAddLinkToBack(&pSnapshot->freeEntries, &pEntry->qlFree);
+
+	memcpy(wlItemSnapshotRecord(pSnapshot, pEntry->recordIndex) + WL_SNP_RP_IMAGE_LEN, &imageLength, 4);
+}
@@ -248,6 +248,10 @@ RsslRet wlLoginProcessProviderMsg(WlLogin *pLogin, WlBase *pBase,
 					pBase->channelState = WL_CHS_START;
 				}
 
+				/* Keep the provider's batch support before it is replaced by the watchlist's own. */
+				pBase->config.supportBatchRequests = (pLoginRefresh->flags & RDM_LG_RFF_HAS_SUPPORT_BATCH) ?
+					pLoginRefresh->supportBatchRequests : 0;
+
 				/* Adjust attributes according to watchlist support. */
 				if (pLogin->pRequest)
 				{
@@ -16,6 +16,207 @@ RDMCachedService *rscCreateService(RsslErrorInfo *pErrorInfo);
 void rscRemoveService(WlServiceCache *pServiceCache, RDMCachedService *pCachedService);
 void rscDestroyService(RDMCachedService *pCachedService);
 
+/* Updates the lists and strings of the info filter, other than the service name. These are copied into a single 
+ * block owned by the cached service (keeping those the update does not change), rather than allocating 
+ * each list and string separately. */
+static RsslRet rscUpdateInfoLists(RDMCachedService *pCachedService, RsslRDMServiceInfo *pUpdatedInfo,
+		RsslErrorInfo *pErrorInfo)
+{
+	RsslRDMServiceInfo *pCachedInfo = &pCachedService->rdm.info;
+	RsslBuffer *pVendor = NULL, *pItemList = NULL;
+	RsslBuffer *dictionariesProvidedList = NULL, *dictionariesUsedList = NULL;
+	RsslUInt32 dictionariesProvidedCount = 0, dictionariesUsedCount = 0;
+	RsslQos *qosList = NULL, defaultQos;
+	RsslUInt32 qosCount = 0;
+	RsslBool sortQos = RSSL_FALSE;
+	RsslBuffer newListBuffer;
+	RsslRDMServiceInfo newInfo;
+	size_t blockSize;
+	char *pPos;
+	RsslUInt32 ui;
+
+	/* Vendor */
+	if (pUpdatedInfo->flags & RDM_SVC_IFF_HAS_VENDOR)
+	{
+		pCachedService->infoUpdateFlags |= RDM_SVC_IFF_HAS_VENDOR;
+		pCachedInfo->flags |= RDM_SVC_IFF_HAS_VENDOR;
+		pVendor = &pUpdatedInfo->vendor;
+	}
+	else if (pCachedInfo->flags & RDM_SVC_IFF_HAS_VENDOR)
+		pVendor = &pCachedInfo->vendor;
+
+	/* DictionariesProvided */
+	if (pUpdatedInfo->flags & RDM_SVC_IFF_HAS_DICTS_PROVIDED)
+	{
+		pCachedService->infoUpdateFlags |= RDM_SVC_IFF_HAS_DICTS_PROVIDED;
+		pCachedInfo->flags |= RDM_SVC_IFF_HAS_DICTS_PROVIDED;
+		dictionariesProvidedList = pUpdatedInfo->dictionariesProvidedList;
+		dictionariesProvidedCount = pUpdatedInfo->dictionariesProvidedCount;
+	}
+	else if (pCachedInfo->flags & RDM_SVC_IFF_HAS_DICTS_PROVIDED)
+	{
+		dictionariesProvidedList = pCachedInfo->dictionariesProvidedList;
+		dictionariesProvidedCount = pCachedInfo->dictionariesProvidedCount;
+	}
+
+	/* DictionariesUsed */
+	if (pUpdatedInfo->flags & RDM_SVC_IFF_HAS_DICTS_USED)
+	{
+		pCachedService->infoUpdateFlags |= RDM_SVC_IFF_HAS_DICTS_USED;
+		pCachedInfo->flags |= RDM_SVC_IFF_HAS_DICTS_USED;
+		dictionariesUsedList = pUpdatedInfo->dictionariesUsedList;
+		dictionariesUsedCount = pUpdatedInfo->dictionariesUsedCount;
+	}
+	else if (pCachedInfo->flags & RDM_SVC_IFF_HAS_DICTS_USED)
+	{
+		dictionariesUsedList = pCachedInfo->dictionariesUsedList;
+		dictionariesUsedCount = pCachedInfo->dictionariesUsedCount;
+	}
+
+	/* QoS */
+	if (pUpdatedInfo->flags & RDM_SVC_IFF_HAS_QOS)
+	{
+		pCachedService->infoUpdateFlags |= RDM_SVC_IFF_HAS_QOS;
+		pCachedInfo->flags |= RDM_SVC_IFF_HAS_QOS;
+		qosList = pUpdatedInfo->qosList;
+		qosCount = pUpdatedInfo->qosCount;
+		sortQos = RSSL_TRUE;
+	}
+	else if (!(pCachedInfo->flags & RDM_SVC_IFF_HAS_QOS))
+	{
+		pCachedService->infoUpdateFlags |= RDM_SVC_IFF_HAS_QOS;
+		pCachedInfo->flags |= RDM_SVC_IFF_HAS_QOS;
+
+		/* If no QoS was ever provided, the default is RealTime/Tick-by-tick. */
+		rsslClearQos(&defaultQos);
+		defaultQos.timeliness = RSSL_QOS_TIME_REALTIME;
+		defaultQos.rate = RSSL_QOS_RATE_TICK_BY_TICK;
+		qosList = &defaultQos;
+		qosCount = 1;
+	}
+	else
+	{
+		qosList = pCachedInfo->qosList;
+		qosCount = pCachedInfo->qosCount;
+	}
+
+	/* ItemList */
+	if (pUpdatedInfo->flags & RDM_SVC_IFF_HAS_ITEM_LIST)
+	{
+		pCachedService->infoUpdateFlags |= RDM_SVC_IFF_HAS_ITEM_LIST;
+		pCachedInfo->flags |= RDM_SVC_IFF_HAS_ITEM_LIST;
+		pItemList = &pUpdatedInfo->itemList;
+	}
+	else if (pCachedInfo->flags & RDM_SVC_IFF_HAS_ITEM_LIST)
+		pItemList = &pCachedInfo->itemList;
+
+	/* Lay out the arrays first so they are aligned, followed by the strings. */
+	blockSize = pUpdatedInfo->capabilitiesCount * sizeof(RsslUInt)
+		+ (dictionariesProvidedCount + dictionariesUsedCount) * sizeof(RsslBuffer)
+		+ qosCount * sizeof(RsslQos);
+	if (pVendor) blockSize += pVendor->length;
+	if (pItemList) blockSize += pItemList->length;
+	for(ui = 0; ui < dictionariesProvidedCount; ++ui)
+		blockSize += dictionariesProvidedList[ui].length;
+	for(ui = 0; ui < dictionariesUsedCount; ++ui)
+		blockSize += dictionariesUsedList[ui].length;
+
+	rsslClearBuffer(&newListBuffer);
+	if (blockSize)
+	{
+		newListBuffer.data = (char*)malloc(blockSize);
+		verify_malloc(newListBuffer.data, pErrorInfo, RSSL_RET_FAILURE);
+		newListBuffer.length = (RsslUInt32)blockSize;
+	}
+	pPos = newListBuffer.data;
+
+	/* Capabilities */
+	newInfo.capabilitiesCount = pUpdatedInfo->capabilitiesCount;
+	if (newInfo.capabilitiesCount)
+	{
+		newInfo.capabilitiesList = (RsslUInt*)pPos;
+		memcpy(pPos, pUpdatedInfo->capabilitiesList, newInfo.capabilitiesCount * sizeof(RsslUInt));
+		pPos += newInfo.capabilitiesCount * sizeof(RsslUInt);
+
+		qsort(newInfo.capabilitiesList, newInfo.capabilitiesCount, sizeof(RsslUInt), rscCompareCapabilities);
+	}
+	else
+		newInfo.capabilitiesList = NULL;
+
+	newInfo.dictionariesProvidedCount = dictionariesProvidedCount;
+	newInfo.dictionariesProvidedList = dictionariesProvidedCount ? (RsslBuffer*)pPos : NULL;
+	pPos += dictionariesProvidedCount * sizeof(RsslBuffer);
+
+	newInfo.dictionariesUsedCount = dictionariesUsedCount;
+	newInfo.dictionariesUsedList = dictionariesUsedCount ? (RsslBuffer*)pPos : NULL;
+	pPos += dictionariesUsedCount * sizeof(RsslBuffer);
+
+	newInfo.qosCount = qosCount;
+	if (qosCount)
+	{
+		newInfo.qosList = (RsslQos*)pPos;
+		memcpy(pPos, qosList, qosCount * sizeof(RsslQos));
+		pPos += qosCount * sizeof(RsslQos);
+
+		/* Sort the QoS list from best to worst. */
+		if (sortQos)
+			qsort(newInfo.qosList, newInfo.qosCount, sizeof(RsslQos), rscCompareQos);
+	}
+	else
+		newInfo.qosList = NULL;
+
+	for(ui = 0; ui < dictionariesProvidedCount; ++ui)
+	{
+		newInfo.dictionariesProvidedList[ui].data = pPos;
+		newInfo.dictionariesProvidedList[ui].length = dictionariesProvidedList[ui].length;
+		memcpy(pPos, dictionariesProvidedList[ui].data, dictionariesProvidedList[ui].length);
+		pPos += dictionariesProvidedList[ui].length;
+	}
+
+	for(ui = 0; ui < dictionariesUsedCount; ++ui)
+	{
+		newInfo.dictionariesUsedList[ui].data = pPos;
+		newInfo.dictionariesUsedList[ui].length = dictionariesUsedList[ui].length;
+		memcpy(pPos, dictionariesUsedList[ui].data, dictionariesUsedList[ui].length);
+		pPos += dictionariesUsedList[ui].length;
+	}
+
+	rsslClearBuffer(&newInfo.vendor);
+	if (pVendor && pVendor->length)
+	{
+		newInfo.vendor.data = pPos;
+		newInfo.vendor.length = pVendor->length;
+		memcpy(pPos, pVendor->data, pVendor->length);
+		pPos += pVendor->length;
+	}
+
+	rsslClearBuffer(&newInfo.itemList);
+	if (pItemList && pItemList->length)
+	{
+		newInfo.itemList.data = pPos;
+		newInfo.itemList.length = pItemList->length;
+		memcpy(pPos, pItemList->data, pItemList->length);
+		pPos += pItemList->length;
+	}
+
+	/* Replace the previous block. */
+	rsslHeapBufferCleanup(&pCachedService->infoListBuffer);
+	pCachedService->infoListBuffer = newListBuffer;
+
+	pCachedInfo->vendor = newInfo.vendor;
+	pCachedInfo->capabilitiesList = newInfo.capabilitiesList;
+	pCachedInfo->capabilitiesCount = newInfo.capabilitiesCount;
+	pCachedInfo->dictionariesProvidedList = newInfo.dictionariesProvidedList;
+	pCachedInfo->dictionariesProvidedCount = newInfo.dictionariesProvidedCount;
+	pCachedInfo->dictionariesUsedList = newInfo.dictionariesUsedList;
+	pCachedInfo->dictionariesUsedCount = newInfo.dictionariesUsedCount;
+	pCachedInfo->qosList = newInfo.qosList;
+	pCachedInfo->qosCount = newInfo.qosCount;
+	pCachedInfo->itemList = newInfo.itemList;
+
+	return RSSL_RET_SUCCESS;
+}
+
 /* Update a service in the cache, based on directory message. */
 RsslRet rscUpdateService(WlServiceCache *pServiceCache, RDMCachedService *pCachedService, 
 		RsslRDMService *pUpdatedService, WlServiceCacheUpdateEvent *pUpdateEvent,
@@ -254,6 +455,7 @@ RDMCachedService *rscCreateService(RsslErrorInfo *pErrorInfo)
 	rsslInitQueueLink(&pCachedService->_updatedServiceLink);
 	rsslInitQueue(&pCachedService->linkList);
 	rsslHeapBufferInit(&pCachedService->tempLinkArrayBuffer, sizeof(RsslRDMServiceLink));
+	rsslClearBuffer(&pCachedService->infoListBuffer);
 
 	if (rsslHashTableInit(&pCachedService->_itemGroupsById, 101, rsslHashBufferSum, 
 				rsslHashBufferCompare, RSSL_TRUE, pErrorInfo) != RSSL_RET_SUCCESS)
@@ -364,39 +566,9 @@ void rscClearUpdateEvent(WlServiceCacheUpdateEvent *pEvent)
 void rscCleanupInfoFilter(RDMCachedService *pCachedService)
 {
 	RsslRDMServiceInfo *pCachedInfo = &pCachedService->rdm.info;
-	RsslUInt32 ui;
 
 	if (pCachedService->hasServiceName)
 		rsslHeapBufferCleanup(&pCachedInfo->serviceName);
-
-	if (pCachedInfo->flags & RDM_SVC_IFF_HAS_VENDOR)
-		rsslHeapBufferCleanup(&pCachedInfo->vendor);
-
-	if (pCachedInfo->capabilitiesList)
-		free(pCachedInfo->capabilitiesList);
-
-	if (pCachedInfo->flags & RDM_SVC_IFF_HAS_DICTS_PROVIDED)
-	{
-		for(ui = 0; ui < pCachedInfo->dictionariesProvidedCount; ++ui)
-			rsslHeapBufferCleanup(&pCachedInfo->dictionariesProvidedList[ui]);
-
-		free(pCachedInfo->dictionariesProvidedList);
-	}
-
-	if (pCachedInfo->flags & RDM_SVC_IFF_HAS_DICTS_USED)
-	{
-		for(ui = 0; ui < pCachedInfo->dictionariesUsedCount; ++ui)
-			rsslHeapBufferCleanup(&pCachedInfo->dictionariesUsedList[ui]);
-
-		free(pCachedInfo->dictionariesUsedList);
-	}
-
-
-	if (pCachedInfo->flags & RDM_SVC_IFF_HAS_QOS)
-		free(pCachedInfo->qosList);
-
-	if (pCachedInfo->flags & RDM_SVC_IFF_HAS_ITEM_LIST)
-		rsslHeapBufferCleanup(&pCachedInfo->itemList);
 }
 
 void rscCleanupLinkFilter(RDMCachedService *pCachedService)
@@ -436,6 +608,7 @@ void rscDestroyService(RDMCachedService *pCachedService)
 	rsslHashTableCleanup(&pCachedService->linkTable);
 
 	rsslHeapBufferCleanup(&pCachedService->tempLinkArrayBuffer);
+	rsslHeapBufferCleanup(&pCachedService->infoListBuffer);
 
 	free(pCachedService);
 }
@@ -565,24 +738,6 @@ RsslRet rscUpdateService(WlServiceCache *pServiceCache, RDMCachedService *pCache
 								&pCachedService->_nameLink, &pCachedInfo->serviceName, &hashSum);
 					}
 
-					/* Vendor */
-					if (pUpdatedInfo->flags & RDM_SVC_IFF_HAS_VENDOR)
-					{
-						pCachedService->infoUpdateFlags |= RDM_SVC_IFF_HAS_VENDOR;
-						pCachedInfo->flags |= RDM_SVC_IFF_HAS_VENDOR;
-
-						if (pCachedInfo->flags & RDM_SVC_IFF_HAS_VENDOR) 
-							rsslHeapBufferCopy(&pCachedInfo->vendor, &pUpdatedInfo->vendor,
-									&pCachedInfo->vendor);
-						else if (rsslHeapBufferCreateCopy(&pCachedInfo->vendor, 
-									&pUpdatedInfo->vendor) != RSSL_RET_SUCCESS)
-						{
-							rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
-									"Memory allocation failed.");
-							return RSSL_RET_FAILURE;
-						}
-					}
-
 					/* IsSource */
 					if (pUpdatedInfo->isSource != pCachedInfo->isSource)
 					{
@@ -591,146 +746,9 @@ RsslRet rscUpdateService(WlServiceCache *pServiceCache, RDMCachedService *pCache
 						pCachedInfo->isSource = pUpdatedInfo->isSource;
 					}
 
-					/* Capabilities */
-					if (pCachedInfo->capabilitiesList)
-						free(pCachedInfo->capabilitiesList);
-					pCachedInfo->capabilitiesCount = pUpdatedInfo->capabilitiesCount;
-					if (pCachedInfo->capabilitiesCount)
-					{
-						RsslUInt32 capabilitiesSize = pUpdatedInfo->capabilitiesCount * sizeof(RsslUInt);
-						pCachedInfo->capabilitiesList = (RsslUInt*)malloc(capabilitiesSize);
-
-						verify_malloc(pCachedInfo->capabilitiesList, pErrorInfo, RSSL_RET_FAILURE);
-
-						memcpy(pCachedInfo->capabilitiesList, pUpdatedInfo->capabilitiesList, 
-								capabilitiesSize);
-
-						qsort(pCachedInfo->capabilitiesList, pCachedInfo->capabilitiesCount, 
-								sizeof(RsslUInt), rscCompareCapabilities);
-					}
-					else
-						pCachedInfo->capabilitiesList = NULL;
-
-					/* DictionariesProvided */
-					if (pUpdatedInfo->flags & RDM_SVC_IFF_HAS_DICTS_PROVIDED)
-					{
-						/* Set filter as updated. */
-						pCachedService->infoUpdateFlags |= RDM_SVC_IFF_HAS_DICTS_PROVIDED;
-						pCachedInfo->flags |= RDM_SVC_IFF_HAS_DICTS_PROVIDED;
-						pCachedInfo->dictionariesProvidedCount = pUpdatedInfo->dictionariesProvidedCount;
-
-						/* Clear current memory. */
-						if (pCachedInfo->dictionariesProvidedList)
-						{
-							for(ui = 0; ui < pCachedInfo->dictionariesProvidedCount; ++ui)
-								rsslHeapBufferCleanup(&pCachedInfo->dictionariesProvidedList[ui]);
-							free(pCachedInfo->dictionariesProvidedList);
-						}
-
-						pCachedInfo->flags |= RDM_SVC_IFF_HAS_DICTS_PROVIDED;
-
-						/* Copy dictionary list. */
-						pCachedInfo->dictionariesProvidedList = (RsslBuffer*)malloc(
-								sizeof(RsslBuffer) * pUpdatedInfo->dictionariesProvidedCount);
-
-						verify_malloc(pCachedInfo->dictionariesProvidedList, pErrorInfo, RSSL_RET_FAILURE);
-
-						for(ui = 0; ui < pCachedInfo->dictionariesProvidedCount; ++ui)
-							if (rsslHeapBufferCreateCopy(&pCachedInfo->dictionariesProvidedList[ui],
-									&pUpdatedInfo->dictionariesProvidedList[ui]) != RSSL_RET_SUCCESS)
-							{
-								pCachedInfo->dictionariesProvidedCount = ui;
-								rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
-										"Memory allocation failed.");
-								return RSSL_RET_FAILURE;
-							}
-
-					}
-
-					if (pUpdatedInfo->flags & RDM_SVC_IFF_HAS_DICTS_USED)
-					{
-						/* Set filter as updated. */
-						pCachedService->infoUpdateFlags |= RDM_SVC_IFF_HAS_DICTS_USED;
-						pCachedInfo->flags |= RDM_SVC_IFF_HAS_DICTS_USED;
-						pCachedInfo->dictionariesUsedCount = pUpdatedInfo->dictionariesUsedCount;
-
-						/* Clear current memory. */
-						if (pCachedInfo->dictionariesUsedList)
-						{
-							for(ui = 0; ui < pCachedInfo->dictionariesUsedCount; ++ui)
-								rsslHeapBufferCleanup(&pCachedInfo->dictionariesUsedList[ui]);
-							free(pCachedInfo->dictionariesUsedList);
-						}
-
-
-						/* Copy dictionary list. */
-						pCachedInfo->dictionariesUsedList = (RsslBuffer*)malloc(
-								sizeof(RsslBuffer) * pUpdatedInfo->dictionariesUsedCount);
-
-						verify_malloc(pCachedInfo->dictionariesUsedList, pErrorInfo, RSSL_RET_FAILURE);
-
-						for(ui = 0; ui < pCachedInfo->dictionariesUsedCount; ++ui)
-							if (rsslHeapBufferCreateCopy(&pCachedInfo->dictionariesUsedList[ui],
-									&pUpdatedInfo->dictionariesUsedList[ui]) != RSSL_RET_SUCCESS)
-							{
-								pCachedInfo->dictionariesUsedCount = ui;
-								rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
-										"Memory allocation failed.");
-								return RSSL_RET_FAILURE;
-							}
-					}
-
-					if (pUpdatedInfo->flags & RDM_SVC_IFF_HAS_QOS)
-					{
-						int qosListSize = sizeof(RsslQos) * pUpdatedInfo->qosCount;
-
-						pCachedService->infoUpdateFlags |= RDM_SVC_IFF_HAS_QOS;
-						pCachedInfo->flags |= RDM_SVC_IFF_HAS_QOS;
-
-						/* Clear current memory. */
-						if (pCachedInfo->qosList)
-							free(pCachedInfo->qosList);
-
-						pCachedInfo->qosCount = pUpdatedInfo->qosCount;
-						pCachedInfo->qosList = (RsslQos*)malloc(qosListSize);
-						verify_malloc(pCachedInfo->qosList, pErrorInfo, RSSL_RET_FAILURE);
-						memcpy(pCachedInfo->qosList, pUpdatedInfo->qosList, qosListSize);
-
-						/* Sort the QoS list from best to worst. */
-						qsort(pCachedInfo->qosList, pCachedInfo->qosCount, sizeof(RsslQos),
-								rscCompareQos);
-					}
-					else if (!(pCachedInfo->flags & RDM_SVC_IFF_HAS_QOS))
-					{
-						pCachedService->infoUpdateFlags |= RDM_SVC_IFF_HAS_QOS;
-						pCachedInfo->flags |= RDM_SVC_IFF_HAS_QOS;
-
-						/* If no QoS was ever provided, the default is RealTime/Tick-by-tick. */
-						pCachedInfo->qosCount = 1;
-						pCachedInfo->qosList = (RsslQos*)malloc(sizeof(RsslQos));
-						verify_malloc(pCachedInfo->qosList, pErrorInfo, RSSL_RET_FAILURE);
-						rsslClearQos(&pCachedInfo->qosList[0]);
-						pCachedInfo->qosList[0].timeliness = RSSL_QOS_TIME_REALTIME;
-						pCachedInfo->qosList[0].rate = RSSL_QOS_RATE_TICK_BY_TICK;
-					}
-
-					/* ItemList */
-					if (pUpdatedInfo->flags & RDM_SVC_IFF_HAS_ITEM_LIST)
-					{
-						pCachedService->infoUpdateFlags |= RDM_SVC_IFF_HAS_ITEM_LIST;
-						pCachedInfo->flags |= RDM_SVC_IFF_HAS_ITEM_LIST;
-
-						if (pCachedInfo->flags & RDM_SVC_IFF_HAS_ITEM_LIST) 
-							rsslHeapBufferCopy(&pCachedInfo->itemList, &pUpdatedInfo->itemList,
-									&pCachedInfo->itemList);
-						else if (rsslHeapBufferCreateCopy(&pCachedInfo->itemList, 
-									&pUpdatedInfo->itemList) != RSSL_RET_SUCCESS)
-						{
-							rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
-									"Memory allocation failed.");
-							return RSSL_RET_FAILURE;
-						}
-					}
+					/* Vendor, Capabilities, DictionariesProvided, DictionariesUsed, QoS, ItemList */
+					if ((ret = rscUpdateInfoLists(pCachedService, pUpdatedInfo, pErrorInfo)) != RSSL_RET_SUCCESS)
+						return ret;
 
 					if (pUpdatedInfo->supportsQosRange != pCachedInfo->supportsQosRange)
 					{
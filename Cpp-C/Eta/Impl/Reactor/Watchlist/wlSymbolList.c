@@ -185,7 +185,7 @@ RsslRet wlSymbolListRequestReissue(WlBase *pBase, WlItems *pItems, WlSymbolListR
 void wlSymbolListRequestDestroy(WlBase *pBase, WlItems *pItems, WlSymbolListRequest *pSymbolListRequest)
 {
 	wlItemRequestCleanup(&pSymbolListRequest->itemBase);
-	free(pSymbolListRequest);
+	rsslMemoryPoolPut(&pBase->requestPool, pSymbolListRequest);
 }
 
 RsslRet wlProcessSymbolListMsg(WlBase *pBase, WlItems *pItems, RsslMsg *pRsslMsg,
@@ -53,6 +53,9 @@ static RsslRet _reactorCleanupReactor(RsslReactorImpl *pReactorImpl);
 /* Requests that the worker begin flushing for the given channel. */
 static RsslRet _reactorSendFlushRequest(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError);
 
+/* Requests a timer event for the given channel. */
+static RsslRet _reactorSetTimer(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslInt64 expireTime, RsslErrorInfo *pError);
+
 /* Adds channel info to reactor list and signals worker to initialize it. Used by both rsslReactorConnect & rsslReactorAccept */
 static RsslRet _reactorAddChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError);
 
@@ -74,8 +77,10 @@ typedef struct
 	RsslStreamInfo			*pStreamInfo;	/* (Input) StreamInfo. */
 	RsslUInt8				*pFTGroupId;	/* (Input) FTGroupId from rsslReadEx */
 	RsslUInt32				*pSeqNum;		/* (Input) SeqNum from rsslReadEx. */
+	RsslUInt64				*pRecvTimestamp;	/* (Input) Receive timestamp from rsslReadEx. */
 	RsslReactorCallbackRet	*pCret;			/* (Output) Return code from callback. */
 	RsslErrorInfo			*pError;		/* (Output) Error. */
+	RsslBool				refreshFromCache;	/* (Output) Refresh for a request was sent from the provider item cache. */
 } ReactorProcessMsgOptions;
 
 static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, ReactorProcessMsgOptions *pOpts);
@@ -176,6 +181,9 @@ static RsslReactorChannelImpl* _reactorTakeChannel(RsslReactorImpl *pReactorImpl
 		if ((pReactorChannel->pWorkerNotifierEvent = rsslCreateNotifierEvent()) == NULL)
 			return NULL;
 
+		if ((pReactorChannel->pStandbyNotifierEvent = rsslCreateNotifierEvent()) == NULL)
+			return NULL;
+
 		if ((pReactorChannel->pNotifierEvent = rsslCreateNotifierEvent()) == NULL)
 			return NULL;
 
@@ -263,7 +271,6 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 {
 	RsslReactorImpl *pReactorImpl;
 	RsslInt32 i;
-	char *memBuf;
 
 #ifdef WIN32
 	LARGE_INTEGER	perfFrequency;
@@ -290,6 +297,15 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 	pReactorImpl->dispatchDecodeMemoryBufferSize = pReactorOpts->dispatchDecodeMemoryBufferSize;
 	pReactorImpl->reactor.userSpecPtr = pReactorOpts->userSpecPtr;
 
+	if (pReactorOpts->enableProviderItemCache)
+	{
+		if (!(pReactorImpl->pItemCache = rsslReactorItemCacheCreate(pReactorOpts->pProviderItemCacheDictionary, pError)))
+		{
+			free(pReactorImpl);
+			return NULL;
+		}
+	}
+
 	pReactorImpl->state = RSSL_REACTOR_ST_ACTIVE;
 
 
@@ -347,6 +363,9 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 		if ((pNewChannel->pWorkerNotifierEvent = rsslCreateNotifierEvent()) == NULL)
 			return NULL;
 
+		if ((pNewChannel->pStandbyNotifierEvent = rsslCreateNotifierEvent()) == NULL)
+			return NULL;
+
 		_reactorMoveChannel(&pReactorImpl->channelPool, pNewChannel);
 	}
 
@@ -381,20 +400,19 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 		return NULL;
 	}
 
-	/* Initialize memory block for decoding RDM structures */
-	memBuf = (char*)malloc(pReactorImpl->dispatchDecodeMemoryBufferSize);
-	if (!memBuf)
+	if (_reactorWorkerStart(pReactorImpl, pReactorOpts, pError) != RSSL_RET_SUCCESS)
 	{
 		_reactorWorkerCleanupReactor(pReactorImpl);
-		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor memory buffer.");
 		return NULL;
 	}
-	pReactorImpl->memoryBuffer.data = memBuf;
-	pReactorImpl->memoryBuffer.length = pReactorImpl->dispatchDecodeMemoryBufferSize;
 
-	if (_reactorWorkerStart(pReactorImpl, pReactorOpts, pError) != RSSL_RET_SUCCESS)
+	if (pReactorOpts->cpuBindWorkerThread >= 0
+			&& RSSL_THREAD_BIND(&pReactorImpl->reactorWorker.thread, pReactorOpts->cpuBindWorkerThread) != 0)
 	{
-		_reactorWorkerCleanupReactor(pReactorImpl);
+		/* Worker is running, so let it clean up the reactor. */
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Failed to bind reactor worker thread to CPU %d.", pReactorOpts->cpuBindWorkerThread);
+		_reactorCleanupReactor(pReactorImpl);
 		return NULL;
 	}
 
@@ -653,6 +671,8 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 		watchlistCreateOpts.maxOutstandingPosts = pRole->ommConsumerRole.watchlistOptions.maxOutstandingPosts;
 		watchlistCreateOpts.postAckTimeout = pRole->ommConsumerRole.watchlistOptions.postAckTimeout;
 		watchlistCreateOpts.requestTimeout = pRole->ommConsumerRole.watchlistOptions.requestTimeout;
+		watchlistCreateOpts.coalesceItemRequests = pRole->ommConsumerRole.watchlistOptions.coalesceItemRequests;
+		watchlistCreateOpts.itemSnapshotFile = pRole->ommConsumerRole.watchlistOptions.itemSnapshotFile;
 		watchlistCreateOpts.ticksPerMsec = pReactorImpl->ticksPerMsec;
 		pWatchlist = rsslWatchlistCreate(&watchlistCreateOpts, pError);
 		if (!pWatchlist) goto reactorConnectFail;
@@ -697,6 +717,13 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 	pReactorChannel->reconnectAttemptCount = 0;
 	pReactorChannel->lastReconnectAttemptMs = 0;
 
+	pReactorChannel->warmStandbyEnabled = (pOpts->enableWarmStandby 
+			&& pRole->base.roleType == RSSL_RC_RT_OMM_CONSUMER 
+			&& pReactorChannel->connectionListCount > 1);
+
+	/* Messages are not submitted through rsslReactorSubmit() when the watchlist is enabled. */
+	pReactorChannel->packingLatencyBudget = pWatchlist ? 0 : pOpts->packingLatencyBudget;
+
 	if (pWatchlist)
 	{
 		RsslReactorEventImpl rsslEvent;
@@ -854,6 +881,7 @@ RSSL_VA_API RsslRet rsslReactorAccept(RsslReactor *pReactor, RsslServer *pServer
 	pReactorChannel->reactorChannel.pRsslServer = pServer;
 	pReactorChannel->reactorChannel.userSpecPtr = pOpts->rsslAcceptOptions.userSpecPtr;
 	pReactorChannel->initializationTimeout = pOpts->initializationTimeout;
+	pReactorChannel->packingLatencyBudget = pOpts->packingLatencyBudget;
 
 	if ((pReactorChannel->pTunnelManager = tunnelManagerOpen(pReactor, (RsslReactorChannel*)pReactorChannel, pError)) == NULL)
 		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
@@ -1128,6 +1156,173 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 	}
 }
 
+/* Writes the channel's packed buffer, if it has one. */
+static RsslRet _reactorWritePackedBuffer(RsslReactorChannelImpl *pReactorChannel, RsslBool budgetExpired, RsslErrorInfo *pError)
+{
+	RsslRet ret;
+	RsslBuffer *pBuffer = pReactorChannel->pPackingBuffer;
+	RsslUInt32 bytesWritten, uncompBytesWritten;
+
+	if (!pBuffer)
+		return RSSL_RET_SUCCESS;
+
+	pReactorChannel->pPackingBuffer = NULL;
+
+	/* No message follows the last one packed. */
+	pBuffer->length = 0;
+
+	ret = rsslWrite(pReactorChannel->reactorChannel.pRsslChannel, pBuffer, pReactorChannel->packingPriority, 0,
+			&bytesWritten, &uncompBytesWritten, &pError->rsslError);
+
+	if (ret < RSSL_RET_SUCCESS)
+	{
+		if (ret != RSSL_RET_WRITE_FLUSH_FAILED)
+		{
+			/* A packed buffer is never fragmented, so the write failed and the buffer is still ours. */
+			RsslError releaseError;
+			rsslReleaseBuffer(pBuffer, &releaseError);
+			rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
+			return ret;
+		}
+
+		/* rsslWrite has the buffer, but attempted to flush and failed. */
+		ret = 1;
+	}
+
+	if (ret > 0)
+		pReactorChannel->writeRet = ret;
+
+	++pReactorChannel->packingStats.buffersWritten;
+	if (budgetExpired)
+		++pReactorChannel->packingStats.budgetExpiredWrites;
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Releases the channel's packed buffer without writing it, if it has one. */
+static void _reactorReleasePackedBuffer(RsslReactorChannelImpl *pReactorChannel)
+{
+	RsslError rsslError;
+
+	if (pReactorChannel->pPackingBuffer)
+	{
+		rsslReleaseBuffer(pReactorChannel->pPackingBuffer, &rsslError);
+		pReactorChannel->pPackingBuffer = NULL;
+	}
+}
+
+/* Copies a submitted message into the channel's packed buffer. Packed messages that cannot be written together with it,
+ * or that have waited for the latency budget, are written first.  If the message should not be packed, *pPacked is
+ * set to RSSL_FALSE and the caller writes it.  Buffers the application got for packing itself are never copied, since
+ * they may hold messages before the current position. */
+static RsslRet _reactorPackSubmit(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslBuffer *pBuffer,
+		RsslReactorSubmitOptions *pSubmitOptions, RsslBool *pPacked, RsslErrorInfo *pError)
+{
+	RsslRet ret;
+	RsslChannel *pRsslChannel = pReactorChannel->reactorChannel.pRsslChannel;
+	RsslBuffer *pPackingBuffer = pReactorChannel->pPackingBuffer;
+	RsslInt64 currentTimeUs = getCurrentTimeUs(pReactorImpl->ticksPerMsec);
+	RsslBool packedByApplication = rsslIsPackedBuffer(pBuffer);
+	RsslError rsslError;
+
+	*pPacked = RSSL_FALSE;
+
+	if (pPackingBuffer)
+	{
+		RsslBool budgetExpired = (currentTimeUs - pReactorChannel->packingStartTimeUs >= (RsslInt64)pReactorChannel->packingLatencyBudget);
+
+		if (budgetExpired || packedByApplication || pSubmitOptions->writeFlags != 0 || pSubmitOptions->priority != pReactorChannel->packingPriority
+				|| pBuffer->length > pPackingBuffer->length)
+		{
+			if ((ret = _reactorWritePackedBuffer(pReactorChannel, budgetExpired, pError)) != RSSL_RET_SUCCESS)
+				return ret;
+		}
+	}
+
+	/* Messages with write flags, those sent while the channel is being set up, and buffers packed by the application 
+	 * are written by themselves. */
+	if (packedByApplication || pSubmitOptions->writeFlags != 0 || pReactorChannel->channelSetupState != RSSL_RC_CHST_READY)
+		return RSSL_RET_SUCCESS;
+
+	if (!pReactorChannel->pPackingBuffer)
+	{
+		if (pReactorChannel->packingBufferSize == 0)
+		{
+			RsslChannelInfo channelInfo;
+
+			if ((ret = rsslGetChannelInfo(pRsslChannel, &channelInfo, &pError->rsslError)) != RSSL_RET_SUCCESS)
+			{
+				rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
+				return ret;
+			}
+
+			pReactorChannel->packingBufferSize = channelInfo.maxFragmentSize;
+		}
+
+		/* A larger message would not leave room for another like it. */
+		if (pBuffer->length > pReactorChannel->packingBufferSize / 2)
+			return RSSL_RET_SUCCESS;
+
+		/* If no buffer is available, the message is written by itself. */
+		if (!(pReactorChannel->pPackingBuffer = rsslGetBuffer(pRsslChannel, pReactorChannel->packingBufferSize, RSSL_TRUE, &rsslError)))
+			return RSSL_RET_SUCCESS;
+
+		pReactorChannel->packingStartTimeUs = currentTimeUs;
+		pReactorChannel->packingPriority = (RsslWritePriorities)pSubmitOptions->priority;
+
+		/* Make sure the buffer is written if nothing else is submitted. */
+		if ((ret = _reactorSetTimer(pReactorImpl, pReactorChannel,
+						(currentTimeUs + pReactorChannel->packingLatencyBudget) / 1000, pError)) != RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	pPackingBuffer = pReactorChannel->pPackingBuffer;
+
+	memcpy(pPackingBuffer->data, pBuffer->data, pBuffer->length);
+	pPackingBuffer->length = pBuffer->length;
+
+	if (!rsslPackBuffer(pRsslChannel, pPackingBuffer, &pError->rsslError))
+	{
+		rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
+		return pError->rsslError.rsslErrorId;
+	}
+
+	*pPacked = RSSL_TRUE;
+	++pReactorChannel->packingStats.messagesPacked;
+
+	if (pSubmitOptions->pBytesWritten)
+		*pSubmitOptions->pBytesWritten = pBuffer->length;
+	if (pSubmitOptions->pUncompressedBytesWritten)
+		*pSubmitOptions->pUncompressedBytesWritten = pBuffer->length;
+
+	/* The message was copied, so the application's buffer is released as if it was written. */
+	rsslReleaseBuffer(pBuffer, &rsslError);
+
+	/* Write the buffer now if there is no room left in it. */
+	if (pPackingBuffer->length == 0)
+		return _reactorWritePackedBuffer(pReactorChannel, RSSL_FALSE, pError);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Writes the channel's packed buffer if its latency budget has run out, or sets a timer for when it will. */
+static RsslRet _reactorCheckPackedBuffer(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError)
+{
+	RsslRet ret;
+	RsslInt64 expireTimeUs = pReactorChannel->packingStartTimeUs + pReactorChannel->packingLatencyBudget;
+
+	if (getCurrentTimeUs(pReactorImpl->ticksPerMsec) < expireTimeUs)
+		return _reactorSetTimer(pReactorImpl, pReactorChannel, expireTimeUs / 1000, pError);
+
+	if ((ret = _reactorWritePackedBuffer(pReactorChannel, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	if (pReactorChannel->writeRet > 0)
+		return _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
+
+	return RSSL_RET_SUCCESS;
+}
+
 RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslBuffer *buffer, RsslReactorSubmitOptions *pSubmitOptions, RsslErrorInfo *pError)
 {
 	RsslRet ret;
@@ -1161,6 +1356,31 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "rsslReactorSubmit may not be used when watchlist is enabled.");
 		return (reactorUnlockInterface((RsslReactorImpl*)pReactor), RSSL_RET_INVALID_ARGUMENT);
 	}
+
+	/* Apply provider item data to the cache before the buffer is given to rsslWrite(). */
+	if (pReactorImpl->pItemCache && pReactorChannel->channelRole.base.roleType == RSSL_RC_RT_OMM_PROVIDER)
+	{
+		if ((ret = rsslReactorItemCacheProcessSubmit(pReactorImpl->pItemCache, pReactorChannel, buffer,
+						pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion, pError)) != RSSL_RET_SUCCESS)
+			return (reactorUnlockInterface(pReactorImpl), ret);
+	}
+
+	++pReactorChannel->packingStats.messagesSubmitted;
+
+	if (pReactorChannel->packingLatencyBudget)
+	{
+		RsslBool packed;
+
+		if ((ret = _reactorPackSubmit(pReactorImpl, pReactorChannel, buffer, pSubmitOptions, &packed, pError)) != RSSL_RET_SUCCESS)
+			return (reactorUnlockInterface(pReactorImpl), ret);
+
+		if (packed)
+		{
+			if (pReactorChannel->writeRet > 0)
+				ret = _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
+			return (reactorUnlockInterface(pReactorImpl), ret);
+		}
+	}
 	
 	/* Write message */
 	ret = rsslWrite(pReactorChannel->reactorChannel.pRsslChannel, 
@@ -1199,6 +1419,9 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 		ret = RSSL_RET_SUCCESS;
 	}
 
+	if (ret != RSSL_RET_WRITE_CALL_AGAIN)
+		++pReactorChannel->packingStats.buffersWritten;
+
 	if (pReactorChannel->writeRet > 0)
 	{
 		ret =  _reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError);
@@ -1209,6 +1432,23 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 
 }
 
+RSSL_VA_API RsslRet rsslReactorGetPackingStats(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslReactorPackingStats *pStats, RsslErrorInfo *pError)
+{
+	RsslRet ret;
+	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pChannel;
+
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	if (!pReactorChannel || !rsslReactorChannelIsValid(pReactorImpl, pReactorChannel, pError))
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+
+	*pStats = pReactorChannel->packingStats;
+
+	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+}
+
 RsslUInt32 _reactorMsgEncodedSize(RsslMsg *pMsg)
 {
 	RsslUInt32 msgSize = 128;
@@ -1455,6 +1695,9 @@ static RsslRet _reactorHandleChannelDown(RsslReactorImpl *pReactorImpl, RsslReac
 		return RSSL_RET_FAILURE;
 	}
 
+	/* Packed messages can no longer be written. */
+	_reactorReleasePackedBuffer(pReactorChannel);
+
 	if(pReactorChannel->reconnectAttemptLimit != 0 && pReactorChannel->reconnectAttemptCount != pReactorChannel->reconnectAttemptLimit)
 	{
 
@@ -1480,6 +1723,9 @@ static RsslRet _reactorHandleChannelDown(RsslReactorImpl *pReactorImpl, RsslReac
 	pEvent->channelEvent.pError = pError;
 	}
 
+	if (pReactorImpl->pItemCache)
+		rsslReactorItemCacheRemoveChannel(pReactorImpl->pItemCache, pReactorChannel);
+
 	/* Bring down tunnel streams. */
 	if (pReactorChannel->pTunnelManager 
 			&& !pReactorChannel->pWatchlist /* Watchlist will fanout closes */)
@@ -1670,6 +1916,14 @@ RSSL_VA_API RsslRet rsslReactorCloseChannel(RsslReactor *pReactor, RsslReactorCh
 
 		_reactorMoveChannel(&pReactorImpl->closingChannels, pReactorChannel);
 
+		/* Write any packed messages before the channel is closed. */
+		if (pReactorChannel->pPackingBuffer)
+		{
+			RsslErrorInfo writeError;
+			if (_reactorWritePackedBuffer(pReactorChannel, RSSL_FALSE, &writeError) != RSSL_RET_SUCCESS)
+				pReactorChannel->pPackingBuffer = NULL;
+		}
+
 		/* Send request to worker to close this channel */
 		rsslClearReactorChannelEventImpl(pEvent);
 		pEvent->channelEvent.channelEventType = (RsslReactorChannelEventType)RSSL_RCIMPL_CET_CLOSE_CHANNEL;
@@ -1683,6 +1937,9 @@ RSSL_VA_API RsslRet rsslReactorCloseChannel(RsslReactor *pReactor, RsslReactorCh
 			pReactorChannel->pTunnelManager = NULL;
 		}
 
+		if (pReactorImpl->pItemCache)
+			rsslReactorItemCacheRemoveChannel(pReactorImpl->pItemCache, pReactorChannel);
+
 		if (!RSSL_ERROR_INFO_CHECK(rsslReactorEventQueuePut(&pReactorImpl->reactorWorker.workerQueue, (RsslReactorEventImpl*)pEvent) == RSSL_RET_SUCCESS, RSSL_RET_FAILURE, pError))
 			return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
 
@@ -2028,6 +2285,12 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 					if (_reactorHandleTunnelManagerRet(pReactorImpl, pReactorChannel, ret, pError) != RSSL_RET_SUCCESS)
 						return ret;
 				}
+
+				if (pReactorChannel->pPackingBuffer && pReactorChannel->reactorParentQueue == &pReactorImpl->activeChannels)
+				{
+					if (_reactorCheckPackedBuffer(pReactorImpl, pReactorChannel, pError) != RSSL_RET_SUCCESS)
+						return (_reactorHandleChannelDown(pReactorImpl, pReactorChannel, pError));
+				}
 				break;
 			}
 			default:
@@ -2073,6 +2336,80 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 	}
 }
 
+/* Makes sure the channel's RDM decode buffer is allocated, or doubles it after a message did not fit in it. 
+ * The buffer keeps its size, so later messages of the same size fit on the first attempt. */
+static RsslRet _reactorGrowDecodeBuffer(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, 
+		RsslErrorInfo *pError)
+{
+	RsslBuffer *pDecodeBuffer = &pReactorChannel->rdmDecodeBuffer;
+	RsslUInt32 newLength;
+
+	if (!pDecodeBuffer->data)
+	{
+		pDecodeBuffer->length = 0;
+		newLength = pReactorImpl->dispatchDecodeMemoryBufferSize > 0 ? 
+			(RsslUInt32)pReactorImpl->dispatchDecodeMemoryBufferSize : 1024;
+	}
+	else if ((newLength = pDecodeBuffer->length * 2) < pDecodeBuffer->length)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Message is too large to decode.");
+		return RSSL_RET_FAILURE;
+	}
+
+	if (rsslHeapBufferResize(pDecodeBuffer, newLength, RSSL_FALSE) != RSSL_RET_SUCCESS)
+	{
+		pDecodeBuffer->length = 0;
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+				"Failed to allocate decode buffer of %u bytes.", newLength);
+		return RSSL_RET_FAILURE;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Decodes the payload of a login, directory or dictionary message into the typed message, using the channel's decode buffer. */
+static RsslRet _reactorDecodeRDMMsg(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslMsg *pMsg,
+		RsslRDMMsg *pRdmMsg, RsslErrorInfo *pError)
+{
+	RsslDecodeIterator	dIter;
+	RsslBuffer			memoryBuffer;
+	RsslRet				ret;
+
+	if (!pReactorChannel->rdmDecodeBuffer.data
+			&& (ret = _reactorGrowDecodeBuffer(pReactorImpl, pReactorChannel, pError)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	do
+	{
+		memoryBuffer = pReactorChannel->rdmDecodeBuffer;
+
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
+		rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
+
+		switch(pMsg->msgBase.domainType)
+		{
+			case RSSL_DMT_LOGIN:
+				ret = rsslDecodeRDMLoginMsg(&dIter, pMsg, &pRdmMsg->loginMsg, &memoryBuffer, pError); break;
+			case RSSL_DMT_SOURCE:
+				ret = rsslDecodeRDMDirectoryMsg(&dIter, pMsg, &pRdmMsg->directoryMsg, &memoryBuffer, pError); break;
+			case RSSL_DMT_DICTIONARY:
+				ret = rsslDecodeRDMDictionaryMsg(&dIter, pMsg, &pRdmMsg->dictionaryMsg, &memoryBuffer, pError); break;
+			default:
+				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, 
+						"Unexpected domain type %u.", pMsg->msgBase.domainType);
+				return RSSL_RET_INVALID_ARGUMENT;
+		}
+
+		if (ret != RSSL_RET_BUFFER_TOO_SMALL)
+			return ret;
+
+	} while ((ret = _reactorGrowDecodeBuffer(pReactorImpl, pReactorChannel, pError)) == RSSL_RET_SUCCESS);
+
+	return ret;
+}
+
 static RsslRet _reactorEncodeRDMAsRsslMsg(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslRDMMsg *pRdmMsg, RsslMsg *pRsslMsg,
 		RsslErrorInfo *pErrorInfo)
 {
@@ -2081,17 +2418,31 @@ static RsslRet _reactorEncodeRDMAsRsslMsg(RsslReactorImpl *pReactorImpl, RsslRea
 	RsslRet				ret;
 	RsslBuffer			memBuffer;
 
-	/* Encode message to a buffer. */
-	rsslClearEncodeIterator(&encodeIter);
-	rsslSetEncodeIteratorRWFVersion(&encodeIter, pReactorChannel->reactorChannel.majorVersion,
-			pReactorChannel->reactorChannel.minorVersion);
+	/* Encode message to the channel's decode buffer (the typed message comes from the watchlist, so is not using it). */
+	if (!pReactorChannel->rdmDecodeBuffer.data
+			&& (ret = _reactorGrowDecodeBuffer(pReactorImpl, pReactorChannel, pErrorInfo)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	do
+	{
+		rsslClearEncodeIterator(&encodeIter);
+		rsslSetEncodeIteratorRWFVersion(&encodeIter, pReactorChannel->reactorChannel.majorVersion,
+				pReactorChannel->reactorChannel.minorVersion);
 
-	memBuffer = pReactorImpl->memoryBuffer;
-	rsslSetEncodeIteratorBuffer(&encodeIter, &memBuffer);
+		memBuffer = pReactorChannel->rdmDecodeBuffer;
+		rsslSetEncodeIteratorBuffer(&encodeIter, &memBuffer);
 
-	if ((ret = rsslEncodeRDMMsg(&encodeIter, pRdmMsg, &memBuffer.length, pErrorInfo))
-			!= RSSL_RET_SUCCESS)
-		return ret;
+		if ((ret = rsslEncodeRDMMsg(&encodeIter, pRdmMsg, &memBuffer.length, pErrorInfo))
+				== RSSL_RET_SUCCESS)
+			break;
+
+		if (ret != RSSL_RET_BUFFER_TOO_SMALL)
+			return ret;
+
+		if ((ret = _reactorGrowDecodeBuffer(pReactorImpl, pReactorChannel, pErrorInfo)) != RSSL_RET_SUCCESS)
+			return ret;
+
+	} while (1);
 
 	/* Decode as RsslMsg. */
 	rsslClearDecodeIterator(&decodeIter);
@@ -2116,6 +2467,8 @@ static void _reactorCallDefaultCallback(RsslReactorImpl *pReactorImpl, RsslReact
 	msgEvent.pStreamInfo = (RsslStreamInfo*)pOpts->pStreamInfo;
 	msgEvent.pFTGroupId = pOpts->pFTGroupId;
 	msgEvent.pSeqNum = pOpts->pSeqNum;
+	msgEvent.pRecvTimestamp = pOpts->pRecvTimestamp;
+	msgEvent.refreshFromCache = pOpts->refreshFromCache;
 
 	_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
 	*pOpts->pCret = (*pReactorChannel->channelRole.base.defaultMsgCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &msgEvent);
@@ -2152,6 +2505,117 @@ static RsslRet _reactorRaiseToDefaultCallback(RsslReactorImpl *pReactorImpl, Rss
 	return RSSL_RET_SUCCESS;
 }
 
+/* Sends a refresh from the provider item cache in response to a request.
+ * Parts are encoded into buffers of the channel's maximum fragment size, so that each part is written in a single fragment.
+ * If the refresh cannot be written in full (e.g. no buffers are available), *pRefreshSent is left unset and the
+ * request is passed to the application as usual; the CLEAR_CACHE flag on its refresh replaces any parts already sent. */
+static RsslRet _reactorSendCachedRefresh(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel,
+		RsslRequestMsg *pRequestMsg, RsslReactorCachedItem *pItem, RsslBool *pRefreshSent, RsslErrorInfo *pError)
+{
+	RsslReactorItemCache *pItemCache = pReactorImpl->pItemCache;
+	RsslReactorChannelInfo channelInfo;
+	RsslEncodeIterator eIter;
+	RsslBuffer *pBuf;
+	RsslUInt32 bufferSize, prevBufferSize;
+	RsslBool isComplete = RSSL_FALSE;
+	RsslRet ret;
+
+	*pRefreshSent = RSSL_FALSE;
+
+	if ((ret = rsslReactorGetChannelInfo(&pReactorChannel->reactorChannel, &channelInfo, pError)) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
+		return ret;
+	}
+
+	bufferSize = channelInfo.rsslChannelInfo.maxFragmentSize;
+
+	rsslReactorItemCacheStartRefresh(pItemCache);
+
+	while (!isComplete)
+	{
+		if (!(pBuf = rsslReactorGetBuffer(&pReactorChannel->reactorChannel, bufferSize, RSSL_FALSE, pError)))
+		{
+			rsslReactorItemCacheEndRefresh(pItemCache);
+			return RSSL_RET_SUCCESS;
+		}
+
+		rsslClearEncodeIterator(&eIter);
+		rsslSetEncodeIteratorRWFVersion(&eIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
+		rsslSetEncodeIteratorBuffer(&eIter, pBuf);
+
+		if ((ret = rsslReactorItemCacheEncodeRefresh(pItemCache, pItem, pRequestMsg, &eIter, &isComplete, pError)) != RSSL_RET_SUCCESS)
+		{
+			rsslReleaseBuffer(pBuf, &pError->rsslError);
+
+			if (ret == RSSL_RET_BUFFER_TOO_SMALL)
+			{
+				prevBufferSize = bufferSize;
+				bufferSize *= 2;
+				if (bufferSize > prevBufferSize)
+					continue;
+			}
+
+			rsslReactorItemCacheEndRefresh(pItemCache);
+			return ret;
+		}
+
+		pBuf->length = rsslGetEncodedBufferLength(&eIter);
+
+		if ((ret = _reactorSubmit(pReactorImpl, pReactorChannel, pBuf, pError)) < RSSL_RET_SUCCESS)
+		{
+			rsslReactorItemCacheEndRefresh(pItemCache);
+			return ret;
+		}
+
+		/* If the channel went down, the item may no longer exist. If the buffer is waiting to be written,
+		 * no more parts can be sent yet. */
+		if (pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels
+				|| (pReactorChannel->pWriteCallAgainBuffer && !isComplete))
+		{
+			rsslReactorItemCacheEndRefresh(pItemCache);
+			return RSSL_RET_SUCCESS;
+		}
+
+		/* Further parts are sized for the maximum fragment size again. */
+		bufferSize = channelInfo.rsslChannelInfo.maxFragmentSize;
+	}
+
+	rsslReactorItemCacheEndRefresh(pItemCache);
+	*pRefreshSent = RSSL_TRUE;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Passes requests and closes received on a provider channel to the item cache, answering
+ * requests from the cache where possible. */
+static RsslRet _reactorProcessItemCacheMsg(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, ReactorProcessMsgOptions *pOpts)
+{
+	RsslMsg *pMsg = pOpts->pRsslMsg;
+	RsslReactorCachedItem *pItem;
+	RsslRet ret;
+
+	switch(pMsg->msgBase.msgClass)
+	{
+		case RSSL_MC_REQUEST:
+			if ((ret = rsslReactorItemCacheProcessRequest(pReactorImpl->pItemCache, pReactorChannel, &pMsg->requestMsg, &pItem,
+							pOpts->pError)) != RSSL_RET_SUCCESS)
+				return ret;
+
+			/* A fragmented message is still being written, so leave the refresh to the application. */
+			if (!pItem || pReactorChannel->pWriteCallAgainBuffer)
+				return RSSL_RET_SUCCESS;
+
+			return _reactorSendCachedRefresh(pReactorImpl, pReactorChannel, &pMsg->requestMsg, pItem, &pOpts->refreshFromCache, pOpts->pError);
+
+		case RSSL_MC_CLOSE:
+			rsslReactorItemCacheProcessClose(pReactorImpl->pItemCache, pReactorChannel, pMsg->msgBase.streamId);
+			return RSSL_RET_SUCCESS;
+
+		default:
+			return RSSL_RET_SUCCESS;
+	}
+}
+
 static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, ReactorProcessMsgOptions *pOpts)
 {
 	RsslRet					ret;
@@ -2161,7 +2625,6 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 	RsslErrorInfo			*pError = pOpts->pError;
 	RsslStreamInfo			*pStreamInfo = pOpts->pStreamInfo;
 	RsslReactorCallbackRet	*pCret = pOpts->pCret;
-	RsslDecodeIterator		dIter;
 
 	/* check for RsslTunnelStream message */
 	if (pReactorChannel->pTunnelManager && pMsg)
@@ -2193,7 +2656,6 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 					if (pConsumerRole->loginMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
 						RsslRDMLoginMsg loginResponse, *pLoginResponse;
 						RsslRDMLoginMsgEvent loginEvent;
 
@@ -2202,10 +2664,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 						if (!pRdmMsg)
 						{
-							rsslClearDecodeIterator(&dIter);
-							rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-							rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-							ret = rsslDecodeRDMLoginMsg(&dIter, pMsg, &loginResponse, &memoryBuffer, pError);
+							ret = _reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, pMsg, (RsslRDMMsg*)&loginResponse, pError);
 							pLoginResponse = &loginResponse;
 						}
 						else
@@ -2219,6 +2678,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 						loginEvent.baseMsgEvent.pStreamInfo = (RsslStreamInfo*)pStreamInfo;
 						loginEvent.baseMsgEvent.pFTGroupId = pOpts->pFTGroupId;
 						loginEvent.baseMsgEvent.pSeqNum = pOpts->pSeqNum;
+						loginEvent.baseMsgEvent.pRecvTimestamp = pOpts->pRecvTimestamp;
 
 
 						if (ret == RSSL_RET_SUCCESS)
@@ -2334,13 +2794,9 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 					{
 						if (!pRdmMsg)
 						{
-							RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
 							rsslClearRDMDirectoryMsg(&directoryResponse);
 
-							rsslClearDecodeIterator(&dIter);
-							rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-							rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-							ret = rsslDecodeRDMDirectoryMsg(&dIter, pMsg, &directoryResponse, &memoryBuffer, pError);
+							ret = _reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, pMsg, (RsslRDMMsg*)&directoryResponse, pError);
 							pDirectoryResponse = &directoryResponse;
 						}
 						else
@@ -2362,6 +2818,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 						directoryEvent.baseMsgEvent.pStreamInfo = (RsslStreamInfo*)pStreamInfo;
 						directoryEvent.baseMsgEvent.pFTGroupId = pOpts->pFTGroupId;
 						directoryEvent.baseMsgEvent.pSeqNum = pOpts->pSeqNum;
+						directoryEvent.baseMsgEvent.pRecvTimestamp = pOpts->pRecvTimestamp;
 
 						if (ret == RSSL_RET_SUCCESS)
 						{
@@ -2543,16 +3000,12 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 					if (pConsumerRole->dictionaryMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
 						RsslRDMDictionaryMsg dictionaryResponse;
 						RsslRDMDictionaryMsgEvent dictionaryEvent;
 						rsslClearRDMDictionaryMsg(&dictionaryResponse);
 						rsslClearRDMDictionaryMsgEvent(&dictionaryEvent);
 
-						rsslClearDecodeIterator(&dIter);
-						rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-						rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-						ret = rsslDecodeRDMDictionaryMsg(&dIter, pMsg, &dictionaryResponse, &memoryBuffer, pError);
+						ret = _reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, pMsg, (RsslRDMMsg*)&dictionaryResponse, pError);
 
 						/* Avoid passing these when the watchlist is enabled; the message may be modified from what was sent by the provider. */
 						if (!pConsumerRole->watchlistOptions.enableWatchlist)
@@ -2564,6 +3017,7 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 						dictionaryEvent.baseMsgEvent.pStreamInfo = (RsslStreamInfo*)pStreamInfo;
 						dictionaryEvent.baseMsgEvent.pFTGroupId = pOpts->pFTGroupId;
 						dictionaryEvent.baseMsgEvent.pSeqNum = pOpts->pSeqNum;
+						dictionaryEvent.baseMsgEvent.pRecvTimestamp = pOpts->pRecvTimestamp;
 						if (ret == RSSL_RET_SUCCESS) dictionaryEvent.pRDMDictionaryMsg = &dictionaryResponse;
 						else dictionaryEvent.baseMsgEvent.pErrorInfo = pError;
 
@@ -2653,17 +3107,13 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 					if (pNIProviderRole->loginMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
 						RsslRDMLoginMsg loginResponse;
 						RsslRDMLoginMsgEvent loginEvent;
 
 						rsslClearRDMLoginMsg(&loginResponse);
 						rsslClearRDMLoginMsgEvent(&loginEvent);
 
-						rsslClearDecodeIterator(&dIter);
-						rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-						rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-						ret = rsslDecodeRDMLoginMsg(&dIter, pMsg, &loginResponse, &memoryBuffer, pError);
+						ret = _reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, pMsg, (RsslRDMMsg*)&loginResponse, pError);
 
 						loginEvent.baseMsgEvent.pRsslMsgBuffer = pMsgBuf;
 						loginEvent.baseMsgEvent.pRsslMsg = pMsg;
@@ -2774,17 +3224,13 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 
 					if (pProviderRole->loginMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
 						RsslRDMLoginMsg loginResponse;
 						RsslRDMLoginMsgEvent loginEvent;
 
 						rsslClearRDMLoginMsg(&loginResponse);
 						rsslClearRDMLoginMsgEvent(&loginEvent);
 
-						rsslClearDecodeIterator(&dIter);
-						rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-						rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-						ret = rsslDecodeRDMLoginMsg(&dIter, pMsg, &loginResponse, &memoryBuffer, pError);
+						ret = _reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, pMsg, (RsslRDMMsg*)&loginResponse, pError);
 
 						loginEvent.baseMsgEvent.pRsslMsgBuffer = pMsgBuf;
 						loginEvent.baseMsgEvent.pRsslMsg = pMsg;
@@ -2811,17 +3257,13 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 				{
 					if (pProviderRole->directoryMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
 						RsslRDMDirectoryMsg directoryResponse;
 						RsslRDMDirectoryMsgEvent directoryEvent;
 
 						rsslClearRDMDirectoryMsg(&directoryResponse);
 						rsslClearRDMDirectoryMsgEvent(&directoryEvent);
 
-						rsslClearDecodeIterator(&dIter);
-						rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-						rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-						ret = rsslDecodeRDMDirectoryMsg(&dIter, pMsg, &directoryResponse, &memoryBuffer, pError);
+						ret = _reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, pMsg, (RsslRDMMsg*)&directoryResponse, pError);
 
 						directoryEvent.baseMsgEvent.pRsslMsgBuffer = pMsgBuf;
 						directoryEvent.baseMsgEvent.pRsslMsg = pMsg;
@@ -2848,17 +3290,13 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 				{
 					if (pProviderRole->dictionaryMsgCallback)
 					{
-						RsslBuffer memoryBuffer = pReactorImpl->memoryBuffer;
 						RsslRDMDictionaryMsg dictionaryResponse;
 						RsslRDMDictionaryMsgEvent dictionaryEvent;
 
 						rsslClearRDMDictionaryMsg(&dictionaryResponse);
 						rsslClearRDMDictionaryMsgEvent(&dictionaryEvent);
 
-						rsslClearDecodeIterator(&dIter);
-						rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.majorVersion, pReactorChannel->reactorChannel.minorVersion);
-						rsslSetDecodeIteratorBuffer(&dIter, &pMsg->msgBase.encDataBody);
-						ret = rsslDecodeRDMDictionaryMsg(&dIter, pMsg, &dictionaryResponse, &memoryBuffer, pError);
+						ret = _reactorDecodeRDMMsg(pReactorImpl, pReactorChannel, pMsg, (RsslRDMMsg*)&dictionaryResponse, pError);
 
 						dictionaryEvent.baseMsgEvent.pRsslMsgBuffer = pMsgBuf;
 						dictionaryEvent.baseMsgEvent.pRsslMsg = pMsg;
@@ -2882,6 +3320,16 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 				}
 
 				default:
+					if (pReactorImpl->pItemCache)
+					{
+						if ((ret = _reactorProcessItemCacheMsg(pReactorImpl, pReactorChannel, pOpts)) != RSSL_RET_SUCCESS)
+							return ret;
+
+						/* Channel may have gone down while sending the cached refresh. */
+						if (pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels)
+							return RSSL_RET_SUCCESS;
+					}
+
 					_reactorCallDefaultCallback(pReactorImpl, pReactorChannel, pOpts);
 					break;
 				
@@ -2910,6 +3358,8 @@ static RsslRet _reactorWatchlistMsgCallback(RsslWatchlist *pWatchlist, RsslWatch
 	processOpts.pError = pError;
 	processOpts.pSeqNum = pEvent->pSeqNum;
 	processOpts.pFTGroupId = pEvent->pFTGroupId;
+	processOpts.pRecvTimestamp = pEvent->pRecvTimestamp;
+	processOpts.refreshFromCache = RSSL_FALSE;
 
 	if (pEvent->pRdmMsg)
 	{
@@ -2978,6 +3428,9 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 				if (readOutArgs.readOutFlags & RSSL_READ_OUT_SEQNUM)
 					wlProcessOpts.pSeqNum = &readOutArgs.seqNum;
 
+				if (readOutArgs.readOutFlags & RSSL_READ_OUT_RECV_TIMESTAMP)
+					wlProcessOpts.pRecvTimestamp = &readOutArgs.recvTimestamp;
+
 				if ((ret = _reactorReadWatchlistMsg(pReactorImpl, pReactorChannel, &wlProcessOpts, pError))
 						< RSSL_RET_SUCCESS)
 					return ret;
@@ -2995,6 +3448,7 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 				processOpts.pError = pError;
 				processOpts.pRsslMsg = &msg;
 				processOpts.pRdmMsg = NULL;
+				processOpts.refreshFromCache = RSSL_FALSE;
 
 				processOpts.pFTGroupId = 
 					(readOutArgs.readOutFlags & RSSL_READ_OUT_FTGROUP_ID) ? 
@@ -3004,6 +3458,10 @@ static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslRe
 					(readOutArgs.readOutFlags & RSSL_READ_OUT_SEQNUM) ?
 					&readOutArgs.seqNum : NULL;
 
+				processOpts.pRecvTimestamp = 
+					(readOutArgs.readOutFlags & RSSL_READ_OUT_RECV_TIMESTAMP) ?
+					&readOutArgs.recvTimestamp : NULL;
+
 				if ((ret = _reactorProcessMsg(pReactorImpl, pReactorChannel, &processOpts))
 						!= RSSL_RET_SUCCESS)
 					return ret;
@@ -7,6 +7,7 @@
 
 #include "rtr/rsslReactorImpl.h"
 #include "rtr/rsslReactorEventsImpl.h"
+#include "rtr/wlBase.h"
 #include <stddef.h>
 
 #include <assert.h>
@@ -56,6 +57,25 @@ void _reactorWorkerHandleShutdownRequest(RsslReactorImpl *pReactorImpl, RsslErro
 /* Cleans up any memory of copied RDMMsgs. */
 static void _reactorWorkerFreeChannelRDMMsgs(RsslReactorChannelImpl *pReactorChannel);
 
+/* Stream ID of the directory snapshot requested on a standby connection. It is closed by the snapshot refresh,
+ * so it does not conflict with streams opened after failing over to the connection. */
+static const RsslInt32 STANDBY_DIRECTORY_STREAM_ID = 0x7fffffff;
+
+/* Starts a warm standby connection for the channel. */
+static void _reactorWorkerConnectStandby(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel);
+
+/* Handles notification on a channel's standby connection. */
+static void _reactorWorkerProcessStandby(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslNotifierEvent *pNotifierEvent);
+
+/* Starts, pings and times out a channel's standby connection. Called periodically for active channels. */
+static void _reactorWorkerCheckStandby(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel);
+
+/* Closes a channel's standby connection, if any. */
+static void _reactorWorkerCloseStandby(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel);
+
+/* Makes a ready standby connection the channel's connection. Returns RSSL_FALSE (and closes the standby connection) if it is not ready. */
+static RsslBool _reactorWorkerPromoteStandby(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel);
+
 /* Setup and start the worker thread (Should be called from rsslCreateReactor) */
 RsslRet _reactorWorkerStart(RsslReactorImpl *pReactorImpl, RsslCreateReactorOptions *pReactorOptions, RsslErrorInfo *pError);
 
@@ -133,11 +153,14 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 		RsslReactorChannelImpl *pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
 		_reactorWorkerFreeChannelRDMMsgs(pReactorChannel);
 		_rsslChannelFreeConnectionList(pReactorChannel);
+		rsslHeapBufferCleanup(&pReactorChannel->rdmDecodeBuffer);
 		rsslCleanupReactorEventQueue(&pReactorChannel->eventQueue);
 		if (pReactorChannel->pNotifierEvent)
 			rsslDestroyNotifierEvent(pReactorChannel->pNotifierEvent);
 		if (pReactorChannel->pWorkerNotifierEvent)
 			rsslDestroyNotifierEvent(pReactorChannel->pWorkerNotifierEvent);
+		if (pReactorChannel->pStandbyNotifierEvent)
+			rsslDestroyNotifierEvent(pReactorChannel->pStandbyNotifierEvent);
 		free(pReactorChannel);
 	}
 	while ((pLink = rsslQueueRemoveFirstLink(&pReactorImpl->initializingChannels)))
@@ -145,6 +168,7 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 		RsslReactorChannelImpl *pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
 		_reactorWorkerFreeChannelRDMMsgs(pReactorChannel);
 		_rsslChannelFreeConnectionList(pReactorChannel);
+		rsslHeapBufferCleanup(&pReactorChannel->rdmDecodeBuffer);
 		rsslCleanupReactorEventQueue(&pReactorChannel->eventQueue);
 		if (pReactorChannel->pWatchlist)
 			rsslWatchlistDestroy(pReactorChannel->pWatchlist);
@@ -152,6 +176,8 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 			rsslDestroyNotifierEvent(pReactorChannel->pNotifierEvent);
 		if (pReactorChannel->pWorkerNotifierEvent)
 			rsslDestroyNotifierEvent(pReactorChannel->pWorkerNotifierEvent);
+		if (pReactorChannel->pStandbyNotifierEvent)
+			rsslDestroyNotifierEvent(pReactorChannel->pStandbyNotifierEvent);
 		free(pReactorChannel);
 	}
 	while ((pLink = rsslQueueRemoveFirstLink(&pReactorImpl->activeChannels)))
@@ -159,6 +185,7 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 		RsslReactorChannelImpl *pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
 		_reactorWorkerFreeChannelRDMMsgs(pReactorChannel);
 		_rsslChannelFreeConnectionList(pReactorChannel);
+		rsslHeapBufferCleanup(&pReactorChannel->rdmDecodeBuffer);
 		rsslCleanupReactorEventQueue(&pReactorChannel->eventQueue);
 		if (pReactorChannel->pWatchlist)
 			rsslWatchlistDestroy(pReactorChannel->pWatchlist);
@@ -166,6 +193,8 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 			rsslDestroyNotifierEvent(pReactorChannel->pNotifierEvent);
 		if (pReactorChannel->pWorkerNotifierEvent)
 			rsslDestroyNotifierEvent(pReactorChannel->pWorkerNotifierEvent);
+		if (pReactorChannel->pStandbyNotifierEvent)
+			rsslDestroyNotifierEvent(pReactorChannel->pStandbyNotifierEvent);
 		free(pReactorChannel);
 	}
 	while ((pLink = rsslQueueRemoveFirstLink(&pReactorImpl->inactiveChannels)))
@@ -173,6 +202,7 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 		RsslReactorChannelImpl *pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
 		_reactorWorkerFreeChannelRDMMsgs(pReactorChannel);
 		_rsslChannelFreeConnectionList(pReactorChannel);
+		rsslHeapBufferCleanup(&pReactorChannel->rdmDecodeBuffer);
 		rsslCleanupReactorEventQueue(&pReactorChannel->eventQueue);
 		if (pReactorChannel->pWatchlist)
 			rsslWatchlistDestroy(pReactorChannel->pWatchlist);
@@ -180,6 +210,8 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 			rsslDestroyNotifierEvent(pReactorChannel->pNotifierEvent);
 		if (pReactorChannel->pWorkerNotifierEvent)
 			rsslDestroyNotifierEvent(pReactorChannel->pWorkerNotifierEvent);
+		if (pReactorChannel->pStandbyNotifierEvent)
+			rsslDestroyNotifierEvent(pReactorChannel->pStandbyNotifierEvent);
 		free(pReactorChannel);
 	}
 	while ((pLink = rsslQueueRemoveFirstLink(&pReactorImpl->closingChannels)))
@@ -187,6 +219,7 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 		RsslReactorChannelImpl *pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
 		_reactorWorkerFreeChannelRDMMsgs(pReactorChannel);
 		_rsslChannelFreeConnectionList(pReactorChannel);
+		rsslHeapBufferCleanup(&pReactorChannel->rdmDecodeBuffer);
 		rsslCleanupReactorEventQueue(&pReactorChannel->eventQueue);
 		if (pReactorChannel->pWatchlist)
 			rsslWatchlistDestroy(pReactorChannel->pWatchlist);
@@ -194,6 +227,8 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 			rsslDestroyNotifierEvent(pReactorChannel->pNotifierEvent);
 		if (pReactorChannel->pWorkerNotifierEvent)
 			rsslDestroyNotifierEvent(pReactorChannel->pWorkerNotifierEvent);
+		if (pReactorChannel->pStandbyNotifierEvent)
+			rsslDestroyNotifierEvent(pReactorChannel->pStandbyNotifierEvent);
 		free(pReactorChannel);
 	}
 	while ((pLink = rsslQueueRemoveFirstLink(&pReactorImpl->reconnectingChannels)))
@@ -201,6 +236,7 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 		RsslReactorChannelImpl *pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
 		_reactorWorkerFreeChannelRDMMsgs(pReactorChannel);
 		_rsslChannelFreeConnectionList(pReactorChannel);
+		rsslHeapBufferCleanup(&pReactorChannel->rdmDecodeBuffer);
 		rsslCleanupReactorEventQueue(&pReactorChannel->eventQueue);
 		if (pReactorChannel->pWatchlist)
 			rsslWatchlistDestroy(pReactorChannel->pWatchlist);
@@ -208,6 +244,8 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 			rsslDestroyNotifierEvent(pReactorChannel->pNotifierEvent);
 		if (pReactorChannel->pWorkerNotifierEvent)
 			rsslDestroyNotifierEvent(pReactorChannel->pWorkerNotifierEvent);
+		if (pReactorChannel->pStandbyNotifierEvent)
+			rsslDestroyNotifierEvent(pReactorChannel->pStandbyNotifierEvent);
 		free(pReactorChannel);
 	}
 
@@ -223,8 +261,8 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 	if (pReactorWorker->pQueueNotifierEvent)
 		rsslDestroyNotifierEvent(pReactorWorker->pQueueNotifierEvent);
 
-	if (pReactorImpl->memoryBuffer.data)
-		free(pReactorImpl->memoryBuffer.data);
+	if (pReactorImpl->pItemCache)
+		rsslReactorItemCacheDestroy(pReactorImpl->pItemCache);
 
 	RSSL_MUTEX_DESTROY(&pReactorImpl->interfaceLock);
 	free(pReactorImpl);
@@ -422,6 +460,8 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 													}
 												}
 
+												_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+
 												/* Remove channel from worker's list */
 												_reactorWorkerMoveChannel(&pReactorWorker->inactiveChannels, pReactorChannel);
 												pReactorChannel->lastPingSentMs = 0;
@@ -451,6 +491,15 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 													pReactorChannel->reactorChannel.pRsslChannel = 0;
 												}
 
+												/* If a standby connection is ready, continue on it right away. */
+												if (pReactorChannel->warmStandbyEnabled 
+														&& _reactorWorkerPromoteStandby(pReactorImpl, pReactorChannel))
+												{
+													if (!RSSL_ERROR_INFO_CHECK(_reactorWorkerProcessNewChannel(pReactorImpl, pReactorChannel) == RSSL_RET_SUCCESS, ret, &pReactorWorker->workerCerr))
+														return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
+													break;
+												}
+
 												if(pReactorChannel->reconnectAttemptCount == 0)
 												{
 													pReactorChannel->reconnectDelay = pReactorChannel->reconnectMinDelay;
@@ -489,6 +538,8 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 													}
 												}
 
+												_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+
 												/* Close RSSL channel if present. */
 												if (pReactorChannel->reactorChannel.pRsslChannel)
 												{
@@ -594,7 +645,13 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 				{
 					pReactorChannel = (RsslReactorChannelImpl*)object;
 
-					if (pReactorChannel->reactorChannel.pRsslChannel == NULL)
+					if (pNotifierEvent == pReactorChannel->pStandbyNotifierEvent)
+					{
+						/* Standby connection may have been closed or promoted while processing earlier events. */
+						if (pReactorChannel->pStandbyChannel)
+							_reactorWorkerProcessStandby(pReactorImpl, pReactorChannel, pNotifierEvent);
+					}
+					else if (pReactorChannel->reactorChannel.pRsslChannel == NULL)
 					{
 						/* We may have just closed this channel and started reconnecting it. Do not process notification for it. */
 					}
@@ -790,6 +847,9 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 				_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->lastPingSentMs + (RsslInt64)(pReactorChannel->reactorChannel.pRsslChannel->pingTimeout * 1000 * pingIntervalFactor) - pReactorWorker->lastRecordedTimeMs));
 			}
 
+			if (pReactorChannel->warmStandbyEnabled)
+				_reactorWorkerCheckStandby(pReactorImpl, pReactorChannel);
+
 			/* Process any channels that are waiting for a timeout. */
 			if (pReactorChannel->nextExpireTime != RCIMPL_TIMER_UNSET)
 			{
@@ -799,7 +859,8 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 					_reactorWorkerSendTimerExpired(pReactorImpl, pReactorChannel, pReactorWorker->lastRecordedTimeMs);
 				}
 				else
-					_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->nextExpireTime - pReactorWorker->lastRecordedTimeMs));
+					/* The timer expires once the current time has passed it, so wake up then rather than spinning until it does. */
+					_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->nextExpireTime + 1 - pReactorWorker->lastRecordedTimeMs));
 			}
 		}
 
@@ -881,6 +942,7 @@ void _reactorWorkerHandleShutdownRequest(RsslReactorImpl *pReactorImpl, RsslErro
 	RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->activeChannels, pLink)
 	{
 		pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
+		_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
 		_reactorWorkerMoveChannel(&pReactorWorker->inactiveChannels, pReactorChannel);
 	}
 
@@ -988,3 +1050,379 @@ static void _reactorWorkerFreeChannelRDMMsgs(RsslReactorChannelImpl *pReactorCha
 	}
 
 }
+
+static void _reactorWorkerCloseStandby(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
+{
+	RsslError rsslError;
+
+	/* The standby notifier event is added to the notifier while there is a standby connection. */
+	if (pReactorChannel->pStandbyChannel)
+	{
+		rsslNotifierRemoveEvent(pReactorImpl->reactorWorker.pNotifier, pReactorChannel->pStandbyNotifierEvent);
+		rsslCloseChannel(pReactorChannel->pStandbyChannel, &rsslError);
+		pReactorChannel->pStandbyChannel = NULL;
+	}
+
+	pReactorChannel->standbyState = RSSL_RC_SBST_NONE;
+}
+
+/* Sends the login request and a directory snapshot request on a standby connection that finished initializing. */
+static RsslRet _reactorWorkerStandbySendRequests(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
+{
+	RsslChannel *pChannel = pReactorChannel->pStandbyChannel;
+	RsslRDMLoginRequest *pRoleLoginRequest = pReactorChannel->channelRole.ommConsumerRole.pLoginRequest;
+	RsslRDMLoginRequest loginRequest;
+	RsslRDMDirectoryRequest directoryRequest;
+	RsslRDMMsg *rdmMsgs[2];
+	RsslEncodeIterator eIter;
+	RsslErrorInfo errorInfo;
+	RsslBuffer *pBuffer;
+	RsslUInt32 bytesWritten, uncompBytesWritten;
+	RsslRet ret;
+	int i;
+
+	pReactorChannel->standbyState = RSSL_RC_SBST_LOGGING_IN;
+	pReactorChannel->standbyStartTimeMs = pReactorImpl->reactorWorker.lastRecordedTimeMs;
+	pReactorChannel->standbyLastReadMs = pReactorImpl->reactorWorker.lastRecordedTimeMs;
+	pReactorChannel->standbyLastPingSentMs = pReactorImpl->reactorWorker.lastRecordedTimeMs;
+
+	if (!pRoleLoginRequest)
+	{
+		/* Nothing to log in with; the connection itself is kept ready. */
+		pReactorChannel->standbyState = RSSL_RC_SBST_READY;
+		return RSSL_RET_SUCCESS;
+	}
+
+	/* Log in on the stream that will be used once the channel moves to this connection, so that
+	 * the login sent then is a reissue. */
+	loginRequest = *pRoleLoginRequest;
+	if (pReactorChannel->pWatchlist)
+		loginRequest.rdmMsgBase.streamId = LOGIN_STREAM_ID;
+
+	rsslClearRDMDirectoryRequest(&directoryRequest);
+	directoryRequest.rdmMsgBase.streamId = STANDBY_DIRECTORY_STREAM_ID;
+	directoryRequest.flags = RDM_DR_RQF_NONE;
+	directoryRequest.filter = RDM_DIRECTORY_SERVICE_INFO_FILTER | RDM_DIRECTORY_SERVICE_STATE_FILTER;
+
+	rdmMsgs[0] = (RsslRDMMsg*)&loginRequest;
+	rdmMsgs[1] = (RsslRDMMsg*)&directoryRequest;
+
+	for (i = 0; i < 2; ++i)
+	{
+		if (!(pBuffer = rsslGetBuffer(pChannel, 4096, RSSL_FALSE, &errorInfo.rsslError)))
+			return RSSL_RET_FAILURE;
+
+		rsslClearEncodeIterator(&eIter);
+		rsslSetEncodeIteratorRWFVersion(&eIter, pChannel->majorVersion, pChannel->minorVersion);
+		rsslSetEncodeIteratorBuffer(&eIter, pBuffer);
+
+		if (rsslEncodeRDMMsg(&eIter, rdmMsgs[i], &pBuffer->length, &errorInfo) != RSSL_RET_SUCCESS)
+		{
+			rsslReleaseBuffer(pBuffer, &errorInfo.rsslError);
+			return RSSL_RET_FAILURE;
+		}
+
+		if ((ret = rsslWrite(pChannel, pBuffer, RSSL_HIGH_PRIORITY, 0, &bytesWritten, &uncompBytesWritten, &errorInfo.rsslError)) 
+				< RSSL_RET_SUCCESS)
+		{
+			rsslReleaseBuffer(pBuffer, &errorInfo.rsslError);
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+	if ((ret = rsslFlush(pChannel, &errorInfo.rsslError)) < RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	if (ret > 0 && rsslNotifierRegisterWrite(pReactorImpl->reactorWorker.pNotifier, pReactorChannel->pStandbyNotifierEvent) < 0)
+		return RSSL_RET_FAILURE;
+
+	return RSSL_RET_SUCCESS;
+}
+
+static void _reactorWorkerConnectStandby(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
+{
+	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
+	RsslChannel *pStandbyChannel;
+	RsslError rsslError;
+
+	pReactorChannel->lastStandbyAttemptMs = pReactorWorker->lastRecordedTimeMs;
+	pReactorChannel->standbyListIter = (pReactorChannel->connectionListIter + 1) % pReactorChannel->connectionListCount;
+	pReactorChannel->standbyLoggedIn = RSSL_FALSE;
+	pReactorChannel->standbyHaveDirectory = RSSL_FALSE;
+
+	if (!(pStandbyChannel = rsslConnect(
+					&pReactorChannel->connectionOptList[pReactorChannel->standbyListIter].rsslConnectOptions, &rsslError)))
+		return;
+
+	if (rsslNotifierAddEvent(pReactorWorker->pNotifier, pReactorChannel->pStandbyNotifierEvent, 
+				(int)pStandbyChannel->socketId, pReactorChannel) < 0)
+	{
+		rsslCloseChannel(pStandbyChannel, &rsslError);
+		return;
+	}
+
+	pReactorChannel->pStandbyChannel = pStandbyChannel;
+
+	if (rsslNotifierRegisterRead(pReactorWorker->pNotifier, pReactorChannel->pStandbyNotifierEvent) < 0)
+	{
+		_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+		return;
+	}
+
+	pReactorChannel->standbyState = RSSL_RC_SBST_INITIALIZING;
+	pReactorChannel->standbyStartTimeMs = pReactorWorker->lastRecordedTimeMs;
+
+	switch (pReactorChannel->pStandbyChannel->state)
+	{
+		case RSSL_CH_STATE_INITIALIZING:
+			if (rsslNotifierRegisterWrite(pReactorWorker->pNotifier, pReactorChannel->pStandbyNotifierEvent) < 0)
+				_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+			break;
+		case RSSL_CH_STATE_ACTIVE:
+			if (_reactorWorkerStandbySendRequests(pReactorImpl, pReactorChannel) != RSSL_RET_SUCCESS)
+				_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+			break;
+		default:
+			_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+			break;
+	}
+}
+
+/* Processes a message received on a standby connection. Returns RSSL_RET_FAILURE if the standby connection should be closed. */
+static RsslRet _reactorWorkerStandbyProcessMsg(RsslReactorChannelImpl *pReactorChannel, RsslBuffer *pBuffer)
+{
+	RsslChannel *pChannel = pReactorChannel->pStandbyChannel;
+	RsslDecodeIterator dIter;
+	RsslMsg msg;
+	const RsslState *pState;
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorRWFVersion(&dIter, pChannel->majorVersion, pChannel->minorVersion);
+	rsslSetDecodeIteratorBuffer(&dIter, pBuffer);
+
+	if (rsslDecodeMsg(&dIter, &msg) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	pState = rsslGetState(&msg);
+
+	switch(msg.msgBase.domainType)
+	{
+		case RSSL_DMT_LOGIN:
+			if (pState)
+			{
+				if (pState->streamState != RSSL_STREAM_OPEN)
+					return RSSL_RET_FAILURE;
+
+				pReactorChannel->standbyLoggedIn = (pState->dataState == RSSL_DATA_OK);
+			}
+			break;
+
+		case RSSL_DMT_SOURCE:
+			if (msg.msgBase.streamId != STANDBY_DIRECTORY_STREAM_ID)
+				break;
+
+			if (msg.msgBase.msgClass == RSSL_MC_REFRESH)
+			{
+				if (msg.refreshMsg.flags & RSSL_RFMF_REFRESH_COMPLETE)
+					pReactorChannel->standbyHaveDirectory = RSSL_TRUE;
+			}
+			else if (pState && pState->streamState != RSSL_STREAM_OPEN && !pReactorChannel->standbyHaveDirectory)
+				return RSSL_RET_FAILURE;
+			break;
+
+		default:
+			break;
+	}
+
+	if (pReactorChannel->standbyLoggedIn && pReactorChannel->standbyHaveDirectory)
+		pReactorChannel->standbyState = RSSL_RC_SBST_READY;
+	else if (pReactorChannel->standbyState == RSSL_RC_SBST_READY)
+		pReactorChannel->standbyState = RSSL_RC_SBST_LOGGING_IN;
+
+	return RSSL_RET_SUCCESS;
+}
+
+static void _reactorWorkerProcessStandby(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslNotifierEvent *pNotifierEvent)
+{
+	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
+	RsslChannel *pChannel = pReactorChannel->pStandbyChannel;
+	RsslError rsslError;
+	RsslRet ret;
+
+	if (rsslNotifierEventIsFdBad(pNotifierEvent))
+	{
+		if (rsslNotifierUpdateEventFd(pReactorWorker->pNotifier, pNotifierEvent, (int)pChannel->socketId) < 0)
+			_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+		return;
+	}
+
+	if (pReactorChannel->standbyState == RSSL_RC_SBST_INITIALIZING)
+	{
+		RsslInProgInfo inProg = RSSL_INIT_IN_PROG_INFO;
+
+		rsslNotifierUnregisterWrite(pReactorWorker->pNotifier, pNotifierEvent);
+
+		switch(rsslInitChannel(pChannel, &inProg, &rsslError))
+		{
+			case RSSL_RET_CHAN_INIT_IN_PROGRESS:
+				if (inProg.flags & RSSL_IP_FD_CHANGE)
+				{
+					if (rsslNotifierUpdateEventFd(pReactorWorker->pNotifier, pNotifierEvent, (int)pChannel->socketId) < 0
+							|| rsslNotifierRegisterRead(pReactorWorker->pNotifier, pNotifierEvent) < 0
+							|| rsslNotifierRegisterWrite(pReactorWorker->pNotifier, pNotifierEvent) < 0)
+						_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+				}
+				break;
+
+			case RSSL_RET_SUCCESS:
+				if (_reactorWorkerStandbySendRequests(pReactorImpl, pReactorChannel) != RSSL_RET_SUCCESS)
+					_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+				break;
+
+			default:
+				_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+				break;
+		}
+		return;
+	}
+
+	if (rsslNotifierEventIsWritable(pNotifierEvent))
+	{
+		if ((ret = rsslFlush(pChannel, &rsslError)) < RSSL_RET_SUCCESS)
+		{
+			_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+			return;
+		}
+		else if (ret == 0)
+			rsslNotifierUnregisterWrite(pReactorWorker->pNotifier, pNotifierEvent);
+	}
+
+	if (rsslNotifierEventIsReadable(pNotifierEvent))
+	{
+		do
+		{
+			RsslBuffer *pBuffer = rsslRead(pChannel, &ret, &rsslError);
+
+			if (pBuffer)
+			{
+				pReactorChannel->standbyLastReadMs = pReactorWorker->lastRecordedTimeMs;
+				if (_reactorWorkerStandbyProcessMsg(pReactorChannel, pBuffer) != RSSL_RET_SUCCESS)
+				{
+					_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+					return;
+				}
+			}
+			else switch(ret)
+			{
+				case RSSL_RET_READ_PING:
+					pReactorChannel->standbyLastReadMs = pReactorWorker->lastRecordedTimeMs;
+					break;
+				case RSSL_RET_READ_FD_CHANGE:
+					if (rsslNotifierUpdateEventFd(pReactorWorker->pNotifier, pNotifierEvent, (int)pChannel->socketId) < 0)
+					{
+						_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+						return;
+					}
+					break;
+				case RSSL_RET_READ_WOULD_BLOCK:
+					break;
+				default:
+					if (ret < RSSL_RET_SUCCESS)
+					{
+						_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+						return;
+					}
+					break;
+			}
+		} while (ret > 0);
+	}
+}
+
+static void _reactorWorkerCheckStandby(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
+{
+	RsslReactorWorker *pReactorWorker = &pReactorImpl->reactorWorker;
+	RsslInt64 pingIntervalMs;
+	RsslError rsslError;
+
+	switch(pReactorChannel->standbyState)
+	{
+		case RSSL_RC_SBST_NONE:
+			/* Retry the standby connection at the maximum reconnect delay. */
+			if (pReactorChannel->lastStandbyAttemptMs == 0
+					|| pReactorWorker->lastRecordedTimeMs - pReactorChannel->lastStandbyAttemptMs >= pReactorChannel->reconnectMaxDelay)
+				_reactorWorkerConnectStandby(pReactorImpl, pReactorChannel);
+			else
+				_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->lastStandbyAttemptMs 
+							+ pReactorChannel->reconnectMaxDelay - pReactorWorker->lastRecordedTimeMs));
+			break;
+
+		case RSSL_RC_SBST_INITIALIZING:
+		case RSSL_RC_SBST_LOGGING_IN:
+		{
+			/* The standby connection must be initialized and logged in within the initialization timeout. */
+			RsslInt64 timeoutMs = (RsslInt64)pReactorChannel->connectionOptList[pReactorChannel->standbyListIter].initializationTimeout * 1000;
+
+			if (pReactorWorker->lastRecordedTimeMs - pReactorChannel->standbyStartTimeMs > timeoutMs)
+			{
+				_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+				return;
+			}
+			_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->standbyStartTimeMs + timeoutMs
+						- pReactorWorker->lastRecordedTimeMs));
+			break;
+		}
+
+		default:
+			break;
+	}
+
+	if (pReactorChannel->standbyState != RSSL_RC_SBST_LOGGING_IN && pReactorChannel->standbyState != RSSL_RC_SBST_READY)
+		return;
+
+	/* Close the standby connection if the provider stopped pinging it; ping it otherwise. */
+	if (pReactorWorker->lastRecordedTimeMs - pReactorChannel->standbyLastReadMs > (RsslInt64)pReactorChannel->pStandbyChannel->pingTimeout * 1000)
+	{
+		_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+		return;
+	}
+
+	pingIntervalMs = (RsslInt64)(pReactorChannel->pStandbyChannel->pingTimeout * 1000 * pingIntervalFactor);
+	if (pReactorWorker->lastRecordedTimeMs - pReactorChannel->standbyLastPingSentMs > pingIntervalMs)
+	{
+		if (rsslPing(pReactorChannel->pStandbyChannel, &rsslError) < RSSL_RET_SUCCESS)
+		{
+			_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+			return;
+		}
+		pReactorChannel->standbyLastPingSentMs = pReactorWorker->lastRecordedTimeMs;
+		_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)pingIntervalMs);
+	}
+	else
+		_reactorWorkerCalculateNextTimeout(pReactorImpl, (RsslUInt32)(pReactorChannel->standbyLastPingSentMs + pingIntervalMs
+					- pReactorWorker->lastRecordedTimeMs));
+}
+
+static RsslBool _reactorWorkerPromoteStandby(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
+{
+	if (pReactorChannel->standbyState != RSSL_RC_SBST_READY)
+	{
+		/* Reconnect normally. The standby connection would duplicate the next reconnection attempt. */
+		_reactorWorkerCloseStandby(pReactorImpl, pReactorChannel);
+		return RSSL_FALSE;
+	}
+
+	/* The channel's own notifier event is added for the connection by _reactorWorkerProcessNewChannel. */
+	rsslNotifierRemoveEvent(pReactorImpl->reactorWorker.pNotifier, pReactorChannel->pStandbyNotifierEvent);
+
+	pReactorChannel->reactorChannel.pRsslChannel = pReactorChannel->pStandbyChannel;
+	pReactorChannel->pStandbyChannel = NULL;
+	pReactorChannel->standbyState = RSSL_RC_SBST_NONE;
+	pReactorChannel->lastStandbyAttemptMs = pReactorImpl->reactorWorker.lastRecordedTimeMs;
+
+	pReactorChannel->connectionListIter = pReactorChannel->standbyListIter;
+	pReactorChannel->reactorChannel.userSpecPtr = pReactorChannel->connectionOptList[pReactorChannel->connectionListIter].rsslConnectOptions.userSpecPtr;
+	pReactorChannel->initializationTimeout = pReactorChannel->connectionOptList[pReactorChannel->connectionListIter].initializationTimeout;
+	pReactorChannel->channelSetupState = RSSL_RC_CHST_INIT;
+
+	return RSSL_TRUE;
+}
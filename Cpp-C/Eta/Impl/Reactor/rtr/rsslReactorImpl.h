@@ -20,6 +20,8 @@
 #include "rtr/rsslThread.h"
 #include "rtr/rsslReactorUtils.h"
 #include "rtr/tunnelManager.h"
+#include "rtr/rsslReactorItemCache.h"
+#include "rtr/rsslHeapBuffer.h"
 
 #ifdef WIN32
 #include <windows.h>
@@ -45,6 +47,15 @@ typedef enum
 	RSSL_RC_CHST_RECONNECTING = 6
 } RsslReactorChannelSetupState;
 
+/* State of a channel's warm standby connection. */
+typedef enum
+{
+	RSSL_RC_SBST_NONE = 0,			/* No standby connection. */
+	RSSL_RC_SBST_INITIALIZING = 1,	/* Standby connection is initializing. */
+	RSSL_RC_SBST_LOGGING_IN = 2,	/* Login and directory requests were sent on the standby connection. */
+	RSSL_RC_SBST_READY = 3			/* Standby connection is logged in and has its directory; the channel can fail over to it. */
+} RsslReactorStandbyState;
+
 /* RsslReactorChannelImpl 
  * - Handles a channel associated with the RsslReactor */
 typedef struct 
@@ -69,6 +80,8 @@ typedef struct
 	RsslBool	tunnelDispatchEventQueued;
 
 	RsslRDMMsg rdmMsg;				/* The typed message that has been decoded */
+	RsslBuffer rdmDecodeBuffer;		/* Memory for the lists of typed messages decoded for callbacks. Grows to fit the largest message
+									 * seen, and is kept when the channel is reused from the pool. */
 	RsslReactorChannelSetupState channelSetupState;
 	RsslBuffer *pWriteCallAgainBuffer; /* Used when WRITE_CALL_AGAIN is returned from an internal rsslReactorSubmit() call. */
 
@@ -99,6 +112,29 @@ typedef struct
 	RsslInt32 connectionListIter;
 	RsslReactorConnectInfo *connectionOptList;
 	TunnelManager *pTunnelManager;
+
+	/* Warm standby. While the channel is active, the worker keeps a second connection to the next
+	 * entry of the connection list logged in, and fails over to it instead of reconnecting. */
+	RsslBool warmStandbyEnabled;
+	RsslReactorStandbyState standbyState;	/* Worker thread only */
+	RsslChannel *pStandbyChannel;
+	RsslNotifierEvent *pStandbyNotifierEvent;
+	RsslInt32 standbyListIter;				/* Entry of connectionOptList used by the standby connection. */
+	RsslInt64 standbyStartTimeMs;
+	RsslInt64 standbyLastPingSentMs;
+	RsslInt64 standbyLastReadMs;
+	RsslInt64 lastStandbyAttemptMs;
+	RsslBool standbyLoggedIn;
+	RsslBool standbyHaveDirectory;
+
+	/* Packing of submitted messages. Small messages are copied into pPackingBuffer, which is written when
+	 * it is full or when its first message has waited for packingLatencyBudget microseconds. */
+	RsslUInt32 packingLatencyBudget;
+	RsslBuffer *pPackingBuffer;
+	RsslUInt32 packingBufferSize;		/* Size of packed buffers(the channel's maxFragmentSize), or 0 if not yet known. */
+	RsslInt64 packingStartTimeUs;		/* Time the first message was packed into pPackingBuffer. */
+	RsslWritePriorities packingPriority;
+	RsslReactorPackingStats packingStats;
 } RsslReactorChannelImpl;
 
 RTR_C_INLINE void rsslClearReactorChannelImpl(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pInfo)
@@ -195,6 +231,8 @@ RTR_C_INLINE void rsslResetReactorChannelState(RsslReactorImpl *pReactorImpl, Rs
 	pReactorChannel->readRet = 0;
 	pReactorChannel->writeRet = 0;
 	pReactorChannel->pWriteCallAgainBuffer = 0;
+	pReactorChannel->pPackingBuffer = 0;
+	pReactorChannel->packingBufferSize = 0;
 }
 
 
@@ -213,6 +251,12 @@ RTR_C_INLINE void rsslResetReactorChannel(RsslReactorImpl *pReactorImpl, RsslRea
 	pReactorChannel->connectionListCount = 0;
 	pReactorChannel->connectionListIter = 0;
 	pReactorChannel->connectionOptList = NULL;
+	pReactorChannel->warmStandbyEnabled = RSSL_FALSE;
+	pReactorChannel->standbyState = RSSL_RC_SBST_NONE;
+	pReactorChannel->pStandbyChannel = NULL;
+	pReactorChannel->lastStandbyAttemptMs = 0;
+	pReactorChannel->packingLatencyBudget = 0;
+	memset(&pReactorChannel->packingStats, 0, sizeof(RsslReactorPackingStats));
 	pReactorChannel->reactorChannel.socketId = (RsslSocket)REACTOR_INVALID_SOCKET;
 	pReactorChannel->reactorChannel.oldSocketId = (RsslSocket)REACTOR_INVALID_SOCKET;
 
@@ -298,8 +342,6 @@ struct _RsslReactorImpl
 	RsslNotifier *pNotifier; /* Notifier for reactorEventQueue and channels */
 	RsslNotifierEvent *pQueueNotifierEvent; /* Notification for reactorEventQueue */
 
-	RsslBuffer memoryBuffer;
-
 	RsslInt64 lastRecordedTimeMs;
 
 	RsslInt32 channelCount;			/* Total number of channels in use. */
@@ -311,10 +353,12 @@ struct _RsslReactorImpl
 	RsslReactorEventQueueGroup activeEventQueueGroup;
 
 	RsslReactorWorker reactorWorker;						/* The reactor's worker */
-	RsslInt32 dispatchDecodeMemoryBufferSize;					/* The size to allocate for the temporary decoding block. This is used for decoding to the RDM structures. */
+	RsslInt32 dispatchDecodeMemoryBufferSize;					/* Initial size of each channel's rdmDecodeBuffer. */
 	RsslReactorState state;
 
 	RsslInt64 ticksPerMsec;
+
+	RsslReactorItemCache *pItemCache;	/* Provider item cache, if enabled. */
 };
 
 RTR_C_INLINE void rsslClearReactorImpl(RsslReactorImpl *pReactorImpl)
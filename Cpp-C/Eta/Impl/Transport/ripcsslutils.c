@@ -26,6 +26,128 @@ static ripcSSLCTXApiFuncs ctxFuncs = INIT_SSL_CTX_FUNCS;
 static ripcCryptoApiFuncs cryptoFuncs = INIT_CRYPTO_API_FUNCS;
 static ripcSSLBIOApiFuncs bioFuncs = INIT_SSL_BIO_API_FUNCS;
 
+/* Sessions from completed client handshakes, so that reconnecting to the same host and port can resume the
+ * session with an abbreviated handshake instead of doing the full key exchange again. */
+typedef struct ripcSSLCachedSession
+{
+	struct ripcSSLCachedSession *next;
+	char			*key;		/* host:port */
+	ripcSSLProtocolFlags protocol;
+	SSL_SESSION		*session;
+} ripcSSLCachedSession;
+
+static ripcSSLCachedSession *cachedSessionList = 0;
+static RsslUInt32 cachedSessionCount = 0;
+static RSSL_STATIC_MUTEX_DECL(cachedSessionLock);
+
+RsslInt32 ripcSSLResumeCachedSession(ripcSSLSession *sess)
+{
+	ripcSSLCachedSession *pCached;
+
+	if (sess->resumptionKey == 0)
+		return 0;
+
+	RSSL_STATIC_MUTEX_LOCK(cachedSessionLock);
+	for (pCached = cachedSessionList; pCached; pCached = pCached->next)
+	{
+		if (pCached->protocol == sess->sessionProtocol && strcmp(pCached->key, sess->resumptionKey) == 0)
+		{
+			/* SSL_set_session takes its own reference to the session. */
+			(*(sslFuncs.set_session))(sess->connection, pCached->session);
+			break;
+		}
+	}
+	RSSL_STATIC_MUTEX_UNLOCK(cachedSessionLock);
+
+	return (pCached != 0);
+}
+
+void ripcSSLCacheSession(ripcSSLSession *sess)
+{
+	ripcSSLCachedSession *pCached, *pPrev = 0;
+	SSL_SESSION *pSession;
+
+	if (sess->resumptionKey == 0 || (pSession = (*(sslFuncs.get1_session))(sess->connection)) == 0)
+		return;
+
+	RSSL_STATIC_MUTEX_LOCK(cachedSessionLock);
+	for (pCached = cachedSessionList; pCached; pPrev = pCached, pCached = pCached->next)
+	{
+		if (pCached->protocol == sess->sessionProtocol && strcmp(pCached->key, sess->resumptionKey) == 0)
+			break;
+	}
+
+	if (pCached)
+	{
+		(*(sslFuncs.session_free))(pCached->session);
+		pCached->session = pSession;
+
+		/* Move it to the front, so the least recently connected entries are at the back. */
+		if (pPrev)
+		{
+			pPrev->next = pCached->next;
+			pCached->next = cachedSessionList;
+			cachedSessionList = pCached;
+		}
+	}
+	else if ((pCached = (ripcSSLCachedSession*)_rsslMalloc(sizeof(ripcSSLCachedSession))) != 0
+			&& (pCached->key = (char*)_rsslMalloc(strlen(sess->resumptionKey) + 1)) != 0)
+	{
+		strcpy(pCached->key, sess->resumptionKey);
+		pCached->protocol = sess->sessionProtocol;
+		pCached->session = pSession;
+		pCached->next = cachedSessionList;
+		cachedSessionList = pCached;
+
+		if (++cachedSessionCount > RIPC_SSL_MAX_CACHED_SESSIONS)
+		{
+			/* Drop the least recently connected entry. */
+			for (pPrev = cachedSessionList; pPrev->next->next; pPrev = pPrev->next);
+			pCached = pPrev->next;
+			pPrev->next = 0;
+			--cachedSessionCount;
+
+			(*(sslFuncs.session_free))(pCached->session);
+			_rsslFree(pCached->key);
+			_rsslFree(pCached);
+		}
+	}
+	else
+	{
+		if (pCached)
+			_rsslFree(pCached);
+		(*(sslFuncs.session_free))(pSession);
+	}
+	RSSL_STATIC_MUTEX_UNLOCK(cachedSessionLock);
+}
+
+RsslUInt32 ripcSSLCachedSessionCount(void)
+{
+	RsslUInt32 count;
+
+	RSSL_STATIC_MUTEX_LOCK(cachedSessionLock);
+	count = cachedSessionCount;
+	RSSL_STATIC_MUTEX_UNLOCK(cachedSessionLock);
+
+	return count;
+}
+
+void ripcSSLClearSessionCache(void)
+{
+	ripcSSLCachedSession *pCached;
+
+	RSSL_STATIC_MUTEX_LOCK(cachedSessionLock);
+	while ((pCached = cachedSessionList) != 0)
+	{
+		cachedSessionList = pCached->next;
+		(*(sslFuncs.session_free))(pCached->session);
+		_rsslFree(pCached->key);
+		_rsslFree(pCached);
+	}
+	cachedSessionCount = 0;
+	RSSL_STATIC_MUTEX_UNLOCK(cachedSessionLock);
+}
+
 /* This should only get populated once upon lib load.  If it's none, that's an error case */
 static ripcSSLProtocolFlags supportedProtocols = RIPC_PROTO_SSL_NONE;
 
@@ -141,6 +263,15 @@ RsslInt32 ripcInitializeSSL(char* libsslName, char* libcryptoName)
 			
 		if((sslFuncs.ssl_free = RIPC_DLSYM(sslHandle, "SSL_free")) == 0)
 			goto sslLoadError;
+
+		if((sslFuncs.set_session = RIPC_DLSYM(sslHandle, "SSL_set_session")) == 0)
+			goto sslLoadError;
+
+		if((sslFuncs.get1_session = RIPC_DLSYM(sslHandle, "SSL_get1_session")) == 0)
+			goto sslLoadError;
+
+		if((sslFuncs.session_free = RIPC_DLSYM(sslHandle, "SSL_SESSION_free")) == 0)
+			goto sslLoadError;
 			
 		if((ctxFuncs.ctx_new = RIPC_DLSYM(sslHandle, "SSL_CTX_new")) == 0)
 			goto sslLoadError;
@@ -177,6 +308,12 @@ RsslInt32 ripcInitializeSSL(char* libsslName, char* libcryptoName)
 		
 		if((ctxFuncs.ctx_set_ex_data = RIPC_DLSYM(sslHandle, "SSL_CTX_set_ex_data")) == 0)
 			goto sslLoadError;
+
+		if((ctxFuncs.ctx_set_timeout = RIPC_DLSYM(sslHandle, "SSL_CTX_set_timeout")) == 0)
+			goto sslLoadError;
+
+		if((ctxFuncs.ctx_set_session_id_context = RIPC_DLSYM(sslHandle, "SSL_CTX_set_session_id_context")) == 0)
+			goto sslLoadError;
 	}
 	
 	if(cryptoHandle == 0)
@@ -274,7 +411,7 @@ RsslInt32 ripcInitializeSSL(char* libsslName, char* libcryptoName)
 	SSLfuncs.shutdownTransport = ripcShutdownSSLSocket; // shuts down socket on client or server side
 	SSLfuncs.readTransport = ripcSSLRead; // read function on client or server side
 	SSLfuncs.writeTransport = ripcSSLWrite; // write function on client or server side
-	SSLfuncs.writeVTransport = 0;
+	SSLfuncs.writeVTransport = ripcSSLWriteV; // gathered write function on client or server side
 	SSLfuncs.reconnectClient = ripcSSLReconnection;
 	SSLfuncs.acceptSocket = 0;
 	SSLfuncs.shutdownSrvrError = 0;
@@ -350,6 +487,8 @@ sslLoadError:
 
 void ripcUninitializeSSL(void)
 {
+	ripcSSLClearSessionCache();
+
 	if (cryptoHandle)
 	{
 		(*(cryptoFuncs.evp_cleanup))();
@@ -513,6 +652,9 @@ ripcSSLSession *ripcSSLNewSession(RsslSocket fd, char* name, ripcSSLServer *serv
 	session->ctx = 0;
 	session->connection = 0;
 	session->clientConnState = SSL_INITIALIZING;
+	session->writeBuffer = 0;
+	session->resumptionKey = 0;
+	session->sessionProtocol = RIPC_PROTO_SSL_NONE;
 	
 	/* we only need to initialize the connect opts for client side configs - if its 
 	   a server side channel, just point it to the servers config */
@@ -813,6 +955,14 @@ SSL_CTX* ripcSSLSetupCTX(RsslInt32 user, ripcSSLProtocolFlags version, ripcSSLCo
 		opts |= SSL_OP_SINGLE_DH_USE;
 		if (config->verifyLevel == ripcSSLRequireCA)
 			perm |= SSL_VERIFY_FAIL_IF_NO_PEER_CERT;
+
+		/* Let reconnecting clients resume their sessions, either from the server's session cache or from a session
+		 * ticket, so that a burst of reconnects does not each need a full key exchange.  The session ID context is
+		 * required for resumption when client certificates are verified. */
+		(*(ctxFuncs.ctx_ctrl))(ctx, SSL_CTRL_SET_SESS_CACHE_MODE, SSL_SESS_CACHE_SERVER, NULL);
+		(*(ctxFuncs.ctx_ctrl))(ctx, SSL_CTRL_SET_SESS_CACHE_SIZE, RIPC_SSL_SERVER_SESSION_CACHE_SIZE, NULL);
+		(*(ctxFuncs.ctx_set_timeout))(ctx, RIPC_SSL_SESSION_TIMEOUT);
+		(*(ctxFuncs.ctx_set_session_id_context))(ctx, (const unsigned char*)"ripc", 4);
 	}
 
 	/* need to get CERTFILE from config */
@@ -929,6 +1079,82 @@ RsslInt32 ripcSSLWrite( void *sslSess, char *buf, RsslInt32 len, ripcRWFlags fla
 	return totalOut;
 }
 
+/* our transport writev function -
+   this gathers the buffers into chunks and writes each chunk with a single SSL_write, so that each chunk
+   is encrypted as one TLS record.  Returns the number of bytes written, which may be less than outLen
+   if the write would block; the ripc layer then calls this again with the remaining data. */
+RsslInt32 ripcSSLWriteV( void *sslSess, ripcIovType *iov, RsslInt32 iovcnt, RsslInt32 outLen, ripcRWFlags flags, RsslError *error)
+{
+	ripcSSLSession *sess = (ripcSSLSession*)sslSess;
+	RsslInt32 totalOut = 0;
+	RsslInt32 curIov = 0;
+	RsslInt32 iovOffset = 0;
+	RsslInt32 iovLen;
+	RsslInt32 chunkLen;
+	RsslInt32 copyLen;
+	RsslInt32 numBytes;
+	char *chunk;
+
+	while (totalOut < outLen && curIov < iovcnt)
+	{
+		iovLen = (RsslInt32)RIPC_IOV_GETLEN(&iov[curIov]);
+
+		if (iovLen - iovOffset >= RIPC_SSL_WRITE_CHUNK_SIZE || curIov == iovcnt - 1)
+		{
+			/* Large buffers, and the last one, are written from where they are. */
+			chunk = (char*)RIPC_IOV_GETBUF(&iov[curIov]) + iovOffset;
+			chunkLen = iovLen - iovOffset;
+			++curIov;
+			iovOffset = 0;
+		}
+		else
+		{
+			/* Gather buffers into the chunk until it is full.  Since the ripc layer calls this again with the
+			 * same leading data after a partial write, the chunk retried is the same as the one that blocked. */
+			if (sess->writeBuffer == 0)
+			{
+				if ((sess->writeBuffer = (char*)_rsslMalloc(RIPC_SSL_WRITE_CHUNK_SIZE)) == 0)
+				{
+					_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+					snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Could not allocate space for SSL write buffer.", __FILE__, __LINE__);
+					return (-1);
+				}
+			}
+
+			chunk = sess->writeBuffer;
+			chunkLen = 0;
+			while (curIov < iovcnt && chunkLen < RIPC_SSL_WRITE_CHUNK_SIZE)
+			{
+				iovLen = (RsslInt32)RIPC_IOV_GETLEN(&iov[curIov]);
+				copyLen = iovLen - iovOffset;
+				if (copyLen > RIPC_SSL_WRITE_CHUNK_SIZE - chunkLen)
+					copyLen = RIPC_SSL_WRITE_CHUNK_SIZE - chunkLen;
+
+				MemCopyByInt(chunk + chunkLen, (char*)RIPC_IOV_GETBUF(&iov[curIov]) + iovOffset, copyLen);
+				chunkLen += copyLen;
+				iovOffset += copyLen;
+
+				if (iovOffset == iovLen)
+				{
+					++curIov;
+					iovOffset = 0;
+				}
+			}
+		}
+
+		if ((numBytes = ripcSSLWrite(sslSess, chunk, chunkLen, flags, error)) < 0)
+			return numBytes;
+
+		totalOut += numBytes;
+
+		/* The write would block; let the ripc layer account for what was written. */
+		if (numBytes < chunkLen)
+			break;
+	}
+
+	return totalOut;
+}
+
 RsslInt32 ripcShutdownSSLSocket(void *session)
 {
 	ripcSSLSession *sess = (ripcSSLSession*)session;
@@ -1027,6 +1253,7 @@ RsslInt32 ripcSSLAccept(void *session, ripcSessInProg *inPr, RsslError *error)
 			{
 				sess->clientConnState = SSL_ACTIVE;
 				inPr->intConnState = (sess->clientConnState << 8);  
+				ripcSSLCacheSession(sess);
 				return 1;
 			}
 		}
@@ -1036,6 +1263,7 @@ RsslInt32 ripcSSLAccept(void *session, ripcSessInProg *inPr, RsslError *error)
 void *ripcSSLConnectInt(RsslSocket fd, RsslInt32 SSLProtocolVersion, RsslInt32 *initComplete, void* userSpecPtr, RsslError *error)
 {
 	RsslInt32 retVal = 0;
+	RsslSocketChannel *pChannel = (RsslSocketChannel*)userSpecPtr;
 	ripcSSLSession *sess = ripcInitializeSSLSession(fd, SSLProtocolVersion, 0, error);
 
 	if ((sess->bio = (*(bioFuncs.new_socket))(sess->socket, BIO_NOCLOSE)) == NULL)
@@ -1065,6 +1293,18 @@ void *ripcSSLConnectInt(RsslSocket fd, RsslInt32 SSLProtocolVersion, RsslInt32 *
 	(*(sslFuncs.set_bio))(sess->connection, sess->bio, sess->bio);
 	(*(sslFuncs.set_connect_state))(sess->connection);
 
+	/* resume the session from the last connection to this host and port, if there is one */
+	if (pChannel && pChannel->sslSessionResumption && pChannel->hostName && pChannel->serverName)
+	{
+		size_t keyLen = strlen(pChannel->hostName) + strlen(pChannel->serverName) + 2;
+
+		if ((sess->resumptionKey = (char*)_rsslMalloc(keyLen)) != 0)
+		{
+			snprintf(sess->resumptionKey, keyLen, "%s:%s", pChannel->hostName, pChannel->serverName);
+			ripcSSLResumeCachedSession(sess);
+		}
+	}
+
 	
 	(*(sslFuncs.set_ex_data))(sess->connection, 0, sess);  // Set the user spec pointer for this connection 
 
@@ -1090,6 +1330,7 @@ void *ripcSSLConnectInt(RsslSocket fd, RsslInt32 SSLProtocolVersion, RsslInt32 *
 	else /* This else implies that we are doing blocking. */
 	{
 		sess->clientConnState = SSL_ACTIVE;
+		ripcSSLCacheSession(sess);
 			*initComplete = 1;
 		}
 
@@ -1217,6 +1458,18 @@ RsslInt32 ripcReleaseSSLSession(void* session, RsslError *error)
 			sess->connection = 0;
 		}
 
+		if (sess->writeBuffer)
+		{
+			_rsslFree(sess->writeBuffer);
+			sess->writeBuffer = 0;
+		}
+
+		if (sess->resumptionKey)
+		{
+			_rsslFree(sess->resumptionKey);
+			sess->resumptionKey = 0;
+		}
+
 		_rsslFree(sess);
 	}
 	return 1;
@@ -1261,6 +1514,8 @@ ripcSSLSession *ripcInitializeSSLSession(RsslSocket fd, RsslInt32 SSLProtocolVer
 	if (sess == 0)
 		return 0;
 
+	sess->sessionProtocol = (ripcSSLProtocolFlags)SSLProtocolVersion;
+
 	/* setup the CTX - we are the client */
 	sess->ctx = ripcSSLSetupCTX(0, SSLProtocolVersion, &sess->config, error);
 
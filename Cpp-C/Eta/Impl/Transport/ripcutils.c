@@ -41,6 +41,7 @@
 
 #ifdef Linux
 #include <asm/ioctls.h>
+#include <linux/net_tstamp.h>
 #endif /* Linux */
 
 static rtr_atomic_val rtr_SocketInits = 0;
@@ -381,6 +382,43 @@ int ipcSockOpts(RsslSocket fd, ripcSocketOption *option)
 			break;
 		}
 
+		case RIPC_SOPT_BUSY_POLL:
+		{
+#if defined(Linux) && defined(SO_BUSY_POLL)
+			int busyPollTime = option->options.busy_poll_time;
+			if (setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, (char*)&busyPollTime, sizeof(busyPollTime)) < 0)
+				ret = -1;
+#else
+			ret = -1;
+#endif
+			break;
+		}
+
+		case RIPC_SOPT_RECV_TIMESTAMPS:
+		{
+			int timestampType = option->options.timestamp_type;
+
+			if (timestampType < RSSL_RECV_TIMESTAMP_NONE || timestampType > RSSL_RECV_TIMESTAMP_HARDWARE)
+				ret = -1;
+			else
+			{
+#if defined(Linux) && defined(SO_TIMESTAMPNS) && defined(SO_TIMESTAMPING)
+				int softwareOn = (timestampType == RSSL_RECV_TIMESTAMP_SOFTWARE);
+				int hardwareFlags = (timestampType == RSSL_RECV_TIMESTAMP_HARDWARE) ?
+					(SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE
+					 | SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE) : 0;
+
+				if (setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, (char*)&softwareOn, sizeof(softwareOn)) < 0
+						|| setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING, (char*)&hardwareFlags, sizeof(hardwareFlags)) < 0)
+					ret = -1;
+#else
+				if (timestampType != RSSL_RECV_TIMESTAMP_NONE)
+					ret = -1;
+#endif
+			}
+			break;
+		}
+
 		default:
 			ret = -1;
 			break;
@@ -611,6 +649,101 @@ int ipcRead( void *transport, char *buf, int max_len, ripcRWFlags flags, RsslErr
 	return((int)totalBytes);
 }
 
+#ifdef Linux
+RsslUInt64 ipcGetRecvTimestamp(struct msghdr *msg)
+{
+	struct cmsghdr *cmsg;
+
+	for (cmsg = CMSG_FIRSTHDR(msg); cmsg != NULL; cmsg = CMSG_NXTHDR(msg, cmsg))
+	{
+		struct timespec ts[3];
+
+		if (cmsg->cmsg_level != SOL_SOCKET)
+			continue;
+
+		if (cmsg->cmsg_type == SCM_TIMESTAMPNS)
+		{
+			memcpy(ts, CMSG_DATA(cmsg), sizeof(struct timespec));
+			return (RsslUInt64)ts[0].tv_sec * 1000000000ULL + (RsslUInt64)ts[0].tv_nsec;
+		}
+#ifdef SCM_TIMESTAMPING
+		else if (cmsg->cmsg_type == SCM_TIMESTAMPING)
+		{
+			/* ts[0] is the software timestamp, ts[2] the raw hardware timestamp. */
+			memcpy(ts, CMSG_DATA(cmsg), sizeof(ts));
+			if (ts[2].tv_sec || ts[2].tv_nsec)
+				ts[0] = ts[2];
+			return (RsslUInt64)ts[0].tv_sec * 1000000000ULL + (RsslUInt64)ts[0].tv_nsec;
+		}
+#endif
+	}
+
+	return 0;
+}
+#endif
+
+int ipcReadTimestamp(void *transport, char *buf, int max_len, ripcRWFlags flags, RsslUInt64 *pTimestamp, RsslError *error)
+{
+#ifdef Linux
+	struct msghdr msg;
+	struct iovec iov;
+	char control[RIPC_RECV_TIMESTAMP_CONTROL_LEN];
+	ssize_t numBytes;
+	int totalBytes = 0;
+	RsslUInt64 timestamp;
+
+	while (totalBytes < max_len)
+	{
+		iov.iov_base = buf + totalBytes;
+		iov.iov_len = (size_t)(max_len - totalBytes);
+		memset(&msg, 0, sizeof(msg));
+		msg.msg_iov = &iov;
+		msg.msg_iovlen = 1;
+		msg.msg_control = control;
+		msg.msg_controllen = sizeof(control);
+
+		numBytes = recvmsg((RsslSocket)(intptr_t)transport, &msg, 0);
+
+		if (numBytes > 0)
+		{
+			totalBytes += (int)numBytes;
+			if ((timestamp = ipcGetRecvTimestamp(&msg)) != 0)
+				*pTimestamp = timestamp;
+		}
+		else if (numBytes < 0)
+		{
+			error->text[0] = '\0';
+			if ((errno == _IPC_WOULD_BLOCK) || (errno == EINTR))
+			{
+				if (!(flags & RIPC_RW_BLOCKING))
+					return(totalBytes);
+			}
+			else
+			{
+				return(-1);
+			}
+		}
+		else	/* numBytes == 0 */
+		{
+			if (totalBytes)
+				return totalBytes;
+			else
+			{
+				error->text[0] = '\0';
+				return(-2);
+			}
+		}
+
+		if ((flags & RIPC_RW_BLOCKING) && (totalBytes != 0) && (!(flags & RIPC_RW_WAITALL)))
+			break;
+	}
+
+	return(totalBytes);
+#else
+	return ipcRead(transport, buf, max_len, flags, error);
+#endif
+}
+
 int ipcWriteV( void *transport, ripcIovType *iov, int iovcnt, int outLen, ripcRWFlags flags, RsslError *error)
 {
 #ifdef _WIN32
@@ -1657,6 +1657,7 @@ RSSL_API RsslBuffer* rsslReadEx(RsslChannel *chnl, RsslReadInArgs *readInArgs, R
 	}
 
 	readOutArgs->readOutFlags = RSSL_READ_OUT_NO_FLAGS;
+	readOutArgs->transportReads = 0;
 	/* lock the channel mutex so that only one read per channel can occur */
 	/* if its already locked, return read in progress */
 	rsslChnlImpl = (rsslChannelImpl*)chnl;
@@ -2213,6 +2214,11 @@ RSSL_API RsslBuffer* rsslPackBuffer(RsslChannel *chnl, RsslBuffer *buffer,  Rssl
 	return (*(rsslChnlImpl->channelFuncs->channelPackBuffer))(rsslChnlImpl, rsslBufImpl, error);
 }	
 
+RSSL_API RsslBool rsslIsPackedBuffer(RsslBuffer *buffer)
+{
+	return (buffer && ((rsslBufferImpl*)buffer)->packingOffset > 0) ? RSSL_TRUE : RSSL_FALSE;
+}
+
 RSSL_API RsslBuffer* rsslGetBuffer(RsslChannel *chnl, RsslUInt32 size, RsslBool packedBuffer, RsslError *error)
 {
 	rsslChannelImpl *rsslChnlImpl=0;
@@ -28,6 +28,7 @@
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <fcntl.h>
+#include "rtr/ripcutils.h"
 #endif
 
 #if defined(_WIN16) || defined(_WIN32)
@@ -104,6 +105,8 @@ typedef struct
 	RsslUInt16			readPort;
 	RsslUInt64			pktRecvCount;
 	RsslUInt64			pktSentCount;
+	RsslUInt8			recvTimestampType;			/* RsslRecvTimestampTypes (see RSSL_RECV_TIMESTAMPS) */
+	RsslUInt64			recvTimestamp;				/* Receive timestamp for the current packet, if any */
 	struct sockaddr_in	sendAddr;
 	struct sockaddr_in	recvAddr;
 	rtrSeqMcastBuffer	writeBuffer;
@@ -148,6 +151,37 @@ RTR_C_ALWAYS_INLINE int seqMcastTrylock(RsslMutex *seqMcastLock)
 }
 
 
+/* Receives the next packet into the input buffer. When receive timestamps are on, the packet is received with
+ * recvmsg() so that its timestamp can be recorded in recvTimestamp. */
+RTR_C_ALWAYS_INLINE RsslInt32 seqMcastRecv(rsslChannelImpl *rsslChnlImpl, RsslSeqMcastChannel *pSeqMcastChannel, struct sockaddr_in *pSrcAddr, RsslInt32 *pSrcAddrLen)
+{
+#ifdef Linux
+	if (pSeqMcastChannel->recvTimestampType != RSSL_RECV_TIMESTAMP_NONE)
+	{
+		struct msghdr msg;
+		struct iovec iov;
+		char control[RIPC_RECV_TIMESTAMP_CONTROL_LEN];
+		RsslInt32 cc;
+
+		iov.iov_base = pSeqMcastChannel->inputBuffer.data;
+		iov.iov_len = pSeqMcastChannel->maxMsgSize + SEQ_MCAST_MAX_HDR_LEN;
+		memset(&msg, 0, sizeof(msg));
+		msg.msg_name = pSrcAddr;
+		msg.msg_namelen = (socklen_t)*pSrcAddrLen;
+		msg.msg_iov = &iov;
+		msg.msg_iovlen = 1;
+		msg.msg_control = control;
+		msg.msg_controllen = sizeof(control);
+
+		if ((cc = (RsslInt32)recvmsg(rsslChnlImpl->Channel.socketId, &msg, 0)) >= 0)
+			pSeqMcastChannel->recvTimestamp = ipcGetRecvTimestamp(&msg);
+		return cc;
+	}
+#endif
+
+	return (RsslInt32)recvfrom(rsslChnlImpl->Channel.socketId, pSeqMcastChannel->inputBuffer.data, pSeqMcastChannel->maxMsgSize + SEQ_MCAST_MAX_HDR_LEN, 0, (struct sockaddr*)pSrcAddr, (socklen_t*)pSrcAddrLen);
+}
+
 /* Write the Sequence Multicast Header to the channel impl.  
 	Preconditions: buf's space has been pre-allocated, and everything's been range checked to ensure that no overflow is possible
 	
@@ -323,6 +357,8 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 	pSeqMcastChannel->writeSeqNum = 0;
 	pSeqMcastChannel->pktRecvCount = 0;
 	pSeqMcastChannel->pktSentCount = 0;
+	pSeqMcastChannel->recvTimestampType = RSSL_RECV_TIMESTAMP_NONE;
+	pSeqMcastChannel->recvTimestamp = 0;
 	pSeqMcastChannel->instanceId = opts->seqMulticastOpts.instanceId;
 	memset(&pSeqMcastChannel->sendAddr, 0, sizeof(pSeqMcastChannel->sendAddr));
 	memset(&pSeqMcastChannel->recvAddr, 0, sizeof(pSeqMcastChannel->recvAddr));
@@ -769,6 +805,28 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastIoctl(rsslChannelImpl *rsslCh
 				return RSSL_RET_FAILURE;
 			}
 			break;
+		case RSSL_RECV_TIMESTAMPS:
+		{
+#ifdef Linux
+			ripcSocketOption opts;
+
+			opts.code = RIPC_SOPT_RECV_TIMESTAMPS;
+			opts.options.timestamp_type = *(RsslInt32*)value;
+			if (ipcSockOpts(rsslChnlImpl->Channel.socketId, &opts) < 0)
+#else
+			if (*(RsslInt32*)value != RSSL_RECV_TIMESTAMP_NONE)
+#endif
+			{
+				_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+				snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslIoctl() Error: 1002 Unable to set receive timestamp type to (%d). System errno: (%d).\n", __FILE__, __LINE__, *(RsslInt32*)value, errno);
+				if (chnlLocking)
+					seqMcastUnlock(&pSeqMcastChannel->lock);
+				return RSSL_RET_FAILURE;
+			}
+			pSeqMcastChannel->recvTimestampType = (RsslUInt8)*(RsslInt32*)value;
+			pSeqMcastChannel->recvTimestamp = 0;
+			break;
+		}
 		/* we dont do anything with these codes in the Sequence Multicast connection. Just return success. */
 		case RSSL_MAX_NUM_BUFFERS:
 		case RSSL_NUM_GUARANTEED_BUFFERS:
@@ -897,7 +955,7 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslBuffer*) rsslSeqMcastRead(rsslChannelImpl* rss
 		{
 			pSeqMcastChannel->inputBuffer.data = pSeqMcastChannel->inputBufferMem;
 
-			if ((cc = recvfrom(rsslChnlImpl->Channel.socketId, pSeqMcastChannel->inputBuffer.data, pSeqMcastChannel->maxMsgSize + SEQ_MCAST_MAX_HDR_LEN, 0, (struct sockaddr*)&srcAddr, (socklen_t*)&srcAddrLen)) < 0)
+			if ((cc = seqMcastRecv(rsslChnlImpl, pSeqMcastChannel, &srcAddr, &srcAddrLen)) < 0)
 			{
 				if(errno == EINTR || errno == EWOULDBLOCK || errno == EAGAIN)
 				{
@@ -1131,6 +1189,12 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslBuffer*) rsslSeqMcastRead(rsslChannelImpl* rss
 	readOutArgs->nodeId.port = pSeqMcastChannel->readPort;
 	readOutArgs->instanceId = pSeqMcastChannel->readInstanceID;
 
+	if (pSeqMcastChannel->recvTimestamp != 0)
+	{
+		readOutArgs->readOutFlags |= RSSL_READ_OUT_RECV_TIMESTAMP;
+		readOutArgs->recvTimestamp = pSeqMcastChannel->recvTimestamp;
+	}
+
 	if ((rsslChnlImpl->debugFlags & RSSL_DEBUG_RSSL_DUMP_IN) && (pSeqMcastChannel->readBuffer.length))
 		(*(rsslSeqMcastDumpInFunc))(__FUNCTION__, pSeqMcastChannel->readBuffer.data, pSeqMcastChannel->readBuffer.length, rsslChnlImpl->Channel.socketId);
 
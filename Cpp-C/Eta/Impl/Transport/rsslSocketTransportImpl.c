@@ -507,8 +507,59 @@ RsslServerSocketChannel* newRsslServerSocketChannel()
 *		from the ipc headers with compression enabled.
 *********************************************/
 
+/* Returns the size of the input buffer to allocate for a channel. With read-ahead, the buffer holds at
+ * least the read-ahead size plus one maximum-size message, so that a partial message at the end of the
+ * buffer can always be completed after it is moved to the start. */
+static size_t ipcInputBufferSize(RsslSocketChannel *rsslSocketChannel, RsslUInt32 numInputBufs)
+{
+	size_t size = (size_t)rsslSocketChannel->maxMsgSize * numInputBufs;
+
+	if (rsslSocketChannel->readAheadSize && size < (size_t)rsslSocketChannel->readAheadSize + rsslSocketChannel->maxMsgSize)
+		size = (size_t)rsslSocketChannel->readAheadSize + rsslSocketChannel->maxMsgSize;
+
+	return size;
+}
+
+/* Returns how many bytes ipcReadSession should read at the end of the input buffer, when it needs
+ * at least minLength more bytes to complete the current header or message.
+ *
+ * Without read-ahead, this is just minLength. With read-ahead (non-blocking channels only), it is
+ * all the free space in the input buffer, so that one read also picks up any messages that follow.
+ * When the free space could not hold a full message, the unread data (which is at most one partial
+ * message) is first moved to the start of the buffer. This is what lets headers and messages that
+ * straddle the end of the buffer be completed without extra reads. */
+RTR_C_ALWAYS_INLINE RsslInt32 ipcReadAheadLength(RsslSocketChannel *rsslSocketChannel, RsslInt32 minLength)
+{
+	rtr_msgb_t *inputBuffer = rsslSocketChannel->inputBuffer;
+
+	if (!rsslSocketChannel->readAheadSize || rsslSocketChannel->blocking)
+		return minLength;
+
+	if (inputBuffer->maxLength - inputBuffer->length < (size_t)rsslSocketChannel->maxMsgSize
+			&& rsslSocketChannel->inputBufCursor > 0)
+	{
+		size_t unreadLength = inputBuffer->length - rsslSocketChannel->inputBufCursor;
+
+		memmove(inputBuffer->buffer, inputBuffer->buffer + rsslSocketChannel->inputBufCursor, unreadLength);
+		inputBuffer->length = unreadLength;
+		rsslSocketChannel->inputBufCursor = 0;
+	}
+
+	return (RsslInt32)(inputBuffer->maxLength - inputBuffer->length);
+}
+
+/* Reads from the channel's transport. When receive timestamps are on, the read also records the
+ * timestamp of the data in rsslSocketChannel->recvTimestamp. */
+RTR_C_ALWAYS_INLINE int ipcReadTransport(RsslSocketChannel *rsslSocketChannel, char *buf, int max_len, ripcRWFlags flags, RsslError *error)
+{
+	if (rsslSocketChannel->recvTimestampType != RSSL_RECV_TIMESTAMP_NONE)
+		return ipcReadTimestamp(rsslSocketChannel->transportInfo, buf, max_len, flags, &rsslSocketChannel->recvTimestamp, error);
+
+	return (*(rsslSocketChannel->transportFuncs->readTransport))(rsslSocketChannel->transportInfo, buf, max_len, flags, error);
+}
+
 rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readret, RsslInt32 *moreData, RsslInt32 *fragLength, RsslInt32 *fragId, 
-	RsslInt32* bytesRead, RsslInt32* uncompBytesRead, RsslInt32 *packing, RsslError *error)
+	RsslInt32* bytesRead, RsslInt32* uncompBytesRead, RsslInt32 *packing, RsslInt32 *transportReads, RsslError *error)
 {
 	RsslInt32  cc;
 	RsslUInt8  canRead = 1;
@@ -526,6 +577,7 @@ rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readr
 	RsslInt32  inBytes = 0;
 	ripcRWFlags	rwflags = RIPC_RW_NONE;
 	RsslInt32 httpHeaderLen = 0;
+	RsslInt32 readLength;
 
 	if (IPC_NULL_PTR(rsslSocketChannel, "ipcReadSession", "rsslSocketChannel", error))
 	{
@@ -558,8 +610,9 @@ rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readr
 #endif
 		IPC_MUTEX_UNLOCK(rsslSocketChannel);
 
-		cc = (*(rsslSocketChannel->transportFuncs->readTransport))(rsslSocketChannel->transportInfo,
-			rsslSocketChannel->inputBuffer->buffer, rsslSocketChannel->readSize, rwflags, error);
+		cc = ipcReadTransport(rsslSocketChannel,
+			rsslSocketChannel->inputBuffer->buffer, ipcReadAheadLength(rsslSocketChannel, rsslSocketChannel->readSize), rwflags, error);
+		++(*transportReads);
 
 #ifdef MUTEX_DEBUG
 	printf("LOCK rsslSocketChannel -- ipcReadSession (after transportFuncs->readTransport)\n");
@@ -650,10 +703,11 @@ rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readr
 #endif
 				IPC_MUTEX_UNLOCK(rsslSocketChannel);
 
-				cc = (*(rsslSocketChannel->transportFuncs->readTransport))(
-					rsslSocketChannel->transportInfo,
+				readLength = ipcReadAheadLength(rsslSocketChannel, (RsslInt32)((IPC_header_size + extendedHdr) - tempLen));
+				cc = ipcReadTransport(rsslSocketChannel,
 					(rsslSocketChannel->inputBuffer->buffer + rsslSocketChannel->inputBuffer->length),
-					((IPC_header_size + extendedHdr) - tempLen), rwflags, error);
+					readLength, rwflags, error);
+				++(*transportReads);
 
 #ifdef MUTEX_DEBUG
 	printf("LOCK rsslSocketChannel -- ipcReadSession (after transportFuncs->readTransport)\n");
@@ -813,10 +867,11 @@ rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readr
 #endif
 			IPC_MUTEX_UNLOCK(rsslSocketChannel);
 
-			cc = (*(rsslSocketChannel->transportFuncs->readTransport))(
-				rsslSocketChannel->transportInfo,
+			readLength = ipcReadAheadLength(rsslSocketChannel, (RsslInt32)(ipcLen - tempLen));
+			cc = ipcReadTransport(rsslSocketChannel,
 				(rsslSocketChannel->inputBuffer->buffer + rsslSocketChannel->inputBuffer->length),
-				(ipcLen - tempLen), rwflags, error);
+				readLength, rwflags, error);
+			++(*transportReads);
 
 #ifdef MUTEX_DEBUG
 	printf("LOCK rsslSocketChannel -- ipcReadSession (after transportFuncs->readTransport)\n");
@@ -6242,6 +6297,11 @@ static ripcSessInit ipcReconnectSocket(RsslSocketChannel *rsslSocketChannel, rip
 		userSpecPtr = (void*)&(rsslSocketChannel->numConnections);
 		rsslSocketChannel->transportFuncs = &(transFuncs[RSSL_CONN_TYPE_EXT_LINE_SOCKET]);
 	}
+	else if (rsslSocketChannel->connType == RSSL_CONN_TYPE_ENCRYPTED)
+	{
+		/* lets the SSL transport resume the session of the previous connection */
+		userSpecPtr = (void*)rsslSocketChannel;
+	}
 
 #ifdef MUTEX_DEBUG
 	printf("UNLOCK rsslSocketChannel -- ipcReconnectSocket\n");
@@ -6387,7 +6447,7 @@ ripcSessInit ipcWaitProxyAck(RsslSocketChannel *rsslSocketChannel, ripcSessInPro
 		}
 
 		rsslSocketChannel->transportInfo = (*(rsslSocketChannel->transportFuncs->newClientConnection))(
-			rsslSocketChannel->stream, &initcomplete, 0, error);
+			rsslSocketChannel->stream, &initcomplete, (void*)rsslSocketChannel, error);
 
 		if (rsslSocketChannel->transportInfo == 0)
 		{
@@ -6897,7 +6957,7 @@ ripcSessInit ipcWaitAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *in
 		printf("Session active ConnVer 0x%x ripcVer 0x%x comp %d\n", rsslSocketChannel->version->connVersion, versionNumber, rsslSocketChannel->inDecompress);
 
 	/* Initialize the input buffer */
-	rsslSocketChannel->inputBuffer = rtr_smplcAllocMsg(gblInputBufs, (rsslSocketChannel->maxMsgSize * rsslSocketChannel->readSize));
+	rsslSocketChannel->inputBuffer = rtr_smplcAllocMsg(gblInputBufs, ipcInputBufferSize(rsslSocketChannel, rsslSocketChannel->readSize));
 
 	if (rsslSocketChannel->inDecompress)
 	{
@@ -7181,6 +7241,7 @@ RsslRet rsslSocketBind(rsslServerImpl* rsslSrvrImpl, RsslBindOptions *opts, Rssl
 	rsslServerSocketChannel->maxGuarMsgs = opts->guaranteedOutputBuffers;
 
 	rsslServerSocketChannel->numInputBufs = opts->numInputBuffers;
+	rsslServerSocketChannel->readAheadSize = opts->tcpOpts.readAheadSize;
 
 	/* Create buffer pool for server */
 	if (opts->sharedPoolLock)
@@ -7503,8 +7564,10 @@ RsslRet rsslSocketConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opt
 		rsslSocketChannel->tcp_nodelay = 0;
 
 	rsslSocketChannel->numInputBufs = opts->numInputBuffers;
+	rsslSocketChannel->readAheadSize = opts->tcpOpts.readAheadSize;
 	
 	rsslSocketChannel->encryptionProtocolFlags = opts->encryptionOpts.encryptionProtocolFlags;
+	rsslSocketChannel->sslSessionResumption = opts->encryptionOpts.sessionResumption;
 
 	/* Set Proxy options, if present */
 	/* If we are on windows and using HTTP/Encrypted we shouldnt set these because options will come in from WinInet/IE settings */
@@ -7722,6 +7785,9 @@ RsslRet rsslSocketConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opt
 
 				return RSSL_RET_FAILURE;
 			}
+
+			/* lets the SSL transport resume the session of the previous connection */
+			userSpecPtr = (void*)rsslSocketChannel;
 		}
 		else
 		{
@@ -8060,6 +8126,7 @@ static RsslSocketChannel *ipcClientChannel(rsslServerImpl* serverImpl, RsslError
 
 	rsslSocketChannel->blocking = (rsslServerSocketChannel->session_blocking ? 1 : 0);
 	rsslSocketChannel->tcp_nodelay = (rsslServerSocketChannel->tcp_nodelay ? 1 : 0);
+	rsslSocketChannel->readAheadSize = rsslServerSocketChannel->readAheadSize;
 	rsslSocketChannel->maxMsgSize = rsslServerSocketChannel->maxMsgSize;
 	rsslSocketChannel->maxUserMsgSize = rsslServerSocketChannel->maxUserMsgSize;
 	rsslSocketChannel->srvrcomp = rsslServerSocketChannel->compressionSupported;
@@ -8074,7 +8141,7 @@ static RsslSocketChannel *ipcClientChannel(rsslServerImpl* serverImpl, RsslError
 	rsslSocketChannel->majorVersion = rsslServerSocketChannel->majorVersion;
 
 	/* Take care of input buffer */
-	rsslSocketChannel->inputBuffer = rtr_smplcAllocMsg(gblInputBufs, (rsslSocketChannel->maxMsgSize * rsslServerSocketChannel->numInputBufs));
+	rsslSocketChannel->inputBuffer = rtr_smplcAllocMsg(gblInputBufs, ipcInputBufferSize(rsslSocketChannel, rsslServerSocketChannel->numInputBufs));
 
 	/*do not need this as we do it later when processing connect msgs */
 	/*rsslSocketChannel->curInputBuf = rtr_smplcDupMsg(gblInputBufs,rsslSocketChannel->inputBuffer);  */
@@ -8526,6 +8593,16 @@ RsslRet rsslSocketCloseChannel(rsslChannelImpl* rsslChnlImpl, RsslError *error)
 }
 
 /* rssl Socket Read */
+/* Sets the receive timestamp, if any, of the message rsslSocketRead is returning. */
+RTR_C_ALWAYS_INLINE void ipcSetRecvTimestamp(RsslSocketChannel *rsslSocketChannel, RsslReadOutArgs *readOutArgs)
+{
+	if (rsslSocketChannel->recvTimestamp != 0 && readOutArgs != NULL)
+	{
+		readOutArgs->readOutFlags |= RSSL_READ_OUT_RECV_TIMESTAMP;
+		readOutArgs->recvTimestamp = rsslSocketChannel->recvTimestamp;
+	}
+}
+
 RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnlImpl, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error)
 {
 	rtr_msgb_t     *ripcBuffer = 0;
@@ -8537,6 +8614,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 	RsslInt32      returnNull = 0;
 	RsslInt32      inBytes = 0;
 	RsslInt32      uncompInBytes = 0;
+	RsslInt32      transportReads = 0;
 	rsslAssemblyBuffer *rsslAssemblyBuf = 0;
 	RsslSocketChannel  *rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpl->transportInfo;
 
@@ -8582,6 +8660,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 		{
 			readOutArgs->bytesRead = 0;
 			readOutArgs->uncompressedBytesRead = 0;
+			readOutArgs->transportReads = 0;
 		}
 
 		rsslChnlImpl->unpackOffset += rwfGet16(bufLength, (rsslChnlImpl->packedBuffer->buffer + rsslChnlImpl->unpackOffset));
@@ -8618,6 +8697,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 		if ((rsslChnlImpl->debugFlags & RSSL_DEBUG_RSSL_DUMP_IN) && (rsslChnlImpl->returnBuffer.length))
 			(*(rsslSocketDumpInFunc))(__FUNCTION__, rsslChnlImpl->returnBuffer.data, rsslChnlImpl->returnBuffer.length, rsslChnlImpl->Channel.socketId);
 
+		ipcSetRecvTimestamp(rsslSocketChannel, readOutArgs);
 		return &(rsslChnlImpl->returnBuffer);
 	}
 
@@ -8632,11 +8712,14 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 	{
 		rsslSocketChannel->workState |= RIPC_INT_READ_THR;
 
-		ripcBuffer = ipcReadSession(rsslSocketChannel, &ipcReadRet, &ripcMoreData, &ripcFragSize, &ripcFragId, &inBytes, &uncompInBytes, &packing, error);
+		ripcBuffer = ipcReadSession(rsslSocketChannel, &ipcReadRet, &ripcMoreData, &ripcFragSize, &ripcFragId, &inBytes, &uncompInBytes, &packing, &transportReads, error);
 
 		rsslSocketChannel->workState &= ~RIPC_INT_READ_THR;
 	}
 
+	if (readOutArgs != NULL)
+		readOutArgs->transportReads = transportReads;
+
 	/* non packed */
 	if (ripcBuffer != 0)
 	{
@@ -8898,7 +8981,10 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 				(*(rsslSocketDumpInFunc))(__FUNCTION__, rsslChnlImpl->returnBuffer.data, rsslChnlImpl->returnBuffer.length, rsslChnlImpl->Channel.socketId);
 		
 			if (!returnNull)
+			{
+				ipcSetRecvTimestamp(rsslSocketChannel, readOutArgs);
 				return &(rsslChnlImpl->returnBuffer);
+			}
 			else
 				return NULL;
 		}
@@ -8917,6 +9003,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 				if (!returnNull)
 				{
 					*readRet = RSSL_RET_SUCCESS;
+					ipcSetRecvTimestamp(rsslSocketChannel, readOutArgs);
 					return &(rsslChnlImpl->returnBuffer);
 				}
 				else
@@ -10106,6 +10193,77 @@ printf("UNLOCK rsslSocketChannel -- rsslSocketIoctl\n");
 		}
 		break;
 
+	case RSSL_SYSTEM_BUSY_POLL:
+		if (iValue < 0)
+		{
+			_rsslSetError(error, (RsslChannel*)(&rsslChnlImpl->Channel), RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+					"<%s:%d> Error: 1004 rsslSocketIoctl() failed, invalid value <%d>, busy poll time must not be negative.\n",
+					__FILE__, __LINE__, iValue);
+
+#ifdef MUTEX_DEBUG
+	printf("UNLOCK rsslSocketChannel -- rsslSocketIoctl\n");
+#endif
+			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			return RSSL_RET_FAILURE;
+		}
+
+		opts.code = RIPC_SOPT_BUSY_POLL;
+		opts.options.busy_poll_time = iValue;
+
+		if (((*(rsslSocketChannel->transportFuncs->setSockOpts))(rsslSocketChannel->stream, &opts,
+																rsslSocketChannel->transportInfo)) < 0)
+		{
+			_rsslSetError(error, (RsslChannel*)(&rsslChnlImpl->Channel), RSSL_RET_FAILURE, errno);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+					"<%s:%d> Error: 1002 Could not set busy poll time to (%d). System errno: (%d)\n",
+					__FILE__, __LINE__, iValue, errno);
+
+#ifdef MUTEX_DEBUG
+printf("UNLOCK rsslSocketChannel -- rsslSocketIoctl\n");
+#endif
+			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			return RSSL_RET_FAILURE;
+		}
+		break;
+
+	case RSSL_RECV_TIMESTAMPS:
+		/* Timestamps are read with recvmsg(), so only plain socket connections support them. */
+		if (rsslSocketChannel->transportFuncs->readTransport != ipcRead)
+		{
+			_rsslSetError(error, (RsslChannel*)(&rsslChnlImpl->Channel), RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+					"<%s:%d> Error: 1004 rsslSocketIoctl() failed, receive timestamps are only supported on RSSL_CONN_TYPE_SOCKET connections.\n",
+					__FILE__, __LINE__);
+
+#ifdef MUTEX_DEBUG
+	printf("UNLOCK rsslSocketChannel -- rsslSocketIoctl\n");
+#endif
+			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			return RSSL_RET_FAILURE;
+		}
+
+		opts.code = RIPC_SOPT_RECV_TIMESTAMPS;
+		opts.options.timestamp_type = iValue;
+
+		if (ipcSockOpts(rsslSocketChannel->stream, &opts) < 0)
+		{
+			_rsslSetError(error, (RsslChannel*)(&rsslChnlImpl->Channel), RSSL_RET_FAILURE, errno);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+					"<%s:%d> Error: 1002 Could not set receive timestamp type to (%d). System errno: (%d)\n",
+					__FILE__, __LINE__, iValue, errno);
+
+#ifdef MUTEX_DEBUG
+printf("UNLOCK rsslSocketChannel -- rsslSocketIoctl\n");
+#endif
+			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			return RSSL_RET_FAILURE;
+		}
+
+		rsslSocketChannel->recvTimestampType = (RsslUInt8)iValue;
+		rsslSocketChannel->recvTimestamp = 0;
+		break;
+
 	case RSSL_DEBUG_FLAGS:
 		/* reset debug flags - if user still wants these on, they should continue passing them in */
 		rsslChnlImpl->debugFlags = 0;
@@ -78,9 +78,12 @@ typedef struct
 	const SSL_METHOD* (*TLSv1_client_method)();  /* TLSv1_client_method */
 	const SSL_METHOD* (*TLSv1_1_client_method)();
 	const SSL_METHOD* (*TLSv1_2_client_method)();
+	int (*set_session)(SSL*, SSL_SESSION*);		/* SSL_set_session */
+	SSL_SESSION* (*get1_session)(SSL*);			/* SSL_get1_session */
+	void (*session_free)(SSL_SESSION*);			/* SSL_SESSION_free */
 } ripcSSLApiFuncs;
 
-#define INIT_SSL_API_FUNCS {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
+#define INIT_SSL_API_FUNCS {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
 
 typedef struct
 {
@@ -97,9 +100,11 @@ typedef struct
 	void* (*ctx_set_ex_data)(SSL_CTX*, int, void*);		/* SSL_CTX_set_ex_data */
 	void (*ctx_free)(SSL_CTX*);												/* SSL_CTX_free */
 	long (*ctx_ctrl)(SSL_CTX*, int, long, void*);							/* SSL_CTX_ctrl */
+	long (*ctx_set_timeout)(SSL_CTX*, long);								/* SSL_CTX_set_timeout */
+	int (*ctx_set_session_id_context)(SSL_CTX*, const unsigned char*, unsigned int);	/* SSL_CTX_set_session_id_context */
 }ripcSSLCTXApiFuncs;
 
-#define INIT_SSL_CTX_FUNCS {0,0,0,0,0,0,0,0,0,0,0,0,0}
+#define INIT_SSL_CTX_FUNCS {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
 
 typedef struct
 {
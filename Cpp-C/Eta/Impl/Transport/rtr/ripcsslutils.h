@@ -105,9 +105,21 @@ typedef struct {
 	char		   clientConnState;
 	ripcSSLProtocolFlags sessionProtocol;
 	ripcSSLConnectOpts  config;  // this holds the config for the clients (if this is server side, the config is copied from the servers 
+	char		  *writeBuffer;  // used by ripcSSLWriteV to gather small buffers into a single record (allocated on first use)
+	char		  *resumptionKey;  // client side: "host:port" under which the TLS session is cached for resumption; 0 if resumption is off
 } ripcSSLSession;
 
-#define RIPC_INIT_SSL_SESSION { 0, 0, 0, 0, 0, SSL_INITIALIZING, RIPC_INIT_SSL_CONNECT_OPTS }
+#define RIPC_INIT_SSL_SESSION { 0, 0, 0, 0, 0, SSL_INITIALIZING, RIPC_INIT_SSL_CONNECT_OPTS, 0, 0 }
+
+/* size of the chunks ripcSSLWriteV gathers buffers into; this is the largest plaintext that fits in one TLS record */
+#define RIPC_SSL_WRITE_CHUNK_SIZE 16384
+
+/* maximum number of client TLS sessions kept for resumption (one per host and port) */
+#define RIPC_SSL_MAX_CACHED_SESSIONS 64
+
+/* server side session cache size, and how long (in seconds) cached sessions and session tickets remain valid */
+#define RIPC_SSL_SERVER_SESSION_CACHE_SIZE 20480
+#define RIPC_SSL_SESSION_TIMEOUT 7200
 
 /* our transport read function -
  this will read from the network using SSL and return the appropriate value to the ripc layer */
@@ -117,6 +129,11 @@ RsslInt32 ripcSSLRead( void *sslSess, char *buf, RsslInt32 max_len, ripcRWFlags
    this will write to the network using SSL and return the appropriate value to the ripc layer */
 RsslInt32 ripcSSLWrite( void *sslSess, char *buf, RsslInt32 len, ripcRWFlags flags, RsslError *error);
 
+/* our transport writev function -
+   this gathers the buffers into chunks of up to RIPC_SSL_WRITE_CHUNK_SIZE bytes, so that many small messages
+   are sent in a single TLS record rather than one record each */
+RsslInt32 ripcSSLWriteV( void *sslSess, ripcIovType *iov, RsslInt32 iovcnt, RsslInt32 outLen, ripcRWFlags flags, RsslError *error);
+
 /* shutdown the SSL and the socket */
 RsslInt32 ripcShutdownSSLSocket(void *session);
 
@@ -131,7 +148,8 @@ ripcSSLServer *ripcInitializeSSLServer(RsslSocket fd, char* name, RsslError  *er
 /* creates and initializes new client/session structure */
 ripcSSLSession *ripcInitializeSSLSession(RsslSocket fd, RsslInt32 SSLProtocolVersion, char* name, RsslError *error);
 
-/* connects session to a server */
+/* connects session to a server.  If userSpecPtr is the RsslSocketChannel being connected and it has session resumption
+   enabled, the session of the previous connection to the same host and port is resumed, if there is one. */
 void *ripcSSLConnectTLSv1(RsslSocket fd, RsslInt32 *initComplete, void* userSpecPtr, RsslError *error);
 
 
@@ -158,6 +176,20 @@ RsslInt32 ripcInitializeSSL(char* libsslName, char* libcryptoName);
 
 void ripcUninitializeSSL(void);
 
+/* sets the session cached for the session's host and port, if any, so that the handshake resumes it.
+   returns 1 if a cached session was set, 0 if there was none or the session has resumption off */
+RsslInt32 ripcSSLResumeCachedSession(ripcSSLSession *sess);
+
+/* caches the TLS session of a client connection under its host and port, replacing any older one.  When the cache is
+   full, the entry of the least recently connected host and port is dropped */
+void ripcSSLCacheSession(ripcSSLSession *sess);
+
+/* number of client sessions currently kept for resumption */
+RsslUInt32 ripcSSLCachedSessionCount(void);
+
+/* frees the client sessions kept for resumption */
+void ripcSSLClearSessionCache(void);
+
 ripcSSLProtocolFlags ripcGetSupportedSSLVersion();
 
 ripcSSLProtocolFlags ripcRemoveHighestSSLVersionFlag(ripcSSLProtocolFlags protoFlags);
@@ -70,7 +70,9 @@ typedef enum {
 	RIPC_SOPT_CLOEXEC		= 6,	/* Use turn_on */
 	RIPC_SOPT_TCP_NODELAY	= 7,	/* Use turn_on */
 	RIPC_SOPT_EXCLUSIVEADDRUSE = 8,	/* Use Exclusive Address Reuse (WIN) */
-	RIPC_SOPT_KEEPALIVE		= 9
+	RIPC_SOPT_KEEPALIVE		= 9,
+	RIPC_SOPT_BUSY_POLL		= 10,	/* Use busy_poll_time */
+	RIPC_SOPT_RECV_TIMESTAMPS = 11	/* Use timestamp_type */
 } ripcSocketOptionsCode;
 
 typedef struct {
@@ -79,6 +81,8 @@ typedef struct {
 		int			turn_on;		/* turn the option on */
 		int			linger_time;	/* linger_time == 0 turns off */
 		int			buffer_size;	/* set to buffer size */
+		int			busy_poll_time;	/* microseconds, 0 turns off */
+		int			timestamp_type;	/* RsslRecvTimestampTypes */
 	} options;
 } ripcSocketOption;
 
@@ -112,6 +116,19 @@ extern int ipcInitTrans(void *transport, ripcSessInProg *inPr, RsslError *error)
 
 extern int ipcRead(void *transport, char *buf, int max_len, ripcRWFlags flags, RsslError *error);
 
+/* Same as ipcRead, but also sets *pTimestamp to the receive timestamp of the data read(see RIPC_SOPT_RECV_TIMESTAMPS),
+ * in nanoseconds since the epoch. *pTimestamp is left unchanged if no data or timestamp was received. */
+extern int ipcReadTimestamp(void *transport, char *buf, int max_len, ripcRWFlags flags, RsslUInt64 *pTimestamp, RsslError *error);
+
+#ifdef Linux
+/* Space needed for the control messages of a recvmsg() call that returns a receive timestamp. */
+#define RIPC_RECV_TIMESTAMP_CONTROL_LEN CMSG_SPACE(3 * sizeof(struct timespec))
+
+/* Gets the receive timestamp from the control messages returned by recvmsg(), in nanoseconds since the epoch.
+ * A hardware timestamp is preferred when present. Returns 0 if there is none. */
+extern RsslUInt64 ipcGetRecvTimestamp(struct msghdr *msg);
+#endif
+
 extern int ipcWrite(void *transport, char *buf, int outLen, ripcRWFlags flags, RsslError *error);
 
 extern int ipcWriteV(void *transport, ripcIovType *iov, int iovcnt, int outLen, ripcRWFlags flags, RsslError *error);
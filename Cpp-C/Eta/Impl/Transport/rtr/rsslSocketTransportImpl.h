@@ -281,6 +281,7 @@ typedef struct {
 	RsslUInt32	maxGuarMsgs;		/* Guar. number output messages per session */
 	RsslUInt32	maxNumMsgs;			/* Max number of output messages per session */
 	RsslUInt32	numInputBufs;		/* number of input buffers used to read in data */
+	RsslUInt32	readAheadSize;		/* read-ahead size for accepted channels, 0 if not enabled */
 	RsslUInt32  compressionSupported;	/* a bitmask of The types of compression supported by this server. 0 means no compression */
 	RsslUInt32	zlibCompressionLevel;	/* compression level for zlib */
 	RsslBool	forcecomp;			/* Force compression */
@@ -309,7 +310,7 @@ typedef struct {
 									*/
 } RsslServerSocketChannel;
 
-#define RSSL_INIT_SERVER_SOCKET_Bind { 0, 0, 0, 0, 0, 0, 0, RSSL_COMP_NONE, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+#define RSSL_INIT_SERVER_SOCKET_Bind { 0, 0, 0, 0, 0, 0, 0, 0, RSSL_COMP_NONE, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
 RTR_C_INLINE void rsslClearRsslServerSocketChannel(RsslServerSocketChannel *rsslServerSocketChannel)
 {
@@ -320,6 +321,7 @@ RTR_C_INLINE void rsslClearRsslServerSocketChannel(RsslServerSocketChannel *rssl
 	rsslServerSocketChannel->maxGuarMsgs = 0;
 	rsslServerSocketChannel->maxNumMsgs = 0;
 	rsslServerSocketChannel->numInputBufs = 0;
+	rsslServerSocketChannel->readAheadSize = 0;
 	rsslServerSocketChannel->compressionSupported = RSSL_COMP_NONE;
 	rsslServerSocketChannel->zlibCompressionLevel = 0;
 	rsslServerSocketChannel->forcecomp = 0;
@@ -359,6 +361,9 @@ typedef struct
 	RsslUInt32			numGuarOutputBufs;	/* Number of guaranteed output buffers */
 	RsslUInt32			numMaxOutputBufs;	/* Maximum number of output buffers */
 	RsslUInt32			numInputBufs;		/* number of input buffers used to read in data */
+	RsslUInt32			readAheadSize;		/* If non-zero, read as much as fits into the input buffer (see ipcReadSession) */
+	RsslUInt8			recvTimestampType;	/* RsslRecvTimestampTypes. If set, network reads record recvTimestamp (see RSSL_RECV_TIMESTAMPS) */
+	RsslUInt64			recvTimestamp;		/* Receive timestamp of the latest network read, in nanoseconds since the epoch */
 	RsslUInt32			pingTimeout;		/* ping timeout */
 	RsslUInt32			rsslFlags;			/* rssl flag settings */
 	RsslUInt32			dbgFlags;			/* debug flags */
@@ -373,6 +378,7 @@ typedef struct
 	RsslUInt32			recvBufSize;
 
 	RsslUInt32 			encryptionProtocolFlags;
+	RsslBool			sslSessionResumption;	/* Resume the TLS session of the last connection to the same host and port */
 
 	/* SSL/TLS Encryption information */
 	ripcSSLProtocolFlags sslProtocolBitmap;		/* Represents the protocols supported by the dynamically loaded openSSL library */
@@ -547,6 +553,9 @@ RTR_C_INLINE void ripcClearRsslSocketChannel(RsslSocketChannel *rsslSocketChanne
 	rsslSocketChannel->inputBufCursor = 0;
 	rsslSocketChannel->curInputBuf = 0;
 	rsslSocketChannel->readSize = 0;
+	rsslSocketChannel->readAheadSize = 0;
+	rsslSocketChannel->recvTimestampType = RSSL_RECV_TIMESTAMP_NONE;
+	rsslSocketChannel->recvTimestamp = 0;
 	rsslSocketChannel->bytesOutLastMsg = 0;
 	rsslSocketChannel->version = 0;
 	rsslSocketChannel->ripcVersion = RIPC_VERSION_LATEST;
@@ -0,0 +1,100 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RSSL_FIELD_LIST_COLUMNS_H
+#define __RSSL_FIELD_LIST_COLUMNS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslFieldList.h"
+#include "rtr/rsslReal.h"
+#include "rtr/rsslDateTime.h"
+#include "rtr/rsslDataDictionary.h"
+
+/**
+ * @addtogroup FieldListDecoding
+ * @{
+ */
+
+/**
+ * @brief Caller-provided arrays that rsslDecodeFieldListColumns() decodes an entire RsslFieldList into.
+ *
+ * Each array holds one element per field entry, so the values of entry i are found at index i of every array.
+ * Only RsslFieldListColumns::fieldIds and RsslFieldListColumns::dataTypes are required; any of the other arrays may be
+ * NULL, in which case the values they would hold are not decoded.  Values of types that do not go in a particular
+ * array leave that array's element for the entry unchanged.
+ * @see RSSL_INIT_FIELD_LIST_COLUMNS, rsslClearFieldListColumns, rsslDecodeFieldListColumns
+ */
+typedef struct
+{
+	RsslUInt32		maxEntries;		/*!< @brief Number of elements available in each of the arrays. */
+	RsslUInt32		entryCount;		/*!< @brief Set by rsslDecodeFieldListColumns() to the number of entries decoded. */
+
+	RsslFieldId		*fieldIds;		/*!< @brief Field ID of each entry. */
+	RsslUInt8		*dataTypes;		/*!< @brief Type of each entry, from the set definition or the dictionary.  ::RSSL_DT_UNKNOWN if the field is not in the dictionary. */
+	RsslUInt8		*blanks;		/*!< @brief RSSL_TRUE for each entry whose value is blank, RSSL_FALSE otherwise. */
+	RsslInt64		*intValues;		/*!< @brief Values of ::RSSL_DT_INT, ::RSSL_DT_UINT and ::RSSL_DT_ENUM entries.  ::RSSL_DT_UINT values are stored as their bit pattern and should be read by casting to RsslUInt64. */
+	RsslDouble		*doubleValues;	/*!< @brief Values of ::RSSL_DT_FLOAT and ::RSSL_DT_DOUBLE entries. */
+	RsslReal		*realValues;	/*!< @brief Values of ::RSSL_DT_REAL entries. */
+	RsslDateTime	*dateTimeValues;/*!< @brief Values of ::RSSL_DT_DATE, ::RSSL_DT_TIME and ::RSSL_DT_DATETIME entries.  For ::RSSL_DT_DATE the time is blank, and for ::RSSL_DT_TIME the date is blank. */
+	RsslUInt32		*dataOffsets;	/*!< @brief Offset of each entry's encoded value from the start of the buffer set on the decode iterator.  Used to find string, buffer and container values. */
+	RsslUInt32		*dataLengths;	/*!< @brief Length of each entry's encoded value. */
+} RsslFieldListColumns;
+
+/**
+ * @brief RsslFieldListColumns static initializer
+ * @see RsslFieldListColumns, rsslClearFieldListColumns
+ */
+#define RSSL_INIT_FIELD_LIST_COLUMNS { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+
+/**
+ * @brief Clears an RsslFieldListColumns
+ * @see RsslFieldListColumns, RSSL_INIT_FIELD_LIST_COLUMNS
+ */
+RTR_C_INLINE void rsslClearFieldListColumns(RsslFieldListColumns *pColumns)
+{
+	memset(pColumns, 0, sizeof(RsslFieldListColumns));
+}
+
+/**
+ * @brief Decodes an entire RsslFieldList, including its entries and their primitive values, into columns.
+ *
+ * This has the same effect as calling rsslDecodeFieldList(), then rsslDecodeFieldEntry() and the primitive decoder for
+ * the type of each entry until ::RSSL_RET_END_OF_CONTAINER, but in one call.  Entry types are taken from the set
+ * definition for set-defined data, and otherwise from the dictionary.  When it returns, the iterator is positioned after
+ * the field list, as it would be after ::RSSL_RET_END_OF_CONTAINER.
+ *
+ * @param pIter Decode iterator, positioned at the field list.
+ * @param pDictionary Dictionary used to look up the types of the fields.  If NULL, types of standard entries are ::RSSL_DT_UNKNOWN.
+ * @param pLocalSetDb Local set definitions to use for set-defined data, if any.
+ * @param pColumns Arrays to decode into.  RsslFieldListColumns::entryCount is set to the number of entries.
+ * @return ::RSSL_RET_SUCCESS if the field list was decoded.
+ * @return ::RSSL_RET_NO_DATA if the field list is empty.
+ * @return ::RSSL_RET_SET_SKIPPED if set-defined data could not be decoded because its set definition is not available.  The standard entries are still decoded.
+ * @return ::RSSL_RET_BUFFER_TOO_SMALL if the field list has more entries than RsslFieldListColumns::maxEntries.  The iterator is left at the start of the entries, so they may still be decoded with rsslDecodeFieldEntry().
+ * @return Otherwise, the failure code from decoding the field list or one of its entries.
+ * @see RsslFieldListColumns, rsslDecodeFieldList, rsslDecodeFieldEntry
+ */
+RSSL_API RsslRet rsslDecodeFieldListColumns(
+				RsslDecodeIterator		*pIter,
+				RsslDataDictionary		*pDictionary,
+				RsslLocalFieldSetDefDb	*pLocalSetDb,
+				RsslFieldListColumns	*pColumns );
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
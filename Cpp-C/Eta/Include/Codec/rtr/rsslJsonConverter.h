@@ -0,0 +1,110 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RSSL_JSON_CONVERTER_H
+#define __RSSL_JSON_CONVERTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslIterators.h"
+#include "rtr/rsslMsg.h"
+#include "rtr/rsslDataDictionary.h"
+
+/**
+ * @addtogroup MsgDecodeUtilsHelpers
+ * @{
+ */
+
+/**
+ * @brief Converts a decoded RsslMsg and its payload to JSON text.
+ *
+ * The message is written as one JSON object, with no whitespace, in the order:
+ * <ul>
+ * <li>"ID" (the stream ID), "Type" (e.g. "Refresh") and "Domain" (e.g. "MarketPrice").</li>
+ * <li>The members of the message class that are present, such as "State", "Qos", "SeqNumber", "PermData" or
+ *     "PostUserInfo".  Message flags that change stream behavior, such as "Solicited", "Complete" or "Streaming",
+ *     are written as true when they are set and omitted otherwise.</li>
+ * <li>"Key" and "ReqKey", with "Service", "Name", "NameType", "Filter", "Identifier" and any attrib container.</li>
+ * <li>"ExtHdr", then the payload, named by its container type: "Fields", "Elements", "Map", "Vector", "Series",
+ *     "FilterList", "Message", "Opaque", "Xml", "Json" or "AnsiPage".</li>
+ * </ul>
+ * Field lists are written as objects keyed by the field acronyms from the dictionary.  Fields that are not in the
+ * dictionary are keyed by their field ID and their values are written as base64.  Element lists are keyed by element
+ * name.  Map, vector, series and filter list entries are written in an "Entries" array, with summary data in
+ * "Summary".  Numbers are written as JSON numbers, with RsslReal values written exactly as they are encoded, and
+ * blank values as null.  Dates and times use ISO 8601 format, RsslBuffer and opaque data is base64 encoded, and
+ * RMTES strings are converted to UTF-8.
+ *
+ * The text is written directly into the caller's buffer and nothing is allocated, so the function can be used on
+ * the message path.  To stream several messages into one buffer, advance RsslBuffer::data by the returned length
+ * between calls.
+ *
+ * @param pIter Decode iterator used to decode pMsg.  It is only used for its RWF version and is not modified.
+ * @param pMsg Message decoded with rsslDecodeMsg().
+ * @param pDictionary Dictionary used to name and type the fields of field lists.  If NULL, fields are keyed by field ID.
+ * @param pOutput Buffer to write to.  On input, RsslBuffer::length is the space available at RsslBuffer::data.  On
+ * ::RSSL_RET_SUCCESS, it is set to the number of bytes written.  The text is not null-terminated.
+ * @return ::RSSL_RET_SUCCESS if the message was written.
+ * @return ::RSSL_RET_BUFFER_TOO_SMALL if the JSON text does not fit in pOutput.
+ * @return Any error returned while decoding the payload.
+ */
+RSSL_API RsslRet rsslConvertMsgToJson(const RsslDecodeIterator *pIter, const RsslMsg *pMsg,
+		const RsslDataDictionary *pDictionary, RsslBuffer *pOutput);
+
+/**
+ * @}
+ */
+
+/**
+ * @addtogroup FieldListEncoding
+ * @{
+ */
+
+/**
+ * @brief Encodes the members of a JSON object as entries of the field list being encoded.
+ *
+ * The object has the same form as the "Fields" member written by rsslConvertMsgToJson(), for example
+ * {"BID":99.96,"ASK":"100.02","TRDTIM_1":"14:02:33.125","DSPLY_NAME":"TRI"}.  Members are keyed by field acronym,
+ * or by field ID if the acronym is not in the dictionary, and each value is converted to the field's type in the
+ * dictionary.  Numeric values may also be given as strings, enum values as their display strings, and dates and
+ * times in ISO 8601 format.  RsslReal values keep the decimal places of the JSON number.  A null value encodes a
+ * blank field.
+ *
+ * The JSON text is read in one pass and encoded straight into the iterator's buffer.  String values without
+ * escapes are copied directly from the JSON text, and nothing is allocated.
+ *
+ * Call rsslEncodeFieldListInit() first.  More entries may be encoded afterwards, before rsslEncodeFieldListComplete().
+ * If an error is returned, entries encoded before the error remain in the field list; the caller will usually
+ * roll back the field list or message.
+ *
+ * @param pIter Encode iterator positioned in a field list.
+ * @param pJson JSON text to encode.
+ * @param pDictionary Dictionary used to find the fields by acronym.
+ * @param pErrorText Optional buffer to receive a description of an ::RSSL_RET_INVALID_DATA or
+ * ::RSSL_RET_UNSUPPORTED_DATA_TYPE error.  RsslBuffer::length is the space available, and the text is null-terminated.
+ * @return ::RSSL_RET_SUCCESS if all members were encoded.
+ * @return ::RSSL_RET_INVALID_DATA if the JSON text is not valid, a field is not in the dictionary, or a value cannot
+ * be converted to the field's type.
+ * @return ::RSSL_RET_UNSUPPORTED_DATA_TYPE if a field's type cannot be set from JSON, such as a container or array.
+ * @return ::RSSL_RET_BUFFER_TOO_SMALL or another error returned by the field entry encoders.
+ */
+RSSL_API RsslRet rsslConvertJsonToFieldEntries(RsslEncodeIterator *pIter, const RsslBuffer *pJson,
+		RsslDataDictionary *pDictionary, RsslBuffer *pErrorText);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
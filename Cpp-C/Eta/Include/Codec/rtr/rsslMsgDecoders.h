@@ -138,6 +138,51 @@ RSSL_API RsslRet rsslExtractGroupId( const RsslDecodeIterator *pIter, RsslBuffer
  */
 RSSL_API RsslRet rsslExtractPostId( const RsslDecodeIterator *pIter, RsslUInt32 *pPostId );
 
+
+/**
+ * @brief The routing fields of an encoded \ref RsslMsg, as populated by rsslPeekMsgHeader().
+ *
+ * @see rsslPeekMsgHeader, rsslClearMsgHeaderInfo
+ */
+typedef struct {
+	RsslUInt8		msgClass;		/*!< @brief The \ref RsslMsgBase::msgClass of the message. See \ref RsslMsgClasses. */
+	RsslUInt8		domainType;		/*!< @brief The \ref RsslMsgBase::domainType of the message. */
+	RsslInt32		streamId;		/*!< @brief The \ref RsslMsgBase::streamId of the message. */
+	RsslUInt16		flags;			/*!< @brief The class-specific flags of the message (e.g. \ref RsslUpdateFlags for an \ref RsslUpdateMsg). */
+	RsslUInt8		containerType;	/*!< @brief The \ref RsslMsgBase::containerType of the message payload. */
+	RsslBuffer		encDataBody;	/*!< @brief Points to the encoded payload of the message, if any. */
+} RsslMsgHeaderInfo;
+
+/**
+ * @brief Static initializer for RsslMsgHeaderInfo
+ * @see RsslMsgHeaderInfo, rsslClearMsgHeaderInfo
+ */
+#define RSSL_INIT_MSG_HEADER_INFO { 0, 0, 0, 0, 0, RSSL_INIT_BUFFER }
+
+/**
+ * @brief Clears an RsslMsgHeaderInfo
+ * @see RsslMsgHeaderInfo, RSSL_INIT_MSG_HEADER_INFO
+ */
+RTR_C_ALWAYS_INLINE void rsslClearMsgHeaderInfo(RsslMsgHeaderInfo *pInfo)
+{
+	memset(pInfo, 0, sizeof(RsslMsgHeaderInfo));
+}
+
+/**
+ * @brief Extract the routing fields of an encoded \ref RsslMsg without decoding the full message header.
+ *
+ * Only the fixed-position portion of the header is read; the message key, permission data, extended header and
+ * other optional members are skipped over using the encoded header length.  The iterator is not moved, so
+ * rsslDecodeMsg() may be called afterwards with the same \ref RsslDecodeIterator if the full header is needed.
+ * To decode the payload alone, set a decode iterator on RsslMsgHeaderInfo::encDataBody.
+ *
+ * @param[in] pIter 		\ref RsslDecodeIterator with the \ref RsslBuffer that contains the encoded \ref RsslMsg set.
+ * @param[out] pInfo 		Pointer to an RsslMsgHeaderInfo to populate. This operation will not copy the payload out of the encoded buffer.
+ * @return RSSL_RET_SUCCESS if pInfo was populated, RSSL_RET_INCOMPLETE_DATA if the buffer is too short to contain the header, RSSL_RET_FAILURE for an unknown message class.
+ * @see RsslMsgHeaderInfo, rsslDecodeMsg
+ */
+RSSL_API RsslRet rsslPeekMsgHeader( const RsslDecodeIterator *pIter, RsslMsgHeaderInfo *pInfo );
+
 /**
  * @}
  */
@@ -110,6 +110,8 @@ typedef struct
 	RsslUInt32						maxOutstandingPosts;	/*!< Sets the maximum number of post acknowledgements that may be oustanding for the channel. */
 	RsslUInt32						postAckTimeout;			/*!< Time a stream will wait for acknowledgement of a post message, in milliseconds. */
 	RsslUInt32						requestTimeout;			/*!< Time a requested stream will wait for a response from the provider, in milliseconds. */
+	RsslBool						coalesceItemRequests;	/*!< Controls whether pending item requests for the same service, domain and QoS are sent to the provider as batch requests, when the provider supports them. */
+	char							*itemSnapshotFile;		/*!< Name of a file in which the watchlist stores the last complete refresh of each item. When the file is reused (e.g. after a restart), streaming requests for stored items immediately receive the stored refresh, with an Open/Suspect state, while the watchlist requests the item from the provider. Requires that the login request allows suspect data. Private streams, requests with views, and multi-part refreshes are not stored. Optional. */
 } RsslConsumerWatchlistOptions;
 
 /**
@@ -144,6 +146,8 @@ RTR_C_INLINE void rsslClearOMMConsumerRole(RsslReactorOMMConsumerRole *pRole)
 	pRole->watchlistOptions.maxOutstandingPosts = 100000;
 	pRole->watchlistOptions.postAckTimeout = 15000;
 	pRole->watchlistOptions.requestTimeout = 15000;
+	pRole->watchlistOptions.coalesceItemRequests = RSSL_FALSE;
+	pRole->watchlistOptions.itemSnapshotFile = NULL;
 }
 
 /**
@@ -221,9 +225,12 @@ RTR_C_INLINE void rsslClearReactorChannelRole(RsslReactorChannelRole *pRole)
  * @see rsslCreateReactor
  */
 typedef struct {
-	RsslInt32	dispatchDecodeMemoryBufferSize;	/*!< Size of the memory buffer(in bytes) that the RsslReactor will use when decoding RsslRDMMsgs to pass to callback functions. */
+	RsslInt32	dispatchDecodeMemoryBufferSize;	/*!< Initial size of the memory buffer(in bytes) that each channel uses when decoding RsslRDMMsgs to pass to callback functions. The buffer is enlarged as needed to fit larger messages. */
 	void		*userSpecPtr; 					/*!< user-specified pointer which will be set on the Reactor. */
 	int			port;							/*!< @deprecated DEPRECATED: This parameter no longer has any effect. It was a port used for creating the eventFd descriptor on the RsslReactor. It was never used on Linux or Solaris platforms. */
+	RsslBool	enableProviderItemCache;		/*!< If RSSL_TRUE, the payload of refreshes and updates submitted on interactive provider channels is cached per item, and requests for items that are already published are answered with a refresh from the cache. See RsslMsgEvent::refreshFromCache. */
+	RsslDataDictionary	*pProviderItemCacheDictionary;	/*!< Optional dictionary used by the provider item cache to validate field list data. Must remain valid for the lifetime of the RsslReactor. */
+	RsslInt32	cpuBindWorkerThread;			/*!< CPU on which to run the RsslReactor's worker thread, or -1 to leave it unbound. Channels are initialized on the worker thread, so their transport buffers are allocated from memory local to this CPU. */
 } RsslCreateReactorOptions;
 
 /**
@@ -235,6 +242,7 @@ RTR_C_INLINE void rsslClearCreateReactorOptions(RsslCreateReactorOptions *pReact
 	memset(pReactorOpts, 0, sizeof(RsslCreateReactorOptions));
 	pReactorOpts->dispatchDecodeMemoryBufferSize = 65536;
 	pReactorOpts->port = 55000;
+	pReactorOpts->cpuBindWorkerThread = -1;
 }
 
 /**
@@ -286,6 +294,14 @@ typedef struct
 	RsslReactorConnectInfo	*reactorConnectionList;	/*!< A list of connnections.  Each connection in the list will be tried with each reconnection attempt. */
 	RsslUInt32				connectionCount;		/*!< The number of connections in reactorConnectionList. */
 
+	RsslBool				enableWarmStandby;		/*!< For consumer channels with more than one connection in reactorConnectionList. While the channel is up, the RsslReactor
+													 * keeps a standby connection to the next connection in the list, logged in with the role's login request and with a
+													 * directory snapshot received. When the channel fails, it reconnects through the standby connection right away, 
+													 * without the reconnect delay and connection setup. */
+
+	RsslUInt32				packingLatencyBudget;	/*!< If nonzero, small messages submitted on this channel are packed into shared transport buffers, and this is the
+													 * longest time(in microseconds) a message may wait to be written. Not used when the watchlist is enabled. See rsslReactorSubmit. */
+
 } RsslReactorConnectOptions;
 
 /**
@@ -302,6 +318,8 @@ RTR_C_INLINE void rsslClearReactorConnectOptions(RsslReactorConnectOptions *pOpt
 
 	pOpts->reactorConnectionList = NULL;
 	pOpts->connectionCount = 0;
+	pOpts->enableWarmStandby = RSSL_FALSE;
+	pOpts->packingLatencyBudget = 0;
 }
 
 /**
@@ -323,6 +341,8 @@ typedef struct
 	RsslAcceptOptions	rsslAcceptOptions;		/*!< Options for accepting the connection. */
 	RsslUInt32			initializationTimeout;	/*!< Time(in seconds) to wait for successful initialization of a channel. 
 												 * If initialization does not complete in time, a RsslReactorChannelEvent will be sent indicating that the channel is down. */
+	RsslUInt32			packingLatencyBudget;	/*!< If nonzero, small messages submitted on this channel are packed into shared transport buffers, and this is the
+												 * longest time(in microseconds) a message may wait to be written. See rsslReactorSubmit. */
 } RsslReactorAcceptOptions;
 
 /**
@@ -333,6 +353,7 @@ RTR_C_INLINE void rsslClearReactorAcceptOptions(RsslReactorAcceptOptions *pOpts)
 {
 	rsslClearAcceptOpts(&pOpts->rsslAcceptOptions);
 	pOpts->initializationTimeout = 60;
+	pOpts->packingLatencyBudget = 0;
 }
 
 /**
@@ -411,6 +432,14 @@ RTR_C_INLINE void rsslClearReactorSubmitOptions(RsslReactorSubmitOptions *pOpts)
 
 /**
  * @brief Sends the given RsslBuffer to the given RsslReactorChannel.
+ *
+ * If the channel was added with a packingLatencyBudget, a message that is no larger than half the channel's maximum fragment size
+ * and is submitted without writeFlags is copied into a packed buffer held by the channel, and pBuffer is released.  Consecutive 
+ * messages of the same priority share the packed buffer, which is written when the next message does not fit in it, or once its 
+ * first message has waited for the latency budget.  The budget is checked on each submit, and by rsslReactorDispatch() when the 
+ * channel is idle(at the millisecond resolution of the RsslReactor's timers).  A buffer the application got for packing itself
+ * (see rsslReactorPackBuffer()) is not copied; the channel's packed buffer is written first, then the application's buffer.
+ *
  * @param pReactor The reactor handling the channel to submit the message to.
  * @param pChannel The channel to send the message to.
  * @param pBuffer The buffer to send.
@@ -420,10 +449,35 @@ RTR_C_INLINE void rsslClearReactorSubmitOptions(RsslReactorSubmitOptions *pOpts)
  * @return RSSL_RET_SUCCESS, if dispatching succeeded and there are no more messages or events to process.
  * @return RSSL_WRITE_CALL_AGAIN, if the buffer cannot be written at this time.
  * @return failure codes, if the RsslReactor was shut down due to a failure.
- * @see RsslReactor, RsslErrorInfo, RsslReactorSubmitOptions, rsslReactorGetBuffer, rsslReactorReleaseBuffer
+ * @see RsslReactor, RsslErrorInfo, RsslReactorSubmitOptions, rsslReactorGetBuffer, rsslReactorReleaseBuffer, rsslReactorGetPackingStats
  */
 RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslBuffer *pBuffer, RsslReactorSubmitOptions *pSubmitOptions, RsslErrorInfo *pError);
 
+/**
+ * @brief Statistics on the messages submitted to a channel and the transport buffers written for them.
+ * messagesSubmitted / buffersWritten gives the average number of messages written per buffer.
+ * @see rsslReactorGetPackingStats
+ */
+typedef struct
+{
+	RsslUInt64	messagesSubmitted;		/*!< Messages submitted to the channel, including those the RsslReactor sends itself. */
+	RsslUInt64	messagesPacked;			/*!< Submitted messages that were packed. */
+	RsslUInt64	buffersWritten;			/*!< Buffers written to the transport, packed or not. */
+	RsslUInt64	budgetExpiredWrites;	/*!< Packed buffers written because the latency budget ran out before they were full. */
+} RsslReactorPackingStats;
+
+/**
+ * @brief Gets the packing statistics of a channel.  The statistics are kept for the life of the channel.
+ * @param pReactor The reactor handling the channel.
+ * @param pChannel The channel to get statistics for.
+ * @param pStats Structure to be populated with the statistics.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return RSSL_RET_SUCCESS, if successful.
+ * @return failure codes, if the channel is not valid for this RsslReactor.
+ * @see RsslReactorPackingStats, RsslReactorConnectOptions, RsslReactorAcceptOptions
+ */
+RSSL_VA_API RsslRet rsslReactorGetPackingStats(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslReactorPackingStats *pStats, RsslErrorInfo *pError);
+
 /**
   * @brief Options when using rsslReactorSubmitMsg. 
   * Provides simple methods of performing advanced item request behaviors such as batch requests and requesting views(the application may also request these behaviors by encoding them
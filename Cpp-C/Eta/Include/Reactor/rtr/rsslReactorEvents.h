@@ -79,6 +79,8 @@ typedef struct
 	RsslErrorInfo	*pErrorInfo;		/*!< Error information. Present if a problem was encountered, and provides information about the error and its location in the source code. */
 	RsslUInt32		*pSeqNum;			/*!< Sequence number associated with this message. */
 	RsslUInt8		*pFTGroupId;		/*!< FTGroupId associated with this message. */
+	RsslUInt64		*pRecvTimestamp;	/*!< Time at which the data containing this message was received, in nanoseconds since the epoch. Present when receive timestamps are turned on for the channel (see ::RSSL_RECV_TIMESTAMPS and RsslReadOutArgs::recvTimestamp). */
+	RsslBool		refreshFromCache;	/*!< Set on an RsslRequestMsg when the provider item cache has already sent the refresh for this request. The application should not send one. See RsslCreateReactorOptions::enableProviderItemCache. */
 } RsslMsgEvent;
 
 /**
@@ -93,6 +95,8 @@ RTR_C_INLINE void rsslClearMsgEvent(RsslMsgEvent *pEvent)
 	pEvent->pStreamInfo = NULL;
 	pEvent->pSeqNum = NULL;
 	pEvent->pFTGroupId = NULL;
+	pEvent->pRecvTimestamp = NULL;
+	pEvent->refreshFromCache = RSSL_FALSE;
 }
 
 /**
@@ -82,9 +82,21 @@ typedef enum {
 										 /*!< (12) Reserved */
 										 /*!< (13) Reserved */
 	RSSL_REGISTER_HASH_ID			= 14, /*!< (14) Channel: Used with ::RSSL_CONN_TYPE_RELIABLE_MCAST connections. Registers a hash so that a filtering-enabled channel allows it. */
-	RSSL_UNREGISTER_HASH_ID			= 15 /*!< (15) Channel: Used with ::RSSL_CONN_TYPE_RELIABLE_MCAST connections. Unregisters a hash so that a filtering-enabled channel no longer allows it. */
+	RSSL_UNREGISTER_HASH_ID			= 15, /*!< (15) Channel: Used with ::RSSL_CONN_TYPE_RELIABLE_MCAST connections. Unregisters a hash so that a filtering-enabled channel no longer allows it. */
+	RSSL_SYSTEM_BUSY_POLL			= 16, /*!< (16) Channel: Used to set the time, in microseconds, that the kernel busy-polls the device queue on socket reads (SO_BUSY_POLL) for this channel. 0 turns it off. Supported on Linux only. */
+	RSSL_RECV_TIMESTAMPS			= 17 /*!< (17) Channel: Used with ::RSSL_CONN_TYPE_SOCKET and ::RSSL_CONN_TYPE_SEQ_MCAST connections to turn receive timestamps on or off. The value is an ::RsslRecvTimestampTypes. Supported on Linux only. @see RsslReadOutArgs::recvTimestamp */
 } RsslIoctlCodes;
 
+/**
+ * @brief Receive timestamp types, used with the ::RSSL_RECV_TIMESTAMPS IOCtl code
+ * @see rsslIoctl
+ */
+typedef enum {
+	RSSL_RECV_TIMESTAMP_NONE		= 0, /*!< (0) No receive timestamps */
+	RSSL_RECV_TIMESTAMP_SOFTWARE	= 1, /*!< (1) Timestamps taken by the kernel when it receives the data (SO_TIMESTAMPNS) */
+	RSSL_RECV_TIMESTAMP_HARDWARE	= 2  /*!< (2) Timestamps taken by the network interface, falling back to kernel timestamps when the interface does not provide them (SO_TIMESTAMPING). Hardware timestamping must be enabled on the interface, and its clock is expected to be synchronized with the system clock. */
+} RsslRecvTimestampTypes;
+
 /**
  * @brief RSSL Connection types
  */
@@ -397,9 +409,10 @@ RSSL_API RsslInt32 rsslBufferUsage(RsslChannel *chnl,
  */
 typedef struct {
 	RsslBool			tcp_nodelay;			/*!< @brief Only used with connectionType of ::RSSL_CONN_TYPE_SOCKET.  If RSSL_TRUE, disables Nagle's Algorithm. */
+	RsslUInt32			readAheadSize;			/*!< @brief If non-zero, non-blocking channels read as much data as is available (up to this many bytes) on each read from the network, rather than only the remainder of the current message. The input buffer is sized to hold at least this many bytes plus one maximum-size message. A value of 0 uses the default reading behavior. */
 } RsslTcpOpts;
 
-#define RSSL_INIT_TCP_OPTS { RSSL_FALSE }
+#define RSSL_INIT_TCP_OPTS { RSSL_FALSE, 0 }
 
 typedef enum {
 	RSSL_MCAST_NO_FLAGS				= 0x00, /*!< @brief None. */
@@ -481,9 +494,10 @@ typedef enum {
  */
 typedef struct {
 	RsslUInt32 encryptionProtocolFlags;
+	RsslBool   sessionResumption;		/*!< @brief If RSSL_TRUE, resumes the TLS session of the last connection to the same host and port, so that reconnecting does an abbreviated handshake rather than a full key exchange. */
 } RsslEncryptionOpts;
 
-#define RSSL_INIT_ENCRYPTION_OPTS { RSSL_ENC_TLSV1 | RSSL_ENC_TLSV1_1 | RSSL_ENC_TLSV1_2}
+#define RSSL_INIT_ENCRYPTION_OPTS { RSSL_ENC_TLSV1 | RSSL_ENC_TLSV1_1 | RSSL_ENC_TLSV1_2, RSSL_TRUE }
 
 
 
@@ -614,6 +628,7 @@ RTR_C_INLINE void rsslClearConnectOpts(RsslConnectOptions *opts)
 	opts->protocolType = 0;
 	opts->userSpecPtr = 0;
 	opts->tcpOpts.tcp_nodelay = RSSL_FALSE;
+	opts->tcpOpts.readAheadSize = 0;
 	opts->multicastOpts.flags = RSSL_MCAST_NO_FLAGS;
 	opts->multicastOpts.disconnectOnGaps = RSSL_FALSE;
 	opts->multicastOpts.packetTTL = 5;
@@ -643,6 +658,7 @@ RTR_C_INLINE void rsslClearConnectOpts(RsslConnectOptions *opts)
 	opts->proxyOpts.proxyPort = 0;
 	opts->componentVersion = NULL;
 	opts->encryptionOpts.encryptionProtocolFlags = RSSL_ENC_TLSV1 | RSSL_ENC_TLSV1_1 | RSSL_ENC_TLSV1_2;
+	opts->encryptionOpts.sessionResumption = RSSL_TRUE;
 	opts->extLineOptions.numConnections = 20;
 }
 
@@ -853,6 +869,7 @@ RTR_C_INLINE void rsslClearBindOpts(RsslBindOptions *opts)
 	opts->protocolType = 0;
 	opts->userSpecPtr = 0;
 	opts->tcpOpts.tcp_nodelay = RSSL_FALSE;
+	opts->tcpOpts.readAheadSize = 0;
 	opts->sysSendBufSize = 0;
 	opts->sysRecvBufSize = 0;
 	opts->componentVersion = NULL;
@@ -1088,7 +1105,8 @@ typedef enum {
 	RSSL_READ_OUT_HASH_ID		= 0x0008,	/*!< (0x08) set when a hash ID is returned */
 	RSSL_READ_OUT_UNICAST		= 0x0010,	/*!< (0x10) set when the message was sent unicast to this node */
 	RSSL_READ_OUT_INSTANCE_ID	= 0x0020,	/*!< (0x20) set when the message has an instance ID set */
-	RSSL_READ_OUT_RETRANSMIT     = 0x0040  	/*!< (0x40) indicates that this message is a retransmission of previous content*/
+	RSSL_READ_OUT_RETRANSMIT     = 0x0040, 	/*!< (0x40) indicates that this message is a retransmission of previous content*/
+	RSSL_READ_OUT_RECV_TIMESTAMP	= 0x0080	/*!< (0x80) set when a receive timestamp is returned */
 } RsslReadOutFlags;
 
 typedef struct {
@@ -1109,12 +1127,14 @@ typedef struct {
 		RsslUInt8				FTGroupId;				/*!< The FTGroup of the node that sent this message */
 		RsslUInt16				instanceId;				/*!< The instance ID of the sender's channel.  When combined with the sender's IP address and port, contained in the nodeId, 
 															 this can be used to identify the specific channel that sent this message. */
+		RsslUInt32				transportReads;			/*!< transportReads Returns the number of times this call to rsslReadEx() read from the channel's transport. Each transport read receives until the socket has no more data (or, for a blocking channel, the requested length), so it can make more than one recv call. Populated for ::RSSL_CONN_TYPE_SOCKET, ::RSSL_CONN_TYPE_ENCRYPTED and ::RSSL_CONN_TYPE_HTTP. */
+		RsslUInt64				recvTimestamp;			/*!< Time at which the data containing this message was received, in nanoseconds since the epoch (system clock). For ::RSSL_CONN_TYPE_SOCKET this is the time of the latest network read the message was assembled from. Populated when ::RSSL_READ_OUT_RECV_TIMESTAMP is set; see ::RSSL_RECV_TIMESTAMPS. */
 } RsslReadOutArgs;
 
 /**
  * @brief RsslReadOutArgs static initialization
  */
-#define RSSL_INIT_READ_OUT_ARGS {RSSL_READ_OUT_NO_FLAGS, 0, 0, 0, {0, 0}, 0, 0, 0}
+#define RSSL_INIT_READ_OUT_ARGS {RSSL_READ_OUT_NO_FLAGS, 0, 0, 0, {0, 0}, 0, 0, 0, 0, 0}
 
 /**
  * @brief Clears the RsslReadInArgs structure passed in
@@ -1134,6 +1154,8 @@ RTR_C_INLINE void rsslClearReadOutArgs(RsslReadOutArgs *readOutArgs)
 	readOutArgs->bytesRead = 0;
 	readOutArgs->readOutFlags = RSSL_READ_OUT_NO_FLAGS;
 	readOutArgs->uncompressedBytesRead = 0;
+	readOutArgs->transportReads = 0;
+	readOutArgs->recvTimestamp = 0;
 }
 
 /**
@@ -1260,6 +1282,16 @@ RSSL_API RsslBuffer* rsslPackBuffer(RsslChannel *chnl,
 											   RsslBuffer *buffer,
 											   RsslError *error);
 
+/**
+ * @brief Indicates whether a buffer was obtained for packing, i.e. from rsslGetBuffer with packedBuffer set
+ *
+ * Such a buffer may hold messages already packed with rsslPackBuffer before the position it currently points to.
+ *
+ * @param buffer Buffer obtained from rsslGetBuffer
+ * @return RSSL_TRUE if the buffer is a packed buffer, RSSL_FALSE otherwise
+ */
+RSSL_API RsslBool rsslIsPackedBuffer(RsslBuffer *buffer);
+
 /**
  *	@}
  */
@@ -1,7 +1,7 @@
 /*
  * This source code is provided under the Apache 2.0 license and is provided
- * AS IS with no warranty or guarantee of fit for purpose.  See the project's 
- * LICENSE.md for details. 
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
  * Copyright Thomson Reuters 2015. All rights reserved.
 */
 
@@ -13,16 +13,48 @@
 #include <assert.h>
 #include <malloc.h>
 
+#ifdef Linux
+#include <sys/mman.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-/* Creates a pool of fixed-size memory blocks. */
+/* Creates a pool of fixed-size memory blocks.
+ *
+ * Blocks are carved from slabs, large contiguous allocations each holding many blocks, so that
+ * objects from the pool sit close together in memory. Free blocks are reused last-in first-out,
+ * so the most recently released (and most likely cached) block is handed out next.
+ * When the pool is empty, a new slab is added. Slabs whose blocks are all free can be released
+ * with rsslMemoryPoolTrim(). */
+
+/* Number of blocks in each slab added when the pool runs out of blocks, unless set in the options. */
+#define RSSL_MEMORY_POOL_DEFAULT_SLAB_BLOCKS 256
+
+/* Huge page size used when hugepage backing is requested. */
+#define RSSL_MEMORY_POOL_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+typedef struct
+{
+	RsslQueueLink	qlSlabs;		/* Link in the pool's slab list. */
+	int				blockCount;		/* Number of blocks in this slab. */
+	int				freeCount;		/* Number of this slab's blocks that are in the pool. */
+	size_t			allocSize;		/* Size of the allocation holding this slab. */
+	RsslBool		isMapped;		/* Whether the slab was allocated with mmap() instead of malloc(). */
+	char			*pBlocks;		/* Start of the first block. */
+} RsslMemorySlab;
 
 typedef struct
 {
 	int			blockSize;
-	RsslQueue	blocks;
+	RsslQueue	blocks;				/* Free blocks, most recently returned first. */
+	size_t		blockStride;		/* Distance between blocks in a slab (block header and block). */
+	int			slabBlockCount;		/* Number of blocks in slabs added when the pool is empty. */
+	RsslBool	useHugePages;		/* Whether to back large slabs with huge pages. */
+	RsslQueue	slabs;				/* All slabs, in the order they were added. */
+	int			totalBlocks;		/* Number of blocks in all slabs. */
+	RsslUInt64	allocatedBytes;		/* Memory allocated for all slabs. */
 } RsslMemoryPool;
 
 typedef struct
@@ -30,11 +62,51 @@ typedef struct
 	RsslQueueLink qlPool;
 } RsslMemoryBlock;
 
+/* Precedes each block, so that a returned block can find its slab. */
+typedef union
+{
+	RsslMemorySlab	*pSlab;
+	RsslUInt64		align;
+} RsslMemoryBlockHeader;
+
+/* Options for rsslMemoryPoolInitEx(). */
+typedef struct
+{
+	int			blockSize;			/* Size of each block. */
+	int			blockCount;			/* Number of blocks to allocate up front, in a single slab. */
+	int			slabBlockCount;		/* Number of blocks in each slab added when the pool is empty.
+									 * 0 uses RSSL_MEMORY_POOL_DEFAULT_SLAB_BLOCKS. */
+	RsslBool	useHugePages;		/* If set, slabs of at least RSSL_MEMORY_POOL_HUGE_PAGE_SIZE are backed
+									 * by huge pages where the platform supports it. Falls back to regular
+									 * pages if none are available. */
+} RsslMemoryPoolOptions;
+
+RTR_C_INLINE void rsslClearMemoryPoolOptions(RsslMemoryPoolOptions *pOpts)
+{
+	pOpts->blockSize = 0;
+	pOpts->blockCount = 0;
+	pOpts->slabBlockCount = 0;
+	pOpts->useHugePages = RSSL_FALSE;
+}
+
+/* Memory statistics for a pool. */
+typedef struct
+{
+	int			totalBlocks;		/* Number of blocks in all slabs. */
+	int			freeBlocks;			/* Number of blocks currently in the pool. */
+	int			slabCount;			/* Number of slabs. */
+	RsslUInt64	allocatedBytes;		/* Memory allocated for all slabs. */
+} RsslMemoryPoolStats;
+
 /* Initializes a pool. */
 RTR_C_INLINE RsslRet rsslMemoryPoolInit(RsslMemoryPool *pPool, int blockSize, int blockCount,
 		RsslErrorInfo *pErrorInfo);
 
-/* Cleans up a pool. */
+/* Initializes a pool with the given options. */
+RTR_C_INLINE RsslRet rsslMemoryPoolInitEx(RsslMemoryPool *pPool, RsslMemoryPoolOptions *pOpts,
+		RsslErrorInfo *pErrorInfo);
+
+/* Cleans up a pool. This releases all slabs, including blocks that were not returned. */
 RTR_C_INLINE void rsslMemoryPoolCleanup(RsslMemoryPool *pPool);
 
 /* Retrieves a memory block from the pool. */
@@ -43,30 +115,134 @@ RTR_C_INLINE void *rsslMemoryPoolGet(RsslMemoryPool *pPool, RsslErrorInfo *pErro
 /* Returns a memory block to the pool. */
 RTR_C_INLINE void rsslMemoryPoolPut(RsslMemoryPool *pPool, void *pMemory);
 
-RTR_C_INLINE RsslRet rsslMemoryPoolInit(RsslMemoryPool *pPool, int blockSize, int blockCount,
-		RsslErrorInfo *pErrorInfo)
+/* Releases slabs whose blocks are all in the pool, as long as at least minFreeBlocks blocks
+ * remain in the pool afterwards. Returns the number of blocks released. */
+RTR_C_INLINE int rsslMemoryPoolTrim(RsslMemoryPool *pPool, int minFreeBlocks);
+
+/* Retrieves memory statistics for the pool. */
+RTR_C_INLINE void rsslMemoryPoolGetStats(RsslMemoryPool *pPool, RsslMemoryPoolStats *pStats);
+
+RTR_C_INLINE RsslMemoryBlockHeader *_rsslMemoryPoolBlockHeader(void *pMemory)
+{
+	return (RsslMemoryBlockHeader*)((char*)pMemory - sizeof(RsslMemoryBlockHeader));
+}
+
+/* Allocates a slab of blockCount blocks and adds its blocks to the pool. */
+RTR_C_INLINE RsslRet _rsslMemoryPoolAddSlab(RsslMemoryPool *pPool, int blockCount, RsslErrorInfo *pErrorInfo)
 {
+	RsslMemorySlab *pSlab;
+	size_t slabSize = (size_t)blockCount * pPool->blockStride;
+	size_t headerSize = (sizeof(RsslMemorySlab) + sizeof(RsslUInt64) - 1) & ~(sizeof(RsslUInt64) - 1);
+	size_t allocSize = headerSize + slabSize;
+	RsslBool isMapped = RSSL_FALSE;
+	char *pBlock;
 	int i;
 
-	assert(blockSize > sizeof(RsslMemoryBlock));
+	pSlab = NULL;
 
-	rsslInitQueue(&pPool->blocks);
-	pPool->blockSize = blockSize;
-
-	for(i = 0; i < blockCount; ++i)
+#if defined(Linux) && defined(MAP_ANONYMOUS)
+	if (pPool->useHugePages && allocSize >= RSSL_MEMORY_POOL_HUGE_PAGE_SIZE)
 	{
-		RsslMemoryBlock *pBlock = (RsslMemoryBlock*)malloc(blockSize);
+		void *pMap;
+		allocSize = (allocSize + RSSL_MEMORY_POOL_HUGE_PAGE_SIZE - 1) & ~((size_t)RSSL_MEMORY_POOL_HUGE_PAGE_SIZE - 1);
 
-		if (!pBlock)
+		pMap = MAP_FAILED;
+#ifdef MAP_HUGETLB
+		/* Use reserved huge pages if there are any. */
+		pMap = mmap(NULL, allocSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+		if (pMap == MAP_FAILED)
 		{
-			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
-					"Memory allocation failure.");
-			rsslMemoryPoolCleanup(pPool);
-			return RSSL_RET_FAILURE;
+			/* Otherwise ask for transparent huge pages. */
+			pMap = mmap(NULL, allocSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#ifdef MADV_HUGEPAGE
+			if (pMap != MAP_FAILED)
+				madvise(pMap, allocSize, MADV_HUGEPAGE);
+#endif
 		}
 
-		rsslQueueAddLinkToBack(&pPool->blocks, &pBlock->qlPool);
+		if (pMap != MAP_FAILED)
+		{
+			pSlab = (RsslMemorySlab*)pMap;
+			isMapped = RSSL_TRUE;
+		}
+		else
+			allocSize = headerSize + slabSize;
 	}
+#endif
+
+	if (!pSlab && !(pSlab = (RsslMemorySlab*)malloc(allocSize)))
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Memory allocation failure.");
+		return RSSL_RET_FAILURE;
+	}
+
+	pSlab->blockCount = blockCount;
+	pSlab->freeCount = blockCount;
+	pSlab->allocSize = allocSize;
+	pSlab->isMapped = isMapped;
+	pSlab->pBlocks = (char*)pSlab + headerSize;
+	rsslQueueAddLinkToBack(&pPool->slabs, &pSlab->qlSlabs);
+
+	/* Add the blocks so that the first block of the slab is handed out first. */
+	pBlock = pSlab->pBlocks + slabSize;
+	for (i = 0; i < blockCount; ++i)
+	{
+		RsslMemoryBlock *pMemoryBlock;
+
+		pBlock -= pPool->blockStride;
+		((RsslMemoryBlockHeader*)pBlock)->pSlab = pSlab;
+		pMemoryBlock = (RsslMemoryBlock*)(pBlock + sizeof(RsslMemoryBlockHeader));
+		rsslQueueAddLinkToFront(&pPool->blocks, &pMemoryBlock->qlPool);
+	}
+
+	pPool->totalBlocks += blockCount;
+	pPool->allocatedBytes += allocSize;
+
+	return RSSL_RET_SUCCESS;
+}
+
+RTR_C_INLINE void _rsslMemoryPoolFreeSlab(RsslMemorySlab *pSlab)
+{
+#if defined(Linux) && defined(MAP_ANONYMOUS)
+	if (pSlab->isMapped)
+	{
+		munmap((void*)pSlab, pSlab->allocSize);
+		return;
+	}
+#endif
+	free(pSlab);
+}
+
+RTR_C_INLINE RsslRet rsslMemoryPoolInit(RsslMemoryPool *pPool, int blockSize, int blockCount,
+		RsslErrorInfo *pErrorInfo)
+{
+	RsslMemoryPoolOptions opts;
+
+	rsslClearMemoryPoolOptions(&opts);
+	opts.blockSize = blockSize;
+	opts.blockCount = blockCount;
+	return rsslMemoryPoolInitEx(pPool, &opts, pErrorInfo);
+}
+
+RTR_C_INLINE RsslRet rsslMemoryPoolInitEx(RsslMemoryPool *pPool, RsslMemoryPoolOptions *pOpts,
+		RsslErrorInfo *pErrorInfo)
+{
+	assert(pOpts->blockSize > sizeof(RsslMemoryBlock));
+
+	rsslInitQueue(&pPool->blocks);
+	rsslInitQueue(&pPool->slabs);
+	pPool->blockSize = pOpts->blockSize;
+	pPool->blockStride = sizeof(RsslMemoryBlockHeader)
+		+ (((size_t)pOpts->blockSize + sizeof(RsslUInt64) - 1) & ~(sizeof(RsslUInt64) - 1));
+	pPool->slabBlockCount = pOpts->slabBlockCount > 0 ? pOpts->slabBlockCount : RSSL_MEMORY_POOL_DEFAULT_SLAB_BLOCKS;
+	pPool->useHugePages = pOpts->useHugePages;
+	pPool->totalBlocks = 0;
+	pPool->allocatedBytes = 0;
+
+	if (pOpts->blockCount > 0 && _rsslMemoryPoolAddSlab(pPool, pOpts->blockCount, pErrorInfo) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
 
 	return RSSL_RET_SUCCESS;
 }
@@ -74,34 +250,78 @@ RTR_C_INLINE RsslRet rsslMemoryPoolInit(RsslMemoryPool *pPool, int blockSize, in
 RTR_C_INLINE void rsslMemoryPoolCleanup(RsslMemoryPool *pPool)
 {
 	RsslQueueLink *pLink;
-	while (pLink = rsslQueueRemoveFirstLink(&pPool->blocks))
-		free(RSSL_QUEUE_LINK_TO_OBJECT(RsslMemoryBlock, qlPool, pLink));
+
+	rsslInitQueue(&pPool->blocks);
+	while (pLink = rsslQueueRemoveFirstLink(&pPool->slabs))
+		_rsslMemoryPoolFreeSlab(RSSL_QUEUE_LINK_TO_OBJECT(RsslMemorySlab, qlSlabs, pLink));
+
+	pPool->totalBlocks = 0;
+	pPool->allocatedBytes = 0;
 }
 
 RTR_C_INLINE void *rsslMemoryPoolGet(RsslMemoryPool *pPool, RsslErrorInfo *pErrorInfo)
 {
 	RsslQueueLink *pLink;
+	void *pMemory;
 
-	if (pLink = rsslQueueRemoveFirstLink(&pPool->blocks))
-		return (void*)RSSL_QUEUE_LINK_TO_OBJECT(RsslMemoryBlock, qlPool, pLink);
-	else
+	if (!(pLink = rsslQueueRemoveFirstLink(&pPool->blocks)))
 	{
-		void *pBlock = (void*)malloc(pPool->blockSize);
-
-		if (!pBlock)
-		{
-			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
-					"Memory allocation failure.");
+		if (_rsslMemoryPoolAddSlab(pPool, pPool->slabBlockCount, pErrorInfo) != RSSL_RET_SUCCESS)
 			return NULL;
-		}
 
-		return pBlock;
+		pLink = rsslQueueRemoveFirstLink(&pPool->blocks);
 	}
+
+	pMemory = (void*)RSSL_QUEUE_LINK_TO_OBJECT(RsslMemoryBlock, qlPool, pLink);
+	--_rsslMemoryPoolBlockHeader(pMemory)->pSlab->freeCount;
+	return pMemory;
 }
 
 RTR_C_INLINE void rsslMemoryPoolPut(RsslMemoryPool *pPool, void *pMemory)
 {
-	rsslQueueAddLinkToBack(&pPool->blocks, &((RsslMemoryBlock*)pMemory)->qlPool);
+	++_rsslMemoryPoolBlockHeader(pMemory)->pSlab->freeCount;
+	rsslQueueAddLinkToFront(&pPool->blocks, &((RsslMemoryBlock*)pMemory)->qlPool);
+}
+
+RTR_C_INLINE int rsslMemoryPoolTrim(RsslMemoryPool *pPool, int minFreeBlocks)
+{
+	RsslQueueLink *pLink, *pPrevLink;
+	int freeBlocks = (int)rsslQueueGetElementCount(&pPool->blocks);
+	int releasedBlocks = 0;
+
+	/* Check the most recently added slabs first. */
+	for (pLink = rsslQueuePeekBack(&pPool->slabs); pLink; pLink = pPrevLink)
+	{
+		RsslMemorySlab *pSlab = RSSL_QUEUE_LINK_TO_OBJECT(RsslMemorySlab, qlSlabs, pLink);
+		char *pBlock;
+		int i;
+
+		pPrevLink = rsslQueuePeekPrev(&pPool->slabs, pLink);
+
+		if (pSlab->freeCount != pSlab->blockCount || freeBlocks - pSlab->blockCount < minFreeBlocks)
+			continue;
+
+		for (i = 0, pBlock = pSlab->pBlocks; i < pSlab->blockCount; ++i, pBlock += pPool->blockStride)
+			rsslQueueRemoveLink(&pPool->blocks,
+					&((RsslMemoryBlock*)(pBlock + sizeof(RsslMemoryBlockHeader)))->qlPool);
+
+		freeBlocks -= pSlab->blockCount;
+		releasedBlocks += pSlab->blockCount;
+		pPool->totalBlocks -= pSlab->blockCount;
+		pPool->allocatedBytes -= pSlab->allocSize;
+		rsslQueueRemoveLink(&pPool->slabs, &pSlab->qlSlabs);
+		_rsslMemoryPoolFreeSlab(pSlab);
+	}
+
+	return releasedBlocks;
+}
+
+RTR_C_INLINE void rsslMemoryPoolGetStats(RsslMemoryPool *pPool, RsslMemoryPoolStats *pStats)
+{
+	pStats->totalBlocks = pPool->totalBlocks;
+	pStats->freeBlocks = (int)rsslQueueGetElementCount(&pPool->blocks);
+	pStats->slabCount = (int)rsslQueueGetElementCount(&pPool->slabs);
+	pStats->allocatedBytes = pPool->allocatedBytes;
 }
 
 #ifdef __cplusplus
@@ -39,6 +39,13 @@ typedef struct
 
 #define RSSL_THREAD_KILL(__pThreadId) TerminateThread((__pThreadId)->handle, 0)
 
+/* Binds the thread to the given CPU. Returns 0 on success. */
+#define RSSL_THREAD_BIND(__pThreadId, __cpuId) \
+	( \
+		((__cpuId) >= 0 && (__cpuId) < (int)(sizeof(DWORD_PTR) * 8) \
+		 && SetThreadAffinityMask((__pThreadId)->handle, ((DWORD_PTR)1) << (__cpuId)) != 0) ? 0 : -1 \
+	)
+
 typedef CRITICAL_SECTION RsslMutex;
 #define RSSL_MUTEX_INIT(__pMutex) (InitializeCriticalSection(__pMutex), 0)
 #define RSSL_MUTEX_INIT_ESDK(__pMutex) (InitializeCriticalSectionAndSpinCount((__pMutex), 512), 0)
@@ -76,6 +83,23 @@ typedef pthread_t RsslThreadId;
 #define RSSL_THREAD_JOIN(__threadId) pthread_join((__threadId), NULL)
 #define RSSL_THREAD_KILL(__pThreadId) pthread_cancel(*(__pThreadId))
 
+/* Binds the thread to the given CPU. Returns 0 on success. */
+RTR_C_INLINE int RSSL_THREAD_BIND(RsslThreadId *pThreadId, int cpuId)
+{
+#ifdef Linux
+	cpu_set_t cpuSet;
+
+	if (cpuId < 0 || cpuId >= CPU_SETSIZE)
+		return -1;
+
+	CPU_ZERO(&cpuSet);
+	CPU_SET(cpuId, &cpuSet);
+	return pthread_setaffinity_np(*pThreadId, sizeof(cpu_set_t), &cpuSet) == 0 ? 0 : -1;
+#else
+	return -1;
+#endif
+}
+
 typedef pthread_mutex_t RsslMutex;
 RTR_C_INLINE int RSSL_MUTEX_INIT(RsslMutex *pMutex)
 {
@@ -39,6 +39,11 @@
 #include <sys/timeb.h> 
 #include <pthread.h>
 #include <signal.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+extern "C" {
+#include "rtr/ripcsslutils.h"
+}
 #endif
 
 void time_sleep(int millisec)
@@ -278,11 +283,13 @@ class ClientChannel
 public:
 	RsslThreadId* pThreadId;		/* Current Thread Id.  Useful for debugging */
 	RsslChannel* pChnl;				/* Channel to be created.  This should be NULL when calling startServerChannel */
+	RsslUInt32 readAheadSize;		/* Read-ahead size for the channel.  0 disables read-ahead */
 
 	ClientChannel()
 	{
 		pThreadId = NULL;
 		pChnl = NULL;
+		readAheadSize = 0;
 	}
 
 	/* If blocking is set to RSSL_TRUE, attempt to connect using rsslConnect.  This will either return an active channel or error out.
@@ -302,6 +309,7 @@ public:
 		connectOpts.protocolType = TEST_PROTOCOL_TYPE;
 		connectOpts.tcp_nodelay = true;
 		connectOpts.blocking = blocking;
+		connectOpts.tcpOpts.readAheadSize = readAheadSize;
 
 		pClientChnl = rsslConnect(&connectOpts, &err);
 
@@ -777,7 +785,7 @@ public:
 };
 
 /* This function starts up the RsslServer. */
-RsslServer* startupServer(RsslBool blocking)
+RsslServer* startupServer(RsslBool blocking, RsslUInt32 readAheadSize = 0)
 {
 	RsslError err;
 	RsslBindOptions bindOpts;
@@ -788,6 +796,7 @@ RsslServer* startupServer(RsslBool blocking)
 	bindOpts.protocolType = TEST_PROTOCOL_TYPE;  /* These tests are just sending a pre-set string across the wire, so protocol type should not be RWF */
 	bindOpts.channelsBlocking = blocking;
 	bindOpts.serverBlocking = blocking;
+	bindOpts.tcpOpts.readAheadSize = readAheadSize;
 
 	server = rsslBind(&bindOpts, &err);
 
@@ -2741,6 +2750,409 @@ TEST_F(ManyThreadConnectionTests, BlockingGlobalLockClientWriteServerRead)
 	rsslCloseServer(server, &err);
 }
 
+#define READ_AHEAD_SIZE 262144
+#define READ_AHEAD_BATCH_COUNT 100
+#define READ_AHEAD_BATCH_TOTAL 200
+
+class ReadAheadTests : public ::testing::Test {
+protected:
+	RsslChannel* serverChannel;
+	RsslChannel* clientChannel;
+	RsslServer* server;
+	bool expectRecvTimestamps;
+	RsslUInt64 minRecvTimestamp, maxRecvTimestamp;	/* Range of receive timestamps seen in the last batch. */
+
+	virtual void SetUp()
+	{
+		RsslError err;
+
+		shutdownTest = false;
+		failTest = false;
+		server = NULL;
+		serverChannel = NULL;
+		clientChannel = NULL;
+		expectRecvTimestamps = false;
+
+		rsslInitialize(RSSL_LOCK_NONE, &err);
+	}
+
+	virtual void TearDown()
+	{
+		RsslError err;
+		if (clientChannel)
+			rsslCloseChannel(clientChannel, &err);
+		if (serverChannel)
+			rsslCloseChannel(serverChannel, &err);
+		rsslCloseServer(server, &err);
+		rsslUninitialize();
+		server = NULL;
+		serverChannel = NULL;
+		clientChannel = NULL;
+		resetDeadlockTimer();
+	}
+
+	void startupServerAndConections(RsslUInt32 readAheadSize)
+	{
+		RsslThreadId serverThread, clientThread;
+		ClientChannel clientOpts;
+		ServerChannel serverChnl;
+		serverChnl.pThreadId = &serverThread;
+		clientOpts.pThreadId = &clientThread;
+		clientOpts.readAheadSize = readAheadSize;
+
+		server = startupServer(RSSL_FALSE, readAheadSize);
+
+		ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+
+		serverChnl.pServer = server;
+
+		RSSL_THREAD_START(&serverThread, nonBlockingServerConnectThread, &serverChnl);
+		RSSL_THREAD_START(&clientThread, nonBlockingClientConnectThread, &clientOpts);
+
+		RSSL_THREAD_JOIN(serverThread);
+		RSSL_THREAD_JOIN(clientThread);
+
+		serverChannel = serverChnl.pChnl;
+		clientChannel = clientOpts.pChnl;
+
+		if (!serverChannel || !clientChannel || serverChannel->state != RSSL_CH_STATE_ACTIVE || clientChannel->state != RSSL_CH_STATE_ACTIVE)
+		{
+			ASSERT_TRUE(false) << "Channel creation failed!";
+		}
+	}
+
+	/* Message lengths vary so that message boundaries (and RIPC headers) fall at every offset of the input buffer.
+	   Every 40th message is larger than the maximum fragment size, so it is fragmented. */
+	static RsslUInt32 messageLength(int msgNum)
+	{
+		if (msgNum % 40 == 39)
+			return 10000 + msgNum % 7;
+		return 4 + (msgNum * 37) % 300;
+	}
+
+	static char messageByte(int msgNum, RsslUInt32 pos)
+	{
+		return (char)(msgNum + pos);
+	}
+
+	/* Writes a batch of messages from the client, then reads them on the server with rsslReadEx, 
+	   checking the length and content of each message.  Transport reads are added to pTransportReads. */
+	void writeAndReadBatch(int firstMsgNum, RsslUInt32* pTransportReads)
+	{
+		RsslWriteInArgs writeInArgs;
+		RsslWriteOutArgs writeOutArgs;
+		RsslReadInArgs readInArgs;
+		RsslReadOutArgs readOutArgs;
+		RsslError err;
+		RsslRet ret;
+		RsslBuffer* pBuffer;
+		fd_set readfds;
+		struct timeval selectTime;
+		int msgNum, readMsgNum = firstMsgNum;
+
+		for (msgNum = firstMsgNum; msgNum < firstMsgNum + READ_AHEAD_BATCH_COUNT; ++msgNum)
+		{
+			RsslUInt32 length = messageLength(msgNum);
+
+			pBuffer = rsslGetBuffer(clientChannel, length, RSSL_FALSE, &err);
+			while (pBuffer == NULL)
+			{
+				ASSERT_GE(rsslFlush(clientChannel, &err), RSSL_RET_SUCCESS) << "Flush failed.  Error: " << err.text;
+				pBuffer = rsslGetBuffer(clientChannel, length, RSSL_FALSE, &err);
+			}
+
+			for (RsslUInt32 pos = 0; pos < length; ++pos)
+				pBuffer->data[pos] = messageByte(msgNum, pos);
+			pBuffer->length = length;
+
+			rsslClearWriteInArgs(&writeInArgs);
+			ret = rsslWriteEx(clientChannel, pBuffer, &writeInArgs, &writeOutArgs, &err);
+			while (ret == RSSL_RET_WRITE_CALL_AGAIN)
+			{
+				ASSERT_GE(rsslFlush(clientChannel, &err), RSSL_RET_SUCCESS) << "Flush failed.  Error: " << err.text;
+				ret = rsslWriteEx(clientChannel, pBuffer, &writeInArgs, &writeOutArgs, &err);
+			}
+			ASSERT_TRUE(ret >= RSSL_RET_SUCCESS || ret == RSSL_RET_WRITE_FLUSH_FAILED) << "Write failed.  Error: " << err.text;
+		}
+
+		while ((ret = rsslFlush(clientChannel, &err)) > RSSL_RET_SUCCESS);
+		ASSERT_EQ(RSSL_RET_SUCCESS, ret) << "Flush failed.  Error: " << err.text;
+
+		FD_ZERO(&readfds);
+		minRecvTimestamp = 0;
+		maxRecvTimestamp = 0;
+
+		while (readMsgNum < firstMsgNum + READ_AHEAD_BATCH_COUNT)
+		{
+			FD_SET(serverChannel->socketId, &readfds);
+			selectTime.tv_sec = 1L;
+			selectTime.tv_usec = 0L;
+			ASSERT_GT(select(FD_SETSIZE, &readfds, NULL, NULL, &selectTime), 0) << "Reader select failed or timed out.";
+
+			do
+			{
+				rsslClearReadInArgs(&readInArgs);
+				rsslClearReadOutArgs(&readOutArgs);
+				pBuffer = rsslReadEx(serverChannel, &readInArgs, &readOutArgs, &ret, &err);
+				*pTransportReads += readOutArgs.transportReads;
+
+				if (pBuffer)
+				{
+					RsslUInt32 length = messageLength(readMsgNum);
+
+					ASSERT_EQ(length, pBuffer->length) << "Wrong length for message " << readMsgNum;
+					if (expectRecvTimestamps)
+					{
+						ASSERT_TRUE(readOutArgs.readOutFlags & RSSL_READ_OUT_RECV_TIMESTAMP) << "No receive timestamp for message " << readMsgNum;
+						ASSERT_GT(readOutArgs.recvTimestamp, (RsslUInt64)0);
+						if (minRecvTimestamp == 0 || readOutArgs.recvTimestamp < minRecvTimestamp)
+							minRecvTimestamp = readOutArgs.recvTimestamp;
+						if (readOutArgs.recvTimestamp > maxRecvTimestamp)
+							maxRecvTimestamp = readOutArgs.recvTimestamp;
+					}
+					else
+						ASSERT_FALSE(readOutArgs.readOutFlags & RSSL_READ_OUT_RECV_TIMESTAMP);
+					for (RsslUInt32 pos = 0; pos < length; ++pos)
+						ASSERT_EQ(messageByte(readMsgNum, pos), pBuffer->data[pos]) << "Wrong data for message " << readMsgNum << " at position " << pos;
+					++readMsgNum;
+				}
+				else
+				{
+					ASSERT_TRUE(ret >= RSSL_RET_SUCCESS || ret == RSSL_RET_READ_PING || ret == RSSL_RET_READ_IN_PROGRESS || ret == RSSL_RET_READ_WOULD_BLOCK)
+						<< "rsslReadEx failed. Return code:" << ret << " Error info: " << err.text;
+				}
+			} while (ret > RSSL_RET_SUCCESS);
+		}
+
+		ASSERT_EQ(firstMsgNum + READ_AHEAD_BATCH_COUNT, readMsgNum);
+	}
+};
+
+/*	Sends messages of varying length (including fragmented messages) from a nonblocking client to a nonblocking server 
+	with read-ahead enabled on both, and checks that every message is read in order with the expected content, 
+	using fewer transport reads than messages. */
+TEST_F(ReadAheadTests, NonBlockingReadAhead)
+{
+	RsslUInt32 transportReads = 0;
+	int msgCount = 0;
+
+	startupServerAndConections(READ_AHEAD_SIZE);
+
+	for (int batch = 0; batch < READ_AHEAD_BATCH_TOTAL; ++batch)
+	{
+		writeAndReadBatch(msgCount, &transportReads);
+		ASSERT_FALSE(HasFatalFailure());
+		msgCount += READ_AHEAD_BATCH_COUNT;
+	}
+
+	ASSERT_GT(transportReads, (RsslUInt32)0);
+	ASSERT_LT(transportReads, (RsslUInt32)msgCount);
+}
+
+/*	Same as above, without read-ahead, to check that transportReads is also reported in the default mode. */
+TEST_F(ReadAheadTests, NonBlockingNoReadAhead)
+{
+	RsslUInt32 transportReads = 0;
+	int msgCount = 0;
+
+	startupServerAndConections(0);
+
+	for (int batch = 0; batch < READ_AHEAD_BATCH_TOTAL; ++batch)
+	{
+		writeAndReadBatch(msgCount, &transportReads);
+		ASSERT_FALSE(HasFatalFailure());
+		msgCount += READ_AHEAD_BATCH_COUNT;
+	}
+
+	ASSERT_GT(transportReads, (RsslUInt32)0);
+}
+
+#ifdef Linux
+/*	Enables software receive timestamps on the server channel, and checks that every message read is reported with
+	a timestamp taken between the batch being written and being read. */
+TEST_F(ReadAheadTests, NonBlockingRecvTimestamps)
+{
+	RsslUInt32 transportReads = 0;
+	int timestampType = RSSL_RECV_TIMESTAMP_SOFTWARE;
+	RsslError err;
+
+	startupServerAndConections(READ_AHEAD_SIZE);
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslIoctl(serverChannel, RSSL_RECV_TIMESTAMPS, &timestampType, &err)) << "Ioctl failed.  Error: " << err.text;
+	expectRecvTimestamps = true;
+
+	/* The kernel turns on timestamping of received packets asynchronously, and TCP reports no timestamp for packets
+	   that arrived before it did. */
+	time_sleep(100);
+
+	for (int batch = 0; batch < 5; ++batch)
+	{
+		struct timespec startTime, endTime;
+
+		clock_gettime(CLOCK_REALTIME, &startTime);
+		writeAndReadBatch(batch * READ_AHEAD_BATCH_COUNT, &transportReads);
+		ASSERT_FALSE(HasFatalFailure());
+		clock_gettime(CLOCK_REALTIME, &endTime);
+
+		ASSERT_GE(minRecvTimestamp, (RsslUInt64)startTime.tv_sec * 1000000000ULL + startTime.tv_nsec);
+		ASSERT_LE(maxRecvTimestamp, (RsslUInt64)endTime.tv_sec * 1000000000ULL + endTime.tv_nsec);
+	}
+
+	/* Turning them off again stops the timestamps being reported. */
+	timestampType = RSSL_RECV_TIMESTAMP_NONE;
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslIoctl(serverChannel, RSSL_RECV_TIMESTAMPS, &timestampType, &err)) << "Ioctl failed.  Error: " << err.text;
+	expectRecvTimestamps = false;
+	writeAndReadBatch(5 * READ_AHEAD_BATCH_COUNT, &transportReads);
+}
+#endif
+
+#ifndef WIN32
+/* Tests the cache of client TLS sessions used to resume sessions on reconnect.  The sessions come from handshakes 
+ * started over a socket pair; the server side never answers, but the client session exists once the hello is sent. */
+class SSLSessionCacheTests : public ::testing::Test {
+protected:
+	RsslSocketChannel *channel;
+	ripcSSLSession *sessions[RIPC_SSL_MAX_CACHED_SESSIONS + 8];
+	RsslSocket fds[RIPC_SSL_MAX_CACHED_SESSIONS + 8][2];
+	int sessionCount;
+	char portName[16];
+
+	virtual void SetUp()
+	{
+		RsslError err;
+
+		rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &err);
+		ASSERT_EQ(1, ripcInitializeSSL(NULL, NULL)) << "Failed to load the SSL libraries.";
+		ripcSSLClearSessionCache();
+
+		channel = (RsslSocketChannel*)calloc(1, sizeof(RsslSocketChannel));
+		channel->hostName = const_cast<char*>("localhost");
+		channel->serverName = portName;
+		channel->sslSessionResumption = RSSL_TRUE;
+		sessionCount = 0;
+	}
+
+	virtual void TearDown()
+	{
+		RsslError err;
+
+		for (int i = 0; i < sessionCount; ++i)
+		{
+			if (sessions[i])
+				ripcReleaseSSLSession(sessions[i], &err);
+			close(fds[i][0]);
+			close(fds[i][1]);
+		}
+
+		free(channel);
+		ripcSSLClearSessionCache();
+		ripcUninitializeSSL();
+		rsslUninitialize();
+		resetDeadlockTimer();
+	}
+
+	/* Starts a client handshake for localhost:port. */
+	ripcSSLSession *startSession(int port)
+	{
+		RsslError err;
+		RsslInt32 initComplete = 0;
+		int i = sessionCount++;
+
+		snprintf(portName, sizeof(portName), "%d", port);
+		sessions[i] = NULL;
+		if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds[i]) != 0)
+			return NULL;
+		fcntl(fds[i][0], F_SETFL, O_NONBLOCK);
+
+		sessions[i] = (ripcSSLSession*)ripcSSLConnectTLSv12(fds[i][0], &initComplete, channel, &err);
+		EXPECT_EQ(0, initComplete);
+		return sessions[i];
+	}
+
+	/* Starts a client handshake for localhost:port and caches its session. */
+	void cacheSession(int port)
+	{
+		ripcSSLSession *sess;
+
+		ASSERT_TRUE((sess = startSession(port)) != NULL);
+		ripcSSLCacheSession(sess);
+	}
+};
+
+TEST_F(SSLSessionCacheTests, ResumeSameHostAndPort)
+{
+	ripcSSLSession *sess;
+
+	cacheSession(14100);
+	ASSERT_EQ((RsslUInt32)1, ripcSSLCachedSessionCount());
+
+	/* Same host and port: the cached session is offered. */
+	ASSERT_TRUE((sess = startSession(14100)) != NULL);
+	ASSERT_STREQ("localhost:14100", sess->resumptionKey);
+	ASSERT_EQ(1, ripcSSLResumeCachedSession(sess));
+
+	/* Other port: nothing to resume. */
+	ASSERT_TRUE((sess = startSession(14101)) != NULL);
+	ASSERT_EQ(0, ripcSSLResumeCachedSession(sess));
+
+	/* Caching the same host and port again replaces the entry. */
+	cacheSession(14100);
+	ASSERT_EQ((RsslUInt32)1, ripcSSLCachedSessionCount());
+}
+
+TEST_F(SSLSessionCacheTests, EvictLeastRecentlyConnected)
+{
+	ripcSSLSession *sess;
+	int i;
+
+	for (i = 0; i < RIPC_SSL_MAX_CACHED_SESSIONS; ++i)
+		cacheSession(15000 + i);
+	ASSERT_EQ((RsslUInt32)RIPC_SSL_MAX_CACHED_SESSIONS, ripcSSLCachedSessionCount());
+
+	/* Reconnect to the oldest port, so the second oldest becomes the least recently connected. */
+	cacheSession(15000);
+	ASSERT_EQ((RsslUInt32)RIPC_SSL_MAX_CACHED_SESSIONS, ripcSSLCachedSessionCount());
+
+	/* One more port drops the second oldest entry. */
+	cacheSession(15000 + RIPC_SSL_MAX_CACHED_SESSIONS);
+	ASSERT_EQ((RsslUInt32)RIPC_SSL_MAX_CACHED_SESSIONS, ripcSSLCachedSessionCount());
+
+	ASSERT_TRUE((sess = startSession(15001)) != NULL);
+	ASSERT_EQ(0, ripcSSLResumeCachedSession(sess));
+
+	ASSERT_TRUE((sess = startSession(15000)) != NULL);
+	ASSERT_EQ(1, ripcSSLResumeCachedSession(sess));
+
+	ASSERT_TRUE((sess = startSession(15000 + RIPC_SSL_MAX_CACHED_SESSIONS)) != NULL);
+	ASSERT_EQ(1, ripcSSLResumeCachedSession(sess));
+}
+
+TEST_F(SSLSessionCacheTests, ResumptionOff)
+{
+	ripcSSLSession *sess;
+
+	cacheSession(14100);
+	ASSERT_EQ((RsslUInt32)1, ripcSSLCachedSessionCount());
+
+	/* With resumption off, the channel neither uses nor adds to the cache. */
+	channel->sslSessionResumption = RSSL_FALSE;
+	ASSERT_TRUE((sess = startSession(14100)) != NULL);
+	ASSERT_TRUE(sess->resumptionKey == NULL);
+	ASSERT_EQ(0, ripcSSLResumeCachedSession(sess));
+
+	cacheSession(14102);
+	ASSERT_EQ((RsslUInt32)1, ripcSSLCachedSessionCount());
+}
+
+TEST_F(SSLSessionCacheTests, ConnectOptionsDefault)
+{
+	RsslConnectOptions connectOpts;
+
+	rsslClearConnectOpts(&connectOpts);
+	ASSERT_EQ(RSSL_TRUE, connectOpts.encryptionOpts.sessionResumption);
+}
+#endif
+
 int main(int argc, char* argv[])
 {
 	int ret;
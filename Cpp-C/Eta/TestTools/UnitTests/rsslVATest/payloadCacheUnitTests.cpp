@@ -0,0 +1,913 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright Thomson Reuters 2018. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/rsslReactor.h"
+#include "rtr/rsslPayloadCache.h"
+#include "rtr/rsslPayloadEntry.h"
+#include "rtr/rsslPayloadCursor.h"
+#include "gtest/gtest.h"
+#include "getTime.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <map>
+#include <string>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <sys/time.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+typedef std::map<RsslFieldId, RsslUInt> FieldValues;
+typedef std::map<std::string, FieldValues> MapValues;
+
+/* Encodes a field list of UInt fields. */
+static void encodeFieldList(RsslEncodeIterator *pIter, const FieldValues &fields)
+{
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+
+	rsslClearFieldList(&fieldList);
+	fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldListInit(pIter, &fieldList, NULL, 0));
+
+	for (FieldValues::const_iterator it = fields.begin(); it != fields.end(); ++it)
+	{
+		RsslUInt value = it->second;
+
+		rsslClearFieldEntry(&fieldEntry);
+		fieldEntry.fieldId = it->first;
+		fieldEntry.dataType = RSSL_DT_UINT;
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldEntry(pIter, &fieldEntry, &value));
+	}
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldListComplete(pIter, RSSL_TRUE));
+}
+
+static void encodeFieldListBuffer(RsslBuffer *pBuffer, const FieldValues &fields)
+{
+	RsslEncodeIterator eIter;
+
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorBuffer(&eIter, pBuffer);
+	encodeFieldList(&eIter, fields);
+	pBuffer->length = rsslGetEncodedBufferLength(&eIter);
+}
+
+static void decodeFieldList(RsslDecodeIterator *pIter, FieldValues &fields)
+{
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslRet ret;
+
+	fields.clear();
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslDecodeFieldList(pIter, &fieldList, NULL));
+
+	while ((ret = rsslDecodeFieldEntry(pIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		RsslUInt value;
+
+		ASSERT_EQ(RSSL_RET_SUCCESS, ret);
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslDecodeUInt(pIter, &value));
+		fields[fieldEntry.fieldId] = value;
+	}
+}
+
+/* A map entry to encode. */
+typedef struct
+{
+	RsslMapEntryActions	action;
+	const char			*key;
+	FieldValues			fields;
+} TestMapEntry;
+
+/* Encodes a map of field lists keyed by buffer (e.g. order IDs). */
+static void encodeMapBuffer(RsslBuffer *pBuffer, const TestMapEntry *entries, RsslUInt32 entryCount, const FieldValues *pSummary)
+{
+	RsslEncodeIterator eIter;
+	RsslMap map;
+	RsslMapEntry mapEntry;
+	RsslUInt32 i;
+
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorBuffer(&eIter, pBuffer);
+
+	rsslClearMap(&map);
+	map.keyPrimitiveType = RSSL_DT_BUFFER;
+	map.containerType = RSSL_DT_FIELD_LIST;
+	if (pSummary)
+		map.flags |= RSSL_MPF_HAS_SUMMARY_DATA;
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapInit(&eIter, &map, 0, 0));
+
+	if (pSummary)
+	{
+		encodeFieldList(&eIter, *pSummary);
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapSummaryDataComplete(&eIter, RSSL_TRUE));
+	}
+
+	for (i = 0; i < entryCount; ++i)
+	{
+		RsslBuffer key;
+
+		key.data = const_cast<char*>(entries[i].key);
+		key.length = (RsslUInt32)strlen(entries[i].key);
+
+		rsslClearMapEntry(&mapEntry);
+		mapEntry.action = entries[i].action;
+
+		if (entries[i].action == RSSL_MPEA_DELETE_ENTRY)
+			ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapEntry(&eIter, &mapEntry, &key));
+		else
+		{
+			ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapEntryInit(&eIter, &mapEntry, &key, 0));
+			encodeFieldList(&eIter, entries[i].fields);
+			ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapEntryComplete(&eIter, RSSL_TRUE));
+		}
+	}
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapComplete(&eIter, RSSL_TRUE));
+	pBuffer->length = rsslGetEncodedBufferLength(&eIter);
+}
+
+/* Decodes a map of field lists, adding its entries to values. */
+static void decodeMap(RsslBuffer *pBuffer, MapValues &values, RsslBool *pHasSummary, FieldValues *pSummary)
+{
+	RsslDecodeIterator dIter;
+	RsslMap map;
+	RsslMapEntry mapEntry;
+	RsslBuffer key;
+	RsslRet ret;
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorBuffer(&dIter, pBuffer);
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslDecodeMap(&dIter, &map));
+	ASSERT_EQ(RSSL_DT_FIELD_LIST, map.containerType);
+	ASSERT_EQ(RSSL_DT_BUFFER, map.keyPrimitiveType);
+
+	*pHasSummary = (map.flags & RSSL_MPF_HAS_SUMMARY_DATA) ? RSSL_TRUE : RSSL_FALSE;
+	if (*pHasSummary && pSummary)
+		decodeFieldList(&dIter, *pSummary);
+
+	while ((ret = rsslDecodeMapEntry(&dIter, &mapEntry, &key)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		ASSERT_EQ(RSSL_RET_SUCCESS, ret);
+		ASSERT_EQ(RSSL_MPEA_ADD_ENTRY, mapEntry.action);
+		decodeFieldList(&dIter, values[std::string(key.data, key.length)]);
+	}
+}
+
+class PayloadCacheTest : public ::testing::Test {
+protected:
+
+	RsslPayloadCacheHandle cacheHandle;
+	RsslPayloadEntryHandle entryHandle;
+	RsslCacheError cacheError;
+	char payloadBlock[65536];
+	RsslBuffer payload;
+	char retrieveBlock[65536];
+	RsslBuffer retrieveBuffer;
+
+	virtual void SetUp()
+	{
+		RsslPayloadCacheConfigOptions cacheConfig;
+
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslPayloadCacheInitialize());
+
+		cacheConfig.maxItems = 0;
+		rsslCacheErrorClear(&cacheError);
+		ASSERT_TRUE((cacheHandle = rsslPayloadCacheCreate(&cacheConfig, &cacheError)) != NULL);
+		ASSERT_TRUE((entryHandle = rsslPayloadEntryCreate(cacheHandle, &cacheError)) != NULL);
+		ASSERT_EQ(1, rsslPayloadCacheGetEntryCount(cacheHandle));
+	}
+
+	virtual void TearDown()
+	{
+		rsslPayloadEntryDestroy(entryHandle);
+		rsslPayloadCacheDestroy(cacheHandle);
+		rsslPayloadCacheUninitialize();
+	}
+
+	void resetPayload()
+	{
+		payload.data = payloadBlock;
+		payload.length = sizeof(payloadBlock);
+	}
+
+	/* Applies the current payload in a message of the given class. */
+	RsslRet applyPayload(RsslUInt8 msgClass, RsslContainerType containerType, RsslUInt16 refreshFlags)
+	{
+		RsslMsg msg;
+		RsslDecodeIterator dIter;
+
+		rsslClearMsg(&msg);
+		msg.msgBase.msgClass = msgClass;
+		msg.msgBase.domainType = RSSL_DMT_MARKET_BY_ORDER;
+		msg.msgBase.streamId = 5;
+		msg.msgBase.containerType = containerType;
+		msg.msgBase.encDataBody = payload;
+		if (msgClass == RSSL_MC_REFRESH)
+			msg.refreshMsg.flags = refreshFlags;
+
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorBuffer(&dIter, &payload);
+
+		rsslCacheErrorClear(&cacheError);
+		return rsslPayloadEntryApply(entryHandle, &dIter, &msg, &cacheError);
+	}
+
+	/* Retrieves the entry into retrieveBuffer, using at most maxLength bytes. */
+	RsslRet retrieve(RsslUInt32 maxLength, RsslPayloadCursorHandle cursorHandle)
+	{
+		RsslEncodeIterator eIter;
+		RsslRet ret;
+
+		retrieveBuffer.data = retrieveBlock;
+		retrieveBuffer.length = maxLength;
+
+		rsslClearEncodeIterator(&eIter);
+		rsslSetEncodeIteratorBuffer(&eIter, &retrieveBuffer);
+
+		rsslCacheErrorClear(&cacheError);
+		if ((ret = rsslPayloadEntryRetrieve(entryHandle, &eIter, cursorHandle, &cacheError)) == RSSL_RET_SUCCESS)
+			retrieveBuffer.length = rsslGetEncodedBufferLength(&eIter);
+
+		return ret;
+	}
+};
+
+TEST_F(PayloadCacheTest, FieldListApplyRetrieve)
+{
+	FieldValues refreshFields, updateFields, expectedFields, retrievedFields;
+	RsslDecodeIterator dIter;
+
+	refreshFields[22] = 100; refreshFields[25] = 101; refreshFields[30] = 10; refreshFields[-5] = 7;
+
+	resetPayload();
+	encodeFieldListBuffer(&payload, refreshFields);
+	ASSERT_EQ(RSSL_RET_SUCCESS, applyPayload(RSSL_MC_REFRESH, RSSL_DT_FIELD_LIST, RSSL_RFMF_CLEAR_CACHE | RSSL_RFMF_REFRESH_COMPLETE));
+	ASSERT_EQ(RSSL_DT_FIELD_LIST, rsslPayloadEntryGetDataType(entryHandle));
+
+	/* Update changes fields in place. A field that was never refreshed is ignored with a warning. */
+	updateFields[25] = 102; updateFields[30] = 11; updateFields[31] = 99;
+	resetPayload();
+	encodeFieldListBuffer(&payload, updateFields);
+	ASSERT_EQ(RSSL_RET_FAILURE, applyPayload(RSSL_MC_UPDATE, RSSL_DT_FIELD_LIST, 0));
+	ASSERT_EQ(RSSL_RET_SUCCESS, cacheError.rsslErrorId);
+
+	expectedFields = refreshFields;
+	expectedFields[25] = 102; expectedFields[30] = 11;
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(sizeof(retrieveBlock), NULL));
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorBuffer(&dIter, &retrieveBuffer);
+	decodeFieldList(&dIter, retrievedFields);
+	ASSERT_TRUE(expectedFields == retrievedFields);
+
+	/* Field lists must be retrieved in one part. */
+	ASSERT_EQ(RSSL_RET_BUFFER_TOO_SMALL, retrieve(8, NULL));
+
+	/* A refresh with CLEAR_CACHE replaces the image. */
+	refreshFields.clear();
+	refreshFields[1] = 1;
+	resetPayload();
+	encodeFieldListBuffer(&payload, refreshFields);
+	ASSERT_EQ(RSSL_RET_SUCCESS, applyPayload(RSSL_MC_REFRESH, RSSL_DT_FIELD_LIST, RSSL_RFMF_CLEAR_CACHE | RSSL_RFMF_REFRESH_COMPLETE));
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(sizeof(retrieveBlock), NULL));
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorBuffer(&dIter, &retrieveBuffer);
+	decodeFieldList(&dIter, retrievedFields);
+	ASSERT_TRUE(refreshFields == retrievedFields);
+
+	/* A map cannot be applied to a field list entry. */
+	resetPayload();
+	encodeMapBuffer(&payload, NULL, 0, NULL);
+	ASSERT_EQ(RSSL_RET_INVALID_DATA, applyPayload(RSSL_MC_UPDATE, RSSL_DT_MAP, 0));
+}
+
+TEST_F(PayloadCacheTest, MapApplyRetrieve)
+{
+	TestMapEntry entries[3];
+	FieldValues summary, retrievedSummary;
+	MapValues expected, retrieved;
+	RsslBool hasSummary;
+
+	summary[15] = 840;
+
+	entries[0].action = RSSL_MPEA_ADD_ENTRY; entries[0].key = "ORDER1"; entries[0].fields[3427] = 100; entries[0].fields[3429] = 5;
+	entries[1].action = RSSL_MPEA_ADD_ENTRY; entries[1].key = "ORDER2"; entries[1].fields[3427] = 101; entries[1].fields[3429] = 6;
+	entries[2].action = RSSL_MPEA_ADD_ENTRY; entries[2].key = "ORDER3"; entries[2].fields[3427] = 102; entries[2].fields[3429] = 7;
+
+	resetPayload();
+	encodeMapBuffer(&payload, entries, 3, &summary);
+	ASSERT_EQ(RSSL_RET_SUCCESS, applyPayload(RSSL_MC_REFRESH, RSSL_DT_MAP, RSSL_RFMF_CLEAR_CACHE | RSSL_RFMF_REFRESH_COMPLETE));
+	ASSERT_EQ(RSSL_DT_MAP, rsslPayloadEntryGetDataType(entryHandle));
+
+	/* Update one order, delete one, add one. */
+	entries[0].action = RSSL_MPEA_UPDATE_ENTRY; entries[0].key = "ORDER2"; entries[0].fields.clear(); entries[0].fields[3429] = 60;
+	entries[1].action = RSSL_MPEA_DELETE_ENTRY; entries[1].key = "ORDER1"; entries[1].fields.clear();
+	entries[2].action = RSSL_MPEA_ADD_ENTRY; entries[2].key = "ORDER4"; entries[2].fields[3427] = 103; entries[2].fields[3429] = 8;
+
+	resetPayload();
+	encodeMapBuffer(&payload, entries, 3, NULL);
+	ASSERT_EQ(RSSL_RET_SUCCESS, applyPayload(RSSL_MC_UPDATE, RSSL_DT_MAP, 0));
+
+	expected["ORDER2"][3427] = 101; expected["ORDER2"][3429] = 60;
+	expected["ORDER3"][3427] = 102; expected["ORDER3"][3429] = 7;
+	expected["ORDER4"][3427] = 103; expected["ORDER4"][3429] = 8;
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(sizeof(retrieveBlock), NULL));
+	decodeMap(&retrieveBuffer, retrieved, &hasSummary, &retrievedSummary);
+	ASSERT_TRUE(hasSummary);
+	ASSERT_TRUE(summary == retrievedSummary);
+	ASSERT_TRUE(expected == retrieved);
+
+	/* Updating an order that is not in the cache is a warning. */
+	entries[0].key = "ORDER9";
+	resetPayload();
+	encodeMapBuffer(&payload, entries, 1, NULL);
+	ASSERT_EQ(RSSL_RET_FAILURE, applyPayload(RSSL_MC_UPDATE, RSSL_DT_MAP, 0));
+	ASSERT_EQ(RSSL_RET_SUCCESS, cacheError.rsslErrorId);
+
+	/* Clearing the entry leaves nothing to retrieve. */
+	rsslPayloadEntryClear(entryHandle);
+	ASSERT_EQ(RSSL_DT_UNKNOWN, rsslPayloadEntryGetDataType(entryHandle));
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(sizeof(retrieveBlock), NULL));
+	ASSERT_EQ(0, retrieveBuffer.length);
+}
+
+TEST_F(PayloadCacheTest, MapMultiPartRetrieve)
+{
+	const RsslUInt32 orderCount = 200;
+	TestMapEntry entries[orderCount];
+	char keys[orderCount][16];
+	FieldValues summary;
+	MapValues retrieved;
+	RsslPayloadCursorHandle cursorHandle;
+	RsslUInt32 i, partCount = 0;
+
+	summary[15] = 840;
+
+	for (i = 0; i < orderCount; ++i)
+	{
+		snprintf(keys[i], sizeof(keys[i]), "ORDER%u", i);
+		entries[i].action = RSSL_MPEA_ADD_ENTRY;
+		entries[i].key = keys[i];
+		entries[i].fields[3427] = 1000 + i;
+		entries[i].fields[3429] = i;
+		entries[i].fields[3426] = 1;
+	}
+
+	resetPayload();
+	encodeMapBuffer(&payload, entries, orderCount, &summary);
+	ASSERT_EQ(RSSL_RET_SUCCESS, applyPayload(RSSL_MC_REFRESH, RSSL_DT_MAP, RSSL_RFMF_CLEAR_CACHE | RSSL_RFMF_REFRESH_COMPLETE));
+
+	/* Without a cursor the whole map must fit. */
+	ASSERT_EQ(RSSL_RET_BUFFER_TOO_SMALL, retrieve(512, NULL));
+
+	ASSERT_TRUE((cursorHandle = rsslPayloadCursorCreate()) != NULL);
+	rsslPayloadCursorClear(cursorHandle);
+
+	while (!rsslPayloadCursorIsComplete(cursorHandle))
+	{
+		RsslBool hasSummary;
+		RsslUInt32 countBefore = (RsslUInt32)retrieved.size();
+
+		ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(512, cursorHandle));
+		decodeMap(&retrieveBuffer, retrieved, &hasSummary, NULL);
+
+		/* Summary data is only in the first part, and each part has at least one entry. */
+		ASSERT_EQ(partCount == 0 ? RSSL_TRUE : RSSL_FALSE, hasSummary);
+		ASSERT_GT(retrieved.size(), countBefore);
+		++partCount;
+	}
+
+	ASSERT_GT(partCount, 1u);
+	ASSERT_EQ(orderCount, (RsslUInt32)retrieved.size());
+	for (i = 0; i < orderCount; ++i)
+		ASSERT_TRUE(entries[i].fields == retrieved[keys[i]]);
+
+	/* Retrieving with a completed cursor encodes nothing. */
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(512, cursorHandle));
+	ASSERT_EQ(0, retrieveBuffer.length);
+
+	rsslPayloadCursorDestroy(cursorHandle);
+}
+
+/* Microbenchmarks. These print rates for comparison between builds rather than asserting on them. */
+
+TEST_F(PayloadCacheTest, FieldListApplyBenchmark)
+{
+	const RsslUInt32 updateCount = 200000;
+	FieldValues refreshFields, updateFields;
+	char updateBlock[1024];
+	RsslBuffer updatePayload;
+	TimeValue startTime, endTime;
+	RsslUInt32 i;
+
+	for (i = 0; i < 60; ++i)
+		refreshFields[(RsslFieldId)(i + 1)] = i;
+
+	resetPayload();
+	encodeFieldListBuffer(&payload, refreshFields);
+	ASSERT_EQ(RSSL_RET_SUCCESS, applyPayload(RSSL_MC_REFRESH, RSSL_DT_FIELD_LIST, RSSL_RFMF_CLEAR_CACHE | RSSL_RFMF_REFRESH_COMPLETE));
+
+	for (i = 0; i < 8; ++i)
+		updateFields[(RsslFieldId)(i * 7 + 1)] = 1000000 + i;
+
+	updatePayload.data = updateBlock;
+	updatePayload.length = sizeof(updateBlock);
+	encodeFieldListBuffer(&updatePayload, updateFields);
+	payload = updatePayload;
+
+	startTime = getTimeNano();
+	for (i = 0; i < updateCount; ++i)
+		ASSERT_EQ(RSSL_RET_SUCCESS, applyPayload(RSSL_MC_UPDATE, RSSL_DT_FIELD_LIST, 0));
+	endTime = getTimeNano();
+
+	printf("  Field list update apply (8 of 60 fields): %.1f ns/update\n", (double)(endTime - startTime) / updateCount);
+}
+
+TEST_F(PayloadCacheTest, MapApplyBenchmark)
+{
+	const RsslUInt32 orderCount = 1000, updateCount = 100000;
+	TestMapEntry *entries = new TestMapEntry[orderCount];
+	char (*keys)[16] = new char[orderCount][16];
+	TestMapEntry update;
+	char updateBlock[1024];
+	RsslBuffer updatePayload;
+	TimeValue startTime, endTime;
+	RsslUInt32 i;
+
+	for (i = 0; i < orderCount; ++i)
+	{
+		snprintf(keys[i], sizeof(keys[i]), "ORDER%u", i);
+		entries[i].action = RSSL_MPEA_ADD_ENTRY;
+		entries[i].key = keys[i];
+		entries[i].fields[3427] = 1000 + i;
+		entries[i].fields[3429] = i;
+	}
+
+	resetPayload();
+	encodeMapBuffer(&payload, entries, orderCount, NULL);
+	ASSERT_EQ(RSSL_RET_SUCCESS, applyPayload(RSSL_MC_REFRESH, RSSL_DT_MAP, RSSL_RFMF_CLEAR_CACHE | RSSL_RFMF_REFRESH_COMPLETE));
+
+	/* Update an order in the middle of the book. */
+	update.action = RSSL_MPEA_UPDATE_ENTRY;
+	update.key = keys[orderCount / 2];
+	update.fields[3429] = 42;
+
+	updatePayload.data = updateBlock;
+	updatePayload.length = sizeof(updateBlock);
+	encodeMapBuffer(&updatePayload, &update, 1, NULL);
+	payload = updatePayload;
+
+	startTime = getTimeNano();
+	for (i = 0; i < updateCount; ++i)
+		ASSERT_EQ(RSSL_RET_SUCCESS, applyPayload(RSSL_MC_UPDATE, RSSL_DT_MAP, 0));
+	endTime = getTimeNano();
+
+	printf("  Map entry update apply (%u orders): %.1f ns/update\n", orderCount, (double)(endTime - startTime) / updateCount);
+
+	delete[] entries;
+	delete[] keys;
+}
+
+TEST_F(PayloadCacheTest, RetrieveBenchmark)
+{
+	const RsslUInt32 orderCount = 1000, retrieveCount = 2000;
+	TestMapEntry *entries = new TestMapEntry[orderCount];
+	char (*keys)[16] = new char[orderCount][16];
+	RsslPayloadCursorHandle cursorHandle;
+	TimeValue startTime, endTime;
+	RsslUInt32 i, partCount = 0;
+
+	for (i = 0; i < orderCount; ++i)
+	{
+		snprintf(keys[i], sizeof(keys[i]), "ORDER%u", i);
+		entries[i].action = RSSL_MPEA_ADD_ENTRY;
+		entries[i].key = keys[i];
+		entries[i].fields[3427] = 1000 + i;
+		entries[i].fields[3429] = i;
+		entries[i].fields[3426] = 1;
+	}
+
+	resetPayload();
+	encodeMapBuffer(&payload, entries, orderCount, NULL);
+	ASSERT_EQ(RSSL_RET_SUCCESS, applyPayload(RSSL_MC_REFRESH, RSSL_DT_MAP, RSSL_RFMF_CLEAR_CACHE | RSSL_RFMF_REFRESH_COMPLETE));
+
+	ASSERT_TRUE((cursorHandle = rsslPayloadCursorCreate()) != NULL);
+
+	/* Retrieve the whole book in parts of a typical fragment size. */
+	startTime = getTimeNano();
+	for (i = 0; i < retrieveCount; ++i)
+	{
+		rsslPayloadCursorClear(cursorHandle);
+		while (!rsslPayloadCursorIsComplete(cursorHandle))
+		{
+			ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(6000, cursorHandle));
+			++partCount;
+		}
+	}
+	endTime = getTimeNano();
+
+	printf("  Map retrieve (%u orders, %u parts): %.1f us/refresh\n", orderCount, partCount / retrieveCount,
+			(double)(endTime - startTime) / retrieveCount / 1000.0);
+
+	rsslPayloadCursorDestroy(cursorHandle);
+	delete[] entries;
+	delete[] keys;
+}
+
+/*** Reactor provider item cache ***/
+
+/* The provider is a reactor with the item cache enabled. The consumer is a plain RsslChannel,
+ * so that requests can be timed without a consumer reactor in the path. */
+
+static RsslBuffer itemName = { 3, const_cast<char*>("TRI") };
+static const RsslUInt16 itemServiceId = 1;
+
+static RsslReactorChannel *pProviderChannel;
+static FieldValues providerFields;		/* Image the provider application publishes. */
+static RsslUInt32 providerRequestCount;	/* Requests the provider application was given. */
+static RsslUInt32 providerRefreshCount;	/* Refreshes the provider application sent. */
+
+static RsslReactorCallbackRet payloadCacheChannelEventCallback(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel, RsslReactorChannelEvent *pEvent)
+{
+	switch(pEvent->channelEventType)
+	{
+		case RSSL_RC_CET_CHANNEL_READY:
+			pProviderChannel = pReactorChannel;
+			break;
+		case RSSL_RC_CET_CHANNEL_DOWN:
+		case RSSL_RC_CET_CHANNEL_DOWN_RECONNECTING:
+			pProviderChannel = NULL;
+			break;
+		default:
+			break;
+	}
+
+	return RSSL_RC_CRET_SUCCESS;
+}
+
+static void providerSubmit(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel, RsslMsg *pMsg, const FieldValues &fields)
+{
+	RsslReactorSubmitMsgOptions submitOpts;
+	RsslErrorInfo errorInfo;
+	char payloadBlock[4096];
+
+	pMsg->msgBase.encDataBody.data = payloadBlock;
+	pMsg->msgBase.encDataBody.length = sizeof(payloadBlock);
+	encodeFieldListBuffer(&pMsg->msgBase.encDataBody, fields);
+
+	rsslClearReactorSubmitMsgOptions(&submitOpts);
+	submitOpts.pRsslMsg = pMsg;
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslReactorSubmitMsg(pReactor, pReactorChannel, &submitOpts, &errorInfo));
+}
+
+static RsslReactorCallbackRet payloadCacheDefaultMsgCallback(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel, RsslMsgEvent *pEvent)
+{
+	RsslMsg *pMsg = pEvent->pRsslMsg;
+	RsslRefreshMsg refreshMsg;
+
+	if (!pMsg || pMsg->msgBase.msgClass != RSSL_MC_REQUEST)
+		return RSSL_RC_CRET_SUCCESS;
+
+	++providerRequestCount;
+
+	/* The reactor already sent the refresh. */
+	if (pEvent->refreshFromCache)
+		return RSSL_RC_CRET_SUCCESS;
+
+	rsslClearRefreshMsg(&refreshMsg);
+	refreshMsg.msgBase.domainType = pMsg->msgBase.domainType;
+	refreshMsg.msgBase.streamId = pMsg->msgBase.streamId;
+	refreshMsg.msgBase.containerType = RSSL_DT_FIELD_LIST;
+	refreshMsg.msgBase.msgKey = pMsg->msgBase.msgKey;
+	refreshMsg.flags = RSSL_RFMF_SOLICITED | RSSL_RFMF_REFRESH_COMPLETE | RSSL_RFMF_CLEAR_CACHE | RSSL_RFMF_HAS_MSG_KEY | RSSL_RFMF_HAS_QOS;
+	refreshMsg.state.streamState = (pMsg->requestMsg.flags & RSSL_RQMF_STREAMING) ? RSSL_STREAM_OPEN : RSSL_STREAM_NON_STREAMING;
+	refreshMsg.state.dataState = RSSL_DATA_OK;
+	refreshMsg.qos.timeliness = RSSL_QOS_TIME_REALTIME;
+	refreshMsg.qos.rate = RSSL_QOS_RATE_TICK_BY_TICK;
+
+	providerSubmit(pReactor, pReactorChannel, (RsslMsg*)&refreshMsg, providerFields);
+	++providerRefreshCount;
+
+	return RSSL_RC_CRET_SUCCESS;
+}
+
+class PayloadCacheReactorTest : public ::testing::Test {
+protected:
+
+	RsslReactor *pProvReactor;
+	RsslServer *pServer;
+	RsslChannel *pConsChannel;
+	RsslErrorInfo errorInfo;
+
+	virtual void SetUp()
+	{
+		RsslCreateReactorOptions reactorOpts;
+		RsslBindOptions bindOpts;
+		RsslConnectOptions connectOpts;
+		RsslReactorAcceptOptions acceptOpts;
+		RsslReactorOMMProviderRole providerRole;
+		RsslInProgInfo inProg;
+		TimeValue endTime;
+
+		providerFields.clear();
+		providerFields[22] = 100; providerFields[25] = 101; providerFields[30] = 10;
+		providerRequestCount = 0;
+		providerRefreshCount = 0;
+		pProviderChannel = NULL;
+
+		rsslClearCreateReactorOptions(&reactorOpts);
+		reactorOpts.enableProviderItemCache = RSSL_TRUE;
+		ASSERT_TRUE((pProvReactor = rsslCreateReactor(&reactorOpts, &errorInfo)) != NULL);
+
+		rsslClearBindOpts(&bindOpts);
+		bindOpts.serviceName = const_cast<char*>("14013");
+		bindOpts.tcpOpts.tcp_nodelay = RSSL_TRUE;
+		ASSERT_TRUE((pServer = rsslBind(&bindOpts, &errorInfo.rsslError)) != NULL);
+
+		rsslClearConnectOpts(&connectOpts);
+		connectOpts.connectionInfo.unified.address = const_cast<char*>("localhost");
+		connectOpts.connectionInfo.unified.serviceName = const_cast<char*>("14013");
+		connectOpts.majorVersion = RSSL_RWF_MAJOR_VERSION;
+		connectOpts.minorVersion = RSSL_RWF_MINOR_VERSION;
+		connectOpts.protocolType = RSSL_RWF_PROTOCOL_TYPE;
+		connectOpts.tcpOpts.tcp_nodelay = RSSL_TRUE;
+		ASSERT_TRUE((pConsChannel = rsslConnect(&connectOpts, &errorInfo.rsslError)) != NULL);
+
+		ASSERT_TRUE(waitForConnection(pServer, 5000));
+
+		rsslClearOMMProviderRole(&providerRole);
+		providerRole.base.channelEventCallback = payloadCacheChannelEventCallback;
+		providerRole.base.defaultMsgCallback = payloadCacheDefaultMsgCallback;
+
+		rsslClearReactorAcceptOptions(&acceptOpts);
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslReactorAccept(pProvReactor, pServer, &acceptOpts, (RsslReactorChannelRole*)&providerRole, &errorInfo));
+
+		endTime = getTimeMilli() + 5000;
+		while (pConsChannel->state == RSSL_CH_STATE_INITIALIZING || !pProviderChannel)
+		{
+			ASSERT_LT(getTimeMilli(), endTime);
+
+			if (pConsChannel->state == RSSL_CH_STATE_INITIALIZING)
+			{
+				RsslRet ret = rsslInitChannel(pConsChannel, &inProg, &errorInfo.rsslError);
+				ASSERT_TRUE(ret == RSSL_RET_SUCCESS || ret == RSSL_RET_CHAN_INIT_IN_PROGRESS);
+			}
+
+			dispatchProvider();
+		}
+
+		ASSERT_EQ(RSSL_CH_STATE_ACTIVE, pConsChannel->state);
+	}
+
+	virtual void TearDown()
+	{
+		rsslCloseChannel(pConsChannel, &errorInfo.rsslError);
+		rsslDestroyReactor(pProvReactor, &errorInfo);
+		rsslCloseServer(pServer, &errorInfo.rsslError);
+	}
+
+	static bool waitForConnection(RsslServer *pServer, RsslInt32 msec)
+	{
+		fd_set readFds;
+		struct timeval selectTime;
+
+		FD_ZERO(&readFds);
+		FD_SET(pServer->socketId, &readFds);
+		selectTime.tv_sec = msec / 1000;
+		selectTime.tv_usec = (msec % 1000) * 1000;
+
+		return select((int)pServer->socketId + 1, &readFds, NULL, NULL, &selectTime) > 0;
+	}
+
+	void dispatchProvider()
+	{
+		RsslReactorDispatchOptions dispatchOpts;
+
+		rsslClearReactorDispatchOptions(&dispatchOpts);
+		ASSERT_GE(rsslReactorDispatch(pProvReactor, &dispatchOpts, &errorInfo), RSSL_RET_SUCCESS);
+	}
+
+	void consumerWrite(RsslMsg *pMsg)
+	{
+		RsslBuffer *pBuffer;
+		RsslEncodeIterator eIter;
+		RsslUInt32 bytesWritten, uncompBytesWritten;
+		RsslRet ret;
+
+		ASSERT_TRUE((pBuffer = rsslGetBuffer(pConsChannel, 1024, RSSL_FALSE, &errorInfo.rsslError)) != NULL);
+		rsslClearEncodeIterator(&eIter);
+		rsslSetEncodeIteratorRWFVersion(&eIter, pConsChannel->majorVersion, pConsChannel->minorVersion);
+		rsslSetEncodeIteratorBuffer(&eIter, pBuffer);
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMsg(&eIter, pMsg));
+		pBuffer->length = rsslGetEncodedBufferLength(&eIter);
+
+		ret = rsslWrite(pConsChannel, pBuffer, RSSL_HIGH_PRIORITY, RSSL_WRITE_DIRECT_SOCKET_WRITE, &bytesWritten, &uncompBytesWritten, &errorInfo.rsslError);
+		ASSERT_GE(ret, RSSL_RET_SUCCESS);
+		while (ret > 0)
+			ret = rsslFlush(pConsChannel, &errorInfo.rsslError);
+	}
+
+	void consumerRequest(RsslInt32 streamId, RsslBool streaming)
+	{
+		RsslRequestMsg requestMsg;
+
+		rsslClearRequestMsg(&requestMsg);
+		requestMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		requestMsg.msgBase.streamId = streamId;
+		requestMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+		requestMsg.msgBase.msgKey.flags = RSSL_MKF_HAS_SERVICE_ID | RSSL_MKF_HAS_NAME;
+		requestMsg.msgBase.msgKey.serviceId = itemServiceId;
+		requestMsg.msgBase.msgKey.name = itemName;
+		requestMsg.flags = RSSL_RQMF_HAS_QOS | (streaming ? RSSL_RQMF_STREAMING : 0);
+		requestMsg.qos.timeliness = RSSL_QOS_TIME_REALTIME;
+		requestMsg.qos.rate = RSSL_QOS_RATE_TICK_BY_TICK;
+
+		consumerWrite((RsslMsg*)&requestMsg);
+	}
+
+	void consumerClose(RsslInt32 streamId)
+	{
+		RsslCloseMsg closeMsg;
+
+		rsslClearCloseMsg(&closeMsg);
+		closeMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		closeMsg.msgBase.streamId = streamId;
+		closeMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+
+		consumerWrite((RsslMsg*)&closeMsg);
+	}
+
+	/* Dispatches the provider and reads from the consumer until a message is received. */
+	void consumerRead(RsslMsg *pMsg, FieldValues &fields)
+	{
+		TimeValue endTime = getTimeMilli() + 5000;
+
+		while (1)
+		{
+			RsslRet readRet;
+			RsslBuffer *pBuffer;
+
+			ASSERT_LT(getTimeMilli(), endTime);
+
+			dispatchProvider();
+
+			if ((pBuffer = rsslRead(pConsChannel, &readRet, &errorInfo.rsslError)))
+			{
+				RsslDecodeIterator dIter;
+
+				rsslClearDecodeIterator(&dIter);
+				rsslSetDecodeIteratorRWFVersion(&dIter, pConsChannel->majorVersion, pConsChannel->minorVersion);
+				rsslSetDecodeIteratorBuffer(&dIter, pBuffer);
+				ASSERT_EQ(RSSL_RET_SUCCESS, rsslDecodeMsg(&dIter, pMsg));
+
+				fields.clear();
+				if (pMsg->msgBase.containerType == RSSL_DT_FIELD_LIST)
+					decodeFieldList(&dIter, fields);
+				return;
+			}
+
+			ASSERT_TRUE(readRet >= RSSL_RET_SUCCESS || readRet == RSSL_RET_READ_WOULD_BLOCK || readRet == RSSL_RET_READ_PING);
+		}
+	}
+
+	/* Requests the item and reads the refresh, returning the request-to-refresh time in nanoseconds. */
+	TimeValue timedRequest(RsslInt32 streamId)
+	{
+		RsslMsg msg;
+		FieldValues fields;
+		TimeValue startTime = getTimeNano();
+
+		consumerRequest(streamId, RSSL_TRUE);
+		consumerRead(&msg, fields);
+		EXPECT_EQ(RSSL_MC_REFRESH, msg.msgBase.msgClass);
+		EXPECT_EQ(streamId, msg.msgBase.streamId);
+
+		return getTimeNano() - startTime;
+	}
+};
+
+TEST_F(PayloadCacheReactorTest, RefreshFromCache)
+{
+	RsslMsg msg;
+	FieldValues fields;
+
+	/* First request is answered by the application. */
+	consumerRequest(5, RSSL_TRUE);
+	consumerRead(&msg, fields);
+	ASSERT_EQ(RSSL_MC_REFRESH, msg.msgBase.msgClass);
+	ASSERT_EQ(5, msg.msgBase.streamId);
+	ASSERT_EQ(1u, providerRefreshCount);
+	ASSERT_TRUE(fields == providerFields);
+
+	/* Second request for the same item is answered from the cache. The application still sees it. */
+	consumerRequest(6, RSSL_TRUE);
+	consumerRead(&msg, fields);
+	ASSERT_EQ(RSSL_MC_REFRESH, msg.msgBase.msgClass);
+	ASSERT_EQ(6, msg.msgBase.streamId);
+	ASSERT_EQ(2u, providerRequestCount);
+	ASSERT_EQ(1u, providerRefreshCount);
+	ASSERT_TRUE(msg.refreshMsg.flags & RSSL_RFMF_SOLICITED);
+	ASSERT_TRUE(msg.refreshMsg.flags & RSSL_RFMF_REFRESH_COMPLETE);
+	ASSERT_TRUE(msg.refreshMsg.flags & RSSL_RFMF_CLEAR_CACHE);
+	ASSERT_TRUE(msg.refreshMsg.flags & RSSL_RFMF_HAS_MSG_KEY);
+	ASSERT_TRUE(rsslBufferIsEqual(&msg.msgBase.msgKey.name, &itemName));
+	ASSERT_EQ(itemServiceId, msg.msgBase.msgKey.serviceId);
+	ASSERT_EQ(RSSL_STREAM_OPEN, msg.refreshMsg.state.streamState);
+	ASSERT_EQ(RSSL_DATA_OK, msg.refreshMsg.state.dataState);
+	ASSERT_TRUE(fields == providerFields);
+
+	/* A snapshot request is answered from the cache as non-streaming. */
+	consumerRequest(7, RSSL_FALSE);
+	consumerRead(&msg, fields);
+	ASSERT_EQ(RSSL_MC_REFRESH, msg.msgBase.msgClass);
+	ASSERT_EQ(7, msg.msgBase.streamId);
+	ASSERT_EQ(1u, providerRefreshCount);
+	ASSERT_EQ(RSSL_STREAM_NON_STREAMING, msg.refreshMsg.state.streamState);
+	ASSERT_TRUE(fields == providerFields);
+}
+
+TEST_F(PayloadCacheReactorTest, UpdatesAppliedToCache)
+{
+	RsslMsg msg;
+	RsslUpdateMsg updateMsg;
+	FieldValues fields, updateFields;
+
+	consumerRequest(5, RSSL_TRUE);
+	consumerRead(&msg, fields);
+	ASSERT_EQ(RSSL_MC_REFRESH, msg.msgBase.msgClass);
+
+	updateFields[25] = 202;
+	rsslClearUpdateMsg(&updateMsg);
+	updateMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	updateMsg.msgBase.streamId = 5;
+	updateMsg.msgBase.containerType = RSSL_DT_FIELD_LIST;
+	providerSubmit(pProvReactor, pProviderChannel, (RsslMsg*)&updateMsg, updateFields);
+
+	consumerRead(&msg, fields);
+	ASSERT_EQ(RSSL_MC_UPDATE, msg.msgBase.msgClass);
+	ASSERT_TRUE(fields == updateFields);
+
+	/* The refresh from the cache reflects the update. */
+	consumerRequest(6, RSSL_TRUE);
+	consumerRead(&msg, fields);
+	ASSERT_EQ(RSSL_MC_REFRESH, msg.msgBase.msgClass);
+	ASSERT_EQ(6, msg.msgBase.streamId);
+	ASSERT_EQ(1u, providerRefreshCount);
+
+	providerFields[25] = 202;
+	ASSERT_TRUE(fields == providerFields);
+
+	/* Once every stream is closed, the item is no longer cached. */
+	consumerClose(5);
+	consumerClose(6);
+	consumerRequest(7, RSSL_TRUE);
+	consumerRead(&msg, fields);
+	ASSERT_EQ(RSSL_MC_REFRESH, msg.msgBase.msgClass);
+	ASSERT_EQ(7, msg.msgBase.streamId);
+	ASSERT_EQ(2u, providerRefreshCount);
+}
+
+TEST_F(PayloadCacheReactorTest, RequestToRefreshLatency)
+{
+	const RsslUInt32 iterations = 500;
+	TimeValue cachedTime = 0, appTime = 0;
+	RsslUInt32 i;
+
+	/* Stream 5 keeps the item published, so requests on stream 6 are answered from the cache. */
+	timedRequest(5);
+
+	for (i = 0; i < iterations; ++i)
+	{
+		cachedTime += timedRequest(6);
+		consumerClose(6);
+	}
+
+	ASSERT_EQ(1u, providerRefreshCount);
+
+	/* Closing stream 5 each time leaves nothing cached, so the application answers every request. */
+	consumerClose(5);
+	for (i = 0; i < iterations; ++i)
+	{
+		appTime += timedRequest(5);
+		consumerClose(5);
+	}
+
+	ASSERT_EQ(1u + iterations, providerRefreshCount);
+
+	printf("  Request-to-refresh latency: %.1f us from cache, %.1f us from application\n",
+			(double)cachedTime / iterations / 1000.0, (double)appTime / iterations / 1000.0);
+}
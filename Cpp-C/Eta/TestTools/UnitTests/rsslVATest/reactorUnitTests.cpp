@@ -168,7 +168,7 @@ static void reactorUnitTests_Raise();
 static void reactorUnitTests_InitializationAndPingTimeout();
 static void reactorUnitTests_ShortPingInterval();
 static void reactorUnitTests_InvalidArguments();
-static void reactorUnitTests_BigDirectoryMsg();
+static void reactorUnitTests_BigDirectoryMsg(RsslBool decodeDirectory);
 
 static void reactorUnitTests_DisconnectFromCallbacks();
 static void reactorUnitTests_AddConnectionFromCallbacks();
@@ -178,6 +178,9 @@ static void reactorUnitTests_ManyConnections();
 #endif
 static void reactorUnitTests_WaitWhileChannelDown();
 static void reactorUnitTests_ReconnectAttemptLimit();
+static void reactorUnitTests_WarmStandby();
+static void reactorUnitTests_BindWorkerThread();
+static void reactorUnitTests_AutomaticPacking();
 
 static void reactorUtilTest_ConnectDeepCopy();
 
@@ -203,6 +206,7 @@ public:
 
 		deleteFile("tmp_dictionary.txt");
 
+		rsslClearCreateReactorOptions(&mOpts);
 		initReactors(&mOpts, RSSL_FALSE);
 	}
 
@@ -234,7 +238,23 @@ TEST_F(ReactorUtilTest, AddConnectionFromCallbacks)
 
 TEST_F(ReactorUtilTest, BigDirectoryMsg)
 {
-	reactorUnitTests_BigDirectoryMsg();
+	reactorUnitTests_BigDirectoryMsg(RSSL_FALSE);
+}
+
+TEST_F(ReactorUtilTest, BigDirectoryMsgSmallDecodeBuffer)
+{
+	/* Recreate the reactors with a decode buffer much smaller than the directory refresh, so that decoding it 
+	 * requires the reactor to grow the buffer. */
+	cleanupReactors(RSSL_FALSE);
+	rsslClearCreateReactorOptions(&mOpts);
+	mOpts.dispatchDecodeMemoryBufferSize = 256;
+	initReactors(&mOpts, RSSL_FALSE);
+
+	reactorUnitTests_BigDirectoryMsg(RSSL_TRUE);
+
+	cleanupReactors(RSSL_FALSE);
+	rsslClearCreateReactorOptions(&mOpts);
+	initReactors(&mOpts, RSSL_FALSE);
 }
 
 TEST_F(ReactorUtilTest, DisconnectFromCallbacks)
@@ -276,6 +296,21 @@ TEST_F(ReactorUtilTest, ReconnectAttemptLimit)
 {
 	reactorUnitTests_ReconnectAttemptLimit();
 }
+
+TEST_F(ReactorUtilTest, WarmStandby)
+{
+	reactorUnitTests_WarmStandby();
+}
+
+TEST_F(ReactorUtilTest, BindWorkerThread)
+{
+	reactorUnitTests_BindWorkerThread();
+}
+
+TEST_F(ReactorUtilTest, AutomaticPacking)
+{
+	reactorUnitTests_AutomaticPacking();
+}
 #ifdef COMPILE_64BITS
 TEST_F(ReactorUtilTest, ManyConnections)
 {
@@ -734,15 +769,14 @@ static void initReactors(RsslCreateReactorOptions *pOpts, RsslBool sameReactor)
 	RsslErrorInfo rsslErrorInfo;
 	clearMyReactor(pConsMon);
 	clearMyReactor(pProvMon);
-	rsslClearCreateReactorOptions(&mOpts);
-	mOpts.userSpecPtr = pConsMon;
+	pOpts->userSpecPtr = pConsMon;
 	ASSERT_TRUE(pConsMon->pReactor = rsslCreateReactor(pOpts, &rsslErrorInfo));
 
 	if (sameReactor)
 		pProvMon->pReactor = pConsMon->pReactor;
 	else
 	{
-		mOpts.userSpecPtr = &myReactors[1];
+		pOpts->userSpecPtr = &myReactors[1];
 		ASSERT_TRUE(pProvMon->pReactor = rsslCreateReactor(pOpts, &rsslErrorInfo));
 	}
 
@@ -2058,7 +2092,26 @@ static void reactorUnitTests_DisconnectFromCallbacks()
 	reactorUnitTests_DisconnectFromCallbacksInt_NiProv();
 }
 
-static void reactorUnitTests_BigDirectoryMsg()
+static RsslUInt32 bigDirectoryServiceCount;
+
+/* Records the size of a decoded directory refresh. The refresh is too large to copy into a MutMsg. */
+static RsslReactorCallbackRet bigDirectoryMsgCallback(RsslReactor* pReactor, RsslReactorChannel* pReactorChannel, RsslRDMDirectoryMsgEvent *pInfo)
+{
+	MyReactor *pMyReactor = (MyReactor*)pReactor->userSpecPtr;
+	MutMsg *pMutMsg = &pMyReactor->mutMsg;
+
+	EXPECT_TRUE(pInfo->pRDMDirectoryMsg);
+	EXPECT_TRUE(!pInfo->baseMsgEvent.pErrorInfo);
+
+	pMutMsg->mutMsgType = MUT_MSG_RDM;
+	pMutMsg->pReactorChannel = pReactorChannel;
+	pMutMsg->rdmMsg.rdmMsgBase = pInfo->pRDMDirectoryMsg->rdmMsgBase;
+	if (pInfo->pRDMDirectoryMsg->rdmMsgBase.rdmMsgType == RDM_DR_MT_REFRESH)
+		bigDirectoryServiceCount = pInfo->pRDMDirectoryMsg->refresh.serviceCount;
+	return RSSL_RC_CRET_SUCCESS;
+}
+
+static void reactorUnitTests_BigDirectoryMsg(RsslBool decodeDirectory)
 {
 
 	RsslRDMService bigDirectoryServiceList[300];
@@ -2093,6 +2146,9 @@ static void reactorUnitTests_BigDirectoryMsg()
 	ommProviderRole.loginMsgCallback = loginMsgCallback;
 	ommNIProviderRole.loginMsgCallback = loginMsgCallback;
 	ommNIProviderRole.pDirectoryRefresh = &directoryRefresh;
+	if (decodeDirectory)
+		ommProviderRole.directoryMsgCallback = bigDirectoryMsgCallback;
+	bigDirectoryServiceCount = 0;
 
 	directoryRefresh.serviceList = bigDirectoryServiceList;
 	directoryRefresh.serviceCount = 300;
@@ -2167,12 +2223,16 @@ static void reactorUnitTests_BigDirectoryMsg()
 		RsslBool gotDirectoryRefresh = RSSL_FALSE;
 		while(dispatchEvent(pProvMon, 100) != RSSL_RET_READ_WOULD_BLOCK)
 		{
-			if (pProvMon->mutMsg.mutMsgType == MUT_MSG_RSSL && pProvMon->mutMsg.pRsslMsg->msgBase.domainType == RSSL_DMT_SOURCE && pProvMon->mutMsg.pRsslMsg->msgBase.msgClass == RSSL_MC_REFRESH )
+			if (!decodeDirectory && pProvMon->mutMsg.mutMsgType == MUT_MSG_RSSL && pProvMon->mutMsg.pRsslMsg->msgBase.domainType == RSSL_DMT_SOURCE && pProvMon->mutMsg.pRsslMsg->msgBase.msgClass == RSSL_MC_REFRESH )
+				gotDirectoryRefresh = RSSL_TRUE;
+			else if (decodeDirectory && pProvMon->mutMsg.mutMsgType == MUT_MSG_RDM && pProvMon->mutMsg.rdmMsg.rdmMsgBase.domainType == RSSL_DMT_SOURCE && pProvMon->mutMsg.rdmMsg.rdmMsgBase.rdmMsgType == RDM_DR_MT_REFRESH)
 				gotDirectoryRefresh = RSSL_TRUE;
 			else ASSERT_TRUE(pProvMon->mutMsg.mutMsgType == MUT_MSG_NONE);
 		}
 
 		ASSERT_TRUE(gotDirectoryRefresh);
+		if (decodeDirectory)
+			ASSERT_EQ(300, bigDirectoryServiceCount);
 	}
 
 	/* Cons: Close (+ ack) */
@@ -2565,6 +2625,132 @@ void reactorUnitTests_ReconnectAttemptLimit()
 	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_NONE);
 }
 
+/* Dispatches the provider reactor until a login or directory request is received, and responds to it with a refresh. 
+ * Returns the channel the request was received on. */
+static RsslReactorChannel *warmStandbyProvRespond(RsslUInt8 domainType)
+{
+	int i;
+
+	for (i = 0; i < 20; ++i)
+	{
+		if (dispatchEvent(pProvMon, 100) < RSSL_RET_SUCCESS || pProvMon->mutMsg.mutMsgType != MUT_MSG_RDM 
+				|| pProvMon->mutMsg.rdmMsg.rdmMsgBase.domainType != domainType)
+			continue;
+
+		if (domainType == RSSL_DMT_LOGIN)
+		{
+			EXPECT_TRUE(pProvMon->mutMsg.rdmMsg.rdmMsgBase.rdmMsgType == RDM_LG_MT_REQUEST);
+			loginRefresh.rdmMsgBase.streamId = pProvMon->mutMsg.rdmMsg.rdmMsgBase.streamId;
+			sendRDMMsg(pProvMon->pReactor, pProvMon->mutMsg.pReactorChannel, (RsslRDMMsg*)&loginRefresh, 400);
+		}
+		else
+		{
+			EXPECT_TRUE(pProvMon->mutMsg.rdmMsg.rdmMsgBase.rdmMsgType == RDM_DR_MT_REQUEST);
+			directoryRefresh.rdmMsgBase.streamId = pProvMon->mutMsg.rdmMsg.rdmMsgBase.streamId;
+			sendRDMMsg(pProvMon->pReactor, pProvMon->mutMsg.pReactorChannel, (RsslRDMMsg*)&directoryRefresh, 400);
+		}
+		return pProvMon->mutMsg.pReactorChannel;
+	}
+
+	return NULL;
+}
+
+/* Dispatches the consumer reactor until the given channel event is received. */
+static RsslBool warmStandbyConsWaitForEvent(RsslReactorChannelEventType eventType)
+{
+	int i;
+
+	for (i = 0; i < 20; ++i)
+	{
+		if (dispatchEvent(pConsMon, 100) >= RSSL_RET_SUCCESS && pConsMon->mutMsg.mutMsgType == MUT_MSG_CONN 
+				&& pConsMon->mutMsg.channelEvent.channelEventType == eventType)
+			return RSSL_TRUE;
+	}
+
+	return RSSL_FALSE;
+}
+
+void reactorUnitTests_WarmStandby()
+{
+	/* Test that a consumer channel with warm standby enabled logs in to the next server in its connection list while up,
+	 * and fails over to that connection when the active one is lost, instead of connecting again. */
+	RsslServer *pRsslServer[2];
+	RsslReactorConnectInfo connectionList[2];
+	RsslReactorChannel *pConsCh, *pActiveProvCh, *pStandbyProvCh;
+	RsslBindOptions rsslBindOpts;
+	int i;
+
+	clearObjects();
+
+	ommConsumerRole.pLoginRequest = &loginRequest;
+	ommConsumerRole.loginMsgCallback = loginMsgCallback;
+	ommProviderRole.loginMsgCallback = loginMsgCallback;
+	ommProviderRole.directoryMsgCallback = directoryMsgCallback;
+	pConsMon->closeConnections = RSSL_FALSE;
+
+	for (i = 0; i < 2; ++i)
+	{
+		rsslClearBindOpts(&rsslBindOpts);
+		rsslBindOpts.serviceName = const_cast<char*>(i == 0 ? "14013" : "14014");
+		ASSERT_TRUE((pRsslServer[i] = rsslBind(&rsslBindOpts, &rsslErrorInfo.rsslError)));
+
+		rsslClearReactorConnectInfo(&connectionList[i]);
+		connectionList[i].rsslConnectOptions.connectionInfo.unified.address = const_cast<char*>("localhost");
+		connectionList[i].rsslConnectOptions.connectionInfo.unified.serviceName = rsslBindOpts.serviceName;
+	}
+
+	connectOpts.reactorConnectionList = connectionList;
+	connectOpts.connectionCount = 2;
+	connectOpts.enableWarmStandby = RSSL_TRUE;
+	connectOpts.reconnectAttemptLimit = -1;
+	connectOpts.reconnectMinDelay = 5000; /* Long enough that a new connection would not be made during the test. */
+	connectOpts.reconnectMaxDelay = 5000;
+
+	ASSERT_TRUE(rsslReactorConnect(pConsMon->pReactor, &connectOpts, (RsslReactorChannelRole*)&ommConsumerRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	/* Prov: Accept the connection to the first server and log it in. */
+	ASSERT_TRUE(waitForConnection(pRsslServer[0], 1000));
+	ASSERT_TRUE(rsslReactorAccept(pProvMon->pReactor, pRsslServer[0], &acceptOpts, (RsslReactorChannelRole*)&ommProviderRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(warmStandbyConsWaitForEvent(RSSL_RC_CET_CHANNEL_UP));
+	ASSERT_TRUE((pActiveProvCh = warmStandbyProvRespond(RSSL_DMT_LOGIN)));
+
+	/* Cons: Channel ready. */
+	ASSERT_TRUE(warmStandbyConsWaitForEvent(RSSL_RC_CET_CHANNEL_READY));
+	pConsCh = pConsMon->mutMsg.pReactorChannel;
+
+	/* Prov: The standby connection is made to the second server, and requests the login and directory. */
+	ASSERT_TRUE(waitForConnection(pRsslServer[1], 1000));
+	ASSERT_TRUE(rsslReactorAccept(pProvMon->pReactor, pRsslServer[1], &acceptOpts, (RsslReactorChannelRole*)&ommProviderRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE((pStandbyProvCh = warmStandbyProvRespond(RSSL_DMT_LOGIN)));
+	ASSERT_TRUE(pStandbyProvCh != pActiveProvCh);
+	ASSERT_TRUE(warmStandbyProvRespond(RSSL_DMT_SOURCE) == pStandbyProvCh);
+
+	/* Cons: Nothing is received from the standby connection. */
+	ASSERT_TRUE(dispatchEvent(pConsMon, 200) == RSSL_RET_READ_WOULD_BLOCK);
+
+	/* Prov: Close the active channel. */
+	removeConnection(pProvMon, pActiveProvCh);
+
+	/* Cons: Channel goes down and comes back up immediately, on the standby connection. */
+	ASSERT_TRUE(warmStandbyConsWaitForEvent(RSSL_RC_CET_CHANNEL_DOWN_RECONNECTING));
+	ASSERT_TRUE(pConsMon->channelDownReconnectingEventCount == 1);
+	ASSERT_TRUE(warmStandbyConsWaitForEvent(RSSL_RC_CET_CHANNEL_UP));
+
+	/* Prov: Login is sent again on the standby connection. */
+	ASSERT_TRUE(warmStandbyProvRespond(RSSL_DMT_LOGIN) == pStandbyProvCh);
+	ASSERT_TRUE(warmStandbyConsWaitForEvent(RSSL_RC_CET_CHANNEL_READY));
+
+	/* No new connections were made to either server. */
+	ASSERT_FALSE(waitForConnection(pRsslServer[0], 100));
+	ASSERT_FALSE(waitForConnection(pRsslServer[1], 100));
+
+	removeConnection(pConsMon, pConsCh);
+	removeConnection(pProvMon, pStandbyProvCh);
+
+	ASSERT_TRUE(rsslCloseServer(pRsslServer[0], &rsslErrorInfo.rsslError) == RSSL_RET_SUCCESS); 
+	ASSERT_TRUE(rsslCloseServer(pRsslServer[1], &rsslErrorInfo.rsslError) == RSSL_RET_SUCCESS); 
+}
+
 #ifdef COMPILE_64BITS
 void reactorUnitTests_ManyConnections()
 {
@@ -2845,3 +3031,193 @@ void reactorUtilTest_ConnectDeepCopy()
 	
 	rsslFreeConnectOpts(&outOpts);
 }
+
+static void reactorUnitTests_BindWorkerThread()
+{
+	RsslCreateReactorOptions reactorOpts;
+	RsslReactor *pReactor;
+
+	/* Worker bound to the first CPU. */
+	rsslClearCreateReactorOptions(&reactorOpts);
+	ASSERT_TRUE(reactorOpts.cpuBindWorkerThread == -1);
+	reactorOpts.cpuBindWorkerThread = 0;
+	ASSERT_TRUE((pReactor = rsslCreateReactor(&reactorOpts, &rsslErrorInfo)) != NULL);
+	ASSERT_TRUE(rsslDestroyReactor(pReactor, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+
+	/* CPU that does not exist. */
+	reactorOpts.cpuBindWorkerThread = 100000;
+	ASSERT_TRUE(rsslCreateReactor(&reactorOpts, &rsslErrorInfo) == NULL);
+	ASSERT_TRUE(rsslErrorInfo.rsslError.rsslErrorId == RSSL_RET_FAILURE);
+}
+
+/* Submits an update message, with no payload, on stream 5. */
+static void packingSubmitUpdate(RsslReactorChannel *pReactorChannel, RsslUInt32 seqNum, RsslUInt8 writeFlags)
+{
+	RsslBuffer *pBuffer;
+	RsslUpdateMsg updateMsg;
+	RsslReactorSubmitOptions submitOpts;
+
+	ASSERT_TRUE((pBuffer = rsslReactorGetBuffer(pReactorChannel, 100, RSSL_FALSE, &rsslErrorInfo)));
+
+	rsslClearUpdateMsg(&updateMsg);
+	updateMsg.msgBase.streamId = 5;
+	updateMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	updateMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	updateMsg.flags = RSSL_UPMF_HAS_SEQ_NUM;
+	updateMsg.seqNum = seqNum;
+
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorRWFVersion(&eIter, pReactorChannel->majorVersion, pReactorChannel->minorVersion);
+	ASSERT_TRUE(rsslSetEncodeIteratorBuffer(&eIter, pBuffer) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(rsslEncodeMsg(&eIter, (RsslMsg*)&updateMsg) == RSSL_RET_SUCCESS);
+	pBuffer->length = rsslGetEncodedBufferLength(&eIter);
+
+	rsslClearReactorSubmitOptions(&submitOpts);
+	submitOpts.writeFlags = writeFlags;
+	ASSERT_TRUE(rsslReactorSubmit(pProvMon->pReactor, pReactorChannel, pBuffer, &submitOpts, &rsslErrorInfo) >= RSSL_RET_SUCCESS);
+}
+
+/* Submits updates on stream 5, packed by the application into one buffer. */
+static void packingSubmitPackedUpdates(RsslReactorChannel *pReactorChannel, RsslUInt32 firstSeqNum, RsslUInt32 count)
+{
+	RsslBuffer *pBuffer;
+	RsslUpdateMsg updateMsg;
+	RsslReactorSubmitOptions submitOpts;
+	RsslUInt32 i;
+
+	ASSERT_TRUE((pBuffer = rsslReactorGetBuffer(pReactorChannel, 100 * count, RSSL_TRUE, &rsslErrorInfo)));
+
+	for (i = 0; i < count; ++i)
+	{
+		rsslClearUpdateMsg(&updateMsg);
+		updateMsg.msgBase.streamId = 5;
+		updateMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		updateMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+		updateMsg.flags = RSSL_UPMF_HAS_SEQ_NUM;
+		updateMsg.seqNum = firstSeqNum + i;
+
+		rsslClearEncodeIterator(&eIter);
+		rsslSetEncodeIteratorRWFVersion(&eIter, pReactorChannel->majorVersion, pReactorChannel->minorVersion);
+		ASSERT_TRUE(rsslSetEncodeIteratorBuffer(&eIter, pBuffer) == RSSL_RET_SUCCESS);
+		ASSERT_TRUE(rsslEncodeMsg(&eIter, (RsslMsg*)&updateMsg) == RSSL_RET_SUCCESS);
+		pBuffer->length = rsslGetEncodedBufferLength(&eIter);
+
+		if (i < count - 1)
+			ASSERT_TRUE((pBuffer = rsslReactorPackBuffer(pReactorChannel, pBuffer, &rsslErrorInfo)));
+	}
+
+	rsslClearReactorSubmitOptions(&submitOpts);
+	ASSERT_TRUE(rsslReactorSubmit(pProvMon->pReactor, pReactorChannel, pBuffer, &submitOpts, &rsslErrorInfo) >= RSSL_RET_SUCCESS);
+}
+
+/* Dispatches the consumer reactor until an update is received, and checks its sequence number. */
+static RsslBool packingConsReceiveUpdate(RsslUInt32 seqNum)
+{
+	int i;
+
+	for (i = 0; i < 20; ++i)
+	{
+		if (dispatchEvent(pConsMon, 100) < RSSL_RET_SUCCESS || pConsMon->mutMsg.mutMsgType != MUT_MSG_RSSL)
+			continue;
+
+		return pConsMon->mutMsg.pRsslMsg->msgBase.msgClass == RSSL_MC_UPDATE && pConsMon->mutMsg.pRsslMsg->updateMsg.seqNum == seqNum;
+	}
+
+	return RSSL_FALSE;
+}
+
+static void reactorUnitTests_AutomaticPacking()
+{
+	/* Test that a channel with a packing latency budget packs the messages submitted on it, and writes them when the
+	 * budget runs out or when a message must be written by itself. */
+	RsslReactorChannel *pConsCh, *pProvCh;
+	RsslReactorPackingStats stats, initialStats;
+	RsslUInt32 i;
+	int j;
+
+	clearObjects();
+
+	ommConsumerRole.pLoginRequest = &loginRequest;
+	ommConsumerRole.loginMsgCallback = loginMsgCallback;
+	ommProviderRole.loginMsgCallback = loginMsgCallback;
+	acceptOpts.packingLatencyBudget = 200000;
+
+	ASSERT_TRUE(rsslReactorConnect(pConsMon->pReactor, &connectOpts, (RsslReactorChannelRole*)&ommConsumerRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(waitForConnection(pServer, 1000));
+	ASSERT_TRUE(rsslReactorAccept(pProvMon->pReactor, pServer, &acceptOpts, (RsslReactorChannelRole*)&ommProviderRole, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(warmStandbyConsWaitForEvent(RSSL_RC_CET_CHANNEL_UP));
+	ASSERT_TRUE((pProvCh = warmStandbyProvRespond(RSSL_DMT_LOGIN)));
+
+	/* Prov: The login refresh is packed, and written when the provider dispatches after the budget runs out. */
+	ASSERT_TRUE(rsslReactorGetPackingStats(pProvMon->pReactor, pProvCh, &initialStats, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(initialStats.messagesSubmitted == 1 && initialStats.messagesPacked == 1 && initialStats.buffersWritten == 0);
+
+	for (j = 0; j < 20 && initialStats.buffersWritten == 0; ++j)
+	{
+		dispatchEvent(pProvMon, 100);
+		ASSERT_TRUE(rsslReactorGetPackingStats(pProvMon->pReactor, pProvCh, &initialStats, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	}
+	ASSERT_TRUE(initialStats.buffersWritten == 1 && initialStats.budgetExpiredWrites == 1);
+
+	/* Cons: Channel ready. */
+	ASSERT_TRUE(warmStandbyConsWaitForEvent(RSSL_RC_CET_CHANNEL_READY));
+	pConsCh = pConsMon->mutMsg.pReactorChannel;
+
+	/* Prov: Submit some updates. They are packed and held until the budget runs out. */
+	for (i = 0; i < 10; ++i)
+		packingSubmitUpdate(pProvCh, i, 0);
+
+	ASSERT_TRUE(rsslReactorGetPackingStats(pProvMon->pReactor, pProvCh, &stats, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(stats.messagesSubmitted == initialStats.messagesSubmitted + 10);
+	ASSERT_TRUE(stats.messagesPacked == initialStats.messagesPacked + 10);
+	ASSERT_TRUE(stats.buffersWritten == initialStats.buffersWritten);
+
+	/* Cons: Nothing is received yet. */
+	while (dispatchEvent(pConsMon, 50) != RSSL_RET_READ_WOULD_BLOCK)
+		ASSERT_TRUE(pConsMon->mutMsg.mutMsgType != MUT_MSG_RSSL);
+
+	/* Prov: Dispatch until the timer writes the packed buffer. */
+	for (j = 0; j < 20 && stats.buffersWritten == initialStats.buffersWritten; ++j)
+	{
+		dispatchEvent(pProvMon, 100);
+		ASSERT_TRUE(rsslReactorGetPackingStats(pProvMon->pReactor, pProvCh, &stats, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	}
+	ASSERT_TRUE(stats.buffersWritten == initialStats.buffersWritten + 1);
+	ASSERT_TRUE(stats.budgetExpiredWrites == initialStats.budgetExpiredWrites + 1);
+
+	/* Cons: All updates are received, in order. */
+	for (i = 0; i < 10; ++i)
+		ASSERT_TRUE(packingConsReceiveUpdate(i));
+
+	/* Prov: A message submitted with write flags is not packed, and the packed buffer is written before it. */
+	packingSubmitUpdate(pProvCh, 10, 0);
+	packingSubmitUpdate(pProvCh, 11, RSSL_WRITE_DIRECT_SOCKET_WRITE);
+
+	ASSERT_TRUE(rsslReactorGetPackingStats(pProvMon->pReactor, pProvCh, &stats, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(stats.messagesSubmitted == initialStats.messagesSubmitted + 12);
+	ASSERT_TRUE(stats.messagesPacked == initialStats.messagesPacked + 11);
+	ASSERT_TRUE(stats.buffersWritten == initialStats.buffersWritten + 3);
+	ASSERT_TRUE(stats.budgetExpiredWrites == initialStats.budgetExpiredWrites + 1);
+
+	ASSERT_TRUE(packingConsReceiveUpdate(10));
+	ASSERT_TRUE(packingConsReceiveUpdate(11));
+
+	/* Prov: A buffer packed by the application is not copied. The packed buffer is written before it. */
+	packingSubmitUpdate(pProvCh, 12, 0);
+	packingSubmitPackedUpdates(pProvCh, 13, 3);
+
+	ASSERT_TRUE(rsslReactorGetPackingStats(pProvMon->pReactor, pProvCh, &stats, &rsslErrorInfo) == RSSL_RET_SUCCESS);
+	ASSERT_TRUE(stats.messagesSubmitted == initialStats.messagesSubmitted + 14);
+	ASSERT_TRUE(stats.messagesPacked == initialStats.messagesPacked + 12);
+	ASSERT_TRUE(stats.buffersWritten == initialStats.buffersWritten + 5);
+
+	/* Prov: Dispatch, so the reactor sees the earlier flush complete and flushes these buffers. */
+	for (j = 0; j < 5; ++j)
+		dispatchEvent(pProvMon, 100);
+
+	for (i = 12; i < 16; ++i)
+		ASSERT_TRUE(packingConsReceiveUpdate(i));
+
+	removeConnection(pConsMon, pConsCh);
+	removeConnection(pProvMon, pProvCh);
+}
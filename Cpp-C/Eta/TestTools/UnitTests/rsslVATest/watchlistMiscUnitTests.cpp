@@ -13,11 +13,16 @@
  * by the watchlist. */
 #include "rtr/wlMsgReorderQueue.h"
 
+/* watchlistMiscTest_MemoryPool tests the memory pool used for watchlist requests and streams. */
+#include "rtr/rsslMemoryPool.h"
+
 void watchlistMiscTest_BigGenericMsg();
 void watchlistMiscTest_BigPostMsg();
 void watchlistMiscTest_MsgKeyInUpdates(); 
 void watchlistMiscTest_SeqNumCompare(); 
 void watchlistMiscTest_AdminRsslMsgs();
+void watchlistMiscTest_MemoryPool();
+void watchlistMiscTest_ItemSnapshot();
 
 class WatchlistMiscUnitTest : public ::testing::Test {
 public:
@@ -58,6 +63,16 @@ TEST_F(WatchlistMiscUnitTest, AdminRsslMsgs)
 	watchlistMiscTest_AdminRsslMsgs();
 }
 
+TEST_F(WatchlistMiscUnitTest, MemoryPool)
+{
+	watchlistMiscTest_MemoryPool();
+}
+
+TEST_F(WatchlistMiscUnitTest, ItemSnapshot)
+{
+	watchlistMiscTest_ItemSnapshot();
+}
+
 #ifdef COMPILE_64BITS
 class WatchlistMiscUnitTest_Multicast : public ::testing::Test {
 public:
@@ -548,6 +563,134 @@ void watchlistMiscTest_SeqNumCompare()
 
 }
 
+/* Block used by watchlistMiscTest_MemoryPool, about the size of a watchlist request. */
+typedef struct
+{
+	RsslQueueLink	qlBlocks;
+	RsslUInt64		value;
+	char			data[200];
+} MemoryPoolTestBlock;
+
+/* Sums the values of the blocks in the list. Used to time iteration over the blocks. */
+static RsslUInt64 memoryPoolTestSum(RsslQueue *pBlockList)
+{
+	RsslQueueLink *pLink;
+	RsslUInt64 sum = 0;
+
+	RSSL_QUEUE_FOR_EACH_LINK(pBlockList, pLink)
+		sum += RSSL_QUEUE_LINK_TO_OBJECT(MemoryPoolTestBlock, qlBlocks, pLink)->value;
+
+	return sum;
+}
+
+void watchlistMiscTest_MemoryPool()
+{
+	const int blockCount = 100000;
+	RsslMemoryPool pool;
+	RsslMemoryPoolStats stats;
+	RsslErrorInfo errorInfo;
+	RsslQueue poolBlocks, mallocBlocks;
+	RsslQueueLink *pLink;
+	MemoryPoolTestBlock *pBlock, *pFirstBlock, *pPrevBlock;
+	TimeValue startTime, poolIterTime, mallocIterTime;
+	RsslUInt64 expectedSum = 0;
+	int i;
+
+	rsslInitQueue(&poolBlocks);
+	rsslInitQueue(&mallocBlocks);
+
+	/* Blocks allocated at initialization come from a single slab, in address order. */
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslMemoryPoolInit(&pool, sizeof(MemoryPoolTestBlock), blockCount, &errorInfo));
+	rsslMemoryPoolGetStats(&pool, &stats);
+	ASSERT_EQ(blockCount, stats.totalBlocks);
+	ASSERT_EQ(blockCount, stats.freeBlocks);
+	ASSERT_EQ(1, stats.slabCount);
+
+	pPrevBlock = NULL;
+	for (i = 0; i < blockCount; ++i)
+	{
+		ASSERT_TRUE((pBlock = (MemoryPoolTestBlock*)rsslMemoryPoolGet(&pool, &errorInfo)) != NULL);
+		if (pPrevBlock)
+			ASSERT_TRUE((char*)pBlock > (char*)pPrevBlock);
+		pBlock->value = i;
+		expectedSum += i;
+		rsslQueueAddLinkToBack(&poolBlocks, &pBlock->qlBlocks);
+		pPrevBlock = pBlock;
+	}
+
+	rsslMemoryPoolGetStats(&pool, &stats);
+	ASSERT_EQ(0, stats.freeBlocks);
+
+	/* Getting a block from the empty pool adds a slab. */
+	ASSERT_TRUE((pFirstBlock = (MemoryPoolTestBlock*)rsslMemoryPoolGet(&pool, &errorInfo)) != NULL);
+	rsslMemoryPoolGetStats(&pool, &stats);
+	ASSERT_EQ(2, stats.slabCount);
+	ASSERT_EQ(blockCount + RSSL_MEMORY_POOL_DEFAULT_SLAB_BLOCKS, stats.totalBlocks);
+	ASSERT_EQ(RSSL_MEMORY_POOL_DEFAULT_SLAB_BLOCKS - 1, stats.freeBlocks);
+
+	/* The block returned last is reused first. */
+	pLink = rsslQueueRemoveFirstLink(&poolBlocks);
+	pBlock = RSSL_QUEUE_LINK_TO_OBJECT(MemoryPoolTestBlock, qlBlocks, pLink);
+	rsslMemoryPoolPut(&pool, pBlock);
+	ASSERT_EQ(pBlock, rsslMemoryPoolGet(&pool, &errorInfo));
+	rsslQueueAddLinkToFront(&poolBlocks, &pBlock->qlBlocks);
+
+	/* The added slab is in use, so nothing can be trimmed. */
+	ASSERT_EQ(0, rsslMemoryPoolTrim(&pool, 0));
+
+	/* Once the added slab's block is returned, the slab can be trimmed, 
+	 * but not if that would leave fewer free blocks than requested. */
+	rsslMemoryPoolPut(&pool, pFirstBlock);
+	ASSERT_EQ(0, rsslMemoryPoolTrim(&pool, RSSL_MEMORY_POOL_DEFAULT_SLAB_BLOCKS));
+	ASSERT_EQ(RSSL_MEMORY_POOL_DEFAULT_SLAB_BLOCKS, rsslMemoryPoolTrim(&pool, 0));
+	rsslMemoryPoolGetStats(&pool, &stats);
+	ASSERT_EQ(1, stats.slabCount);
+	ASSERT_EQ(blockCount, stats.totalBlocks);
+	ASSERT_EQ(0, stats.freeBlocks);
+
+	/* Compare iteration over the pool's blocks with iteration over individually allocated blocks. */
+	for (i = 0; i < blockCount; ++i)
+	{
+		ASSERT_TRUE((pBlock = (MemoryPoolTestBlock*)malloc(sizeof(MemoryPoolTestBlock))) != NULL);
+		pBlock->value = i;
+		rsslQueueAddLinkToBack(&mallocBlocks, &pBlock->qlBlocks);
+	}
+
+	/* Iterate each list once first, so that neither is timed from a cold cache. */
+	ASSERT_EQ(expectedSum, memoryPoolTestSum(&poolBlocks));
+	ASSERT_EQ(expectedSum, memoryPoolTestSum(&mallocBlocks));
+
+	startTime = getTimeNano();
+	ASSERT_EQ(expectedSum, memoryPoolTestSum(&poolBlocks));
+	poolIterTime = getTimeNano() - startTime;
+
+	startTime = getTimeNano();
+	ASSERT_EQ(expectedSum, memoryPoolTestSum(&mallocBlocks));
+	mallocIterTime = getTimeNano() - startTime;
+
+	rsslMemoryPoolGetStats(&pool, &stats);
+	printf("  Memory pool: %d blocks of %u bytes in %d slab(s), %llu bytes allocated.\n",
+			stats.totalBlocks, (unsigned int)sizeof(MemoryPoolTestBlock), stats.slabCount, 
+			(unsigned long long)stats.allocatedBytes);
+	printf("  Iteration over %d blocks: %.2f ns/block (pool), %.2f ns/block (malloc).\n", blockCount,
+			(double)poolIterTime / blockCount, (double)mallocIterTime / blockCount);
+
+	while ((pLink = rsslQueueRemoveFirstLink(&mallocBlocks)))
+		free(RSSL_QUEUE_LINK_TO_OBJECT(MemoryPoolTestBlock, qlBlocks, pLink));
+
+	/* Return all blocks and release the pool's memory. */
+	while ((pLink = rsslQueueRemoveFirstLink(&poolBlocks)))
+		rsslMemoryPoolPut(&pool, RSSL_QUEUE_LINK_TO_OBJECT(MemoryPoolTestBlock, qlBlocks, pLink));
+
+	ASSERT_EQ(blockCount, rsslMemoryPoolTrim(&pool, 0));
+	rsslMemoryPoolGetStats(&pool, &stats);
+	ASSERT_EQ(0, stats.slabCount);
+	ASSERT_EQ(0, stats.totalBlocks);
+	ASSERT_EQ(0u, stats.allocatedBytes);
+
+	rsslMemoryPoolCleanup(&pool);
+}
+
 /* Converts an RDM msg into an RsslMsg, using the given buffer for holding encoded data. */
 static void _wtfRDMMsgToRsslMsg(RsslBuffer *pBuffer, RsslRDMMsg *pRdmMsg, RsslMsg *pRsslMsg)
 {
@@ -695,3 +838,202 @@ void watchlistMiscTest_AdminRsslMsgs()
 
 	wtfFinishTest();
 }
+
+/* Requests an item by name from Service1, and has the provider receive the request. Returns the provider's stream ID.
+ * If pStoredPermData is set, the consumer should first receive the stored image, identified by its permission data. */
+static RsslInt32 itemSnapshotRequestItem(RsslInt32 streamId, RsslBuffer *pItemName, RsslBuffer *pStoredPermData)
+{
+	RsslReactorSubmitMsgOptions opts;
+	RsslRequestMsg	requestMsg, *pRequestMsg;
+	RsslRefreshMsg	*pRefreshMsg;
+	WtfEvent		*pEvent;
+
+	rsslClearRequestMsg(&requestMsg);
+	requestMsg.msgBase.streamId = streamId;
+	requestMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	requestMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	requestMsg.msgBase.msgKey.flags = RSSL_MKF_HAS_NAME;
+	requestMsg.msgBase.msgKey.name = *pItemName;
+	requestMsg.flags = RSSL_RQMF_STREAMING;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&requestMsg;
+	opts.pServiceName = &service1Name;
+	wtfSubmitMsg(&opts, WTF_TC_CONSUMER, NULL, RSSL_FALSE);
+
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	if (!pStoredPermData)
+		EXPECT_TRUE(!wtfGetEvent());
+	else
+	{
+		/* Stored image is given to the consumer as suspect data. */
+		EXPECT_TRUE(pEvent = wtfGetEvent());
+		if (!pEvent) return 0;
+		EXPECT_TRUE(pRefreshMsg = (RsslRefreshMsg*)wtfGetRsslMsg(pEvent));
+		if (!pRefreshMsg) return 0;
+		EXPECT_EQ(RSSL_MC_REFRESH, pRefreshMsg->msgBase.msgClass);
+		EXPECT_EQ(streamId, pRefreshMsg->msgBase.streamId);
+		EXPECT_EQ(RSSL_STREAM_OPEN, pRefreshMsg->state.streamState);
+		EXPECT_EQ(RSSL_DATA_SUSPECT, pRefreshMsg->state.dataState);
+		EXPECT_TRUE(pRefreshMsg->flags & RSSL_RFMF_REFRESH_COMPLETE);
+		EXPECT_TRUE(pRefreshMsg->flags & RSSL_RFMF_HAS_PERM_DATA);
+		EXPECT_TRUE(rsslBufferIsEqual(&pRefreshMsg->permData, pStoredPermData));
+	}
+
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+	EXPECT_TRUE(pEvent = wtfGetEvent());
+	if (!pEvent) return 0;
+	EXPECT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+	if (!pRequestMsg) return 0;
+	EXPECT_EQ(RSSL_MC_REQUEST, pRequestMsg->msgBase.msgClass);
+	EXPECT_TRUE(rsslBufferIsEqual(&pRequestMsg->msgBase.msgKey.name, pItemName));
+	return pRequestMsg->msgBase.streamId;
+}
+
+/* Provider sends a complete refresh, with permission data to identify the image. */
+static void itemSnapshotProviderRefresh(RsslInt32 providerStreamId, RsslBuffer *pItemName, RsslBuffer *pPermData)
+{
+	RsslReactorSubmitMsgOptions opts;
+	RsslRefreshMsg	refreshMsg;
+
+	rsslClearRefreshMsg(&refreshMsg);
+	refreshMsg.msgBase.streamId = providerStreamId;
+	refreshMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	refreshMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	refreshMsg.msgBase.msgKey.flags = RSSL_MKF_HAS_NAME | RSSL_MKF_HAS_SERVICE_ID;
+	refreshMsg.msgBase.msgKey.name = *pItemName;
+	refreshMsg.msgBase.msgKey.serviceId = service1Id;
+	refreshMsg.flags = RSSL_RFMF_SOLICITED | RSSL_RFMF_REFRESH_COMPLETE | RSSL_RFMF_HAS_MSG_KEY
+		| RSSL_RFMF_HAS_PERM_DATA;
+	refreshMsg.permData = *pPermData;
+	refreshMsg.state.streamState = RSSL_STREAM_OPEN;
+	refreshMsg.state.dataState = RSSL_DATA_OK;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&refreshMsg;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+}
+
+void watchlistMiscTest_ItemSnapshot()
+{
+	RsslReactorSubmitMsgOptions opts;
+	WtfSetupConnectionOpts connOpts;
+	WtfEvent		*pEvent;
+	RsslRefreshMsg	*pRefreshMsg;
+	RsslStatusMsg	statusMsg, *pStatusMsg;
+	RsslInt32		providerItemStream, providerClosedItemStream;
+	char			snapshotFile[] = "wlItemSnapshotTest.dat";
+	RsslBuffer		itemName = { 3, const_cast<char*>("TRI") };
+	RsslBuffer		closedItemName = { 4, const_cast<char*>("GONE") };
+	RsslBuffer		permData = { 4, const_cast<char*>("PRM1") };
+	RsslBuffer		newPermData = { 4, const_cast<char*>("PRM2") };
+	FILE			*pFile;
+	long			filePos, fileLength;
+	char			*pFileData;
+
+	remove(snapshotFile);
+
+	ASSERT_TRUE(wtfStartTest());
+
+	wtfClearSetupConnectionOpts(&connOpts);
+	connOpts.itemSnapshotFile = snapshotFile;
+	wtfSetupConnection(&connOpts);
+
+	/* First run: nothing is stored, so the consumer waits for the provider's refresh. */
+	ASSERT_TRUE(providerItemStream = itemSnapshotRequestItem(2, &itemName, NULL));
+
+	itemSnapshotProviderRefresh(providerItemStream, &itemName, &permData);
+
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRefreshMsg = (RsslRefreshMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_EQ(RSSL_MC_REFRESH, pRefreshMsg->msgBase.msgClass);
+	ASSERT_EQ(2, pRefreshMsg->msgBase.streamId);
+	ASSERT_EQ(RSSL_DATA_OK, pRefreshMsg->state.dataState);
+
+	/* Second item is stored, then closed by the provider, which removes it. */
+	ASSERT_TRUE(providerClosedItemStream = itemSnapshotRequestItem(3, &closedItemName, NULL));
+
+	itemSnapshotProviderRefresh(providerClosedItemStream, &closedItemName, &permData);
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRefreshMsg = (RsslRefreshMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_EQ(3, pRefreshMsg->msgBase.streamId);
+
+	rsslClearStatusMsg(&statusMsg);
+	statusMsg.msgBase.streamId = providerClosedItemStream;
+	statusMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	statusMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	statusMsg.flags = RSSL_STMF_HAS_STATE;
+	statusMsg.state.streamState = RSSL_STREAM_CLOSED;
+	statusMsg.state.dataState = RSSL_DATA_SUSPECT;
+
+	rsslClearReactorSubmitMsgOptions(&opts);
+	opts.pRsslMsg = (RsslMsg*)&statusMsg;
+	wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pStatusMsg = (RsslStatusMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_EQ(RSSL_MC_STATUS, pStatusMsg->msgBase.msgClass);
+	ASSERT_EQ(RSSL_STREAM_CLOSED, pStatusMsg->state.streamState);
+
+	wtfFinishTest();
+
+	/* Restart, using the same file. */
+	ASSERT_TRUE(wtfStartTest());
+	wtfSetupConnection(&connOpts);
+
+	/* Consumer receives the stored image before the provider responds. */
+	ASSERT_TRUE(providerItemStream = itemSnapshotRequestItem(2, &itemName, &permData));
+
+	/* Provider's refresh follows, and replaces the stored image. */
+	itemSnapshotProviderRefresh(providerItemStream, &itemName, &newPermData);
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(pEvent = wtfGetEvent());
+	ASSERT_TRUE(pRefreshMsg = (RsslRefreshMsg*)wtfGetRsslMsg(pEvent));
+	ASSERT_EQ(2, pRefreshMsg->msgBase.streamId);
+	ASSERT_EQ(RSSL_DATA_OK, pRefreshMsg->state.dataState);
+	ASSERT_TRUE(rsslBufferIsEqual(&pRefreshMsg->permData, &newPermData));
+
+	/* Closed item was removed, so nothing is received for it. */
+	ASSERT_TRUE(itemSnapshotRequestItem(3, &closedItemName, NULL));
+
+	wtfFinishTest();
+
+	/* Restart again; the newer image was stored. */
+	ASSERT_TRUE(wtfStartTest());
+	wtfSetupConnection(&connOpts);
+
+	ASSERT_TRUE(itemSnapshotRequestItem(2, &itemName, &newPermData));
+
+	wtfFinishTest();
+
+	/* Change a byte of the stored image, as if the system had stopped while it was being written. */
+	ASSERT_TRUE(pFile = fopen(snapshotFile, "r+b"));
+	ASSERT_EQ(0, fseek(pFile, 0, SEEK_END));
+	fileLength = ftell(pFile);
+	ASSERT_TRUE(pFileData = (char*)malloc(fileLength));
+	ASSERT_EQ(0, fseek(pFile, 0, SEEK_SET));
+	ASSERT_EQ((size_t)fileLength, fread(pFileData, 1, fileLength, pFile));
+
+	for (filePos = 0; filePos + (long)newPermData.length <= fileLength; ++filePos)
+		if (memcmp(pFileData + filePos, newPermData.data, newPermData.length) == 0)
+			break;
+	free(pFileData);
+	ASSERT_LT(filePos + (long)newPermData.length, fileLength);
+
+	ASSERT_EQ(0, fseek(pFile, filePos, SEEK_SET));
+	ASSERT_EQ('X', fputc('X', pFile));
+	fclose(pFile);
+
+	/* Restart; the record fails its CRC and is dropped, so the consumer waits for the provider. */
+	ASSERT_TRUE(wtfStartTest());
+	wtfSetupConnection(&connOpts);
+
+	ASSERT_TRUE(itemSnapshotRequestItem(2, &itemName, NULL));
+
+	wtfFinishTest();
+
+	remove(snapshotFile);
+}
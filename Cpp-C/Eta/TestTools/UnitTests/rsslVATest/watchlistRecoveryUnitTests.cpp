@@ -23,6 +23,7 @@ void watchlistRecoveryTest_PrivateStreamWithPayloadAndExtHeader();
 void watchlistRecoveryTest_OneItem_AllowSuspectDataOff();
 void watchlistRecoveryTest_OneItem_GroupMerge();
 void watchlistRecoveryTest_TwoItems_ClosedRecoverFromServiceState();
+void watchlistRecoveryTest_CoalescedItemRequests();
 void watchlistRecoveryTest_OneItem_ClosedRecoverFromGroupState();
 void watchlistRecoveryTest_OneItem_LoginClosedRecover(RsslBool singleOpen);
 void watchlistRecoveryTest_OneItem_LoginClosed();
@@ -155,6 +156,11 @@ TEST_F(WatchlistRecoveryTest, TwoItems_ClosedRecoverFromServiceState)
 	watchlistRecoveryTest_TwoItems_ClosedRecoverFromServiceState();
 }
 
+TEST_F(WatchlistRecoveryTest, CoalescedItemRequests)
+{
+	watchlistRecoveryTest_CoalescedItemRequests();
+}
+
 TEST_F(WatchlistRecoveryTest, OneItem_GroupMerge)
 {
 	watchlistRecoveryTest_OneItem_GroupMerge();
@@ -2303,6 +2309,212 @@ void watchlistRecoveryTest_TwoItems_ClosedRecoverFromServiceState()
 	wtfFinishTest();
 }
 
+void watchlistRecoveryTest_CoalescedItemRequests()
+{
+	WtfEvent		*pEvent;
+	RsslRequestMsg	requestMsg, *pRequestMsg;
+	RsslRefreshMsg	refreshMsg, *pRefreshMsg;
+	RsslStatusMsg	statusMsg, *pStatusMsg;
+	RsslInt32		batchStreamId;
+	RsslRDMDirectoryUpdate directoryUpdate;
+	RsslRDMService service1;
+	RsslReactorSubmitMsgOptions opts;
+	WtfSetupConnectionOpts connOpts;
+	RsslDecodeIterator dIter;
+	RsslElementList	elementList;
+	RsslElementEntry elementEntry;
+	RsslArray		batchArray;
+	RsslBuffer		batchName;
+	RsslRet			ret;
+	int				i, pass, nameCount;
+	const int		itemCount = 8;
+	char			itemNameData[itemCount][8];
+	RsslBuffer		itemNames[itemCount];
+
+	ASSERT_TRUE(wtfStartTest());
+
+	wtfClearSetupConnectionOpts(&connOpts);
+	connOpts.coalesceItemRequests = RSSL_TRUE;
+	wtfSetupConnection(&connOpts);
+
+	/* Request items. They are sent together when the watchlist is next dispatched. */
+	for (i = 0; i < itemCount; ++i)
+	{
+		snprintf(itemNameData[i], sizeof(itemNameData[i]), "ITEM%d", i);
+		itemNames[i].data = itemNameData[i];
+		itemNames[i].length = (RsslUInt32)strlen(itemNameData[i]);
+
+		rsslClearRequestMsg(&requestMsg);
+		requestMsg.msgBase.streamId = 2 + i;
+		requestMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		requestMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+		requestMsg.flags = RSSL_RQMF_STREAMING | RSSL_RQMF_HAS_QOS;
+		requestMsg.qos.timeliness = RSSL_QOS_TIME_REALTIME;
+		requestMsg.qos.rate = RSSL_QOS_RATE_TICK_BY_TICK;
+		requestMsg.msgBase.msgKey.flags |= RSSL_MKF_HAS_NAME;
+		requestMsg.msgBase.msgKey.name = itemNames[i];
+
+		rsslClearReactorSubmitMsgOptions(&opts);
+		opts.pRsslMsg = (RsslMsg*)&requestMsg;
+		opts.pServiceName = &service1Name;
+		wtfSubmitMsg(&opts, WTF_TC_CONSUMER, NULL, RSSL_FALSE);
+	}
+
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	for (pass = 0; pass < 2; ++pass)
+	{
+		/* Provider receives one batch request for all items. */
+		wtfDispatch(WTF_TC_PROVIDER, 100);
+
+		ASSERT_TRUE(pEvent = wtfGetEvent());
+		ASSERT_TRUE(pRequestMsg = (RsslRequestMsg*)wtfGetRsslMsg(pEvent));
+		ASSERT_TRUE(pRequestMsg->msgBase.msgClass == RSSL_MC_REQUEST);
+		ASSERT_TRUE(pRequestMsg->flags & RSSL_RQMF_HAS_BATCH);
+		ASSERT_TRUE(pRequestMsg->flags & RSSL_RQMF_STREAMING);
+		ASSERT_TRUE(!(pRequestMsg->flags & RSSL_RQMF_HAS_PRIORITY));
+		ASSERT_TRUE(!(pRequestMsg->flags & RSSL_RQMF_NO_REFRESH));
+		ASSERT_TRUE(pRequestMsg->flags & RSSL_RQMF_HAS_QOS);
+		ASSERT_TRUE(pRequestMsg->qos.timeliness == RSSL_QOS_TIME_REALTIME);
+		ASSERT_TRUE(pRequestMsg->qos.rate == RSSL_QOS_RATE_TICK_BY_TICK);
+		ASSERT_TRUE(pRequestMsg->msgBase.msgKey.flags & RSSL_MKF_HAS_SERVICE_ID);
+		ASSERT_TRUE(pRequestMsg->msgBase.msgKey.serviceId == service1Id);
+		ASSERT_TRUE(!(pRequestMsg->msgBase.msgKey.flags & RSSL_MKF_HAS_NAME));
+		ASSERT_TRUE(pRequestMsg->msgBase.containerType == RSSL_DT_ELEMENT_LIST);
+		batchStreamId = pRequestMsg->msgBase.streamId;
+
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		rsslSetDecodeIteratorBuffer(&dIter, &pRequestMsg->msgBase.encDataBody);
+		ASSERT_TRUE(rsslDecodeElementList(&dIter, &elementList, NULL) == RSSL_RET_SUCCESS);
+		ASSERT_TRUE(rsslDecodeElementEntry(&dIter, &elementEntry) == RSSL_RET_SUCCESS);
+		ASSERT_TRUE(rsslBufferIsEqual(&elementEntry.name, &RSSL_ENAME_BATCH_ITEM_LIST));
+		ASSERT_TRUE(elementEntry.dataType == RSSL_DT_ARRAY);
+		ASSERT_TRUE(rsslDecodeArray(&dIter, &batchArray) == RSSL_RET_SUCCESS);
+		ASSERT_TRUE(batchArray.primitiveType == RSSL_DT_ASCII_STRING);
+
+		nameCount = 0;
+		while ((ret = rsslDecodeArrayEntry(&dIter, &batchName)) != RSSL_RET_END_OF_CONTAINER)
+		{
+			ASSERT_TRUE(ret == RSSL_RET_SUCCESS);
+			ASSERT_TRUE(nameCount < itemCount);
+			ASSERT_TRUE(rsslBufferIsEqual(&batchName, &itemNames[nameCount]));
+			++nameCount;
+		}
+		ASSERT_TRUE(nameCount == itemCount);
+
+		ASSERT_TRUE(rsslDecodeElementEntry(&dIter, &elementEntry) == RSSL_RET_END_OF_CONTAINER);
+
+		ASSERT_TRUE(!wtfGetEvent());
+
+		if (pass == 1)
+			break;
+
+		/* Provider refreshes each item on the streams following the batch stream, then closes the batch stream. */
+		for (i = 0; i < itemCount; ++i)
+		{
+			rsslClearRefreshMsg(&refreshMsg);
+			refreshMsg.flags = RSSL_RFMF_HAS_MSG_KEY | RSSL_RFMF_CLEAR_CACHE | RSSL_RFMF_HAS_QOS
+				| RSSL_RFMF_SOLICITED | RSSL_RFMF_REFRESH_COMPLETE;
+			refreshMsg.msgBase.streamId = batchStreamId + 1 + i;
+			refreshMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+			refreshMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+			refreshMsg.msgBase.msgKey.flags = RSSL_MKF_HAS_SERVICE_ID | RSSL_MKF_HAS_NAME;
+			refreshMsg.msgBase.msgKey.serviceId = service1Id;
+			refreshMsg.msgBase.msgKey.name = itemNames[i];
+			refreshMsg.qos.timeliness = RSSL_QOS_TIME_REALTIME;
+			refreshMsg.qos.rate = RSSL_QOS_RATE_TICK_BY_TICK;
+			refreshMsg.state.streamState = RSSL_STREAM_OPEN;
+			refreshMsg.state.dataState = RSSL_DATA_OK;
+
+			rsslClearReactorSubmitMsgOptions(&opts);
+			opts.pRsslMsg = (RsslMsg*)&refreshMsg;
+			wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_FALSE);
+		}
+
+		rsslClearStatusMsg(&statusMsg);
+		statusMsg.flags = RSSL_STMF_HAS_STATE;
+		statusMsg.msgBase.streamId = batchStreamId;
+		statusMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		statusMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+		statusMsg.state.streamState = RSSL_STREAM_CLOSED;
+		statusMsg.state.dataState = RSSL_DATA_OK;
+
+		rsslClearReactorSubmitMsgOptions(&opts);
+		opts.pRsslMsg = (RsslMsg*)&statusMsg;
+		wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+		/* Consumer receives a refresh for each item, and nothing for the batch stream. */
+		wtfDispatch(WTF_TC_CONSUMER, 100);
+
+		for (i = 0; i < itemCount; ++i)
+		{
+			ASSERT_TRUE(pEvent = wtfGetEvent());
+			ASSERT_TRUE(pRefreshMsg = (RsslRefreshMsg*)wtfGetRsslMsg(pEvent));
+			ASSERT_TRUE(pRefreshMsg->msgBase.msgClass == RSSL_MC_REFRESH);
+			ASSERT_TRUE(pRefreshMsg->msgBase.streamId == 2 + i);
+			ASSERT_TRUE(pRefreshMsg->state.streamState == RSSL_STREAM_OPEN);
+			ASSERT_TRUE(pRefreshMsg->state.dataState == RSSL_DATA_OK);
+			ASSERT_TRUE(pRefreshMsg->msgBase.msgKey.flags & RSSL_MKF_HAS_NAME);
+			ASSERT_TRUE(rsslBufferIsEqual(&pRefreshMsg->msgBase.msgKey.name, &itemNames[i]));
+		}
+
+		ASSERT_TRUE(!wtfGetEvent());
+
+		/* Provider receives no close for the batch stream. */
+		wtfDispatch(WTF_TC_PROVIDER, 100);
+		ASSERT_TRUE(!wtfGetEvent());
+
+		/* Provider sends closed-recover via directory. */
+		rsslClearRDMDirectoryUpdate(&directoryUpdate);
+		directoryUpdate.rdmMsgBase.streamId = wtfGetProviderDirectoryStream();
+		directoryUpdate.filter = wtfGetProviderDirectoryFilter();
+		rsslClearRDMService(&service1);
+		service1.serviceId = service1Id;
+		service1.flags = RDM_SVCF_HAS_STATE; 
+		service1.state.flags |= RDM_SVC_STF_HAS_STATUS;
+		service1.state.status.streamState = RSSL_STREAM_CLOSED_RECOVER;
+		service1.state.status.dataState = RSSL_DATA_SUSPECT;
+		service1.state.status.text.data = const_cast<char*>("All items closed-recover.");
+		service1.state.status.text.length = (RsslUInt32)strlen(service1.state.status.text.data);
+		directoryUpdate.serviceCount = 1;
+		directoryUpdate.serviceList = &service1;
+
+		rsslClearReactorSubmitMsgOptions(&opts);
+		opts.pRDMMsg = (RsslRDMMsg*)&directoryUpdate;
+		wtfSubmitMsg(&opts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
+
+		/* Consumer receives Open/Suspect status for each item. */
+		wtfDispatch(WTF_TC_CONSUMER, 100);
+
+		for (i = 0; i < itemCount; ++i)
+		{
+			ASSERT_TRUE(pEvent = wtfGetEvent());
+			ASSERT_TRUE(pStatusMsg = (RsslStatusMsg*)wtfGetRsslMsg(pEvent));
+			ASSERT_TRUE(pStatusMsg->msgBase.msgClass == RSSL_MC_STATUS);
+			ASSERT_TRUE(pStatusMsg->msgBase.streamId == 2 + i);
+			ASSERT_TRUE(pStatusMsg->flags & RSSL_STMF_HAS_STATE);
+			ASSERT_TRUE(pStatusMsg->state.streamState == RSSL_STREAM_OPEN);
+			ASSERT_TRUE(pStatusMsg->state.dataState == RSSL_DATA_SUSPECT);
+		}
+
+		ASSERT_TRUE(!wtfGetEvent());
+
+		/* The recovery requests are coalesced again (checked on the next pass). */
+	}
+
+	/* Consumer receives no more events. */
+	wtfDispatch(WTF_TC_CONSUMER, 100);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	/* Provider receives no more events. */
+	wtfDispatch(WTF_TC_PROVIDER, 100);
+	ASSERT_TRUE(!wtfGetEvent());
+
+	wtfFinishTest();
+}
+
 void watchlistRecoveryTest_OneItem_GroupMerge()
 {
 	WtfEvent		*pEvent;
@@ -1085,6 +1085,8 @@ void wtfSetupConnection(WtfSetupConnectionOpts *pOpts)
 	wtf.ommConsumerRole.watchlistOptions.channelOpenCallback = channelEventCallback;
 	wtf.ommConsumerRole.watchlistOptions.requestTimeout = pOpts->requestTimeout;
 	wtf.ommConsumerRole.watchlistOptions.postAckTimeout = pOpts->postAckTimeout;
+	wtf.ommConsumerRole.watchlistOptions.coalesceItemRequests = pOpts->coalesceItemRequests;
+	wtf.ommConsumerRole.watchlistOptions.itemSnapshotFile = pOpts->itemSnapshotFile;
 
 	/* wtfDispatch() multiplies times less than 1 second. So set
 	 * requestTimeout/postAckTimeout accordingly. */
@@ -1185,6 +1187,12 @@ void wtfSetupConnection(WtfSetupConnectionOpts *pOpts)
 		}
 	}
 
+	if (pOpts->coalesceItemRequests)
+	{
+		loginRefresh.flags |= RDM_LG_RFF_HAS_SUPPORT_BATCH;
+		loginRefresh.supportBatchRequests = RDM_LOGIN_BATCH_SUPPORT_REQUESTS;
+	}
+
 	rsslClearReactorSubmitMsgOptions(&submitOpts);
 	submitOpts.pRDMMsg = (RsslRDMMsg*)&loginRefresh;
 	wtfSubmitMsg(&submitOpts, WTF_TC_PROVIDER, NULL, RSSL_TRUE);
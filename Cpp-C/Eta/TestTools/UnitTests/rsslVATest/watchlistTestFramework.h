@@ -301,6 +301,9 @@ typedef struct
 	RsslUInt32	requestTimeout;					/* Sets watchlist request timeout. */
 	RsslBool	multicastGapRecovery;			/* Provider's login response indicates
 												 * whether watchlist should recover from gaps. */
+	RsslBool	coalesceItemRequests;			/* Enables CoalesceItemRequests on watchlist, and
+												 * provider's login response indicates batch support. */
+	char		*itemSnapshotFile;				/* Sets watchlist item snapshot file. */
 } WtfSetupConnectionOpts;
 
 /* Initializes commonly used settings of WtfSetupConnectionOpts. */
@@ -322,6 +325,8 @@ static void wtfClearSetupConnectionOpts(WtfSetupConnectionOpts *pOpts)
 	pOpts->postAckTimeout = 15000;
 	pOpts->requestTimeout = 15000;
 	pOpts->multicastGapRecovery = RSSL_TRUE;
+	pOpts->coalesceItemRequests = RSSL_FALSE;
+	pOpts->itemSnapshotFile = NULL;
 }
 
 /*** Connections ***/
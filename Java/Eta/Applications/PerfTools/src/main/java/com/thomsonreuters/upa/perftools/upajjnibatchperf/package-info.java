@@ -0,0 +1,4 @@
+/**
+ * The upajJNIBatchPerf application package.
+ */
+package com.thomsonreuters.upa.perftools.upajjnibatchperf;
\ No newline at end of file
@@ -0,0 +1,295 @@
+package com.thomsonreuters.upa.perftools.upajjnibatchperf;
+
+import java.nio.ByteBuffer;
+
+import com.thomsonreuters.upa.transport.AcceptOptions;
+import com.thomsonreuters.upa.transport.BindOptions;
+import com.thomsonreuters.upa.transport.Channel;
+import com.thomsonreuters.upa.transport.ChannelState;
+import com.thomsonreuters.upa.transport.ConnectOptions;
+import com.thomsonreuters.upa.transport.Error;
+import com.thomsonreuters.upa.transport.InProgInfo;
+import com.thomsonreuters.upa.transport.InitArgs;
+import com.thomsonreuters.upa.transport.JNIChannel;
+import com.thomsonreuters.upa.transport.ReadArgs;
+import com.thomsonreuters.upa.transport.Server;
+import com.thomsonreuters.upa.transport.Transport;
+import com.thomsonreuters.upa.transport.TransportBuffer;
+import com.thomsonreuters.upa.transport.TransportFactory;
+import com.thomsonreuters.upa.transport.TransportReturnCodes;
+import com.thomsonreuters.upa.transport.WriteArgs;
+
+/**
+ * The upajJNIBatchPerf application. Measures the cost of reading messages
+ * through the UPA JNI transport one message per JNI call, with
+ * {@link Channel#read(ReadArgs, Error)}, against reading them in batches with
+ * {@link JNIChannel#readBatch(ByteBuffer, ReadArgs, Error)}.
+ * <p>
+ * The application binds a JNI TCP server, connects a JNI TCP client to it in
+ * the same process and has the server send the client a fixed number of
+ * messages in each read mode, using
+ * {@link JNIChannel#writeBatch(ByteBuffer, WriteArgs, Error)}. Only the time
+ * spent reading is measured, and messages/sec is reported for each mode.
+ * <p>
+ * This application uses the rsslUpaJNI library, which must be on the
+ * java.library.path.
+ * <p>
+ * <em>Arguments</em>
+ * <ul>
+ * <li>-p Port number the server binds to. Default is 14010.
+ * <li>-msgCount Number of messages read in each mode. Default is 5000000.
+ * <li>-msgSize Size of each message in bytes. Default is 76.
+ * <li>-batchBufSize Size of the readBatch buffer in bytes. Default is 65536.
+ * </ul>
+ */
+public class upajJNIBatchPerf
+{
+    /* connection type of the JNI TCP transport, which the transport reserves for testing */
+    private static final int JNI_SOCKET = 111;
+
+    /* size of the length that precedes each message in a batch buffer */
+    private static final int BATCH_LENGTH_SIZE = 4;
+
+    private String _portNo = "14010";
+    private int _msgCount = 5000000;
+    private int _msgSize = 76;
+    private int _batchBufSize = 65536;
+
+    private Error _error = TransportFactory.createError();
+    private ReadArgs _readArgs = TransportFactory.createReadArgs();
+    private WriteArgs _writeArgs = TransportFactory.createWriteArgs();
+    private InProgInfo _inProgInfo = TransportFactory.createInProgInfo();
+
+    private Server _server;
+    private JNIChannel _serverChannel;
+    private JNIChannel _clientChannel;
+
+    /* messages the server has left to send, and the batch they are sent from */
+    private int _msgsToSend;
+    private ByteBuffer _writeBuffer;
+    private ByteBuffer _readBuffer;
+
+    /* next sequence number expected by the client */
+    private int _nextSeqNum;
+
+    public static void main(String[] args)
+    {
+        upajJNIBatchPerf jniBatchPerf = new upajJNIBatchPerf();
+        jniBatchPerf.init(args);
+        jniBatchPerf.run();
+        jniBatchPerf.uninit();
+        System.exit(0);
+    }
+
+    private void init(String[] args)
+    {
+        for (int i = 0; i < args.length; ++i)
+        {
+            if (args[i].equals("-p") && i + 1 < args.length)
+                _portNo = args[++i];
+            else if (args[i].equals("-msgCount") && i + 1 < args.length)
+                _msgCount = Integer.parseInt(args[++i]);
+            else if (args[i].equals("-msgSize") && i + 1 < args.length)
+                _msgSize = Integer.parseInt(args[++i]);
+            else if (args[i].equals("-batchBufSize") && i + 1 < args.length)
+                _batchBufSize = Integer.parseInt(args[++i]);
+            else
+                exitWithUsage();
+        }
+
+        if (_msgCount <= 0 || _msgSize < 4 || _batchBufSize < _msgSize + BATCH_LENGTH_SIZE)
+            exitWithUsage();
+
+        InitArgs initArgs = TransportFactory.createInitArgs();
+        initArgs.globalLocking(false);
+        if (Transport.initialize(initArgs, _error) != TransportReturnCodes.SUCCESS)
+            exitWithError("Transport.initialize() failed");
+
+        BindOptions bindOpts = TransportFactory.createBindOptions();
+        bindOpts.serviceName(_portNo);
+        bindOpts.connectionType(JNI_SOCKET);
+        bindOpts.guaranteedOutputBuffers(5000);
+        bindOpts.majorVersion(0);
+        bindOpts.minorVersion(0);
+        bindOpts.protocolType(0);
+        if ((_server = Transport.bind(bindOpts, _error)) == null)
+            exitWithError("Transport.bind() failed");
+
+        ConnectOptions connectOpts = TransportFactory.createConnectOptions();
+        connectOpts.unifiedNetworkInfo().address("localhost");
+        connectOpts.unifiedNetworkInfo().serviceName(_portNo);
+        connectOpts.connectionType(JNI_SOCKET);
+        connectOpts.blocking(false);
+        connectOpts.majorVersion(0);
+        connectOpts.minorVersion(0);
+        connectOpts.protocolType(0);
+        if ((_clientChannel = (JNIChannel)Transport.connect(connectOpts, _error)) == null)
+            exitWithError("Transport.connect() failed");
+
+        AcceptOptions acceptOpts = TransportFactory.createAcceptOptions();
+        long endTime = System.currentTimeMillis() + 10000;
+        while (_serverChannel == null || _serverChannel.state() != ChannelState.ACTIVE
+                || _clientChannel.state() != ChannelState.ACTIVE)
+        {
+            if (System.currentTimeMillis() > endTime)
+                exitWithError("Timed out initializing the channels");
+
+            if (_serverChannel == null)
+                _serverChannel = (JNIChannel)_server.accept(acceptOpts, _error);
+            if (_serverChannel != null && _serverChannel.state() != ChannelState.ACTIVE
+                    && _serverChannel.init(_inProgInfo, _error) < TransportReturnCodes.SUCCESS)
+                exitWithError("Server channel init() failed");
+            if (_clientChannel.state() != ChannelState.ACTIVE
+                    && _clientChannel.init(_inProgInfo, _error) < TransportReturnCodes.SUCCESS)
+                exitWithError("Client channel init() failed");
+
+            try
+            {
+                Thread.sleep(1);
+            }
+            catch (InterruptedException e)
+            {
+            }
+        }
+
+        _writeBuffer = ByteBuffer.allocateDirect(_batchBufSize);
+        _writeBuffer.limit(0);
+        _readBuffer = ByteBuffer.allocateDirect(_batchBufSize);
+    }
+
+    private void run()
+    {
+        System.out.println("Reading " + _msgCount + " messages of " + _msgSize + " bytes in each mode");
+
+        printResult("Single", runReads(false));
+        printResult("Batched", runReads(true));
+    }
+
+    /* Sends msgCount messages from the server and returns the time in nanoseconds the client spends reading them. */
+    private long runReads(boolean batched)
+    {
+        long readTime = 0;
+
+        _msgsToSend = _msgCount;
+        _nextSeqNum = 0;
+
+        while (_nextSeqNum < _msgCount)
+        {
+            sendMsgs();
+
+            long startTime = System.nanoTime();
+            int ret = batched ? readBatch() : read();
+            readTime += System.nanoTime() - startTime;
+
+            if (ret < TransportReturnCodes.SUCCESS && ret != TransportReturnCodes.READ_WOULD_BLOCK
+                    && ret != TransportReturnCodes.READ_PING && ret != TransportReturnCodes.READ_FD_CHANGE)
+                exitWithError("Read failed with " + TransportReturnCodes.toString(ret));
+        }
+
+        return readTime;
+    }
+
+    /* Reads with Channel.read() until nothing more is buffered. */
+    private int read()
+    {
+        TransportBuffer msgBuf;
+
+        do
+        {
+            if ((msgBuf = _clientChannel.read(_readArgs, _error)) != null)
+                checkMsg(msgBuf.data(), msgBuf.dataStartPosition(), msgBuf.length());
+        } while (_readArgs.readRetVal() > TransportReturnCodes.SUCCESS);
+
+        return _readArgs.readRetVal();
+    }
+
+    /* Reads with JNIChannel.readBatch() until nothing more is buffered. */
+    private int readBatch()
+    {
+        int msgCount;
+
+        do
+        {
+            _readBuffer.clear();
+            if ((msgCount = _clientChannel.readBatch(_readBuffer, _readArgs, _error)) < 0)
+                return msgCount;
+
+            _readBuffer.flip();
+            for (int i = 0; i < msgCount; ++i)
+            {
+                int length = _readBuffer.getInt();
+                checkMsg(_readBuffer, _readBuffer.position(), length);
+                _readBuffer.position(_readBuffer.position() + length);
+            }
+        } while (_readArgs.readRetVal() > TransportReturnCodes.SUCCESS || msgCount > 0);
+
+        return _readArgs.readRetVal();
+    }
+
+    private void checkMsg(ByteBuffer data, int position, int length)
+    {
+        if (length != _msgSize || data.getInt(position) != _nextSeqNum)
+            exitWithError("Unexpected message " + data.getInt(position) + " of " + length + " bytes, expected message " + _nextSeqNum);
+
+        ++_nextSeqNum;
+    }
+
+    /* Fills a batch with the next messages, if the last one was sent, and writes what is left of it. */
+    private void sendMsgs()
+    {
+        if (!_writeBuffer.hasRemaining())
+        {
+            if (_msgsToSend == 0)
+            {
+                if (_serverChannel.flush(_error) < TransportReturnCodes.SUCCESS)
+                    exitWithError("Flush failed");
+                return;
+            }
+
+            _writeBuffer.clear();
+            while (_msgsToSend > 0 && _writeBuffer.remaining() >= BATCH_LENGTH_SIZE + _msgSize)
+            {
+                _writeBuffer.putInt(_msgSize);
+                _writeBuffer.putInt(_msgCount - _msgsToSend);
+                for (int i = 4; i < _msgSize; ++i)
+                    _writeBuffer.put((byte)0);
+                --_msgsToSend;
+            }
+            _writeBuffer.flip();
+        }
+
+        int ret = _serverChannel.writeBatch(_writeBuffer, _writeArgs, _error);
+        if (ret < TransportReturnCodes.SUCCESS && ret != TransportReturnCodes.NO_BUFFERS)
+            exitWithError("Write failed with " + TransportReturnCodes.toString(ret));
+    }
+
+    private void printResult(String mode, long readTime)
+    {
+        System.out.printf("%-8s read: %d msgs in %.3f sec (%.0f msgs/sec)%n", mode, _msgCount,
+                          readTime / 1000000000.0, _msgCount * 1000000000.0 / readTime);
+    }
+
+    private void uninit()
+    {
+        _clientChannel.close(_error);
+        _serverChannel.close(_error);
+        _server.close(_error);
+        Transport.uninitialize();
+    }
+
+    private void exitWithError(String text)
+    {
+        System.err.println("Error: " + text + ": " + _error.text());
+        System.exit(-1);
+    }
+
+    private static void exitWithUsage()
+    {
+        System.out.println("Options:\n"
+                + "  -p <port>             Port the server binds to (default 14010)\n"
+                + "  -msgCount <count>     Number of messages read in each mode (default 5000000)\n"
+                + "  -msgSize <bytes>      Size of each message, at least 4 (default 76)\n"
+                + "  -batchBufSize <bytes> Size of the readBatch buffer (default 65536)\n");
+        System.exit(-1);
+    }
+}
@@ -284,6 +284,14 @@ public class JNIChannel extends UpaNode implements Channel
         {
             if (_readLock.trylock())
             {
+                if (_batchReadCPtr != 0)
+                {
+                    // reading would invalidate the message readBatch() is holding
+                    ((ReadArgsImpl)readArgs).readRetVal(TransportReturnCodes.FAILURE);
+                    setError(error, this, TransportReturnCodes.FAILURE, 0,
+                             "JNI read() called while readBatch() holds a message that did not fit its buffer");
+                    return null;
+                }
                 return rsslRead(this, (ReadArgsImpl)readArgs, (ErrorImpl)error);
             }
             else
@@ -308,6 +316,65 @@ public class JNIChannel extends UpaNode implements Channel
 
     native JNIBuffer rsslRead(JNIChannel chnl, ReadArgsImpl readArgs, ErrorImpl error);
 
+    /**
+     * Reads as many messages as are available into a direct ByteBuffer with a
+     * single JNI call, instead of one call and one read buffer per message.
+     * <p>
+     * Each message is copied to dest starting at its position, preceded by its
+     * length as a 4 byte big endian int, and dest's position is advanced past
+     * the copied messages. Reading stops when nothing more is buffered on the
+     * channel or the next message does not fit in the remaining space, in which
+     * case that message is returned first by the next call. readArgs is
+     * populated as with {@link #read(ReadArgs, Error)}, with the bytes read
+     * totaled across the batch.
+     * 
+     * @param dest direct ByteBuffer the messages are copied to
+     * @param readArgs read arguments
+     * @param error UPA error, populated on failure
+     * @return the number of messages copied, or {@link TransportReturnCodes#FAILURE}
+     *         if dest is not direct or cannot hold the next message
+     */
+    public int readBatch(ByteBuffer dest, ReadArgs readArgs, Error error)
+    {
+        assert (dest != null) : "dest cannot be null";
+        assert (readArgs != null) : "readArgs cannot be null";
+        assert (error != null) : "error cannot be null";
+
+        if (!dest.isDirect())
+        {
+            setError(error, this, TransportReturnCodes.FAILURE, 0, "JNI readBatch() requires a direct ByteBuffer");
+            return TransportReturnCodes.FAILURE;
+        }
+
+        if (!_readLock.trylock())
+        {
+            // failed to obtain the lock
+            ((ReadArgsImpl)readArgs).readRetVal(TransportReturnCodes.READ_IN_PROGRESS);
+            return 0;
+        }
+
+        try
+        {
+            _batchLength = 0;
+            int msgCount = rsslReadBatch(this, dest, dest.position(), dest.remaining(), (ReadArgsImpl)readArgs, (ErrorImpl)error);
+            dest.position(dest.position() + _batchLength);
+            return msgCount;
+        }
+        catch (Exception e)
+        {
+            ((ReadArgsImpl)readArgs).readRetVal(TransportReturnCodes.FAILURE);
+            setError(error, this, TransportReturnCodes.FAILURE, error.sysError(),
+                     "JNI rsslReadBatch() exception: " + error.text());
+            return TransportReturnCodes.FAILURE;
+        }
+        finally
+        {
+            _readLock.unlock();
+        }
+    }
+
+    native int rsslReadBatch(JNIChannel chnl, ByteBuffer dest, int offset, int length, ReadArgsImpl readArgs, ErrorImpl error);
+
     @Override
     public TransportBuffer getBuffer(int size, boolean packedBuffer, Error error)
     {
@@ -443,6 +510,59 @@ public class JNIChannel extends UpaNode implements Channel
 
     native int rsslFlush(JNIChannel chnl, ErrorImpl error);
 
+    /**
+     * Writes a batch of messages from a direct ByteBuffer and flushes them with
+     * a single JNI call, instead of a getBuffer, write and flush call per message.
+     * <p>
+     * src holds the messages between its position and limit, each preceded by
+     * its length as a 4 byte big endian int, as {@link #readBatch(ByteBuffer, ReadArgs, Error)}
+     * produces them. Every complete message is written with the priority and
+     * flags of writeArgs, and src's position is advanced past the messages
+     * written, so a trailing partial message or the messages left after a
+     * failure can be passed again. writeArgs is populated with the bytes
+     * written totaled across the batch.
+     * 
+     * @param src direct ByteBuffer holding the messages to write
+     * @param writeArgs write arguments
+     * @param error UPA error, populated on failure
+     * @return as {@link #write(TransportBuffer, WriteArgs, Error)} or
+     *         {@link #flush(Error)}: the number of bytes still queued for output,
+     *         or a negative {@link TransportReturnCodes} value
+     */
+    public int writeBatch(ByteBuffer src, WriteArgs writeArgs, Error error)
+    {
+        assert (src != null) : "src cannot be null";
+        assert (writeArgs != null) : "writeArgs cannot be null";
+        assert (error != null) : "error cannot be null";
+
+        if (!src.isDirect())
+        {
+            setError(error, this, TransportReturnCodes.FAILURE, 0, "JNI writeBatch() requires a direct ByteBuffer");
+            return TransportReturnCodes.FAILURE;
+        }
+
+        try
+        {
+            _writeLock.lock();
+            _batchLength = 0;
+            int ret = rsslWriteBatch(this, src, src.position(), src.remaining(), (WriteArgsImpl)writeArgs, (ErrorImpl)error);
+            src.position(src.position() + _batchLength);
+            return ret;
+        }
+        catch (Exception e)
+        {
+            setError(error, this, TransportReturnCodes.FAILURE, error.sysError(),
+                     "JNI rsslWriteBatch() exception: " + error.text());
+            return TransportReturnCodes.FAILURE;
+        }
+        finally
+        {
+            _writeLock.unlock();
+        }
+    }
+
+    native int rsslWriteBatch(JNIChannel chnl, ByteBuffer src, int offset, int length, WriteArgsImpl writeArgs, ErrorImpl error);
+
     @Override
     public int ping(Error error)
     {
@@ -676,6 +796,13 @@ public class JNIChannel extends UpaNode implements Channel
     /* Pointer to the actual rsslChannel in C. */
     public long _rsslChannelCPtr;
 
+    /* Number of bytes copied or written by the last rsslReadBatch or rsslWriteBatch call. */
+    public int _batchLength;
+
+    /* Pointer to the C read buffer rsslReadBatch held back because it did not fit, and its read return value. */
+    public long _batchReadCPtr;
+    public int _batchReadRetVal;
+
     /* for clearing dummy bytes used for notification */
     ByteBuffer _clearBuffer = ByteBuffer.allocate(64);
 